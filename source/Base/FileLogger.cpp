@@ -6,11 +6,19 @@
 #include "Definitions.h"
 
 _FileLogger::_FileLogger()
+    : _FileLogger(Const::LogFilename, DefaultMaxFileSize, DefaultNumBackupFiles)
+{}
+
+_FileLogger::_FileLogger(std::filesystem::path const& filename, uint64_t maxFileSize, int numBackupFiles)
+    : _filename(filename)
+    , _maxFileSize(maxFileSize)
+    , _numBackupFiles(numBackupFiles)
 {
-    LoggingService::get().registerCallBack(this);
+    std::filesystem::remove(_filename);
+    _outfile.open(_filename, std::ios_base::app);
 
-    std::filesystem::remove(Const::LogFilename);
-    _outfile.open(Const::LogFilename, std::ios_base::app);
+    LoggingService::get().registerCallBack(this);
+    LoggingService::get().installCrashHandler();
 }
 
 _FileLogger::~_FileLogger()
@@ -20,5 +28,38 @@ _FileLogger::~_FileLogger()
 
 void _FileLogger::newLogMessage(Priority priority, std::string const& message)
 {
-    _outfile << message << std::endl;
+    if (_fileSize > 0 && _fileSize + message.size() + 1 > _maxFileSize) {
+        rotate();
+    }
+    _outfile << message << '\n';
+    _fileSize += message.size() + 1;
+}
+
+void _FileLogger::flush()
+{
+    _outfile.flush();
+}
+
+void _FileLogger::rotate()
+{
+    _outfile.close();
+    std::error_code errorCode;
+    if (_numBackupFiles > 0) {
+        std::filesystem::remove(getBackupFilename(_numBackupFiles), errorCode);
+        for (int index = _numBackupFiles - 1; index >= 1; --index) {
+            std::filesystem::rename(getBackupFilename(index), getBackupFilename(index + 1), errorCode);
+        }
+        std::filesystem::rename(_filename, getBackupFilename(1), errorCode);
+    } else {
+        std::filesystem::remove(_filename, errorCode);
+    }
+    _outfile.open(_filename, std::ios_base::trunc);
+    _fileSize = 0;
+}
+
+std::filesystem::path _FileLogger::getBackupFilename(int index) const
+{
+    auto result = _filename;
+    result.replace_filename(_filename.stem().string() + "." + std::to_string(index) + _filename.extension().string());
+    return result;
 }
@@ -1,19 +1,35 @@
 #pragma once
 
+#include <cstdint>
+#include <filesystem>
 #include <fstream>
 
 #include "Base/LoggingService.h"
 #include "Definitions.h"
 
+//messages are written without forcing a flush per line, the file is flushed after each batch dispatched by LoggingService
+//if the file exceeds maxFileSize it is renamed to <name>.1<ext> (older backups are shifted up to <name>.<numBackupFiles><ext>) and a new file is started
 class _FileLogger : public LoggingCallBack
 {
 
 public:
     _FileLogger();
+    _FileLogger(std::filesystem::path const& filename, uint64_t maxFileSize, int numBackupFiles);
     ~_FileLogger() override;
 
     void newLogMessage(Priority priority, std::string const& message) override;
+    void flush() override;
 
 private:
+    static auto constexpr DefaultMaxFileSize = 10ull * 1024 * 1024;
+    static auto constexpr DefaultNumBackupFiles = 2;
+
+    void rotate();
+    std::filesystem::path getBackupFilename(int index) const;
+
+    std::filesystem::path _filename;
+    uint64_t _maxFileSize = DefaultMaxFileSize;
+    int _numBackupFiles = DefaultNumBackupFiles;
+    uint64_t _fileSize = 0;
     std::ofstream _outfile;
 };
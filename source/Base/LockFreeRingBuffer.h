@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+//bounded multi-producer multi-consumer queue without locks, each slot carries a sequence number telling whether it is ready for writing or reading
+//the entries are popped in the order in which the producers acquired their slots, i.e. the order of the pushes of each single producer is kept
+template <typename T>
+class LockFreeRingBuffer
+{
+public:
+    explicit LockFreeRingBuffer(size_t capacity);  //capacity is rounded up to a power of 2
+
+    bool tryPush(T&& value);  //returns false if the buffer is full
+    bool tryPop(T& value);  //returns false if the buffer is empty
+
+    size_t getCapacity() const;
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static auto constexpr CacheLineSize = 64;
+
+    size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+    alignas(CacheLineSize) std::atomic<size_t> _writePos = 0;
+    alignas(CacheLineSize) std::atomic<size_t> _readPos = 0;
+};
+
+/**
+ * Implementations
+ */
+
+template <typename T>
+LockFreeRingBuffer<T>::LockFreeRingBuffer(size_t capacity)
+{
+    size_t size = 2;
+    while (size < capacity) {
+        size *= 2;
+    }
+    _mask = size - 1;
+    _slots = std::make_unique<Slot[]>(size);
+    for (size_t i = 0; i < size; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool LockFreeRingBuffer<T>::tryPush(T&& value)
+{
+    auto pos = _writePos.load(std::memory_order_relaxed);
+    while (true) {
+        auto& slot = _slots[pos & _mask];
+        auto sequence = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (_writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.value = std::move(value);
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _writePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool LockFreeRingBuffer<T>::tryPop(T& value)
+{
+    auto pos = _readPos.load(std::memory_order_relaxed);
+    while (true) {
+        auto& slot = _slots[pos & _mask];
+        auto sequence = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+            if (_readPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                value = std::move(slot.value);
+                slot.sequence.store(pos + _mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _readPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+size_t LockFreeRingBuffer<T>::getCapacity() const
+{
+    return _mask + 1;
+}
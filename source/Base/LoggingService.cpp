@@ -1,35 +1,151 @@
 #include "LoggingService.h"
 
-#include <iostream>
+#include <algorithm>
+#include <exception>
 #include <iomanip>
-#include <ctime>
 #include <sstream>
-#include <algorithm>
 
-void LoggingService::log(Priority priority, std::string const& message)
+namespace
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    std::terminate_handler previousTerminateHandler = nullptr;
+    std::once_flag crashHandlerInstalled;
+}
 
-    auto t = std::time(nullptr);
-    auto tm = *std::localtime(&t);
+LoggingService::LoggingService()
+{
+    _dispatchThread = std::thread(&LoggingService::runDispatchThread, this);
+}
 
-    std::stringstream stream;
-    stream << std::put_time(&tm, "%Y-%m-%d %H-%M-%S") << ": " << message;
+LoggingService::~LoggingService()
+{
+    _shutdown = true;
+    ++_numPushedMessages;
+    _numPushedMessages.notify_one();
+    _dispatchThread.join();
 
-    auto enrichedMessage = stream.str();
-    for (auto const& callback : _callbacks) {
-        callback->newLogMessage(priority, enrichedMessage);
+    std::lock_guard<std::mutex> lock(_dispatchMutex);
+    while (dispatchQueuedMessages()) {
+    }
+}
+
+void LoggingService::log(Priority priority, std::string const& message)
+{
+    if (!_queue.tryPush({priority, std::time(nullptr), message})) {
+        ++_numDroppedMessages;
     }
+    ++_numPushedMessages;
+    _numPushedMessages.notify_one();
+}
+
+void LoggingService::flush()
+{
+    std::lock_guard<std::mutex> lock(_dispatchMutex);
+    while (dispatchQueuedMessages()) {
+    }
+}
+
+uint64_t LoggingService::getNumDroppedMessages() const
+{
+    return _numDroppedMessages.load();
 }
 
 void LoggingService::registerCallBack(LoggingCallBack* callback)
 {
+    std::lock_guard<std::mutex> lock(_dispatchMutex);
     _callbacks.emplace_back(callback);
 }
 
 void LoggingService::unregisterCallBack(LoggingCallBack* callback)
 {
-    auto end = std::remove_if(_callbacks.begin(), _callbacks.end(), [&](auto const& callback_) { return callback_ == callback; });
+    std::lock_guard<std::mutex> lock(_dispatchMutex);
+    while (dispatchQueuedMessages()) {
+    }
 
+    auto end = std::remove_if(_callbacks.begin(), _callbacks.end(), [&](auto const& callback_) { return callback_ == callback; });
     _callbacks.erase(end, _callbacks.end());
 }
+
+void LoggingService::installCrashHandler()
+{
+    //repeated calls would register handleTerminate as its own predecessor
+    std::call_once(crashHandlerInstalled, [] { previousTerminateHandler = std::set_terminate(&LoggingService::handleTerminate); });
+}
+
+void LoggingService::runDispatchThread()
+{
+    uint64_t numSeenMessages = 0;
+    while (!_shutdown) {
+        _numPushedMessages.wait(numSeenMessages);
+        numSeenMessages = _numPushedMessages.load();
+
+        std::lock_guard<std::mutex> lock(_dispatchMutex);
+        while (dispatchQueuedMessages()) {
+        }
+    }
+}
+
+bool LoggingService::dispatchQueuedMessages()
+{
+    std::vector<Entry> batch;
+    Entry entry;
+    while (batch.size() < MaxBatchSize && _queue.tryPop(entry)) {
+        batch.emplace_back(std::move(entry));
+    }
+
+    auto numDroppedMessages = _numDroppedMessages.load();
+    if (batch.empty() && numDroppedMessages == _numReportedDroppedMessages) {
+        return false;
+    }
+
+    //the time stamps are formatted here since std::localtime is not thread-safe
+    std::time_t lastTime = 0;
+    std::string timeString;
+    auto formatMessage = [&](std::time_t time, std::string const& message) {
+        if (time != lastTime || timeString.empty()) {
+            auto tm = *std::localtime(&time);
+            std::stringstream stream;
+            stream << std::put_time(&tm, "%Y-%m-%d %H-%M-%S");
+            timeString = stream.str();
+            lastTime = time;
+        }
+        return timeString + ": " + message;
+    };
+    for (auto const& batchEntry : batch) {
+        auto enrichedMessage = formatMessage(batchEntry.time, batchEntry.message);
+        for (auto const& callback : _callbacks) {
+            callback->newLogMessage(batchEntry.priority, enrichedMessage);
+        }
+    }
+    if (numDroppedMessages != _numReportedDroppedMessages) {
+        auto message = formatMessage(
+            std::time(nullptr), std::to_string(numDroppedMessages - _numReportedDroppedMessages) + " log messages have been dropped due to a full log buffer.");
+        _numReportedDroppedMessages = numDroppedMessages;
+        for (auto const& callback : _callbacks) {
+            callback->newLogMessage(Priority::Important, message);
+        }
+    }
+    for (auto const& callback : _callbacks) {
+        callback->flush();
+    }
+    return true;
+}
+
+void LoggingService::flushOnCrash()
+{
+    //the crash may have occurred during dispatching
+    std::unique_lock<std::mutex> lock(_dispatchMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+    while (dispatchQueuedMessages()) {
+    }
+}
+
+void LoggingService::handleTerminate()
+{
+    LoggingService::get().flushOnCrash();
+    if (previousTerminateHandler) {
+        previousTerminateHandler();
+    }
+    std::abort();
+}
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
-#include <mutex>
 
+#include "LockFreeRingBuffer.h"
 #include "Singleton.h"
 
 enum class Priority
@@ -17,24 +22,64 @@ class LoggingCallBack
 public:
     virtual ~LoggingCallBack() = default;
     virtual void newLogMessage(Priority priority, std::string const& message) = 0;
+    virtual void flush() {}  //called after each batch of messages
 };
 
+//log() only enqueues the message into a ring buffer, a dedicated thread dispatches the messages in batches to the callbacks
+//the callbacks are therefore called from the logging thread (or from the thread calling flush()), but never concurrently
 class LoggingService
 {
-    MAKE_SINGLETON(LoggingService);
+    MAKE_SINGLETON_NO_DEFAULT_CONSTRUCTION(LoggingService);
 
 public:
+    ~LoggingService();
+
+    //does not block; if the ring buffer is full the message is dropped and counted
     void log(Priority priority, std::string const& message);
 
+    //dispatches all queued messages on the calling thread and flushes the callbacks
+    void flush();
+
+    uint64_t getNumDroppedMessages() const;
+
     void registerCallBack(LoggingCallBack* callback);
-    void unregisterCallBack(LoggingCallBack* callback);
+    void unregisterCallBack(LoggingCallBack* callback);  //queued messages are dispatched before
+
+    //dispatches the queued messages when the program terminates due to an uncaught exception
+    //fatal signals are not handled since dispatching is not async-signal-safe, repeated calls have no effect
+    void installCrashHandler();
 
 private:
+    LoggingService();
+
+    struct Entry
+    {
+        Priority priority = Priority::Unimportant;
+        std::time_t time = 0;
+        std::string message;
+    };
+
+    void runDispatchThread();
+    bool dispatchQueuedMessages();  //requires _dispatchMutex, returns false if nothing was queued
+    void flushOnCrash();
+    static void handleTerminate();
+
+    static auto constexpr QueueCapacity = 8192;
+    static auto constexpr MaxBatchSize = 512;
+
+    LockFreeRingBuffer<Entry> _queue{QueueCapacity};
+    std::atomic<uint64_t> _numPushedMessages = 0;  //used for waking up the dispatch thread
+    std::atomic<uint64_t> _numDroppedMessages = 0;
+    uint64_t _numReportedDroppedMessages = 0;
+
+    std::mutex _dispatchMutex;  //guards the callbacks and serializes the dispatching
     std::vector<LoggingCallBack*> _callbacks;
-    std::mutex _mutex;
+
+    std::atomic<bool> _shutdown = false;
+    std::thread _dispatchThread;
 };
 
 inline void log(Priority priority, std::string const& message)
 {
     LoggingService::get().log(priority, message);
-}
\ No newline at end of file
+}
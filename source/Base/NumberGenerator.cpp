@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <sstream>
 #include <thread>
 #include <random>
@@ -6,15 +7,27 @@
 
 NumberGenerator::NumberGenerator()
 {
-    _arrayOfRandomNumbers.reserve(1323781);
     _runningNumber = 0;
     std::random_device rd;   //Will be used to obtain a seed for the random number engine
-    std::mt19937 gen(rd());  //Standard mersenne_twister_engine seeded with rd()
-    std::uniform_int_distribution<> distrib(0);
+    _seed = rd();
+    fillArray();
+}
 
-    for (uint32_t i = 0; i < 1323781; ++i) {
-        _arrayOfRandomNumbers.emplace_back(distrib(gen));
-    }
+void NumberGenerator::setSeed(uint32_t seed)
+{
+    _seed = seed;
+    _index = 0;
+    fillArray();
+}
+
+uint32_t NumberGenerator::getSeed() const
+{
+    return _seed;
+}
+
+RandomStream NumberGenerator::createStream(uint64_t stream) const
+{
+    return RandomStream(_seed, stream);
 }
 
 uint32_t NumberGenerator::getRandomInt()
@@ -58,6 +71,25 @@ uint64_t NumberGenerator::getId()
     return (static_cast<uint64_t>(1) << 48) | ++_runningNumber; //first term is to avoid collisions with GPU-generated ids
 }
 
+uint64_t NumberGenerator::getIds(int number)
+{
+    auto result = getId();
+    _runningNumber += std::max(0, number - 1);
+    return result;
+}
+
+void NumberGenerator::fillArray()
+{
+    std::mt19937 gen(_seed);  //Standard mersenne_twister_engine
+    std::uniform_int_distribution<> distrib(0);
+
+    _arrayOfRandomNumbers.clear();
+    _arrayOfRandomNumbers.reserve(1323781);
+    for (uint32_t i = 0; i < 1323781; ++i) {
+        _arrayOfRandomNumbers.emplace_back(distrib(gen));
+    }
+}
+
 uint32_t NumberGenerator::getNumberFromArray()
 {
 	_index = (_index + 1) % _arrayOfRandomNumbers.size();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Definitions.h"
+#include "RandomStream.h"
 #include "Singleton.h"
 
 class NumberGenerator
@@ -8,6 +9,12 @@ class NumberGenerator
     MAKE_SINGLETON_NO_DEFAULT_CONSTRUCTION(NumberGenerator);
 
 public:
+    //refills the random number array deterministically, i.e. the following random numbers only depend on the seed; ids are not reset
+    void setSeed(uint32_t seed);
+    uint32_t getSeed() const;
+
+    //independent stream derived from the seed, e.g. one per thread or entity, which does not access the shared array
+    RandomStream createStream(uint64_t stream) const;
 
 	uint32_t getRandomInt();
     uint32_t getRandomInt(uint32_t range);
@@ -17,6 +24,7 @@ public:
     float getRandomFloat(float min, float max);
 
 	uint64_t getId();
+    uint64_t getIds(int number);  //reserves a contiguous range of ids and returns the first one
 
 	uint32_t getLargeRandomInt(uint32_t range);
     uint32_t getNumberFromArray();
@@ -24,6 +32,9 @@ public:
 private:
     NumberGenerator();
 
+    void fillArray();
+
+    uint32_t _seed = 0;
 	int _index = 0;
 	std::vector<uint32_t> _arrayOfRandomNumbers;
 	uint64_t _runningNumber = 0;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+struct ParallelPartition
+{
+    int startIndex;
+    int endIndex;   //inclusive
+};
+
+class Parallel
+{
+public:
+    static int getNumThreads();
+
+    static ParallelPartition calcPartition(int numEntities, int division, int numDivisions);
+
+    //calls func(ParallelPartition const&) on worker threads for disjoint partitions of [0, numEntities)
+    template <typename Func>
+    static void forEachPartition(int numEntities, Func const& func, int maxThreads = 0);
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+inline int Parallel::getNumThreads()
+{
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+inline ParallelPartition Parallel::calcPartition(int numEntities, int division, int numDivisions)
+{
+    auto entitiesByDivisions = numEntities / numDivisions;
+    auto remainder = numEntities % numDivisions;
+
+    ParallelPartition result;
+    if (division < remainder) {
+        result.startIndex = division * (entitiesByDivisions + 1);
+        result.endIndex = result.startIndex + entitiesByDivisions;
+    } else {
+        result.startIndex = remainder * (entitiesByDivisions + 1) + (division - remainder) * entitiesByDivisions;
+        result.endIndex = result.startIndex + entitiesByDivisions - 1;
+    }
+    return result;
+}
+
+template <typename Func>
+void Parallel::forEachPartition(int numEntities, Func const& func, int maxThreads)
+{
+    if (numEntities <= 0) {
+        return;
+    }
+    auto numThreads = std::min(numEntities, maxThreads > 0 ? maxThreads : getNumThreads());
+    if (numThreads == 1) {
+        func(ParallelPartition{0, numEntities - 1});
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    auto processPartition = [&](int division) {
+        try {
+            func(calcPartition(numEntities, division, numThreads));
+        } catch (...) {
+            exceptions[division] = std::current_exception();
+        }
+    };
+    for (int i = 1; i < numThreads; ++i) {
+        threads.emplace_back(processPartition, i);
+    }
+    processPartition(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
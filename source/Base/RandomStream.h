@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+//counter-based random numbers: the i-th number of a stream is a pure function of (seed, stream, i), i.e. streams for different threads or entities
+//can be drawn concurrently and in any order without shared state and reproduce the same values for the same seed
+//the mixing corresponds to SplitMix64 started at a state derived from seed and stream
+//CudaNumberGenerator mirrors calcState and getNumber on the device
+class RandomStream
+{
+public:
+    RandomStream(uint64_t seed, uint64_t stream, uint64_t counter = 0)
+        : _state(calcState(seed, stream))
+        , _counter(counter)
+    {}
+
+    uint32_t getRandomInt() { return static_cast<uint32_t>(getNumber(_state, _counter++) >> 32); }
+    uint32_t getRandomInt(uint32_t range) { return getRandomInt() % range; }
+    uint32_t getRandomInt(uint32_t min, uint32_t max) { return min + getRandomInt() % (max - min + 1); }
+    float getRandomFloat() { return toUnitInterval(getNumber(_state, _counter++)); }  //uniformly distributed in [0, 1)
+    float getRandomFloat(float min, float max) { return min + (max - min) * getRandomFloat(); }
+
+    uint64_t getCounter() const { return _counter; }
+
+    static uint64_t getNumber(uint64_t seed, uint64_t stream, uint64_t counter) { return getNumber(calcState(seed, stream), counter); }
+
+    static uint64_t calcState(uint64_t seed, uint64_t stream) { return mix(mix(seed) ^ (stream * 0xd1b54a32d192ed03ull + 0x8bb84b93962eacc9ull)); }
+    static uint64_t getNumber(uint64_t state, uint64_t counter) { return mix(state + (counter + 1) * 0x9e3779b97f4a7c15ull); }
+    static float toUnitInterval(uint64_t number) { return static_cast<float>(number >> 40) / static_cast<float>(1 << 24); }
+
+    static uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t _state;
+    uint64_t _counter;
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+//single-threaded buffer with fixed capacity, pushing into a full buffer overwrites the oldest element
+//the elements are indexed from the oldest (index 0) to the newest one
+template <typename T>
+class RingBuffer
+{
+public:
+    explicit RingBuffer(size_t capacity);
+
+    void pushBack(T const& value);
+    void popFront();
+    void clear();
+
+    size_t size() const;
+    bool isEmpty() const;
+    size_t getCapacity() const;
+
+    T const& operator[](size_t index) const;
+    T const& front() const;
+    T const& back() const;
+
+private:
+    std::vector<T> _elements;
+    size_t _startIndex = 0;
+    size_t _size = 0;
+};
+
+/**
+ * Implementations
+ */
+
+template <typename T>
+RingBuffer<T>::RingBuffer(size_t capacity)
+    : _elements(capacity > 0 ? capacity : 1)
+{}
+
+template <typename T>
+void RingBuffer<T>::pushBack(T const& value)
+{
+    if (_size == _elements.size()) {
+        _elements[_startIndex] = value;
+        _startIndex = (_startIndex + 1) % _elements.size();
+    } else {
+        _elements[(_startIndex + _size) % _elements.size()] = value;
+        ++_size;
+    }
+}
+
+template <typename T>
+void RingBuffer<T>::popFront()
+{
+    if (_size > 0) {
+        _startIndex = (_startIndex + 1) % _elements.size();
+        --_size;
+    }
+}
+
+template <typename T>
+void RingBuffer<T>::clear()
+{
+    _startIndex = 0;
+    _size = 0;
+}
+
+template <typename T>
+size_t RingBuffer<T>::size() const
+{
+    return _size;
+}
+
+template <typename T>
+bool RingBuffer<T>::isEmpty() const
+{
+    return _size == 0;
+}
+
+template <typename T>
+size_t RingBuffer<T>::getCapacity() const
+{
+    return _elements.size();
+}
+
+template <typename T>
+T const& RingBuffer<T>::operator[](size_t index) const
+{
+    return _elements[(_startIndex + index) % _elements.size()];
+}
+
+template <typename T>
+T const& RingBuffer<T>::front() const
+{
+    return (*this)[0];
+}
+
+template <typename T>
+T const& RingBuffer<T>::back() const
+{
+    return (*this)[_size - 1];
+}
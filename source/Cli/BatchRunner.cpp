@@ -0,0 +1,253 @@
+#include "BatchRunner.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include "Base/Parallel.h"
+#include "Base/StringHelper.h"
+#include "EngineCpu/CpuSimulationFacade.h"
+#include "EngineImpl/SimulationFacadeImpl.h"
+#include "EngineInterface/RawStatisticsData.h"
+#include "EngineInterface/StatisticsConverterService.h"
+#include "EngineInterface/TimingSink.h"
+#include "PersisterInterface/SerializerService.h"
+
+namespace
+{
+    //closes the simulation also when a run is aborted by an exception, otherwise its engine thread would keep running
+    class SimulationCloser
+    {
+    public:
+        SimulationCloser(SimulationFacade const& simulationFacade)
+            : _simulationFacade(simulationFacade)
+        {}
+
+        ~SimulationCloser()
+        {
+            try {
+                _simulationFacade->closeSimulation();
+            } catch (...) {
+            }
+        }
+
+    private:
+        SimulationFacade _simulationFacade;
+    };
+}
+
+BatchRunner::BatchRunner(SweepSpecification const& specification, DeserializedSimulation const& input, BatchRunnerSettings const& settings)
+    : _specification(specification)
+    , _input(input)
+    , _settings(settings)
+{}
+
+bool BatchRunner::run(std::vector<SweepJob> const& jobs)
+{
+    std::filesystem::create_directories(_specification.outputDirectory);
+    writeIndexFile(jobs);
+
+    _jobs = &jobs;
+    _nextJobIndex = 0;
+    _success = true;
+    _savingThreadShutdown = false;
+
+    std::thread savingThread(&BatchRunner::runSavingThread, this);
+    std::vector<std::thread> workers;
+    if (_settings.useGpu) {
+        workers.emplace_back(&BatchRunner::runWorker, this, Backend::Gpu);
+    }
+    for (int i = 0; i < _settings.numCpuJobs; ++i) {
+        workers.emplace_back(&BatchRunner::runWorker, this, Backend::Cpu);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    {
+        std::lock_guard lock(_savingMutex);
+        _savingThreadShutdown = true;
+    }
+    _savingCondition.notify_all();
+    savingThread.join();
+
+    _jobs = nullptr;
+    return _success;
+}
+
+void BatchRunner::runWorker(Backend backend)
+{
+    while (true) {
+        SweepJob const* job = nullptr;
+        {
+            std::lock_guard lock(_jobMutex);
+            if (_nextJobIndex == _jobs->size()) {
+                return;
+            }
+            job = &_jobs->at(_nextJobIndex++);
+        }
+        try {
+            runJob(*job, backend);
+        } catch (std::exception const& e) {
+            print(job->name + " failed: " + e.what());
+            std::lock_guard lock(_jobMutex);
+            _success = false;
+        }
+    }
+}
+
+void BatchRunner::runJob(SweepJob const& job, Backend backend)
+{
+    auto startTimepoint = std::chrono::steady_clock::now();
+    auto runDirectory = _specification.outputDirectory / job.name;
+    std::filesystem::create_directories(runDirectory);
+
+    auto simulationFacade = createSimulationFacade(backend, job);
+    auto const& auxiliaryData = _input.auxiliaryData;
+    simulationFacade->newSimulation(
+        auxiliaryData.timestep, auxiliaryData.generalSettings, SweepSpecificationParser::applyParameterValues(auxiliaryData.simulationParameters, job));
+    SimulationCloser simulationCloser(simulationFacade);
+    std::shared_ptr<_AccumulatingTimingSink> timingSink;
+    if (_settings.measureTimings) {
+        timingSink = std::make_shared<_AccumulatingTimingSink>();
+        simulationFacade->setTimingSink(timingSink);
+    }
+    simulationFacade->setClusteredSimulationData(_input.mainData);
+    simulationFacade->setRealTime(auxiliaryData.realTime);
+    print(job.name + " started on " + simulationFacade->getGpuName());
+
+    auto statistics = _input.statistics;
+    auto statisticsFilename = runDirectory / "statistics.csv";
+    std::filesystem::remove(statisticsFilename);
+    std::optional<TimelineStatistics> lastStatistics;
+    std::optional<uint64_t> lastStatisticsTimestep;
+
+    auto createSnapshot = [&] {
+        auto result = std::make_shared<DeserializedSimulation>();
+        result->mainData = simulationFacade->getClusteredSimulationData();
+        result->auxiliaryData = auxiliaryData;
+        result->auxiliaryData.timestep = simulationFacade->getCurrentTimestep();
+        result->auxiliaryData.simulationParameters = simulationFacade->getSimulationParameters();
+        result->auxiliaryData.realTime = simulationFacade->getRealTime();
+        result->statistics = statistics;
+        return result;
+    };
+
+    uint64_t timesteps = 0;
+    while (timesteps < _specification.timesteps) {
+        auto stepsUntilStatistics = _specification.statisticsInterval - timesteps % _specification.statisticsInterval;
+        auto stepsUntilSnapshot = _specification.snapshotInterval > 0 ? _specification.snapshotInterval - timesteps % _specification.snapshotInterval
+                                                                     : _specification.timesteps;
+        auto stepsToCalculate = std::min({stepsUntilStatistics, stepsUntilSnapshot, _specification.timesteps - timesteps});
+        simulationFacade->calcTimesteps(stepsToCalculate);
+        timesteps += stepsToCalculate;
+
+        if (timesteps % _specification.statisticsInterval == 0) {
+            auto timestep = simulationFacade->getCurrentTimestep();
+            auto rawStatistics = simulationFacade->getRawStatistics();
+            auto time = toDouble(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTimepoint).count()) / 1000;
+            auto dataPoint = StatisticsConverterService::get().convert(rawStatistics.timeline, timestep, time, lastStatistics, lastStatisticsTimestep);
+            statistics.emplace_back(dataPoint);
+            lastStatistics = rawStatistics.timeline;
+            lastStatisticsTimestep = timestep;
+            scheduleSaving(
+                [statisticsFilename, dataPoint] { return SerializerService::get().appendStatisticsToFile(statisticsFilename, {dataPoint}); },
+                statisticsFilename.string());
+        }
+        if (_specification.snapshotInterval > 0 && timesteps % _specification.snapshotInterval == 0 && timesteps < _specification.timesteps) {
+            auto snapshot = createSnapshot();
+            auto filename = runDirectory / ("snapshot_" + std::to_string(snapshot->auxiliaryData.timestep) + ".sim");
+            scheduleSaving([filename, snapshot] { return SerializerService::get().serializeSimulationToFiles(filename, *snapshot); }, filename.string());
+        }
+    }
+
+    auto snapshot = createSnapshot();
+    auto filename = runDirectory / "final.sim";
+    scheduleSaving([filename, snapshot] { return SerializerService::get().serializeSimulationToFiles(filename, *snapshot); }, filename.string());
+
+    if (timingSink) {
+        auto timingsFilename = runDirectory / "timings.json";
+        scheduleSaving([timingsFilename, timingSink] { return timingSink->exportToFile(timingsFilename); }, timingsFilename.string());
+    }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTimepoint).count();
+    auto tps = ms != 0 ? 1000.0f * toFloat(timesteps) / toFloat(ms) : 0.0f;
+    print(job.name + " finished: " + StringHelper::format(timesteps) + " time steps, " + StringHelper::format(ms) + " ms, " + StringHelper::format(tps, 1) + " TPS");
+}
+
+SimulationFacade BatchRunner::createSimulationFacade(Backend backend, SweepJob const& job) const
+{
+    auto randomSeed = _settings.randomSeed.value_or(0) + static_cast<uint32_t>(job.repetition);
+    if (backend == Backend::Gpu) {
+        auto result = std::make_shared<_SimulationFacadeImpl>();
+        if (_settings.randomSeed) {
+            auto gpuSettings = result->getGpuSettings();
+            gpuSettings.deterministicRandomNumbers = true;
+            gpuSettings.randomSeed = randomSeed;
+            result->setGpuSettings_async(gpuSettings);
+        }
+        return result;
+    }
+    auto numThreads = _settings.numThreadsPerCpuJob > 0 ? _settings.numThreadsPerCpuJob : std::max(1, Parallel::getNumThreads() / _settings.numCpuJobs);
+    return std::make_shared<_CpuSimulationFacade>(numThreads, randomSeed);
+}
+
+void BatchRunner::writeIndexFile(std::vector<SweepJob> const& jobs) const
+{
+    auto filename = _specification.outputDirectory / "sweep.csv";
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Could not write " + filename.string() + ".");
+    }
+    stream << "run,repetition";
+    for (auto const& range : _specification.parameterRanges) {
+        stream << ",\"" << range.node << "\"";
+    }
+    stream << std::endl;
+    for (auto const& job : jobs) {
+        stream << job.name << "," << job.repetition;
+        for (auto const& [node, value] : job.parameterValues) {
+            stream << "," << value;
+        }
+        stream << std::endl;
+    }
+}
+
+void BatchRunner::scheduleSaving(std::function<bool()> const& saveFunc, std::string const& description)
+{
+    std::unique_lock lock(_savingMutex);
+    _savingCondition.wait(lock, [this] { return _pendingSavings.size() < MaxPendingSavings; });
+    _pendingSavings.emplace_back(saveFunc, description);
+    lock.unlock();
+    _savingCondition.notify_all();
+}
+
+void BatchRunner::runSavingThread()
+{
+    while (true) {
+        std::pair<std::function<bool()>, std::string> saving;
+        {
+            std::unique_lock lock(_savingMutex);
+            _savingCondition.wait(lock, [this] { return !_pendingSavings.empty() || _savingThreadShutdown; });
+            if (_pendingSavings.empty()) {
+                return;
+            }
+            saving = _pendingSavings.front();
+        }
+        if (!saving.first()) {
+            print("Could not write " + saving.second + ".");
+            std::lock_guard lock(_jobMutex);
+            _success = false;
+        }
+        {
+            std::lock_guard lock(_savingMutex);
+            _pendingSavings.pop_front();
+        }
+        _savingCondition.notify_all();
+    }
+}
+
+void BatchRunner::print(std::string const& message)
+{
+    std::lock_guard lock(_printMutex);
+    std::cout << message << std::endl;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EngineInterface/Definitions.h"
+#include "PersisterInterface/DeserializedSimulation.h"
+#include "PersisterInterface/SweepSpecification.h"
+
+struct BatchRunnerSettings
+{
+    bool useGpu = true;  //the GPU engine supports only one simulation per process at a time
+    int numCpuJobs = 0;  //concurrent runs on the CPU backend
+    int numThreadsPerCpuJob = 0;  //0 = hardware threads divided by the number of CPU jobs
+    bool measureTimings = false;  //phase timings of each run are written to timings.json
+    std::optional<uint32_t> randomSeed;  //if set, the GPU runs use deterministic random numbers; each run is seeded with randomSeed + repetition
+};
+
+//runs the jobs of a sweep concurrently on the available backends
+//the deserialized input is shared by all jobs and snapshots are saved on a separate thread while the simulations continue
+class BatchRunner
+{
+public:
+    BatchRunner(SweepSpecification const& specification, DeserializedSimulation const& input, BatchRunnerSettings const& settings);
+
+    bool run(std::vector<SweepJob> const& jobs);  //returns false if at least one job failed
+
+private:
+    enum class Backend
+    {
+        Gpu,
+        Cpu
+    };
+    void runWorker(Backend backend);
+    void runJob(SweepJob const& job, Backend backend);
+    SimulationFacade createSimulationFacade(Backend backend, SweepJob const& job) const;
+
+    void writeIndexFile(std::vector<SweepJob> const& jobs) const;
+    void scheduleSaving(std::function<bool()> const& saveFunc, std::string const& description);
+    void runSavingThread();
+
+    void print(std::string const& message);
+
+    SweepSpecification _specification;
+    DeserializedSimulation const& _input;
+    BatchRunnerSettings _settings;
+
+    std::mutex _jobMutex;
+    std::vector<SweepJob> const* _jobs = nullptr;
+    size_t _nextJobIndex = 0;
+    bool _success = true;
+
+    static auto constexpr MaxPendingSavings = 4;  //limits the memory consumption if saving is slower than simulating
+    std::mutex _savingMutex;
+    std::condition_variable _savingCondition;
+    std::deque<std::pair<std::function<bool()>, std::string>> _pendingSavings;
+    bool _savingThreadShutdown = false;
+
+    std::mutex _printMutex;
+};
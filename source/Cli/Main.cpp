@@ -5,12 +5,47 @@
 
 #include "Base/GlobalSettings.h"
 #include "Base/LoggingService.h"
+#include "Base/NumberGenerator.h"
 #include "Base/Resources.h"
 #include "Base/StringHelper.h"
 #include "Base/FileLogger.h"
+#include "EngineInterface/CreatureCensusService.h"
+#include "EngineInterface/PatternAnalysisService.h"
+#include "EngineInterface/TimingSink.h"
 #include "PersisterInterface/SerializerService.h"
+#include "PersisterInterface/SweepSpecification.h"
 #include "EngineImpl/SimulationFacadeImpl.h"
 
+#include "BatchRunner.h"
+
+namespace
+{
+    int runSweep(std::string const& sweepFilename, BatchRunnerSettings const& settings)
+    {
+        auto specification = SweepSpecificationParser::parse(sweepFilename);
+        auto jobs = SweepSpecificationParser::createJobs(specification);
+        if (!settings.useGpu && settings.numCpuJobs <= 0) {
+            std::cout << "No backend for running the sweep given." << std::endl;
+            return 1;
+        }
+
+        //the input is read once and shared by all runs
+        std::cout << "Reading input" << std::endl;
+        DeserializedSimulation simData;
+        if (!SerializerService::get().deserializeSimulationFromFiles(simData, specification.input)) {
+            std::cout << "Could not read from input files." << std::endl;
+            return 1;
+        }
+
+        std::cout << "Start sweep with " << jobs.size() << " runs" << std::endl;
+        auto startTimepoint = std::chrono::steady_clock::now();
+        auto success = BatchRunner(specification, simData, settings).run(jobs);
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTimepoint).count();
+        std::cout << "Sweep finished: " << jobs.size() << " runs, " << StringHelper::format(ms) << " ms" << std::endl;
+        return success ? 0 : 1;
+    }
+}
+
 int main(int argc, char** argv)
 {
     try {
@@ -23,6 +58,13 @@ int main(int argc, char** argv)
         std::string outputFilename;
         std::string statisticsFilename;
         int timesteps = 0;
+        std::string sweepFilename;
+        BatchRunnerSettings batchSettings;
+        bool noGpu = false;
+        std::string benchmarkFilename;
+        std::string censusFilename;
+        std::string patternsFilename;
+        uint32_t randomSeed = 0;
         app.add_option(
             "-i", inputFilename, "Specifies the name of the input file for the simulation to run. The corresponding *.settings.json should also be available.");
         app.add_option(
@@ -30,8 +72,47 @@ int main(int argc, char** argv)
             outputFilename,
             "Specifies the name of the output file for the simulation. The *.settings.json and *.statistics.csv file will also be saved.");
         app.add_option("-t", timesteps, "The number of time steps to be calculated.");
+        app.add_option(
+            "--sweep",
+            sweepFilename,
+            "Specifies a JSON file describing a parameter sweep (input, output directory, time steps, snapshot and statistics interval, repetitions and "
+            "parameter ranges). If given, -i, -o and -t are ignored.");
+        app.add_option("--cpu-jobs", batchSettings.numCpuJobs, "The number of sweep runs executed concurrently on the CPU backend.");
+        app.add_option("--cpu-threads", batchSettings.numThreadsPerCpuJob, "The number of threads per CPU run. Default: hardware threads / CPU jobs.");
+        app.add_flag("--no-gpu", noGpu, "Sweep runs are not executed on the GPU.");
+        app.add_option(
+            "--benchmark",
+            benchmarkFilename,
+            "Measures the durations of the phases of each time step, data accesses and conversions and writes the breakdown to the given *.json or *.csv "
+            "file.");
+        app.add_flag("--benchmark-runs", batchSettings.measureTimings, "Writes the phase timings of each sweep run to timings.json in the run directory.");
+        app.add_option(
+            "--census",
+            censusFilename,
+            "Writes a table with one row per creature (cells, energy, bounding box, cell functions, genome, age, velocity) of the final state to the given "
+            "*.csv file.");
+        app.add_option(
+            "--patterns",
+            patternsFilename,
+            "Writes the repetitive cell networks (classes of at least two clusters with isomorphic cell networks) of the final state to the given *.csv "
+            "file.");
+        auto randomSeedOption = app.add_option(
+            "--seed",
+            randomSeed,
+            "Enables deterministic random numbers seeded with the given value such that runs with the same input produce reproducible random "
+            "sequences. In a sweep, each run is seeded with the value plus its repetition index.");
         CLI11_PARSE(app, argc, argv);
 
+        if (*randomSeedOption) {
+            NumberGenerator::get().setSeed(randomSeed);
+            batchSettings.randomSeed = randomSeed;
+        }
+
+        if (!sweepFilename.empty()) {
+            batchSettings.useGpu = !noGpu;
+            return runSweep(sweepFilename, batchSettings);
+        }
+
         //read input
         std::cout << "Reading input" << std::endl;
         if (inputFilename.empty()) {
@@ -48,7 +129,18 @@ int main(int argc, char** argv)
         auto startTimepoint = std::chrono::steady_clock::now();
 
         auto simulationFacade = std::make_shared<_SimulationFacadeImpl>();
+        if (*randomSeedOption) {
+            auto gpuSettings = simulationFacade->getGpuSettings();
+            gpuSettings.deterministicRandomNumbers = true;
+            gpuSettings.randomSeed = randomSeed;
+            simulationFacade->setGpuSettings_async(gpuSettings);
+        }
         simulationFacade->newSimulation(simData.auxiliaryData.timestep, simData.auxiliaryData.generalSettings, simData.auxiliaryData.simulationParameters);
+        std::shared_ptr<_AccumulatingTimingSink> timingSink;
+        if (!benchmarkFilename.empty()) {
+            timingSink = std::make_shared<_AccumulatingTimingSink>();
+            simulationFacade->setTimingSink(timingSink);
+        }
         simulationFacade->setClusteredSimulationData(simData.mainData);
         simulationFacade->setStatisticsHistory(simData.statistics);
         simulationFacade->setRealTime(simData.auxiliaryData.realTime);
@@ -79,6 +171,37 @@ int main(int argc, char** argv)
             return 1;
         }
 
+        if (!censusFilename.empty()) {
+            auto census = CreatureCensusService::get().calcCensus(simData.mainData);
+            std::cout << "Census: " << census.getNumCreatures() << " creatures" << std::endl;
+            if (!CreatureCensusService::get().exportToFile(censusFilename, census)) {
+                std::cout << "Could not write census file." << std::endl;
+                return 1;
+            }
+        }
+
+        if (!patternsFilename.empty()) {
+            auto patternClasses = PatternAnalysisService::get().calcPatternClasses(simData.mainData);
+            std::erase_if(patternClasses, [](PatternClass const& patternClass) { return patternClass.getNumElements() <= 1; });
+            std::cout << "Pattern analysis: " << patternClasses.size() << " repetitive cell networks" << std::endl;
+            if (!PatternAnalysisService::get().exportToFile(patternsFilename, patternClasses, simData.mainData)) {
+                std::cout << "Could not write pattern analysis file." << std::endl;
+                return 1;
+            }
+        }
+
+        if (timingSink) {
+            std::cout << "Timings per phase (total ms / average ms):" << std::endl;
+            for (auto const& entry : timingSink->getStatistics()) {
+                std::cout << "  " << entry.phase << ": " << StringHelper::format(toFloat(entry.totalMs), 1) << " / "
+                          << StringHelper::format(toFloat(entry.totalMs / toDouble(entry.count)), 3) << std::endl;
+            }
+            if (!timingSink->exportToFile(benchmarkFilename)) {
+                std::cout << "Could not write benchmark file." << std::endl;
+                return 1;
+            }
+        }
+
         std::cout << "Finished" << std::endl;
     } catch (std::exception const& e) {
         std::cerr << "An uncaught exception occurred: " << e.what() << std::endl;
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/CreatureCensusService.h"
+
+#include "SyntheticWorldGenerator.h"
+
+static void CreatureCensus_calcCensus(benchmark::State& state)
+{
+    auto data = SyntheticWorldGenerator::createWorld(SyntheticWorldParameters().numCells(toInt(state.range(0))).genomeNodes(20));
+
+    for (auto _ : state) {
+        auto census = CreatureCensusService::get().calcCensus(data);
+        benchmark::DoNotOptimize(census.numCells.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(CreatureCensus_calcCensus)->Arg(10000)->Arg(100000)->ArgName("cells")->Unit(benchmark::kMillisecond);
+
+//creatures without creature id are identified via their connections
+static void CreatureCensus_calcCensusByConnectivity(benchmark::State& state)
+{
+    auto data = SyntheticWorldGenerator::createWorld(SyntheticWorldParameters().numCells(toInt(state.range(0))).genomeNodes(20));
+    for (auto& cluster : data.clusters) {
+        for (auto& cell : cluster.cells) {
+            cell.creatureId = 0;
+        }
+    }
+
+    for (auto _ : state) {
+        auto census = CreatureCensusService::get().calcCensus(data);
+        benchmark::DoNotOptimize(census.numCells.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(CreatureCensus_calcCensusByConnectivity)->Arg(10000)->Arg(100000)->ArgName("cells")->Unit(benchmark::kMillisecond);
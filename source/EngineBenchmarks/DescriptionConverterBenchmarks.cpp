@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineImpl/DescriptionConverter.h"
+
+#include "SyntheticWorldGenerator.h"
+
+namespace
+{
+    SyntheticWorldParameters createWorldParameters(benchmark::State const& state)
+    {
+        return SyntheticWorldParameters()
+            .numCells(toInt(state.range(0)))
+            .maxConnections(toInt(state.range(1)))
+            .genomeNodes(toInt(state.range(2)))
+            .numParticles(toInt(state.range(0)) / 10);
+    }
+}
+
+static void DescriptionConverter_convertDescriptionToTO(benchmark::State& state)
+{
+    auto data = SyntheticWorldGenerator::createWorld(createWorldParameters(state));
+    DescriptionConverter converter{SimulationParameters()};
+    DataTO dataTO;
+    dataTO.init(converter.getArraySizes(data));
+
+    for (auto _ : state) {
+        *dataTO.numCells = 0;
+        *dataTO.numParticles = 0;
+        *dataTO.numAuxiliaryData = 0;
+        converter.convertDescriptionToTO(dataTO, data);
+        benchmark::DoNotOptimize(*dataTO.numCells);
+    }
+    dataTO.destroy();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DescriptionConverter_convertDescriptionToTO)
+    ->ArgsProduct({{10000, 100000}, {2, 6}, {0, 20}})
+    ->ArgNames({"cells", "max connections", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+static void DescriptionConverter_convertTOtoClusteredDataDescription(benchmark::State& state)
+{
+    auto data = SyntheticWorldGenerator::createWorld(createWorldParameters(state));
+    DescriptionConverter converter{SimulationParameters()};
+    DataTO dataTO;
+    dataTO.init(converter.getArraySizes(data));
+    *dataTO.numCells = 0;
+    *dataTO.numParticles = 0;
+    *dataTO.numAuxiliaryData = 0;
+    converter.convertDescriptionToTO(dataTO, data);
+
+    for (auto _ : state) {
+        auto result = converter.convertTOtoClusteredDataDescription(dataTO);
+        benchmark::DoNotOptimize(result.clusters.size());
+    }
+    dataTO.destroy();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DescriptionConverter_convertTOtoClusteredDataDescription)
+    ->ArgsProduct({{10000, 100000}, {2, 6}, {0, 20}})
+    ->ArgNames({"cells", "max connections", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+static void DescriptionConverter_convertTOtoDataDescription(benchmark::State& state)
+{
+    auto data = SyntheticWorldGenerator::createWorld(createWorldParameters(state));
+    DescriptionConverter converter{SimulationParameters()};
+    DataTO dataTO;
+    dataTO.init(converter.getArraySizes(data));
+    *dataTO.numCells = 0;
+    *dataTO.numParticles = 0;
+    *dataTO.numAuxiliaryData = 0;
+    converter.convertDescriptionToTO(dataTO, data);
+
+    for (auto _ : state) {
+        auto result = converter.convertTOtoDataDescription(dataTO);
+        benchmark::DoNotOptimize(result.cells.size());
+    }
+    dataTO.destroy();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DescriptionConverter_convertTOtoDataDescription)
+    ->ArgsProduct({{10000, 100000}, {2, 6}, {0, 20}})
+    ->ArgNames({"cells", "max connections", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,65 @@
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+
+#include "SyntheticWorldGenerator.h"
+
+static void DescriptionEditService_randomMultiply(benchmark::State& state)
+{
+    auto number = toInt(state.range(0));
+    auto parallelPlacement = state.range(1) != 0;
+    auto input = DescriptionEditService::get().createHex(DescriptionEditService::CreateHexParameters().layers(3));
+    auto worldSizeValue = toInt(std::sqrt(toFloat(number * input.cells.size())) * 5);
+    IntVector2D worldSize{worldSizeValue, worldSizeValue};
+
+    for (auto _ : state) {
+        auto overlappingCheckSuccessful = true;
+        auto result = DescriptionEditService::get().randomMultiply(
+            input,
+            DescriptionEditService::RandomMultiplyParameters().number(number).overlappingCheck(true).parallelPlacement(parallelPlacement),
+            worldSize,
+            DataDescription(),
+            overlappingCheckSuccessful);
+        benchmark::DoNotOptimize(result.cells.size());
+    }
+    state.SetItemsProcessed(state.iterations() * number);
+}
+BENCHMARK(DescriptionEditService_randomMultiply)
+    ->ArgsProduct({{1000, 10000, 100000}, {0, 1}})
+    ->ArgNames({"copies", "parallel"})
+    ->Unit(benchmark::kMillisecond);
+
+static void DescriptionEditService_reconnectCells(benchmark::State& state)
+{
+    auto data = DataDescription(SyntheticWorldGenerator::createWorld(
+        SyntheticWorldParameters().numCells(toInt(state.range(0))).clusterShape(static_cast<SyntheticClusterShape>(state.range(1)))));
+
+    for (auto _ : state) {
+        DescriptionEditService::get().reconnectCells(data, 1.1f);
+        benchmark::DoNotOptimize(data.cells.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DescriptionEditService_reconnectCells)
+    ->ArgsProduct({{10000, 100000}, {toInt(SyntheticClusterShape::Rect), toInt(SyntheticClusterShape::Hex), toInt(SyntheticClusterShape::Creature)}})
+    ->ArgNames({"cells", "shape"})
+    ->Unit(benchmark::kMillisecond);
+
+static void DescriptionEditService_duplicate(benchmark::State& state)
+{
+    auto parameters = SyntheticWorldParameters().numCells(toInt(state.range(0))).genomeNodes(20);
+    auto data = SyntheticWorldGenerator::createWorld(parameters);
+    auto worldSize = SyntheticWorldGenerator::getWorldSize(parameters);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto result = data;
+        state.ResumeTiming();
+        DescriptionEditService::get().duplicate(result, worldSize, {worldSize.x * 2, worldSize.y * 2});
+        benchmark::DoNotOptimize(result.clusters.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(DescriptionEditService_duplicate)->Arg(10000)->Arg(100000)->ArgName("cells")->Unit(benchmark::kMillisecond);
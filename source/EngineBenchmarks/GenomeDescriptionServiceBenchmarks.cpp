@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/GenomeDescriptionService.h"
+
+#include "SyntheticWorldGenerator.h"
+
+static void GenomeDescriptionService_convertDescriptionToBytes(benchmark::State& state)
+{
+    auto genome = SyntheticWorldGenerator::createGenome(toInt(state.range(0)), ConstructionShape_Custom, 0);
+
+    for (auto _ : state) {
+        auto bytes = GenomeDescriptionService::get().convertDescriptionToBytes(genome);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(GenomeDescriptionService_convertDescriptionToBytes)->Arg(10)->Arg(100)->Arg(1000)->ArgName("nodes")->Unit(benchmark::kMicrosecond);
+
+static void GenomeDescriptionService_convertBytesToDescription(benchmark::State& state)
+{
+    auto bytes = GenomeDescriptionService::get().convertDescriptionToBytes(
+        SyntheticWorldGenerator::createGenome(toInt(state.range(0)), ConstructionShape_Custom, 0));
+
+    for (auto _ : state) {
+        auto genome = GenomeDescriptionService::get().convertBytesToDescription(bytes);
+        benchmark::DoNotOptimize(genome.cells.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(GenomeDescriptionService_convertBytesToDescription)->Arg(10)->Arg(100)->Arg(1000)->ArgName("nodes")->Unit(benchmark::kMicrosecond);
+
+static void GenomeDescriptionService_getNumNodesRecursively(benchmark::State& state)
+{
+    auto bytes = GenomeDescriptionService::get().convertDescriptionToBytes(
+        SyntheticWorldGenerator::createGenome(toInt(state.range(0)), ConstructionShape_Custom, 0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GenomeDescriptionService::get().getNumNodesRecursively(bytes, true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(GenomeDescriptionService_getNumNodesRecursively)->Arg(10)->Arg(100)->Arg(1000)->ArgName("nodes")->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/HostSpotCalculator.h"
+
+namespace
+{
+    auto const WorldSize = IntVector2D{2000, 1000};
+
+    SimulationParameters createParametersWithZones(int numZones)
+    {
+        SimulationParameters result;
+        result.numZones = numZones;
+        for (int i = 0; i < numZones; ++i) {
+            auto& zone = result.zone[i];
+            zone.posX = toFloat((i * 397) % WorldSize.x);
+            zone.posY = toFloat((i * 211) % WorldSize.y);
+            zone.shapeType = i % 2 == 0 ? SpotShapeType_Circular : SpotShapeType_Rectangular;
+            zone.fadeoutRadius = 200.0f;
+            zone.values.friction = 0.01f * toFloat(i);
+            zone.activatedValues.friction = true;
+        }
+        return result;
+    }
+}
+
+static void HostSpotCalculator_calcParameter(benchmark::State& state)
+{
+    auto parameters = createParametersWithZones(toInt(state.range(0)));
+    HostSpotCalculator calculator(parameters, WorldSize);
+    auto resolution = IntVector2D{1000, 1000};
+
+    for (auto _ : state) {
+        std::vector<float> result(resolution.x * resolution.y);
+        for (int y = 0; y < resolution.y; ++y) {
+            for (int x = 0; x < resolution.x; ++x) {
+                result[x + y * resolution.x] = calculator.calcParameter(
+                    &SimulationParametersZoneValues::friction,
+                    &SimulationParametersZoneActivatedValues::friction,
+                    {(toFloat(x) + 0.5f) * 2.0f, (toFloat(y) + 0.5f) * 1.0f});
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * resolution.x * resolution.y);
+}
+BENCHMARK(HostSpotCalculator_calcParameter)->Arg(1)->Arg(MAX_ZONES)->ArgName("zones")->Unit(benchmark::kMillisecond);
+
+static void HostSpotCalculator_calcParameterMap(benchmark::State& state)
+{
+    auto parameters = createParametersWithZones(toInt(state.range(0)));
+    HostSpotCalculator calculator(parameters, WorldSize);
+
+    for (auto _ : state) {
+        auto result = calculator.calcParameterMap(
+            {1000, 1000}, [](SimulationParametersZoneValues const& values) { return values.friction; }, &SimulationParametersZoneActivatedValues::friction, 1);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1000 * 1000);
+}
+BENCHMARK(HostSpotCalculator_calcParameterMap)->Arg(1)->Arg(MAX_ZONES)->ArgName("zones")->Unit(benchmark::kMillisecond);
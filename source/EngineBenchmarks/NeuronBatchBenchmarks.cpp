@@ -0,0 +1,68 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/NeuronBatchService.h"
+
+namespace
+{
+    std::vector<NeuronDescription> createRandomNeurons(int number)
+    {
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+        std::uniform_int_distribution<int> activationFunctionDistribution(0, NeuronActivationFunction_Count - 1);
+
+        std::vector<NeuronDescription> result(number);
+        for (auto& neuron : result) {
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    neuron.weights[row][col] = distribution(gen);
+                }
+                neuron.biases[row] = distribution(gen);
+                neuron.activationFunctions[row] = activationFunctionDistribution(gen);
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::vector<float>> createRandomSignals(int number)
+    {
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+        std::vector<std::vector<float>> result(number, std::vector<float>(MAX_CHANNELS));
+        for (auto& signal : result) {
+            for (auto& channel : signal) {
+                channel = distribution(gen);
+            }
+        }
+        return result;
+    }
+}
+
+static void NeuronBatch_evaluate(benchmark::State& state)
+{
+    auto numNeurons = toInt(state.range(0));
+    auto numSignals = toInt(state.range(1));
+    auto batch = NeuronBatchService::get().createBatch(createRandomNeurons(numNeurons));
+    auto signals = createRandomSignals(numSignals);
+
+    for (auto _ : state) {
+        auto result = NeuronBatchService::get().evaluate(batch, signals);
+        benchmark::DoNotOptimize(result.channels.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numNeurons * numSignals);
+}
+BENCHMARK(NeuronBatch_evaluate)->Args({64, 64})->Args({1024, 64})->Args({1024, 1024})->Args({16384, 256});
+
+static void NeuronBatch_createBatch(benchmark::State& state)
+{
+    auto neurons = createRandomNeurons(toInt(state.range(0)));
+
+    for (auto _ : state) {
+        auto batch = NeuronBatchService::get().createBatch(neurons);
+        benchmark::DoNotOptimize(batch.weights.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(NeuronBatch_createBatch)->Arg(1024)->Arg(16384);
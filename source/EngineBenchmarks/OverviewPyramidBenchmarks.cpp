@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/OverviewPyramid.h"
+
+#include "SyntheticWorldGenerator.h"
+
+static void OverviewPyramid_build(benchmark::State& state)
+{
+    auto parameters = SyntheticWorldParameters().numCells(toInt(state.range(0)));
+    auto data = SyntheticWorldGenerator::createWorld(parameters);
+    auto worldSize = SyntheticWorldGenerator::getWorldSize(parameters);
+
+    for (auto _ : state) {
+        OverviewPyramid pyramid(worldSize);
+        pyramid.update(data);
+        benchmark::DoNotOptimize(pyramid.getTotal().numCells);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(OverviewPyramid_build)->Arg(100000)->Arg(1000000)->ArgName("cells")->Unit(benchmark::kMillisecond);
+
+//successive snapshots in which a small part of the clusters has moved
+static void OverviewPyramid_update(benchmark::State& state)
+{
+    auto parameters = SyntheticWorldParameters().numCells(toInt(state.range(0)));
+    auto data = SyntheticWorldGenerator::createWorld(parameters);
+    auto worldSize = SyntheticWorldGenerator::getWorldSize(parameters);
+    OverviewPyramid pyramid(worldSize);
+    pyramid.update(data);
+
+    auto offset = 1.0f;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int i = 0; i < toInt(data.clusters.size()); i += 100) {
+            for (auto& cell : data.clusters[i].cells) {
+                cell.pos.x += offset;
+            }
+        }
+        offset = -offset;
+        state.ResumeTiming();
+        pyramid.update(data);
+        benchmark::DoNotOptimize(pyramid.getChangedTiles(0).size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(OverviewPyramid_update)->Arg(100000)->Arg(1000000)->ArgName("cells")->Unit(benchmark::kMillisecond);
+
+static void OverviewPyramid_createRgbImage(benchmark::State& state)
+{
+    auto parameters = SyntheticWorldParameters().numCells(toInt(state.range(0)));
+    auto data = SyntheticWorldGenerator::createWorld(parameters);
+    OverviewPyramid pyramid(SyntheticWorldGenerator::getWorldSize(parameters));
+    pyramid.update(data);
+    auto level = pyramid.calcLevel(0.05f);
+
+    for (auto _ : state) {
+        auto image = pyramid.createRgbImage(level);
+        benchmark::DoNotOptimize(image.data());
+    }
+}
+BENCHMARK(OverviewPyramid_createRgbImage)->Arg(100000)->Arg(1000000)->ArgName("cells")->Unit(benchmark::kMicrosecond);
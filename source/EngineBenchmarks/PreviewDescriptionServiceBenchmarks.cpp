@@ -0,0 +1,21 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/PreviewDescriptionService.h"
+
+#include "SyntheticWorldGenerator.h"
+
+static void PreviewDescriptionService_convert(benchmark::State& state)
+{
+    auto genome = SyntheticWorldGenerator::createGenome(toInt(state.range(0)), toInt(state.range(1)), 0);
+    SimulationParameters parameters;
+
+    for (auto _ : state) {
+        auto preview = PreviewDescriptionService::get().convert(genome, std::nullopt, parameters);
+        benchmark::DoNotOptimize(preview.cells.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(PreviewDescriptionService_convert)
+    ->ArgsProduct({{10, 100, 1000}, {ConstructionShape_Custom, ConstructionShape_Rectangle, ConstructionShape_Hexagon}})
+    ->ArgNames({"nodes", "shape"})
+    ->Unit(benchmark::kMicrosecond);
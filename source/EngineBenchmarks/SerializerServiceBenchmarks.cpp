@@ -0,0 +1,89 @@
+#include <filesystem>
+
+#include <benchmark/benchmark.h>
+
+#include "PersisterInterface/SerializerService.h"
+
+#include "SyntheticWorldGenerator.h"
+
+namespace
+{
+    DeserializedSimulation createSimulation(benchmark::State const& state)
+    {
+        auto parameters = SyntheticWorldParameters().numCells(toInt(state.range(0))).genomeNodes(toInt(state.range(1))).numParticles(toInt(state.range(0)) / 10);
+
+        DeserializedSimulation result;
+        result.mainData = SyntheticWorldGenerator::createWorld(parameters);
+        result.auxiliaryData.generalSettings.worldSizeX = SyntheticWorldGenerator::getWorldSize(parameters).x;
+        result.auxiliaryData.generalSettings.worldSizeY = SyntheticWorldGenerator::getWorldSize(parameters).y;
+        result.statistics = SyntheticWorldGenerator::createStatistics(1000, 0);
+        return result;
+    }
+
+    auto const BenchmarkFilename = std::filesystem::temp_directory_path() / "alien_serializer_benchmark.sim";
+}
+
+static void SerializerService_serializeSimulationToStrings(benchmark::State& state)
+{
+    auto simulation = createSimulation(state);
+
+    for (auto _ : state) {
+        SerializedSimulation serializedSimulation;
+        SerializerService::get().serializeSimulationToStrings(serializedSimulation, simulation);
+        benchmark::DoNotOptimize(serializedSimulation.mainData.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SerializerService_serializeSimulationToStrings)
+    ->ArgsProduct({{10000, 100000}, {0, 20}})
+    ->ArgNames({"cells", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+static void SerializerService_deserializeSimulationFromStrings(benchmark::State& state)
+{
+    SerializedSimulation serializedSimulation;
+    SerializerService::get().serializeSimulationToStrings(serializedSimulation, createSimulation(state));
+
+    for (auto _ : state) {
+        DeserializedSimulation simulation;
+        SerializerService::get().deserializeSimulationFromStrings(simulation, serializedSimulation);
+        benchmark::DoNotOptimize(simulation.mainData.clusters.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SerializerService_deserializeSimulationFromStrings)
+    ->ArgsProduct({{10000, 100000}, {0, 20}})
+    ->ArgNames({"cells", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+static void SerializerService_serializeSimulationToFiles(benchmark::State& state)
+{
+    auto simulation = createSimulation(state);
+
+    for (auto _ : state) {
+        SerializerService::get().serializeSimulationToFiles(BenchmarkFilename, simulation);
+    }
+    SerializerService::get().deleteSimulation(BenchmarkFilename);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SerializerService_serializeSimulationToFiles)
+    ->ArgsProduct({{10000, 100000}, {20}})
+    ->ArgNames({"cells", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+static void SerializerService_deserializeSimulationFromFiles(benchmark::State& state)
+{
+    SerializerService::get().serializeSimulationToFiles(BenchmarkFilename, createSimulation(state));
+
+    for (auto _ : state) {
+        DeserializedSimulation simulation;
+        SerializerService::get().deserializeSimulationFromFiles(simulation, BenchmarkFilename);
+        benchmark::DoNotOptimize(simulation.mainData.clusters.size());
+    }
+    SerializerService::get().deleteSimulation(BenchmarkFilename);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SerializerService_deserializeSimulationFromFiles)
+    ->ArgsProduct({{10000, 100000}, {20}})
+    ->ArgNames({"cells", "genome nodes"})
+    ->Unit(benchmark::kMillisecond);
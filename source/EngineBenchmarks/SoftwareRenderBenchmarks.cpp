@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/SoftwareRenderService.h"
+
+static void SoftwareRenderService_renderAccumulationImage(benchmark::State& state)
+{
+    auto maxThreads = toInt(state.range(0));
+    auto zoom = toFloat(state.range(1));
+    IntVector2D worldSize{1000, 1000};
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(300).height(300).center({500.0f, 500.0f}));
+    SimulationParameters parameters;
+    parameters.features.cellGlow = state.range(2) != 0;
+
+    IntVector2D imageSize{1920, 1080};
+    RealVector2D rectUpperLeft{500.0f - toFloat(imageSize.x) / zoom / 2, 500.0f - toFloat(imageSize.y) / zoom / 2};
+    auto renderParameters = SoftwareRenderService::RenderParameters().imageSize(imageSize).zoom(zoom).rectUpperLeft(rectUpperLeft).maxThreads(maxThreads);
+
+    for (auto _ : state) {
+        auto image = SoftwareRenderService::get().renderAccumulationImage(data, worldSize, parameters, renderParameters);
+        benchmark::DoNotOptimize(image.data());
+    }
+    state.SetItemsProcessed(state.iterations() * imageSize.x * imageSize.y);
+}
+BENCHMARK(SoftwareRenderService_renderAccumulationImage)
+    ->ArgsProduct({{1, 4}, {4, 16}, {0, 1}})
+    ->ArgNames({"threads", "zoom", "glow"})
+    ->Unit(benchmark::kMillisecond);
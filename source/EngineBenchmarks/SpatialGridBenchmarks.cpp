@@ -0,0 +1,111 @@
+#include <cmath>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/SpatialGrid.h"
+
+namespace
+{
+    IntVector2D getWorldSize(int numCells)
+    {
+        auto size = toInt(std::sqrt(toFloat(numCells)) * 2);
+        return {size, size};
+    }
+
+    std::vector<RealVector2D> createRandomPositions(int number, IntVector2D const& worldSize)
+    {
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> distributionX(0, toFloat(worldSize.x));
+        std::uniform_real_distribution<float> distributionY(0, toFloat(worldSize.y));
+        std::vector<RealVector2D> result;
+        result.reserve(number);
+        for (int i = 0; i < number; ++i) {
+            result.emplace_back(distributionX(gen), distributionY(gen));
+        }
+        return result;
+    }
+}
+
+static void SpatialGrid_build(benchmark::State& state)
+{
+    auto numCells = toInt(state.range(0));
+    auto worldSize = getWorldSize(numCells);
+    auto positions = createRandomPositions(numCells, worldSize);
+
+    for (auto _ : state) {
+        SpatialGrid grid(worldSize, 2.0f);
+        grid.build(positions);
+        benchmark::DoNotOptimize(grid.getNumEntries());
+    }
+    state.SetItemsProcessed(state.iterations() * numCells);
+}
+BENCHMARK(SpatialGrid_build)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void SpatialGrid_isOccupied(benchmark::State& state)
+{
+    auto numCells = toInt(state.range(0));
+    auto worldSize = getWorldSize(numCells);
+    SpatialGrid grid(worldSize, 2.0f);
+    grid.build(createRandomPositions(numCells, worldSize));
+    auto queryPositions = createRandomPositions(numCells, worldSize);
+
+    for (auto _ : state) {
+        int numOccupied = 0;
+        for (auto const& pos : queryPositions) {
+            numOccupied += grid.isOccupied(pos, 2.0f) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(numOccupied);
+    }
+    state.SetItemsProcessed(state.iterations() * numCells);
+}
+BENCHMARK(SpatialGrid_isOccupied)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void SpatialGrid_insert(benchmark::State& state)
+{
+    auto numCells = toInt(state.range(0));
+    auto worldSize = getWorldSize(numCells);
+    auto positions = createRandomPositions(numCells, worldSize);
+
+    for (auto _ : state) {
+        SpatialGrid grid(worldSize, 2.0f);
+        for (auto const& pos : positions) {
+            grid.insert(pos);
+        }
+        benchmark::DoNotOptimize(grid.getNumEntries());
+    }
+    state.SetItemsProcessed(state.iterations() * numCells);
+}
+BENCHMARK(SpatialGrid_insert)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void DescriptionEditService_reconnectCells(benchmark::State& state)
+{
+    auto size = toInt(std::sqrt(toFloat(state.range(0))));
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(size).height(size));
+
+    for (auto _ : state) {
+        DescriptionEditService::get().reconnectCells(data, 1.1f);
+    }
+    state.SetItemsProcessed(state.iterations() * data.cells.size());
+}
+BENCHMARK(DescriptionEditService_reconnectCells)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void DescriptionEditService_addIfSpaceAvailable(benchmark::State& state)
+{
+    auto numCells = toInt(state.range(0));
+    auto worldSize = getWorldSize(numCells);
+    DataDescription toAdd;
+    for (auto const& pos : createRandomPositions(numCells, worldSize)) {
+        toAdd.addCell(CellDescription().setPos(pos));
+    }
+
+    for (auto _ : state) {
+        DataDescription result;
+        DescriptionEditService::Occupancy occupancy;
+        DescriptionEditService::get().addIfSpaceAvailable(result, occupancy, toAdd, 0.5f, worldSize);
+        benchmark::DoNotOptimize(result.cells.size());
+    }
+    state.SetItemsProcessed(state.iterations() * numCells);
+}
+BENCHMARK(DescriptionEditService_addIfSpaceAvailable)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/StatisticsHistory.h"
+
+#include "SyntheticWorldGenerator.h"
+
+static void StatisticsHistory_getCopiedData(benchmark::State& state)
+{
+    StatisticsHistory history;
+    history.getDataRef() = SyntheticWorldGenerator::createStatistics(toInt(state.range(0)), 0);
+
+    for (auto _ : state) {
+        auto data = history.getCopiedData();
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(StatisticsHistory_getCopiedData)->Arg(1000)->Arg(100000)->ArgName("data points")->Unit(benchmark::kMicrosecond);
+
+//every call appends a data point such that the history repeatedly exceeds MaxSamples and halves its resolution
+static void StatisticsHistory_addDataPoint(benchmark::State& state)
+{
+    TimelineStatistics rawStatistics{};
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        rawStatistics.timestep.numCells[color] = 1000;
+        rawStatistics.timestep.totalEnergy[color] = 100000.0f;
+    }
+    auto numDataPoints = toInt(state.range(0));
+
+    for (auto _ : state) {
+        StatisticsHistory history;
+        for (int i = 0; i < numDataPoints; ++i) {
+
+            //the time step spacing exceeds the growing long-term delta of the history
+            history.addDataPoint(rawStatistics, static_cast<uint64_t>(i) << 40);
+        }
+        benchmark::DoNotOptimize(history.getDataRef().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(StatisticsHistory_addDataPoint)->Arg(2000)->Arg(10000)->ArgName("data points")->Unit(benchmark::kMillisecond);
@@ -0,0 +1,273 @@
+#include "SyntheticWorldGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/GenomeDescriptionService.h"
+#include "EngineInterface/PreviewDescriptionService.h"
+#include "EngineInterface/ShapeGenerator.h"
+#include "EngineInterface/StatisticsConverterService.h"
+
+namespace
+{
+    auto constexpr NumGenomeVariants = 8;
+    auto constexpr ClusterMargin = 5.0f;
+
+    struct ClusterTemplate
+    {
+        DataDescription data;  //ids are 1..n, upper left corner at (0, 0)
+        RealVector2D size;
+    };
+
+    ClusterTemplate createClusterTemplate(SyntheticWorldParameters const& parameters)
+    {
+        ClusterTemplate result;
+        auto cellsPerCluster = std::max(1, parameters._cellsPerCluster);
+        switch (parameters._clusterShape) {
+        case SyntheticClusterShape::Rect: {
+            auto width = toInt(std::ceil(std::sqrt(toFloat(cellsPerCluster))));
+            auto height = (cellsPerCluster + width - 1) / width;
+            result.data = DescriptionEditService::get().createRect(
+                DescriptionEditService::CreateRectParameters().width(width).height(height).maxConnections(parameters._maxConnections).randomCreatureId(false));
+        } break;
+        case SyntheticClusterShape::Hex: {
+            //a hexagon with n layers consists of 3n^2 - 3n + 1 cells
+            auto layers = toInt(std::ceil((3.0 + std::sqrt(9.0 + 12.0 * (cellsPerCluster - 1))) / 6.0));
+            result.data = DescriptionEditService::get().createHex(
+                DescriptionEditService::CreateHexParameters().layers(std::max(1, layers)).maxConnections(parameters._maxConnections).randomCreatureId(false));
+        } break;
+        case SyntheticClusterShape::Creature: {
+            auto genome = SyntheticWorldGenerator::createGenome(cellsPerCluster, parameters._creatureShape, parameters._seed);
+            auto preview = PreviewDescriptionService::get().convert(genome, std::nullopt, SimulationParameters());
+            for (auto const& previewCell : preview.cells) {
+                result.data.addCell(CellDescription()
+                                        .setId(result.data.cells.size() + 1)
+                                        .setPos(previewCell.pos)
+                                        .setColor(previewCell.color)
+                                        .setExecutionOrderNumber(previewCell.executionOrderNumber)
+                                        .setMaxConnections(parameters._maxConnections));
+            }
+            DescriptionEditService::get().reconnectCells(result.data, genome.header.connectionDistance * 1.1f);
+        } break;
+        }
+
+        RealVector2D minPos{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+        RealVector2D maxPos{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+        for (auto const& cell : result.data.cells) {
+            minPos = {std::min(minPos.x, cell.pos.x), std::min(minPos.y, cell.pos.y)};
+            maxPos = {std::max(maxPos.x, cell.pos.x), std::max(maxPos.y, cell.pos.y)};
+        }
+        result.data.shift(RealVector2D{-minPos.x, -minPos.y});
+        result.size = maxPos - minPos;
+
+        //ids of DescriptionEditService are taken from the global NumberGenerator and therefore depend on previous calls
+        std::unordered_map<uint64_t, uint64_t> newIdByOldId;
+        for (size_t i = 0; i < result.data.cells.size(); ++i) {
+            newIdByOldId.emplace(result.data.cells.at(i).id, i + 1);
+        }
+        for (auto& cell : result.data.cells) {
+            cell.id = newIdByOldId.at(cell.id);
+            for (auto& connection : cell.connections) {
+                connection.cellId = newIdByOldId.at(connection.cellId);
+            }
+        }
+        return result;
+    }
+
+    struct WorldLayout
+    {
+        int numClusters = 0;
+        int numColumns = 0;
+        float clusterDistance = 0;
+        IntVector2D worldSize;
+    };
+
+    WorldLayout calcWorldLayout(SyntheticWorldParameters const& parameters, ClusterTemplate const& clusterTemplate)
+    {
+        WorldLayout result;
+        auto cellsPerCluster = std::max(1, toInt(clusterTemplate.data.cells.size()));
+        result.numClusters = std::max(1, (parameters._numCells + cellsPerCluster - 1) / cellsPerCluster);
+        result.numColumns = toInt(std::ceil(std::sqrt(toFloat(result.numClusters))));
+        result.clusterDistance = std::max(clusterTemplate.size.x, clusterTemplate.size.y) + ClusterMargin;
+        auto numRows = (result.numClusters + result.numColumns - 1) / result.numColumns;
+        result.worldSize = {toInt(std::ceil(toFloat(result.numColumns) * result.clusterDistance)), toInt(std::ceil(toFloat(numRows) * result.clusterDistance))};
+        return result;
+    }
+}
+
+ClusteredDataDescription SyntheticWorldGenerator::createWorld(SyntheticWorldParameters const& parameters)
+{
+    auto clusterTemplate = createClusterTemplate(parameters);
+    auto layout = calcWorldLayout(parameters, clusterTemplate);
+    std::mt19937 randomEngine(parameters._seed);
+    std::uniform_int_distribution<int> colorDistribution(0, MAX_COLORS - 1);
+    std::uniform_real_distribution<float> energyDistribution(50.0f, 150.0f);
+    std::uniform_real_distribution<float> velocityDistribution(-0.1f, 0.1f);
+
+    std::vector<std::vector<uint8_t>> genomes;
+    if (parameters._genomeNodes > 0) {
+        for (int i = 0; i < NumGenomeVariants; ++i) {
+            genomes.emplace_back(GenomeDescriptionService::get().convertDescriptionToBytes(
+                createGenome(parameters._genomeNodes, ConstructionShape_Custom, parameters._seed + i + 1)));
+        }
+    }
+
+    ClusteredDataDescription result;
+    result.clusters.reserve(layout.numClusters);
+    auto numTemplateCells = toInt(clusterTemplate.data.cells.size());
+    for (int clusterIndex = 0; clusterIndex < layout.numClusters; ++clusterIndex) {
+        auto idOffset = clusterIndex * numTemplateCells;
+        RealVector2D clusterPos{
+            toFloat(clusterIndex % layout.numColumns) * layout.clusterDistance + ClusterMargin / 2,
+            toFloat(clusterIndex / layout.numColumns) * layout.clusterDistance + ClusterMargin / 2};
+        RealVector2D clusterVel{velocityDistribution(randomEngine), velocityDistribution(randomEngine)};
+        std::optional<int> color;
+        if (parameters._clusterShape != SyntheticClusterShape::Creature) {
+            color = colorDistribution(randomEngine);  //creatures keep the colors of their genome
+        }
+
+        ClusterDescription cluster;
+        cluster.cells = clusterTemplate.data.cells;
+        for (auto& cell : cluster.cells) {
+            cell.id += idOffset;
+            for (auto& connection : cell.connections) {
+                connection.cellId += idOffset;
+            }
+            cell.pos += clusterPos;
+            cell.vel = clusterVel;
+            cell.energy = energyDistribution(randomEngine);
+            cell.creatureId = clusterIndex + 1;
+            if (color) {
+                cell.color = *color;
+            }
+        }
+        if (!genomes.empty()) {
+            cluster.cells.front().setCellFunction(ConstructorDescription().setGenome(genomes.at(clusterIndex % NumGenomeVariants)));
+        }
+        result.clusters.emplace_back(std::move(cluster));
+    }
+
+    std::uniform_real_distribution<float> posXDistribution(0, toFloat(layout.worldSize.x));
+    std::uniform_real_distribution<float> posYDistribution(0, toFloat(layout.worldSize.y));
+    auto particleIdOffset = layout.numClusters * numTemplateCells;
+    result.particles.reserve(std::max(0, parameters._numParticles));
+    for (int i = 0; i < parameters._numParticles; ++i) {
+        result.particles.emplace_back(ParticleDescription()
+                                          .setId(particleIdOffset + i + 1)
+                                          .setPos({posXDistribution(randomEngine), posYDistribution(randomEngine)})
+                                          .setVel({velocityDistribution(randomEngine), velocityDistribution(randomEngine)})
+                                          .setEnergy(energyDistribution(randomEngine))
+                                          .setColor(colorDistribution(randomEngine)));
+    }
+    return result;
+}
+
+IntVector2D SyntheticWorldGenerator::getWorldSize(SyntheticWorldParameters const& parameters)
+{
+    return calcWorldLayout(parameters, createClusterTemplate(parameters)).worldSize;
+}
+
+GenomeDescription SyntheticWorldGenerator::createGenome(int numNodes, ConstructionShape shape, uint32_t seed)
+{
+    std::mt19937 randomEngine(seed);
+    std::uniform_int_distribution<int> cellFunctionDistribution(0, 9);
+    std::uniform_int_distribution<int> colorDistribution(0, MAX_COLORS - 1);
+    std::uniform_real_distribution<float> weightDistribution(-1.0f, 1.0f);
+
+    GenomeDescription result;
+    result.header.shape = shape;
+    for (int i = 0; i < numNodes; ++i) {
+        CellGenomeDescription cell;
+        cell.setColor(colorDistribution(randomEngine)).setExecutionOrderNumber(i % MAX_CHANNELS);
+        switch (cellFunctionDistribution(randomEngine)) {
+        case 0: {
+            NeuronGenomeDescription neuron;
+            for (auto& row : neuron.weights) {
+                for (auto& weight : row) {
+                    weight = weightDistribution(randomEngine);
+                }
+            }
+            for (auto& bias : neuron.biases) {
+                bias = weightDistribution(randomEngine);
+            }
+            cell.cellFunction = neuron;
+        } break;
+        case 1:
+            cell.cellFunction = TransmitterGenomeDescription();
+            break;
+        case 2:
+            cell.cellFunction = SensorGenomeDescription();
+            break;
+        case 3:
+            cell.cellFunction = NerveGenomeDescription();
+            break;
+        case 4:
+            cell.cellFunction = AttackerGenomeDescription();
+            break;
+        case 5:
+            cell.cellFunction = MuscleGenomeDescription();
+            break;
+        case 6:
+            cell.cellFunction = DefenderGenomeDescription();
+            break;
+        case 7:
+            cell.cellFunction = ReconnectorGenomeDescription();
+            break;
+        case 8:
+            cell.cellFunction = DetonatorGenomeDescription();
+            break;
+        default:
+            break;
+        }
+        result.cells.emplace_back(cell);
+    }
+
+    if (auto shapeGenerator = ShapeGeneratorFactory::create(shape)) {
+        result.header.angleAlignment = shapeGenerator->getConstructorAngleAlignment();
+        for (auto& cell : result.cells) {
+            auto shapeGenerationResult = shapeGenerator->generateNextConstructionData();
+            cell.referenceAngle = shapeGenerationResult.angle;
+            cell.numRequiredAdditionalConnections = shapeGenerationResult.numRequiredAdditionalConnections;
+        }
+    }
+    return result;
+}
+
+StatisticsHistoryData SyntheticWorldGenerator::createStatistics(int numDataPoints, uint32_t seed)
+{
+    std::mt19937 randomEngine(seed);
+    std::uniform_int_distribution<int> changeDistribution(-50, 50);
+    std::uniform_int_distribution<int> activityDistribution(0, 1000);
+
+    StatisticsHistoryData result;
+    result.reserve(numDataPoints);
+    TimelineStatistics rawStatistics;
+    std::optional<TimelineStatistics> lastRawStatistics;
+    std::optional<uint64_t> lastTimestep;
+    for (int i = 0; i < numDataPoints; ++i) {
+        auto timestep = static_cast<uint64_t>(i) * 1000;
+        for (int color = 0; color < MAX_COLORS; ++color) {
+            auto& statistics = rawStatistics.timestep;
+            statistics.numCells[color] = std::max(0, statistics.numCells[color] + 1000 + changeDistribution(randomEngine));
+            statistics.numSelfReplicators[color] = statistics.numCells[color] / 100;
+            statistics.numColonies[color] = statistics.numCells[color] / 500;
+            statistics.numParticles[color] = std::max(0, statistics.numParticles[color] + changeDistribution(randomEngine));
+            statistics.numGenomeCells[color] = statistics.numSelfReplicators[color] * 20;
+            statistics.genomeComplexity[color] = toFloat(statistics.numSelfReplicators[color]) * 3.5f;
+            statistics.totalEnergy[color] = toFloat(statistics.numCells[color]) * 100.0f;
+
+            auto& accumulated = rawStatistics.accumulated;
+            accumulated.numCreatedCells[color] += activityDistribution(randomEngine);
+            accumulated.numAttacks[color] += activityDistribution(randomEngine);
+            accumulated.numMuscleActivities[color] += activityDistribution(randomEngine);
+            accumulated.numNeuronActivities[color] += activityDistribution(randomEngine);
+            accumulated.numSensorActivities[color] += activityDistribution(randomEngine);
+        }
+        result.emplace_back(StatisticsConverterService::get().convert(rawStatistics, timestep, toDouble(timestep), lastRawStatistics, lastTimestep));
+        lastRawStatistics = rawStatistics;
+        lastTimestep = timestep;
+    }
+    return result;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Base/Definitions.h"
+#include "EngineInterface/CellFunctionConstants.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDescriptions.h"
+#include "EngineInterface/StatisticsHistory.h"
+
+enum class SyntheticClusterShape
+{
+    Rect,
+    Hex,
+    Creature  //body is the preview of a generated genome
+};
+
+struct SyntheticWorldParameters
+{
+    MEMBER_DECLARATION(SyntheticWorldParameters, int, numCells, 10000);  //approximate, the last cluster is not truncated
+    MEMBER_DECLARATION(SyntheticWorldParameters, int, cellsPerCluster, 100);
+    MEMBER_DECLARATION(SyntheticWorldParameters, SyntheticClusterShape, clusterShape, SyntheticClusterShape::Rect);
+    MEMBER_DECLARATION(SyntheticWorldParameters, ConstructionShape, creatureShape, ConstructionShape_Hexagon);
+    MEMBER_DECLARATION(SyntheticWorldParameters, int, maxConnections, 6);  //controls the connection density
+    MEMBER_DECLARATION(SyntheticWorldParameters, int, genomeNodes, 0);  //0 = no constructors, otherwise each cluster contains one
+    MEMBER_DECLARATION(SyntheticWorldParameters, int, numParticles, 0);
+    MEMBER_DECLARATION(SyntheticWorldParameters, uint32_t, seed, 0);
+};
+
+//creates reproducible worlds for benchmarking host-side code: same parameters yield identical descriptions (including ids)
+class SyntheticWorldGenerator
+{
+public:
+    static ClusteredDataDescription createWorld(SyntheticWorldParameters const& parameters);
+    static IntVector2D getWorldSize(SyntheticWorldParameters const& parameters);
+
+    //the geometry is taken from the ShapeGenerator of the given shape and cell functions are chosen randomly
+    static GenomeDescription createGenome(int numNodes, ConstructionShape shape, uint32_t seed);
+
+    static StatisticsHistoryData createStatistics(int numDataPoints, uint32_t seed);
+};
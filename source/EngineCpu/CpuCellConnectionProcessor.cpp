@@ -0,0 +1,207 @@
+#include "CpuCellConnectionProcessor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Math.h"
+
+void CpuCellConnectionProcessor::processAddOperations(CpuSimulationData& data)
+{
+    for (auto const& operation : data.structuralOperations.addConnectionPairs) {
+        auto const& cell1 = data.cells[operation.cellIndex];
+        auto const& cell2 = data.cells[operation.otherCellIndex];
+        if (cell1.getConnectionIndex(operation.otherCellIndex) == -1 && cell1.numConnections < cell1.maxConnections
+            && cell2.numConnections < cell2.maxConnections) {
+            tryAddConnections(data, operation.cellIndex, operation.otherCellIndex);
+        }
+    }
+}
+
+void CpuCellConnectionProcessor::processDeleteCellOperations(CpuSimulationData& data)
+{
+    auto& operations = data.structuralOperations;
+    for (auto const& cellIndex : operations.delCells) {
+        auto& cell = data.cells[cellIndex];
+        if (cell.deleted) {
+            continue;
+        }
+        cell.deleted = true;
+        data.addEnergyParticle(cell.pos, cell.vel, cell.color, cell.energy);
+
+        for (int i = 0; i < cell.numConnections; ++i) {
+            operations.delConnections.emplace_back(CpuStructuralOperations::DelConnection{cell.connections[i].cellIndex, cellIndex});
+        }
+    }
+}
+
+void CpuCellConnectionProcessor::processDeleteConnectionOperations(CpuSimulationData& data)
+{
+    for (auto const& operation : data.structuralOperations.delConnections) {
+        auto& cell = data.cells[operation.cellIndex];
+        if (!cell.deleted) {
+            deleteConnectionOneWay(cell, operation.connectedCellIndex);
+        }
+    }
+}
+
+bool CpuCellConnectionProcessor::tryAddConnections(CpuSimulationData& data, int cellIndex1, int cellIndex2, float desiredDistance)
+{
+    auto& cell1 = data.cells[cellIndex1];
+    auto posDelta = data.getCorrectedDirection(data.cells[cellIndex2].pos - cell1.pos);
+
+    CpuCellConnection origConnections[MAX_CELL_BONDS];
+    int origNumConnection = cell1.numConnections;
+    for (int i = 0; i < origNumConnection; ++i) {
+        origConnections[i] = cell1.connections[i];
+    }
+
+    if (!tryAddConnectionOneWay(data, cellIndex1, cellIndex2, posDelta, desiredDistance)) {
+        return false;
+    }
+    if (!tryAddConnectionOneWay(data, cellIndex2, cellIndex1, posDelta * (-1), desiredDistance)) {
+        cell1.numConnections = origNumConnection;
+        for (int i = 0; i < origNumConnection; ++i) {
+            cell1.connections[i] = origConnections[i];
+        }
+        return false;
+    }
+    return true;
+}
+
+void CpuCellConnectionProcessor::deleteConnectionOneWay(CpuCell& cell1, int cellIndex2)
+{
+    for (int i = 0; i < cell1.numConnections; ++i) {
+        if (cell1.connections[i].cellIndex == cellIndex2) {
+            float angleToAdd = cell1.connections[i].angleFromPrevious;
+            for (int j = i; j < cell1.numConnections - 1; ++j) {
+                cell1.connections[j] = cell1.connections[j + 1];
+            }
+
+            if (i < cell1.numConnections - 1) {
+                cell1.connections[i].angleFromPrevious += angleToAdd;
+            } else {
+                cell1.connections[0].angleFromPrevious += angleToAdd;
+            }
+
+            --cell1.numConnections;
+            return;
+        }
+    }
+}
+
+bool CpuCellConnectionProcessor::tryAddConnectionOneWay(
+    CpuSimulationData& data,
+    int cellIndex1,
+    int cellIndex2,
+    RealVector2D const& posDelta,
+    float desiredDistance)
+{
+    auto& cell1 = data.cells[cellIndex1];
+    if (cell1.numConnections == MAX_CELL_BONDS) {
+        return false;
+    }
+    if (wouldResultInOverlappingConnection(data, cell1, data.cells[cellIndex2].pos)) {
+        return false;
+    }
+
+    auto newAngle = Math::angleOfVector(posDelta);
+    if (desiredDistance == 0) {
+        desiredDistance = Math::length(posDelta);
+    }
+
+    // *****
+    // special case: cell1 has no connections
+    // *****
+    if (0 == cell1.numConnections) {
+        cell1.numConnections++;
+        cell1.connections[0] = CpuCellConnection{cellIndex2, desiredDistance, 360.0f};
+        return true;
+    }
+
+    // *****
+    // special case: cell1 has one connection
+    // *****
+    if (1 == cell1.numConnections) {
+        auto connectedCellDelta = data.getCorrectedDirection(data.cells[cell1.connections[0].cellIndex].pos - cell1.pos);
+        auto prevAngle = Math::angleOfVector(connectedCellDelta);
+        auto angleDiff = newAngle - prevAngle;
+        if (angleDiff < 0) {
+            angleDiff += 360.0;
+        }
+        if (std::abs(angleDiff) < NEAR_ZERO || std::abs(angleDiff - 360.0f) < NEAR_ZERO || std::abs(angleDiff + 360.0f) < NEAR_ZERO) {
+            return false;
+        }
+
+        cell1.connections[1].angleFromPrevious = angleDiff;
+        cell1.connections[0].angleFromPrevious = 360.0f - angleDiff;
+
+        cell1.numConnections++;
+        cell1.connections[1].cellIndex = cellIndex2;
+        cell1.connections[1].distance = desiredDistance;
+        return true;
+    }
+
+    // *****
+    // process general case
+    // *****
+
+    // find appropriate index for new connection
+    int index = 0;
+    float prevAngle = 0;
+    float nextAngle = 0;
+    for (; index < cell1.numConnections; ++index) {
+        auto prevIndex = (index + cell1.numConnections - 1) % cell1.numConnections;
+        prevAngle = Math::angleOfVector(data.getCorrectedDirection(data.cells[cell1.connections[prevIndex].cellIndex].pos - cell1.pos));
+        nextAngle = Math::angleOfVector(data.getCorrectedDirection(data.cells[cell1.connections[index].cellIndex].pos - cell1.pos));
+        if (Math::isAngleInBetween(prevAngle, nextAngle, newAngle) || prevIndex == index) {
+            break;
+        }
+    }
+    if (index == cell1.numConnections) {
+        return false;
+    }
+
+    // create new connection object
+    auto refAngle = cell1.connections[index].angleFromPrevious;
+    auto angleDiff1 = Math::subtractAngle(newAngle, prevAngle);
+    auto angleDiff2 = Math::subtractAngle(nextAngle, prevAngle);
+    auto newAngleFraction = angleDiff2 != 0 ? angleDiff1 / angleDiff2 : 0.5f;
+    auto angleFromPrevious = std::min(refAngle * newAngleFraction, refAngle);
+    if (angleFromPrevious < NEAR_ZERO) {
+        return false;
+    }
+    CpuCellConnection newConnection{cellIndex2, desiredDistance, angleFromPrevious};
+
+    // insert new connection
+    if (index == 0) {
+        index = cell1.numConnections;  // connection at index 0 should be an invariant
+    }
+    for (int j = cell1.numConnections; j > index; --j) {
+        cell1.connections[j] = cell1.connections[j - 1];
+    }
+    cell1.connections[index] = newConnection;
+    cell1.connections[(index + 1) % (cell1.numConnections + 1)].angleFromPrevious = refAngle - angleFromPrevious;
+    cell1.numConnections++;
+
+    return true;
+}
+
+bool CpuCellConnectionProcessor::wouldResultInOverlappingConnection(CpuSimulationData const& data, CpuCell const& cell1, RealVector2D const& otherCellPos)
+{
+    auto const& n = cell1.numConnections;
+    if (n < 2) {
+        return false;
+    }
+    for (int i = 0; i < n; ++i) {
+        auto connectedCellIndex = cell1.connections[i].cellIndex;
+        auto nextConnectedCellIndex = cell1.connections[(i + 1) % n].cellIndex;
+        auto const& connectedCell = data.cells[connectedCellIndex];
+        if (connectedCell.getConnectionIndex(nextConnectedCellIndex) == -1) {
+            continue;
+        }
+        if (Math::crossing(cell1.pos, otherCellPos, connectedCell.pos, data.cells[nextConnectedCellIndex].pos)) {
+            return true;
+        }
+    }
+    return false;
+}
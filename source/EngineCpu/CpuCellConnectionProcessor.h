@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+
+//host port of the structural operations in CellConnectionProcessor.cuh
+//scheduled operations are processed sequentially in the order in which they have been merged
+class CpuCellConnectionProcessor
+{
+public:
+    static void processAddOperations(CpuSimulationData& data);
+    static void processDeleteCellOperations(CpuSimulationData& data);
+    static void processDeleteConnectionOperations(CpuSimulationData& data);
+
+    static bool tryAddConnections(CpuSimulationData& data, int cellIndex1, int cellIndex2, float desiredDistance = 0);
+    static void deleteConnectionOneWay(CpuCell& cell1, int cellIndex2);
+
+private:
+    static bool tryAddConnectionOneWay(CpuSimulationData& data, int cellIndex1, int cellIndex2, RealVector2D const& posDelta, float desiredDistance);
+    static bool wouldResultInOverlappingConnection(CpuSimulationData const& data, CpuCell const& cell1, RealVector2D const& otherCellPos);
+};
@@ -0,0 +1,690 @@
+#include "CpuCellProcessor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "Base/Math.h"
+#include "Base/Parallel.h"
+#include "EngineInterface/HostSpotCalculator.h"
+
+namespace
+{
+    struct PartitionOutput
+    {
+        CpuStructuralOperations operations;
+        std::vector<std::pair<int, RealVector2D>> forceContributions;  //forces which are added to shared1 of other cells
+        std::vector<int> detachingCellIndices;
+    };
+
+    //calls func(int index, PartitionOutput& output) for [0, numEntities) on worker threads
+    //and merges the outputs afterwards in the order of the indices
+    template <typename Func>
+    void forEach(CpuSimulationData& data, int numEntities, Func const& func)
+    {
+        auto maxThreads = data.maxThreads > 0 ? data.maxThreads : Parallel::getNumThreads();
+        auto numPartitions = std::max(1, std::min(numEntities, maxThreads));
+        std::vector<PartitionOutput> outputs(numPartitions);
+        Parallel::forEachPartition(
+            numPartitions,
+            [&](ParallelPartition const& partitions) {
+                for (int partitionIndex = partitions.startIndex; partitionIndex <= partitions.endIndex; ++partitionIndex) {
+                    auto partition = Parallel::calcPartition(numEntities, partitionIndex, numPartitions);
+                    for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                        func(index, outputs[partitionIndex]);
+                    }
+                }
+            },
+            maxThreads);
+
+        for (auto const& output : outputs) {
+            data.structuralOperations.append(output.operations);
+            for (auto const& [cellIndex, force] : output.forceContributions) {
+                data.cells[cellIndex].shared1 += force;
+            }
+            for (auto const& cellIndex : output.detachingCellIndices) {
+                data.cells[cellIndex].livingState = LivingState_Detaching;
+            }
+        }
+    }
+
+    template <typename Func>
+    void forEachCell(CpuSimulationData& data, Func const& func)
+    {
+        forEach(data, toInt(data.cells.size()), func);
+    }
+
+    float dot(RealVector2D const& p, RealVector2D const& q)
+    {
+        return p.x * q.x + p.y * q.y;
+    }
+
+    float lengthSquared(RealVector2D const& v)
+    {
+        return v.x * v.x + v.y * v.y;
+    }
+
+    RealVector2D normalized(RealVector2D v)
+    {
+        Math::normalize(v);
+        return v;
+    }
+
+    RealVector2D rotateQuarterClockwise(RealVector2D const& v)
+    {
+        return {-v.y, v.x};
+    }
+
+    float calcKernel(float q)
+    {
+        float result;
+        if (q < 1) {
+            result = 2.0f / 3.0f - q * q + 0.5f * q * q * q;
+        } else if (q < 2) {
+            result = 2.0f - q;
+            result = result * result * result / 6;
+        } else {
+            result = 0;
+        }
+        result *= 3.0f / (2.0f * Const::Pi);
+        return result;
+    }
+
+    float calcKernel_d(float q)
+    {
+        float result;
+        if (q < 1) {
+            result = -2 * q + 3.0f / 2.0f * q * q;
+        } else if (q < 2) {
+            result = -0.5f * (2.0f - q) * (2.0f - q);
+        } else {
+            result = 0;
+        }
+        result *= 3.0f / (2.0f * Const::Pi);
+        return result;
+    }
+
+    //cellMaxBindingEnergy and cellFusionVelocity are evaluated at the position of the first cell as in the CUDA kernels
+    bool isFusionPossible(CpuCell const& cell, CpuCell const& otherCell, RealVector2D const& velDelta, float cellMaxBindingEnergy, float cellFusionVelocity)
+    {
+        return Math::length(velDelta) >= cellFusionVelocity && cell.numConnections < cell.maxConnections
+            && otherCell.numConnections < otherCell.maxConnections && cell.energy <= cellMaxBindingEnergy && otherCell.energy <= cellMaxBindingEnergy
+            && !cell.barrier && !otherCell.barrier;
+    }
+}
+
+void CpuCellProcessor::init(CpuSimulationData& data)
+{
+    for (auto& cell : data.cells) {
+        cell.shared1 = {0, 0};
+    }
+}
+
+void CpuCellProcessor::updateMap(CpuSimulationData& data)
+{
+    std::vector<RealVector2D> positions;
+    positions.reserve(data.cells.size());
+    for (auto const& cell : data.cells) {
+        positions.emplace_back(cell.pos);
+    }
+    data.cellMap.build(positions);
+}
+
+void CpuCellProcessor::calcFluidForces_reconnectCells_correctOverlap(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    auto const& smoothingLength = parameters.motionData.fluidMotion.smoothingLength;
+
+    //overlap corrections are applied after all forces have been calculated from the same positions
+    std::vector<RealVector2D> posDeltas(data.cells.size());
+
+    HostSpotCalculator spotCalculator(parameters, data.worldSize);
+    forEachCell(data, [&](int cellIndex, PartitionOutput& output) {
+        auto& cell = data.cells[cellIndex];
+        auto cellMaxBindingEnergy = spotCalculator.calcParameter(
+            &SimulationParametersZoneValues::cellMaxBindingEnergy, &SimulationParametersZoneActivatedValues::cellMaxBindingEnergy, cell.pos);
+        auto cellFusionVelocity = spotCalculator.calcParameter(
+            &SimulationParametersZoneValues::cellFusionVelocity, &SimulationParametersZoneActivatedValues::cellFusionVelocity, cell.pos);
+
+        RealVector2D F_pressure;
+        RealVector2D F_viscosity;
+        RealVector2D cellPosDelta;
+        float density = 0;
+
+        std::array<int, MaxBarrierCellsForCollision> barrierCellIndices;
+        int numBarrierCells = 0;
+
+        data.cellMap.forEachWithinRadius(cell.pos, smoothingLength * 2, [&](int otherCellIndex, float) {
+            auto const& otherCell = data.cells[otherCellIndex];
+            auto posDelta = data.getCorrectedDirection(cell.pos - otherCell.pos);
+            auto distance = Math::length(posDelta);
+            if (distance > smoothingLength * 2) {
+                return;
+            }
+
+            if (otherCell.barrier) {
+                if (numBarrierCells < MaxBarrierCellsForCollision) {
+                    barrierCellIndices[numBarrierCells++] = otherCellIndex;
+                }
+                return;
+            }
+
+            //calc density
+            density += calcKernel(distance / smoothingLength) / (smoothingLength * smoothingLength);
+
+            if (cellIndex == otherCellIndex) {
+                return;
+            }
+
+            //overlap correction
+            if (!cell.barrier && distance < parameters.cellMinDistance) {
+                cellPosDelta += posDelta * parameters.cellMinDistance / 5;
+            }
+
+            if (cell.getConnectionIndex(otherCellIndex) != -1) {
+                return;
+            }
+
+            //calc forces: for simplicity pressure = density
+            auto velDelta = cell.vel - otherCell.vel;
+            auto const& cellPressure = cell.density;            //optimization: using the density from last time step
+            auto const& otherCellPressure = otherCell.density;  //optimization: using the density from last time step
+            auto factor = (cellPressure / (cell.density * cell.density) + otherCellPressure / (otherCell.density * otherCell.density));
+
+            if (std::abs(distance) > NEAR_ZERO) {
+                float kernel_d = calcKernel_d(distance / smoothingLength) / (smoothingLength * smoothingLength * smoothingLength);
+                F_pressure += posDelta / (-distance) * factor * kernel_d;
+                F_viscosity += velDelta / otherCell.density * distance * kernel_d / (distance * distance + 0.25f);
+            }
+
+            //fusion
+            if (isFusionPossible(cell, otherCell, velDelta, cellMaxBindingEnergy, cellFusionVelocity)) {
+                output.operations.addConnectionPairs.emplace_back(CpuStructuralOperations::AddConnectionPair{cellIndex, otherCellIndex});
+            }
+        });
+
+        //calculate barrier forces
+        if (numBarrierCells > 0) {
+            int closestBarrierCellIndex = -1;
+            float closestBarrierCellDistance = 0;
+            for (int i = 0; i < numBarrierCells; ++i) {
+                auto distance = data.getDistance(cell.pos, data.cells[barrierCellIndices[i]].pos);
+                if (closestBarrierCellIndex == -1 || distance < closestBarrierCellDistance) {
+                    closestBarrierCellIndex = barrierCellIndices[i];
+                    closestBarrierCellDistance = distance;
+                }
+            }
+            auto const& closestBarrierCell = data.cells[closestBarrierCellIndex];
+
+            RealVector2D r{0, 0};
+            if (closestBarrierCell.numConnections <= 1) {
+                r = data.getCorrectedDirection(cell.pos - closestBarrierCell.pos);
+            } else {
+                auto angleToCell = Math::angleOfVector(data.getCorrectedDirection(cell.pos - closestBarrierCell.pos));
+                auto numConnections = closestBarrierCell.numConnections;
+                for (int i = 0; i < numConnections; ++i) {
+                    auto const& otherCell1 = data.cells[closestBarrierCell.connections[i].cellIndex];
+                    auto const& otherCell2 = data.cells[closestBarrierCell.connections[(i + 1) % numConnections].cellIndex];
+                    auto angleToOtherCell1 = Math::angleOfVector(data.getCorrectedDirection(otherCell1.pos - closestBarrierCell.pos));
+                    auto angleToOtherCell2 = Math::angleOfVector(data.getCorrectedDirection(otherCell2.pos - closestBarrierCell.pos));
+                    if (Math::isAngleInBetween(angleToOtherCell1, angleToOtherCell2, angleToCell)) {
+                        r = Math::rotateQuarterCounterClockwise(otherCell2.pos - otherCell1.pos);
+                        break;
+                    }
+                }
+            }
+            auto vr = cell.vel - closestBarrierCell.vel;
+            auto dot_vr_r = dot(vr, r);
+
+            if (dot_vr_r < 0) {
+                auto truncated_r_squared = std::max(0.05f, lengthSquared(r));
+                auto truncated_distance = std::max(0.05f, closestBarrierCellDistance);
+                cell.shared1 += (vr - r * 2 * dot_vr_r / truncated_r_squared + closestBarrierCell.vel - cell.vel) / truncated_distance;
+            }
+        }
+
+        posDeltas[cellIndex] = cellPosDelta;
+        cell.shared1 += F_pressure * parameters.motionData.fluidMotion.pressureStrength + F_viscosity * parameters.motionData.fluidMotion.viscosityStrength;
+        cell.shared2.x = density;
+    });
+
+    for (int i = 0; i < toInt(data.cells.size()); ++i) {
+        data.cells[i].pos += posDeltas[i];
+    }
+}
+
+void CpuCellProcessor::calcCollisions_reconnectCells_correctOverlap(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    auto const& collisionMotion = parameters.motionData.collisionMotion;
+
+    //overlap corrections are applied after all forces have been calculated from the same positions
+    std::vector<RealVector2D> posDeltas(data.cells.size());
+
+    HostSpotCalculator spotCalculator(parameters, data.worldSize);
+    forEachCell(data, [&](int cellIndex, PartitionOutput& output) {
+        auto& cell = data.cells[cellIndex];
+        auto cellMaxBindingEnergy = spotCalculator.calcParameter(
+            &SimulationParametersZoneValues::cellMaxBindingEnergy, &SimulationParametersZoneActivatedValues::cellMaxBindingEnergy, cell.pos);
+        auto cellFusionVelocity = spotCalculator.calcParameter(
+            &SimulationParametersZoneValues::cellFusionVelocity, &SimulationParametersZoneActivatedValues::cellFusionVelocity, cell.pos);
+        data.cellMap.forEachWithinRadius(cell.pos, collisionMotion.cellMaxCollisionDistance, [&](int otherCellIndex, float) {
+            if (otherCellIndex == cellIndex) {
+                return;
+            }
+            auto const& otherCell = data.cells[otherCellIndex];
+            auto posDelta = data.getCorrectedDirection(cell.pos - otherCell.pos);
+            auto distance = Math::length(posDelta);
+
+            //overlap correction
+            if (!cell.barrier && distance < parameters.cellMinDistance) {
+                posDeltas[cellIndex] += posDelta * parameters.cellMinDistance / 5;
+            }
+
+            if (cell.getConnectionIndex(otherCellIndex) != -1) {
+                return;
+            }
+
+            //collision algorithm
+            auto velDelta = cell.vel - otherCell.vel;
+            auto isApproaching = dot(posDelta, velDelta) < 0;
+            auto barrierFactor = cell.barrier ? 2.0f : 1.0f;
+
+            RealVector2D force;
+            if (Math::length(cell.vel) > 0.5f && isApproaching) {
+                auto distanceSquared = distance * distance + 0.25f;
+                force = posDelta * dot(velDelta, posDelta) / (-2 * distanceSquared) * barrierFactor;
+            } else {
+                force = normalized(posDelta) * (collisionMotion.cellMaxCollisionDistance - distance) * collisionMotion.cellRepulsionStrength * barrierFactor;
+            }
+            cell.shared1 += force;
+            output.forceContributions.emplace_back(otherCellIndex, -force);
+
+            //fusion
+            if (isApproaching && isFusionPossible(cell, otherCell, velDelta, cellMaxBindingEnergy, cellFusionVelocity)) {
+                output.operations.addConnectionPairs.emplace_back(CpuStructuralOperations::AddConnectionPair{cellIndex, otherCellIndex});
+            }
+        });
+    });
+
+    for (int i = 0; i < toInt(data.cells.size()); ++i) {
+        data.cells[i].pos += posDeltas[i];
+    }
+}
+
+void CpuCellProcessor::checkForces(CpuSimulationData& data)
+{
+    //sequential because of the random numbers
+    HostSpotCalculator spotCalculator(data.parameters, data.worldSize);
+    for (int index = 0; index < toInt(data.cells.size()); ++index) {
+        auto& cell = data.cells[index];
+        cell.density = cell.shared2.x;
+        if (cell.barrier) {
+            continue;
+        }
+
+        if (Math::length(cell.shared1)
+            > spotCalculator.calcParameter(&SimulationParametersZoneValues::cellMaxForce, &SimulationParametersZoneActivatedValues::cellMaxForce, cell.pos, cell.color)) {
+            if (data.random() < data.parameters.cellMaxForceDecayProb) {
+                data.structuralOperations.scheduleDeleteAllConnections(cell, index);
+            }
+        }
+    }
+}
+
+void CpuCellProcessor::applyForces(CpuSimulationData& data)
+{
+    auto const& cellMaxVelocity = data.parameters.cellMaxVelocity;
+    forEachCell(data, [&](int index, PartitionOutput&) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+
+        cell.vel += cell.shared1;
+        if (Math::length(cell.vel) > cellMaxVelocity) {
+            cell.vel = normalized(cell.vel) * cellMaxVelocity;
+        }
+        cell.shared1 = {0, 0};
+    });
+}
+
+void CpuCellProcessor::calcConnectionForces(CpuSimulationData& data, bool considerAngles)
+{
+    auto const& cellMinDistance = data.parameters.cellMinDistance;
+    forEachCell(data, [&](int index, PartitionOutput& output) {
+        auto& cell = data.cells[index];
+        if (0 == cell.numConnections || cell.barrier) {
+            return;
+        }
+        RealVector2D force{0, 0};
+        auto prevDisplacement = data.getCorrectedDirection(data.cells[cell.connections[cell.numConnections - 1].cellIndex].pos - cell.pos);
+        auto cellStiffnessSquared = cell.stiffness * cell.stiffness;
+
+        auto numConnections = cell.numConnections;
+        for (int i = 0; i < numConnections; ++i) {
+            auto connectedCellIndex = cell.connections[i].cellIndex;
+            auto const& connectedCell = data.cells[connectedCellIndex];
+            auto connectedCellStiffnessSquared = connectedCell.stiffness * connectedCell.stiffness;
+
+            auto displacement = data.getCorrectedDirection(connectedCell.pos - cell.pos);
+
+            auto actualDistance = Math::length(displacement);
+            auto bondDistance = cell.connections[i].distance;
+            auto deviation = actualDistance - bondDistance;
+            force = force + normalized(displacement) * deviation * (cellStiffnessSquared + connectedCellStiffnessSquared) / 6;
+
+            if (considerAngles && (numConnections > 2 || (numConnections == 2 && i == 0))) {
+
+                auto lastIndex = (i + numConnections - 1) % numConnections;
+                auto lastConnectedCellIndex = cell.connections[lastIndex].cellIndex;
+
+                //check if there is a triangular connection
+                auto triangularConnection = connectedCell.getConnectionIndex(lastConnectedCellIndex) != -1;
+
+                //angle forces in case of no triangular connections
+                if (!triangularConnection) {
+                    auto angle = Math::angleOfVector(displacement);
+                    auto prevAngle = Math::angleOfVector(prevDisplacement);
+                    auto actualAngleFromPrevious = Math::subtractAngle(angle, prevAngle);
+                    if (actualAngleFromPrevious < 0) {
+                        continue;
+                    }
+                    auto referenceAngleFromPrevious = cell.connections[i].angleFromPrevious;
+
+                    auto strength = std::abs(referenceAngleFromPrevious - actualAngleFromPrevious) / 2000 * cellStiffnessSquared;
+
+                    auto force1 = rotateQuarterClockwise(normalized(displacement) / std::max(Math::length(displacement), cellMinDistance) * strength);
+                    auto force2 = Math::rotateQuarterCounterClockwise(
+                        normalized(prevDisplacement) / std::max(Math::length(prevDisplacement), cellMinDistance) * strength);
+
+                    if (referenceAngleFromPrevious < actualAngleFromPrevious) {
+                        force1 = force1 * (-1);
+                        force2 = force2 * (-1);
+                    }
+                    if (!connectedCell.barrier) {
+                        output.forceContributions.emplace_back(connectedCellIndex, force1);
+                    }
+                    if (!data.cells[lastConnectedCellIndex].barrier) {
+                        output.forceContributions.emplace_back(lastConnectedCellIndex, force2);
+                    }
+                    force -= force1 + force2;
+                }
+            }
+
+            prevDisplacement = displacement;
+        }
+        output.forceContributions.emplace_back(index, force);
+    });
+}
+
+void CpuCellProcessor::checkConnections(CpuSimulationData& data)
+{
+    forEachCell(data, [&](int index, PartitionOutput& output) {
+        auto const& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+
+        bool scheduleForDestruction = false;
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+            auto actualDistance = Math::length(data.getCorrectedDirection(connectedCell.pos - cell.pos));
+            if (actualDistance > data.parameters.cellMaxBindingDistance[cell.color]) {
+                scheduleForDestruction = true;
+            }
+        }
+        if (scheduleForDestruction) {
+            output.operations.scheduleDeleteAllConnections(cell, index);
+            for (int i = 0; i < cell.numConnections; ++i) {
+                output.detachingCellIndices.emplace_back(cell.connections[i].cellIndex);
+            }
+        }
+    });
+}
+
+void CpuCellProcessor::verletPositionUpdate(CpuSimulationData& data)
+{
+    auto const& timestepSize = data.parameters.timestepSize;
+    forEachCell(data, [&](int index, PartitionOutput&) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            cell.pos += cell.vel * timestepSize;
+            data.correctPosition(cell.pos);
+        } else {
+            cell.pos += cell.vel * timestepSize + cell.shared1 * timestepSize * timestepSize / 2;
+            data.correctPosition(cell.pos);
+            cell.shared2 = cell.shared1;  //forces
+            cell.shared1 = {0, 0};
+        }
+    });
+}
+
+void CpuCellProcessor::verletVelocityUpdate(CpuSimulationData& data)
+{
+    auto const& timestepSize = data.parameters.timestepSize;
+    forEachCell(data, [&](int index, PartitionOutput&) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        auto acceleration = (cell.shared1 + cell.shared2) / 2;
+        cell.vel += acceleration * timestepSize;
+    });
+}
+
+void CpuCellProcessor::aging(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    HostSpotCalculator spotCalculator(parameters, data.worldSize);
+    forEachCell(data, [&](int index, PartitionOutput&) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        ++cell.age;
+
+        if (parameters.features.cellColorTransitionRules) {
+            auto color = ((cell.color % MAX_COLORS) + MAX_COLORS) % MAX_COLORS;
+            auto spotIndex = spotCalculator.getFirstMatchingSpotOrBase(cell.pos, &SimulationParametersZoneActivatedValues::cellColorTransition);
+            auto const& values = spotIndex == -1 ? parameters.baseValues : parameters.zone[spotIndex].values;
+            auto transitionDuration = values.cellColorTransitionDuration[color];
+            auto targetColor = values.cellColorTransitionTargetColor[color];
+            if (transitionDuration > 0 && cell.age > transitionDuration) {
+                cell.color = targetColor;
+                cell.age = 0;
+            }
+        }
+        if (cell.livingState == LivingState_Ready && cell.activationTime > 0) {
+            --cell.activationTime;
+        }
+    });
+}
+
+void CpuCellProcessor::livingStateTransition(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    std::vector<LivingState> nextLivingStates(data.cells.size());
+    forEachCell(data, [&](int index, PartitionOutput&) {
+        auto& cell = data.cells[index];
+
+        bool isSameCreatureNeighborDetaching = false;
+        bool isOtherCreatureNeighborDetaching = false;
+        bool isSameCreatureNeighborReviving = false;
+        bool isNeighborActivating = false;
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+            if (connectedCell.creatureId == cell.creatureId) {
+                auto connectedLivingState = connectedCell.livingState;
+                if (connectedLivingState == LivingState_Detaching) {
+                    isSameCreatureNeighborDetaching = true;
+                } else if (connectedLivingState == LivingState_Reviving) {
+                    isSameCreatureNeighborReviving = true;
+                } else if (connectedLivingState == LivingState_Activating) {
+                    isNeighborActivating = true;
+                }
+            } else {
+                if (connectedCell.livingState == LivingState_Detaching) {
+                    isOtherCreatureNeighborDetaching = true;
+                }
+            }
+        }
+
+        auto origLivingState = cell.livingState;
+        auto livingState = origLivingState;
+
+        if (cell.barrier) {
+            livingState = LivingState_Ready;
+        } else if (origLivingState == LivingState_Activating) {
+            livingState = LivingState_Ready;
+            if (parameters.features.cellAgeLimiter && parameters.cellResetAgeAfterActivation) {
+                cell.age = 0;
+            }
+        } else if (origLivingState == LivingState_Reviving) {
+            livingState = LivingState_Ready;
+        } else if (origLivingState == LivingState_UnderConstruction) {
+            if (isNeighborActivating) {
+                livingState = LivingState_Activating;
+            }
+            if (isOtherCreatureNeighborDetaching && parameters.cellDeathConsequences != CellDeathConsquences_None) {
+                livingState = LivingState_Detaching;
+            }
+        } else if (origLivingState == LivingState_Detaching) {
+            if (isSameCreatureNeighborReviving && parameters.cellDeathConsequences == CellDeathConsquences_DetachedPartsDie) {
+                livingState = LivingState_Reviving;
+            }
+            if (parameters.cellDeathConsequences == CellDeathConsquences_None) {
+                livingState = LivingState_Ready;
+            }
+        } else if (origLivingState == LivingState_Ready) {
+            if (isSameCreatureNeighborDetaching && parameters.cellDeathConsequences != CellDeathConsquences_None) {
+                if (parameters.cellDeathConsequences == CellDeathConsquences_DetachedPartsDie && cell.containsSelfReplication) {
+                    livingState = LivingState_Reviving;
+                } else {
+                    livingState = LivingState_Detaching;
+                }
+            }
+        }
+        nextLivingStates[index] = livingState;
+    });
+
+    for (int index = 0; index < toInt(data.cells.size()); ++index) {
+        data.cells[index].livingState = nextLivingStates[index];
+    }
+}
+
+void CpuCellProcessor::applyInnerFriction(CpuSimulationData& data)
+{
+    //sequential because each connection updates the velocities of both cells
+    auto const innerFriction = data.parameters.innerFriction;
+    for (auto& cell : data.cells) {
+        if (cell.barrier) {
+            continue;
+        }
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto& connectingCell = data.cells[cell.connections[i].cellIndex];
+            if (connectingCell.barrier) {
+                continue;
+            }
+            auto averageVel = (cell.vel + connectingCell.vel) / 2;
+            cell.vel = cell.vel * (1.0f - innerFriction) + averageVel * innerFriction;
+            connectingCell.vel = connectingCell.vel * (1.0f - innerFriction) + averageVel * innerFriction;
+        }
+    }
+}
+
+void CpuCellProcessor::applyFriction(CpuSimulationData& data)
+{
+    HostSpotCalculator spotCalculator(data.parameters, data.worldSize);
+    forEachCell(data, [&](int index, PartitionOutput&) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        auto friction = spotCalculator.calcParameter(&SimulationParametersZoneValues::friction, &SimulationParametersZoneActivatedValues::friction, cell.pos);
+        cell.vel = cell.vel * (1.0f - friction);
+    });
+}
+
+void CpuCellProcessor::decay(CpuSimulationData& data)
+{
+    //sequential because of the random numbers and the living state changes of connected cells
+    auto const& parameters = data.parameters;
+    HostSpotCalculator spotCalculator(parameters, data.worldSize);
+    for (int index = 0; index < toInt(data.cells.size()); ++index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            continue;
+        }
+        auto cellMaxBindingEnergy = spotCalculator.calcParameter(
+            &SimulationParametersZoneValues::cellMaxBindingEnergy, &SimulationParametersZoneActivatedValues::cellMaxBindingEnergy, cell.pos);
+        if (cell.energy > cellMaxBindingEnergy) {
+            data.structuralOperations.scheduleDeleteAllConnections(cell, index);
+        }
+
+        if (cell.livingState == LivingState_Dying || cell.livingState == LivingState_Detaching) {
+            auto cellDeathProbability = spotCalculator.calcParameter(
+                &SimulationParametersZoneValues::cellDeathProbability, &SimulationParametersZoneActivatedValues::cellDeathProbability, cell.pos, cell.color);
+            if (data.random() < cellDeathProbability) {
+                data.structuralOperations.delCells.emplace_back(index);
+            }
+        }
+
+        bool cellDestruction = false;
+        auto cellMinEnergy = spotCalculator.calcParameter(
+            &SimulationParametersZoneValues::cellMinEnergy, &SimulationParametersZoneActivatedValues::cellMinEnergy, cell.pos, cell.color);
+        if (cell.energy < cellMinEnergy) {
+            cellDestruction = true;
+        }
+
+        auto cellMaxAge = parameters.cellMaxAge[cell.color];
+        if (parameters.features.cellAgeLimiter && parameters.cellInactiveMaxAgeActivated && cell.mutationId != 1
+            && cell.cellFunctionUsed == CellFunctionUsed_No && cell.livingState == LivingState_Ready && cell.activationTime == 0) {
+            bool adjacentCellsUsed = false;
+            for (int i = 0; i < cell.numConnections; ++i) {
+                if (data.cells[cell.connections[i].cellIndex].cellFunctionUsed == CellFunctionUsed_Yes) {
+                    adjacentCellsUsed = true;
+                    break;
+                }
+            }
+            if (!adjacentCellsUsed) {
+                auto cellInactiveMaxAge = spotCalculator.calcParameter(
+                    &SimulationParametersZoneValues::cellInactiveMaxAge, &SimulationParametersZoneActivatedValues::cellInactiveMaxAge, cell.pos, cell.color);
+                cellMaxAge = toInt(cellInactiveMaxAge);
+            }
+        }
+        if (parameters.features.cellAgeLimiter && parameters.cellEmergentMaxAgeActivated && cell.mutationId == 1) {
+            cellMaxAge = parameters.cellEmergentMaxAge[cell.color];
+        }
+        if (cellMaxAge > 0 && cell.age > cellMaxAge) {
+            cellDestruction = true;
+        }
+
+        if (cellDestruction && cell.livingState != LivingState_Dying) {
+            cell.livingState = LivingState_Dying;
+            for (int i = 0; i < cell.numConnections; ++i) {
+                auto& connectedCell = data.cells[cell.connections[i].cellIndex];
+                if (connectedCell.livingState != LivingState_Dying) {
+                    connectedCell.livingState = LivingState_Detaching;
+                }
+            }
+        }
+    }
+}
+
+void CpuCellProcessor::resetDensity(CpuSimulationData& data)
+{
+    for (auto& cell : data.cells) {
+        cell.density = 1.0f;
+    }
+}
+
+void CpuCellProcessor::particleMovement(CpuSimulationData& data)
+{
+    auto const& timestepSize = data.parameters.timestepSize;
+    forEach(data, toInt(data.particles.size()), [&](int index, PartitionOutput&) {
+        auto& particle = data.particles[index];
+        particle.pos = particle.pos + particle.vel * timestepSize;
+        data.correctPosition(particle.pos);
+    });
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+
+//host port of the physics part of CellProcessor.cuh
+//per-cell kernels run on worker threads; contributions to other cells and scheduled operations are merged in the order of the cell indices
+//so that the result does not depend on the number of threads
+class CpuCellProcessor
+{
+public:
+    static void init(CpuSimulationData& data);
+    static void updateMap(CpuSimulationData& data);
+
+    static void calcFluidForces_reconnectCells_correctOverlap(CpuSimulationData& data);
+    static void calcCollisions_reconnectCells_correctOverlap(CpuSimulationData& data);
+    static void checkForces(CpuSimulationData& data);
+    static void applyForces(CpuSimulationData& data);  //prerequisite: data from calcFluidForces/calcCollisions
+
+    static void calcConnectionForces(CpuSimulationData& data, bool considerAngles);
+    static void checkConnections(CpuSimulationData& data);
+    static void verletPositionUpdate(CpuSimulationData& data);
+    static void verletVelocityUpdate(CpuSimulationData& data);
+
+    static void aging(CpuSimulationData& data);
+    static void livingStateTransition(CpuSimulationData& data);
+
+    static void applyInnerFriction(CpuSimulationData& data);
+    static void applyFriction(CpuSimulationData& data);
+
+    static void decay(CpuSimulationData& data);
+
+    static void resetDensity(CpuSimulationData& data);
+
+    static void particleMovement(CpuSimulationData& data);  //from RadiationProcessor::movement
+
+private:
+    static auto constexpr MaxBarrierCellsForCollision = 10;
+};
@@ -0,0 +1,193 @@
+#include "CpuDescriptionConverter.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "EngineInterface/GenomeDescriptionService.h"
+
+namespace
+{
+    bool containsSelfReplication(CellDescription const& cell)
+    {
+        if (cell.getCellFunctionType() != CellFunction_Constructor) {
+            return false;
+        }
+        auto const& constructor = std::get<ConstructorDescription>(*cell.cellFunction);
+        auto genome = GenomeDescriptionService::get().convertBytesToDescription(constructor.genome);
+        return std::any_of(genome.cells.begin(), genome.cells.end(), [](CellGenomeDescription const& node) {
+            return node.getCellFunctionType() == CellFunction_Constructor && std::get<ConstructorGenomeDescription>(*node.cellFunction).isMakeGenomeCopy();
+        });
+    }
+}
+
+void CpuDescriptionConverter::addDescriptionToData(CpuSimulationData& data, DataDescription const& description) const
+{
+    auto startIndex = toInt(data.cells.size());
+    std::unordered_map<uint64_t, int> cellIndexById;
+    for (int i = 0; i < toInt(description.cells.size()); ++i) {
+        cellIndexById.emplace(description.cells[i].id, startIndex + i);
+    }
+
+    for (auto const& cellDesc : description.cells) {
+        CpuCell cell;
+        setCellProperties(data, cell, cellDesc);
+        for (auto const& connection : cellDesc.connections) {
+            auto findResult = cellIndexById.find(connection.cellId);
+            if (findResult == cellIndexById.end() || cell.numConnections == MAX_CELL_BONDS) {
+                continue;
+            }
+            cell.connections[cell.numConnections++] = CpuCellConnection{findResult->second, connection.distance, connection.angleFromPrevious};
+        }
+
+        //only the properties which are not processed on the host are kept in the description
+        auto remainingDesc = cellDesc;
+        remainingDesc.connections.clear();
+        data.addCell(cell, std::move(remainingDesc));
+    }
+
+    for (auto const& particleDesc : description.particles) {
+        CpuParticle particle;
+        setParticleProperties(data, particle, particleDesc);
+        data.addParticle(particle);
+    }
+}
+
+void CpuDescriptionConverter::changeCell(CpuSimulationData& data, CellDescription const& changedCell) const
+{
+    for (int i = 0; i < toInt(data.cells.size()); ++i) {
+        if (data.cells[i].id == changedCell.id && !data.cells[i].deleted) {
+            setCellProperties(data, data.cells[i], changedCell);
+            data.cellDescriptions[i] = changedCell;
+            data.cellDescriptions[i].connections.clear();
+            return;
+        }
+    }
+}
+
+void CpuDescriptionConverter::changeParticle(CpuSimulationData& data, ParticleDescription const& changedParticle) const
+{
+    for (auto& particle : data.particles) {
+        if (particle.id == changedParticle.id && !particle.deleted) {
+            setParticleProperties(data, particle, changedParticle);
+            return;
+        }
+    }
+}
+
+DataDescription CpuDescriptionConverter::convertDataToDescription(CpuSimulationData const& data) const
+{
+    DataDescription result;
+    result.cells.reserve(data.cells.size());
+    for (int i = 0; i < toInt(data.cells.size()); ++i) {
+        if (!data.cells[i].deleted) {
+            result.cells.emplace_back(createCellDescription(data, i));
+        }
+    }
+    for (auto const& particle : data.particles) {
+        if (!particle.deleted) {
+            result.particles.emplace_back(createParticleDescription(particle));
+        }
+    }
+    return result;
+}
+
+ClusteredDataDescription CpuDescriptionConverter::convertDataToClusteredDescription(CpuSimulationData const& data) const
+{
+    ClusteredDataDescription result;
+
+    std::vector<bool> visited(data.cells.size(), false);
+    std::vector<int> cellIndicesToVisit;
+    for (int startIndex = 0; startIndex < toInt(data.cells.size()); ++startIndex) {
+        if (visited[startIndex] || data.cells[startIndex].deleted) {
+            continue;
+        }
+        ClusterDescription cluster;
+        visited[startIndex] = true;
+        cellIndicesToVisit.emplace_back(startIndex);
+        while (!cellIndicesToVisit.empty()) {
+            auto cellIndex = cellIndicesToVisit.back();
+            cellIndicesToVisit.pop_back();
+            cluster.addCell(createCellDescription(data, cellIndex));
+
+            auto const& cell = data.cells[cellIndex];
+            for (int i = 0; i < cell.numConnections; ++i) {
+                auto connectedCellIndex = cell.connections[i].cellIndex;
+                if (!visited[connectedCellIndex]) {
+                    visited[connectedCellIndex] = true;
+                    cellIndicesToVisit.emplace_back(connectedCellIndex);
+                }
+            }
+        }
+        result.addCluster(cluster);
+    }
+    for (auto const& particle : data.particles) {
+        if (!particle.deleted) {
+            result.particles.emplace_back(createParticleDescription(particle));
+        }
+    }
+    return result;
+}
+
+void CpuDescriptionConverter::setCellProperties(CpuSimulationData const& data, CpuCell& cell, CellDescription const& cellDesc) const
+{
+    cell.id = cellDesc.id;
+    cell.pos = cellDesc.pos;
+    data.correctPosition(cell.pos);
+    cell.vel = cellDesc.vel;
+    cell.energy = cellDesc.energy;
+    cell.stiffness = cellDesc.stiffness;
+    cell.color = cellDesc.color;
+    cell.maxConnections = cellDesc.maxConnections;
+    cell.barrier = cellDesc.barrier;
+    cell.age = cellDesc.age;
+    cell.livingState = cellDesc.livingState;
+    cell.creatureId = cellDesc.creatureId;
+    cell.mutationId = cellDesc.mutationId;
+    cell.activationTime = cellDesc.activationTime;
+    cell.cellFunctionUsed = cellDesc.cellFunctionUsed;
+    cell.containsSelfReplication = containsSelfReplication(cellDesc);
+}
+
+void CpuDescriptionConverter::setParticleProperties(CpuSimulationData const& data, CpuParticle& particle, ParticleDescription const& particleDesc) const
+{
+    particle.id = particleDesc.id;
+    particle.pos = particleDesc.pos;
+    data.correctPosition(particle.pos);
+    particle.vel = particleDesc.vel;
+    particle.energy = particleDesc.energy;
+    particle.color = particleDesc.color;
+}
+
+CellDescription CpuDescriptionConverter::createCellDescription(CpuSimulationData const& data, int cellIndex) const
+{
+    auto const& cell = data.cells[cellIndex];
+    auto result = data.cellDescriptions[cellIndex];
+    result.id = cell.id;
+    result.pos = cell.pos;
+    result.vel = cell.vel;
+    result.energy = cell.energy;
+    result.stiffness = cell.stiffness;
+    result.color = cell.color;
+    result.maxConnections = cell.maxConnections;
+    result.barrier = cell.barrier;
+    result.age = cell.age;
+    result.livingState = cell.livingState;
+    result.creatureId = cell.creatureId;
+    result.mutationId = cell.mutationId;
+    result.activationTime = cell.activationTime;
+    result.cellFunctionUsed = cell.cellFunctionUsed;
+    result.connections.clear();
+    for (int i = 0; i < cell.numConnections; ++i) {
+        auto const& connection = cell.connections[i];
+        result.connections.emplace_back(ConnectionDescription()
+                                            .setCellId(data.cells[connection.cellIndex].id)
+                                            .setDistance(connection.distance)
+                                            .setAngleFromPrevious(connection.angleFromPrevious));
+    }
+    return result;
+}
+
+ParticleDescription CpuDescriptionConverter::createParticleDescription(CpuParticle const& particle) const
+{
+    return ParticleDescription().setId(particle.id).setPos(particle.pos).setVel(particle.vel).setEnergy(particle.energy).setColor(particle.color);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "EngineInterface/Descriptions.h"
+
+#include "CpuSimulationData.h"
+
+class CpuDescriptionConverter
+{
+public:
+    //adds the cells and particles of the description; connections to cells which are not contained in the description are ignored
+    void addDescriptionToData(CpuSimulationData& data, DataDescription const& description) const;
+
+    void changeCell(CpuSimulationData& data, CellDescription const& changedCell) const;  //connections remain unchanged
+    void changeParticle(CpuSimulationData& data, ParticleDescription const& changedParticle) const;
+
+    DataDescription convertDataToDescription(CpuSimulationData const& data) const;
+    ClusteredDataDescription convertDataToClusteredDescription(CpuSimulationData const& data) const;
+
+private:
+    void setCellProperties(CpuSimulationData const& data, CpuCell& cell, CellDescription const& cellDesc) const;
+    void setParticleProperties(CpuSimulationData const& data, CpuParticle& particle, ParticleDescription const& particleDesc) const;
+    CellDescription createCellDescription(CpuSimulationData const& data, int cellIndex) const;
+    ParticleDescription createParticleDescription(CpuParticle const& particle) const;
+};
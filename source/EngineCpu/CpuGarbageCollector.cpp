@@ -0,0 +1,63 @@
+#include "CpuGarbageCollector.h"
+
+#include <algorithm>
+
+#include "Base/Parallel.h"
+
+void CpuGarbageCollector::cleanupAfterTimestep(CpuSimulationData& data)
+{
+    data.structuralOperations.clear();
+    cleanupCells(data);
+    cleanupParticles(data);
+}
+
+void CpuGarbageCollector::cleanupCells(CpuSimulationData& data)
+{
+    auto numCells = toInt(data.cells.size());
+    if (std::none_of(data.cells.begin(), data.cells.end(), [](CpuCell const& cell) { return cell.deleted; })) {
+        return;
+    }
+
+    //step 1: stable compaction of the cell array
+    std::vector<int> newIndices(numCells, -1);
+    int numRemainingCells = 0;
+    for (int index = 0; index < numCells; ++index) {
+        if (data.cells[index].deleted) {
+            continue;
+        }
+        newIndices[index] = numRemainingCells;
+        if (numRemainingCells != index) {
+            data.cells[numRemainingCells] = data.cells[index];
+            data.cellDescriptions[numRemainingCells] = std::move(data.cellDescriptions[index]);
+        }
+        ++numRemainingCells;
+    }
+    data.cells.resize(numRemainingCells);
+    data.cellDescriptions.resize(numRemainingCells);
+
+    //step 2: remap connections (connections to deleted cells should have been removed by the structural operations)
+    Parallel::forEachPartition(
+        numRemainingCells,
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                auto& cell = data.cells[index];
+                int numConnections = 0;
+                for (int i = 0; i < cell.numConnections; ++i) {
+                    auto newIndex = newIndices[cell.connections[i].cellIndex];
+                    if (newIndex != -1) {
+                        cell.connections[numConnections] = cell.connections[i];
+                        cell.connections[numConnections].cellIndex = newIndex;
+                        ++numConnections;
+                    }
+                }
+                cell.numConnections = numConnections;
+            }
+        },
+        data.maxThreads);
+}
+
+void CpuGarbageCollector::cleanupParticles(CpuSimulationData& data)
+{
+    data.particles.erase(
+        std::remove_if(data.particles.begin(), data.particles.end(), [](CpuParticle const& particle) { return particle.deleted; }), data.particles.end());
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+
+//host counterpart of GarbageCollectorKernelsLauncher: removes deleted cells and particles and remaps the connection indices
+class CpuGarbageCollector
+{
+public:
+    static void cleanupAfterTimestep(CpuSimulationData& data);
+
+private:
+    static void cleanupCells(CpuSimulationData& data);
+    static void cleanupParticles(CpuSimulationData& data);
+};
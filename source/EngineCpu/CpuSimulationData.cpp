@@ -0,0 +1,81 @@
+#include "CpuSimulationData.h"
+
+#include <algorithm>
+
+#include "Base/Math.h"
+
+void CpuStructuralOperations::clear()
+{
+    addConnectionPairs.clear();
+    delConnections.clear();
+    delCells.clear();
+}
+
+void CpuStructuralOperations::append(CpuStructuralOperations const& other)
+{
+    addConnectionPairs.insert(addConnectionPairs.end(), other.addConnectionPairs.begin(), other.addConnectionPairs.end());
+    delConnections.insert(delConnections.end(), other.delConnections.begin(), other.delConnections.end());
+    delCells.insert(delCells.end(), other.delCells.begin(), other.delCells.end());
+}
+
+void CpuStructuralOperations::scheduleDeleteAllConnections(CpuCell const& cell, int cellIndex)
+{
+    for (int i = 0; i < cell.numConnections; ++i) {
+        auto connectedCellIndex = cell.connections[i].cellIndex;
+        delConnections.emplace_back(DelConnection{connectedCellIndex, cellIndex});
+        delConnections.emplace_back(DelConnection{cellIndex, connectedCellIndex});
+    }
+}
+
+void CpuSimulationData::init(IntVector2D const& worldSize_, uint64_t timestep_, uint32_t randomSeed)
+{
+    worldSize = worldSize_;
+    timestep = timestep_;
+    cells.clear();
+    cellDescriptions.clear();
+    particles.clear();
+    structuralOperations.clear();
+    cellMap = SpatialGrid(worldSize, 2.0f);
+    _randomEngine.seed(randomSeed);
+    _nextId = 1;
+}
+
+float CpuSimulationData::getDistance(RealVector2D const& p, RealVector2D const& q) const
+{
+    return Math::length(getCorrectedDirection(p - q));
+}
+
+float CpuSimulationData::random()
+{
+    return _distribution(_randomEngine);
+}
+
+uint64_t CpuSimulationData::createNewId()
+{
+    return _nextId++;
+}
+
+void CpuSimulationData::addCell(CpuCell const& cell, CellDescription description)
+{
+    _nextId = std::max(_nextId, cell.id + 1);
+    cells.emplace_back(cell);
+    cellDescriptions.emplace_back(std::move(description));
+}
+
+void CpuSimulationData::addParticle(CpuParticle const& particle)
+{
+    _nextId = std::max(_nextId, particle.id + 1);
+    particles.emplace_back(particle);
+}
+
+void CpuSimulationData::addEnergyParticle(RealVector2D pos, RealVector2D const& vel, int color, float energy)
+{
+    correctPosition(pos);
+    CpuParticle particle;
+    particle.id = createNewId();
+    particle.pos = pos;
+    particle.vel = vel;
+    particle.color = color;
+    particle.energy = energy;
+    particles.emplace_back(particle);
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Vector2D.h"
+#include "EngineInterface/CellFunctionConstants.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/EngineConstants.h"
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/SpatialGrid.h"
+
+struct CpuCellConnection
+{
+    int cellIndex = -1;
+    float distance = 0;
+    float angleFromPrevious = 0;
+};
+
+//host counterpart of the Cell struct in the CUDA kernels; connections refer to indices in CpuSimulationData::cells
+struct CpuCell
+{
+    uint64_t id = 0;
+    RealVector2D pos;
+    RealVector2D vel;
+    float energy = 0;
+    float stiffness = 1.0f;
+    int color = 0;
+    int maxConnections = 0;
+    bool barrier = false;
+    int age = 0;
+    LivingState livingState = LivingState_Ready;
+    int creatureId = 0;
+    int mutationId = 0;
+    int activationTime = 0;
+    CellFunctionUsed cellFunctionUsed = CellFunctionUsed_No;
+    bool containsSelfReplication = false;  //constructor with a genome which contains a self-copy
+
+    int numConnections = 0;
+    CpuCellConnection connections[MAX_CELL_BONDS];
+
+    //temporary data during a time step
+    RealVector2D shared1;
+    RealVector2D shared2;
+    float density = 1.0f;
+    bool deleted = false;
+
+    int getConnectionIndex(int cellIndex) const
+    {
+        for (int i = 0; i < numConnections; ++i) {
+            if (connections[i].cellIndex == cellIndex) {
+                return i;
+            }
+        }
+        return -1;
+    }
+};
+
+struct CpuParticle
+{
+    uint64_t id = 0;
+    RealVector2D pos;
+    RealVector2D vel;
+    float energy = 0;
+    int color = 0;
+    bool deleted = false;
+};
+
+//operations which are scheduled during the parallel kernels and processed afterwards in a deterministic order
+struct CpuStructuralOperations
+{
+    struct AddConnectionPair
+    {
+        int cellIndex;
+        int otherCellIndex;
+    };
+    struct DelConnection
+    {
+        int cellIndex;
+        int connectedCellIndex;
+    };
+    std::vector<AddConnectionPair> addConnectionPairs;
+    std::vector<DelConnection> delConnections;
+    std::vector<int> delCells;
+
+    void clear();
+    void append(CpuStructuralOperations const& other);
+
+    void scheduleDeleteAllConnections(CpuCell const& cell, int cellIndex);
+};
+
+class CpuSimulationData
+{
+public:
+    void init(IntVector2D const& worldSize, uint64_t timestep, uint32_t randomSeed = 0);
+
+    //toroidal space as in BaseMap of the CUDA kernels
+    void correctPosition(RealVector2D& pos) const
+    {
+        auto intPartX = toInt(std::floor(pos.x));
+        auto intPartY = toInt(std::floor(pos.y));
+        auto fracPart = RealVector2D{pos.x - toFloat(intPartX), pos.y - toFloat(intPartY)};
+        intPartX = ((intPartX % worldSize.x) + worldSize.x) % worldSize.x;
+        intPartY = ((intPartY % worldSize.y) + worldSize.y) % worldSize.y;
+        pos = {toFloat(intPartX) + fracPart.x, toFloat(intPartY) + fracPart.y};
+    }
+    RealVector2D getCorrectedDirection(RealVector2D const& disp) const
+    {
+        return {std::remainder(disp.x, toFloat(worldSize.x)), std::remainder(disp.y, toFloat(worldSize.y))};
+    }
+    float getDistance(RealVector2D const& p, RealVector2D const& q) const;
+
+    float random();  //uniformly distributed in [0, 1)
+    uint64_t createNewId();
+
+    void addCell(CpuCell const& cell, CellDescription description);
+    void addParticle(CpuParticle const& particle);
+    void addEnergyParticle(RealVector2D pos, RealVector2D const& vel, int color, float energy);
+
+    IntVector2D worldSize;
+    uint64_t timestep = 0;
+    SimulationParameters parameters;  //plays the role of the constant memory in the CUDA kernels
+    int maxThreads = 0;  //0 = number of hardware threads
+
+    std::vector<CpuCell> cells;
+    std::vector<CellDescription> cellDescriptions;  //properties which are not processed on the host (cell functions, genomes, ...)
+    std::vector<CpuParticle> particles;
+
+    CpuStructuralOperations structuralOperations;
+    SpatialGrid cellMap;  //contains all cells after CpuCellProcessor::updateMap, entry indices correspond to cell indices
+
+private:
+    std::mt19937 _randomEngine;
+    std::uniform_real_distribution<float> _distribution{0.0f, 1.0f};
+    uint64_t _nextId = 1;
+};
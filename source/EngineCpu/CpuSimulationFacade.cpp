@@ -0,0 +1,568 @@
+#include "CpuSimulationFacade.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "Base/Parallel.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/OfflineStatisticsService.h"
+#include "EngineInterface/TimingSink.h"
+
+#include "CpuDescriptionConverter.h"
+
+namespace
+{
+    std::chrono::milliseconds const StatisticsUpdate(30);
+}
+
+_CpuSimulationFacade::_CpuSimulationFacade(int maxThreads, uint32_t randomSeed)
+    : _maxThreads(maxThreads)
+    , _randomSeed(randomSeed)
+{}
+
+_CpuSimulationFacade::~_CpuSimulationFacade()
+{
+    if (_thread.joinable()) {
+        closeSimulation();
+    }
+}
+
+void _CpuSimulationFacade::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters)
+{
+    if (_thread.joinable()) {
+        closeSimulation();
+    }
+    _generalSettings = generalSettings;
+    _origSettings.generalSettings = generalSettings;
+    _origSettings.simulationParameters = parameters;
+    _statisticsHistory.rewrite({}, timestep);
+    {
+        std::lock_guard lock(_mutex);
+        _data.init({generalSettings.worldSizeX, generalSettings.worldSizeY}, timestep, _randomSeed);
+        _data.parameters = parameters;
+        _data.maxThreads = _maxThreads;
+        updateStatistics();
+    }
+
+    _isShutdown.store(false);
+    _thread = std::thread(&_CpuSimulationFacade::runThreadLoop, this);
+
+    _realTime = std::chrono::milliseconds(0);
+    _simRunTimePoint.reset();
+
+    ++_sessionId;
+}
+
+int _CpuSimulationFacade::getSessionId() const
+{
+    return _sessionId;
+}
+
+void _CpuSimulationFacade::clear()
+{
+    std::lock_guard lock(_mutex);
+    _data.init(_data.worldSize, _data.timestep, _randomSeed);
+    updateStatistics();
+}
+
+void _CpuSimulationFacade::setImageResource(void* image) {}
+
+std::string _CpuSimulationFacade::getGpuName() const
+{
+    return "CPU (" + std::to_string(_maxThreads > 0 ? _maxThreads : Parallel::getNumThreads()) + " threads)";
+}
+
+void _CpuSimulationFacade::tryDrawVectorGraphics(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom)
+{
+    throwNotSupported("Rendering");
+}
+
+std::optional<OverlayDescription> _CpuSimulationFacade::tryDrawVectorGraphicsAndReturnOverlay(
+    RealVector2D const& rectUpperLeft,
+    RealVector2D const& rectLowerRight,
+    IntVector2D const& imageSize,
+    double zoom)
+{
+    throwNotSupported("Rendering");
+}
+
+bool _CpuSimulationFacade::isSyncSimulationWithRendering() const
+{
+    return _syncSimulationWithRendering;
+}
+
+void _CpuSimulationFacade::setSyncSimulationWithRendering(bool value)
+{
+    _syncSimulationWithRendering = value;
+}
+
+int _CpuSimulationFacade::getSyncSimulationWithRenderingRatio() const
+{
+    return _syncSimulationWithRenderingRatio;
+}
+
+void _CpuSimulationFacade::setSyncSimulationWithRenderingRatio(int value)
+{
+    _syncSimulationWithRenderingRatio = value;
+}
+
+ClusteredDataDescription _CpuSimulationFacade::getClusteredSimulationData()
+{
+    std::lock_guard lock(_mutex);
+    ScopedTiming timing(_timingSink, "conversion: data to description");
+    return CpuDescriptionConverter().convertDataToClusteredDescription(_data);
+}
+
+DataDescription _CpuSimulationFacade::getSimulationData()
+{
+    std::lock_guard lock(_mutex);
+    ScopedTiming timing(_timingSink, "conversion: data to description");
+    return CpuDescriptionConverter().convertDataToDescription(_data);
+}
+
+ClusteredDataDescription _CpuSimulationFacade::getSelectedClusteredSimulationData(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+DataDescription _CpuSimulationFacade::getSelectedSimulationData(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+DataDescription _CpuSimulationFacade::getInspectedSimulationData(std::vector<uint64_t> objectIds, InspectedPayloads const& payloads)
+{
+    //the payloads are held on the host anyway, hence they are always returned
+    std::unordered_set<uint64_t> objectIdSet(objectIds.begin(), objectIds.end());
+    auto data = getSimulationData();
+
+    DataDescription result;
+    for (auto const& cell : data.cells) {
+        if (objectIdSet.contains(cell.id)) {
+            result.cells.emplace_back(cell);
+        }
+    }
+    for (auto const& particle : data.particles) {
+        if (objectIdSet.contains(particle.id)) {
+            result.particles.emplace_back(particle);
+        }
+    }
+    return result;
+}
+
+void _CpuSimulationFacade::addAndSelectSimulationData(DataDescription const& dataToAdd)
+{
+    std::lock_guard lock(_mutex);
+    CpuDescriptionConverter().addDescriptionToData(_data, dataToAdd);
+    updateStatistics();
+}
+
+void _CpuSimulationFacade::setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate)
+{
+    setSimulationData(DataDescription(dataToUpdate));
+}
+
+void _CpuSimulationFacade::setSimulationData(DataDescription const& dataToUpdate)
+{
+    std::lock_guard lock(_mutex);
+    ScopedTiming timing(_timingSink, "conversion: description to data");
+    _data.init(_data.worldSize, _data.timestep, _randomSeed);
+    CpuDescriptionConverter().addDescriptionToData(_data, dataToUpdate);
+    updateStatistics();
+}
+
+void _CpuSimulationFacade::removeSelectedObjects(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::relaxSelectedObjects(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::uniformVelocitiesForSelectedObjects(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::makeSticky(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::removeStickiness(bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::setBarrier(bool value, bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::colorSelectedObjects(unsigned char color, bool includeClusters)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::reconnectSelectedObjects()
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::setDetached(bool value)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::changeCell(CellDescription const& changedCell)
+{
+    std::lock_guard lock(_mutex);
+    CpuDescriptionConverter().changeCell(_data, changedCell);
+}
+
+void _CpuSimulationFacade::changeParticle(ParticleDescription const& changedParticle)
+{
+    std::lock_guard lock(_mutex);
+    CpuDescriptionConverter().changeParticle(_data, changedParticle);
+}
+
+void _CpuSimulationFacade::calcTimesteps(uint64_t timesteps)
+{
+    std::lock_guard lock(_mutex);
+    for (uint64_t i = 0; i < timesteps; ++i) {
+        _kernelsLauncher.calcTimestep(_data);
+        updateStatisticsIfNecessary();
+    }
+    updateStatistics();
+}
+
+void _CpuSimulationFacade::runSimulation()
+{
+    _simRunTimePoint = std::chrono::system_clock::now();
+    {
+        std::lock_guard lock(_runMutex);
+        _isSimulationRunning.store(true);
+    }
+    _runCondition.notify_all();
+}
+
+void _CpuSimulationFacade::pauseSimulation()
+{
+    _isSimulationRunning.store(false);
+
+    //wait until the current time step is finished
+    std::lock_guard lock(_mutex);
+
+    _realTime = getRealTime();
+    _simRunTimePoint.reset();
+}
+
+void _CpuSimulationFacade::applyCataclysm(int power)
+{
+    throwNotSupported("Cataclysm");
+}
+
+bool _CpuSimulationFacade::isSimulationRunning() const
+{
+    return _isSimulationRunning.load();
+}
+
+void _CpuSimulationFacade::closeSimulation()
+{
+    {
+        std::lock_guard lock(_runMutex);
+        _isShutdown.store(true);
+    }
+    _runCondition.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    _isSimulationRunning.store(false);
+}
+
+uint64_t _CpuSimulationFacade::getCurrentTimestep() const
+{
+    std::lock_guard lock(_mutex);
+    return _data.timestep;
+}
+
+void _CpuSimulationFacade::setCurrentTimestep(uint64_t value)
+{
+    {
+        std::lock_guard lock(_mutex);
+        _data.timestep = value;
+    }
+    _statisticsHistory.resetTime(value);
+}
+
+std::chrono::milliseconds _CpuSimulationFacade::getRealTime() const
+{
+    if (_simRunTimePoint) {
+        return _realTime + std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - *_simRunTimePoint);
+    } else {
+        return _realTime;
+    }
+}
+
+void _CpuSimulationFacade::setRealTime(std::chrono::milliseconds const& value)
+{
+    _realTime = value;
+    if (_simRunTimePoint) {
+        _simRunTimePoint = std::chrono::system_clock::now();
+    }
+}
+
+SimulationParameters _CpuSimulationFacade::getSimulationParameters() const
+{
+    std::lock_guard lock(_mutex);
+    return _data.parameters;
+}
+
+SimulationParameters const& _CpuSimulationFacade::getOriginalSimulationParameters() const
+{
+    return _origSettings.simulationParameters;
+}
+
+void _CpuSimulationFacade::setSimulationParameters(SimulationParameters const& parameters, SimulationParametersUpdateConfig const& updateConfig)
+{
+    std::lock_guard lock(_mutex);
+    if (updateConfig == SimulationParametersUpdateConfig::AllExceptChangingPositions) {
+        auto origParameters = _data.parameters;
+        _data.parameters = parameters;
+        for (int i = 0; i < std::min(origParameters.numZones, _data.parameters.numZones); ++i) {
+            _data.parameters.zone[i].posX = origParameters.zone[i].posX;
+            _data.parameters.zone[i].posY = origParameters.zone[i].posY;
+        }
+    } else {
+        _data.parameters = parameters;
+    }
+    _kernelsLauncher.prepareForSimulationParametersChanges(_data);
+}
+
+void _CpuSimulationFacade::setOriginalSimulationParameters(SimulationParameters const& parameters)
+{
+    _origSettings.simulationParameters = parameters;
+}
+
+GpuSettings _CpuSimulationFacade::getGpuSettings() const
+{
+    return _gpuSettings;
+}
+
+GpuSettings _CpuSimulationFacade::getOriginalGpuSettings() const
+{
+    return _origSettings.gpuSettings;
+}
+
+void _CpuSimulationFacade::setGpuSettings_async(GpuSettings const& gpuSettings)
+{
+    _gpuSettings = gpuSettings;
+}
+
+void _CpuSimulationFacade::applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius)
+{
+    throwNotSupported("Applying forces");
+}
+
+void _CpuSimulationFacade::switchSelection(RealVector2D const& pos, float radius)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::swapSelection(RealVector2D const& pos, float radius)
+{
+    throwNotSupported("Selection");
+}
+
+SelectionShallowData _CpuSimulationFacade::getSelectionShallowData()
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::setSelection(RealVector2D const& startPos, RealVector2D const& endPos)
+{
+    throwNotSupported("Selection");
+}
+
+void _CpuSimulationFacade::removeSelection() {}
+
+bool _CpuSimulationFacade::updateSelectionIfNecessary()
+{
+    return false;
+}
+
+GeneralSettings _CpuSimulationFacade::getGeneralSettings() const
+{
+    return _generalSettings;
+}
+
+IntVector2D _CpuSimulationFacade::getWorldSize() const
+{
+    return {_generalSettings.worldSizeX, _generalSettings.worldSizeY};
+}
+
+RawStatisticsData _CpuSimulationFacade::getRawStatistics() const
+{
+    std::lock_guard lock(_mutex);
+    return _statisticsData;
+}
+
+StatisticsHistory const& _CpuSimulationFacade::getStatisticsHistory() const
+{
+    return _statisticsHistory;
+}
+
+void _CpuSimulationFacade::setStatisticsHistory(StatisticsHistoryData const& data)
+{
+    _statisticsHistory.rewrite(data, getCurrentTimestep());
+}
+
+std::optional<int> _CpuSimulationFacade::getTpsRestriction() const
+{
+    auto result = _tpsRestriction.load();
+    return 0 != result ? std::optional<int>(result) : std::optional<int>();
+}
+
+void _CpuSimulationFacade::setTpsRestriction(std::optional<int> const& value)
+{
+    _tpsRestriction.store(value ? *value : 0);
+}
+
+float _CpuSimulationFacade::getTps() const
+{
+    return _tps.load();
+}
+
+void _CpuSimulationFacade::setTimingSink(TimingSink const& sink)
+{
+    std::lock_guard lock(_mutex);
+    _timingSink = sink;
+    _kernelsLauncher.setTimingSink(sink);
+}
+
+void _CpuSimulationFacade::testOnly_mutate(uint64_t cellId, MutationType mutationType)
+{
+    throwNotSupported("Mutations");
+}
+
+void _CpuSimulationFacade::testOnly_mutationCheck(uint64_t cellId)
+{
+    throwNotSupported("Mutations");
+}
+
+std::vector<uint64_t>
+_CpuSimulationFacade::testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom)
+{
+    throwNotSupported("Rendering");
+}
+
+void _CpuSimulationFacade::runThreadLoop()
+{
+    while (true) {
+        {
+            std::unique_lock lock(_runMutex);
+            _runCondition.wait(lock, [this] { return _isSimulationRunning.load() || _isShutdown.load(); });
+        }
+        if (_isShutdown.load()) {
+            break;
+        }
+
+        auto startTimepoint = std::chrono::steady_clock::now();
+        calcTimestepAndMeasureTps();
+
+        auto tpsRestriction = _tpsRestriction.load();
+        if (tpsRestriction > 0) {
+            auto desiredDuration = std::chrono::microseconds(1000000 / tpsRestriction);
+            auto timestepDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTimepoint);
+            if (desiredDuration > timestepDuration) {
+                std::this_thread::sleep_for(desiredDuration - timestepDuration);
+            }
+        }
+    }
+    _tps.store(0);
+}
+
+void _CpuSimulationFacade::calcTimestepAndMeasureTps()
+{
+    {
+        std::lock_guard lock(_mutex);
+        if (!_isSimulationRunning.load()) {
+            _measureTimepoint.reset();
+            _tps.store(0);
+            return;
+        }
+        _kernelsLauncher.calcTimestep(_data);
+        updateStatisticsIfNecessary();
+    }
+
+    auto timepoint = std::chrono::steady_clock::now();
+    if (!_measureTimepoint) {
+        _measureTimepoint = timepoint;
+    } else {
+        int duration = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(timepoint - *_measureTimepoint).count());
+        if (duration > 199) {
+            _measureTimepoint = timepoint;
+            _tps.store(toFloat(_timestepsSinceMeasurement) * 1000 / duration);
+            _timestepsSinceMeasurement = 0;
+        }
+    }
+    ++_timestepsSinceMeasurement;
+}
+
+void _CpuSimulationFacade::updateStatistics()
+{
+    ScopedTiming timing(_timingSink, "statistics update");
+
+    //the garbage collector has already removed the deleted cells and particles
+    auto getCell = [&](int index) {
+        auto const& cell = _data.cells[index];
+        auto const& description = _data.cellDescriptions[index];
+        OfflineStatisticsService::CellInput result;
+        result.color = cell.color;
+        result.age = cell.age;
+        result.barrier = cell.barrier;
+        result.mutationId = static_cast<uint32_t>(cell.mutationId);
+        result.energy = cell.energy;
+        result.genomeComplexity = description.genomeComplexity;
+        result.cellFunction = description.getCellFunctionType();
+        if (result.cellFunction == CellFunction_Constructor) {
+            auto const& genome = std::get<ConstructorDescription>(*description.cellFunction).genome;
+            result.genome = genome.data();
+            result.genomeSize = toInt(genome.size());
+        } else if (result.cellFunction == CellFunction_Injector) {
+            auto const& genome = std::get<InjectorDescription>(*description.cellFunction).genome;
+            result.genome = genome.data();
+            result.genomeSize = toInt(genome.size());
+        }
+        return result;
+    };
+    auto getParticle = [&](int index) {
+        auto const& particle = _data.particles[index];
+        return OfflineStatisticsService::ParticleInput{particle.color, particle.energy};
+    };
+    _statisticsData = OfflineStatisticsService::get().calcStatistics(
+        toInt(_data.cells.size()), getCell, toInt(_data.particles.size()), getParticle, _data.maxThreads);
+    _lastStatisticsUpdateTime = std::chrono::steady_clock::now();
+
+    _statisticsHistory.addDataPoint(_statisticsData.timeline, _data.timestep);
+}
+
+void _CpuSimulationFacade::updateStatisticsIfNecessary()
+{
+    if (!_lastStatisticsUpdateTime || std::chrono::steady_clock::now() - *_lastStatisticsUpdateTime > StatisticsUpdate) {
+        updateStatistics();
+    }
+}
+
+void _CpuSimulationFacade::throwNotSupported(std::string const& operation) const
+{
+    throw std::runtime_error(operation + " is not supported by the CPU simulation backend.");
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "EngineInterface/Definitions.h"
+#include "EngineInterface/RawStatisticsData.h"
+#include "EngineInterface/Settings.h"
+#include "EngineInterface/SimulationFacade.h"
+#include "EngineInterface/StatisticsHistory.h"
+
+#include "CpuSimulationData.h"
+#include "CpuSimulationKernelsLauncher.h"
+
+//reference implementation of the simulation facade which runs the physics of the time step pipeline on host threads
+//operations which depend on the GPU (rendering, selections, cell functions for tests) throw std::runtime_error
+class _CpuSimulationFacade : public _SimulationFacade
+{
+public:
+    explicit _CpuSimulationFacade(int maxThreads = 0, uint32_t randomSeed = 0);  //maxThreads = 0: number of hardware threads
+    ~_CpuSimulationFacade() override;
+
+    void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters) override;
+    int getSessionId() const override;
+
+    void clear() override;
+
+    void setImageResource(void* image) override;
+    std::string getGpuName() const override;
+
+    void tryDrawVectorGraphics(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom) override;
+    std::optional<OverlayDescription> tryDrawVectorGraphicsAndReturnOverlay(
+        RealVector2D const& rectUpperLeft,
+        RealVector2D const& rectLowerRight,
+        IntVector2D const& imageSize,
+        double zoom) override;
+
+    bool isSyncSimulationWithRendering() const override;
+    void setSyncSimulationWithRendering(bool value) override;
+    int getSyncSimulationWithRenderingRatio() const override;
+    void setSyncSimulationWithRenderingRatio(int value) override;
+
+    ClusteredDataDescription getClusteredSimulationData() override;
+    DataDescription getSimulationData() override;
+    ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters) override;
+    DataDescription getSelectedSimulationData(bool includeClusters) override;
+    DataDescription getInspectedSimulationData(std::vector<uint64_t> objectIds, InspectedPayloads const& payloads) override;
+
+    void addAndSelectSimulationData(DataDescription const& dataToAdd) override;
+    void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) override;
+    void setSimulationData(DataDescription const& dataToUpdate) override;
+    void removeSelectedObjects(bool includeClusters) override;
+    void relaxSelectedObjects(bool includeClusters) override;
+    void uniformVelocitiesForSelectedObjects(bool includeClusters) override;
+    void makeSticky(bool includeClusters) override;
+    void removeStickiness(bool includeClusters) override;
+    void setBarrier(bool value, bool includeClusters) override;
+    void colorSelectedObjects(unsigned char color, bool includeClusters) override;
+    void reconnectSelectedObjects() override;
+    void setDetached(bool value) override;
+    void changeCell(CellDescription const& changedCell) override;
+    void changeParticle(ParticleDescription const& changedParticle) override;
+
+    void calcTimesteps(uint64_t timesteps) override;
+    void runSimulation() override;
+    void pauseSimulation() override;
+    void applyCataclysm(int power) override;
+
+    bool isSimulationRunning() const override;
+
+    void closeSimulation() override;
+
+    uint64_t getCurrentTimestep() const override;
+    void setCurrentTimestep(uint64_t value) override;
+
+    std::chrono::milliseconds getRealTime() const override;
+    void setRealTime(std::chrono::milliseconds const& value) override;
+
+    SimulationParameters getSimulationParameters() const override;
+    SimulationParameters const& getOriginalSimulationParameters() const override;
+    void setSimulationParameters(
+        SimulationParameters const& parameters,
+        SimulationParametersUpdateConfig const& updateConfig = SimulationParametersUpdateConfig::All) override;
+    void setOriginalSimulationParameters(SimulationParameters const& parameters) override;
+
+    GpuSettings getGpuSettings() const override;
+    GpuSettings getOriginalGpuSettings() const override;
+    void setGpuSettings_async(GpuSettings const& gpuSettings) override;
+
+    void applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius) override;
+
+    void switchSelection(RealVector2D const& pos, float radius) override;
+    void swapSelection(RealVector2D const& pos, float radius) override;
+    SelectionShallowData getSelectionShallowData() override;
+    void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData) override;
+    void setSelection(RealVector2D const& startPos, RealVector2D const& endPos) override;
+    void removeSelection() override;
+    bool updateSelectionIfNecessary() override;
+
+    GeneralSettings getGeneralSettings() const override;
+    IntVector2D getWorldSize() const override;
+    RawStatisticsData getRawStatistics() const override;
+    StatisticsHistory const& getStatisticsHistory() const override;
+    void setStatisticsHistory(StatisticsHistoryData const& data) override;
+
+    std::optional<int> getTpsRestriction() const override;
+    void setTpsRestriction(std::optional<int> const& value) override;
+
+    float getTps() const override;
+
+    void setTimingSink(TimingSink const& sink) override;
+
+    // for tests only
+    void testOnly_mutate(uint64_t cellId, MutationType mutationType) override;
+    void testOnly_mutationCheck(uint64_t cellId) override;
+    std::vector<uint64_t>
+    testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom) override;
+
+private:
+    void runThreadLoop();
+    void calcTimestepAndMeasureTps();
+    void updateStatistics();  //requires _mutex
+    void updateStatisticsIfNecessary();  //requires _mutex
+    [[noreturn]] void throwNotSupported(std::string const& operation) const;
+
+    int _maxThreads = 0;
+    uint32_t _randomSeed = 0;
+    int _sessionId = 0;
+
+    Settings _origSettings;
+    GeneralSettings _generalSettings;
+    GpuSettings _gpuSettings;
+    std::chrono::milliseconds _realTime;
+    std::optional<std::chrono::time_point<std::chrono::system_clock>> _simRunTimePoint;
+    StatisticsHistory _statisticsHistory;
+    bool _syncSimulationWithRendering = false;
+    int _syncSimulationWithRenderingRatio = 2;
+
+    mutable std::mutex _mutex;  //protects _data and _statisticsData
+    CpuSimulationData _data;
+    RawStatisticsData _statisticsData;
+    std::optional<std::chrono::steady_clock::time_point> _lastStatisticsUpdateTime;
+    CpuSimulationKernelsLauncher _kernelsLauncher;
+    TimingSink _timingSink;
+
+    std::thread _thread;
+    std::mutex _runMutex;
+    std::condition_variable _runCondition;
+    std::atomic<bool> _isSimulationRunning = false;
+    std::atomic<bool> _isShutdown = false;
+    std::atomic<int> _tpsRestriction = 0;
+    std::atomic<float> _tps = 0;
+
+    //for measuring the time steps per second
+    std::optional<std::chrono::steady_clock::time_point> _measureTimepoint;
+    int _timestepsSinceMeasurement = 0;
+};
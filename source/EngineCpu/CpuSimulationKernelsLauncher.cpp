@@ -0,0 +1,78 @@
+#include "CpuSimulationKernelsLauncher.h"
+
+#include "EngineInterface/TimingSink.h"
+
+#include "CpuCellConnectionProcessor.h"
+#include "CpuCellProcessor.h"
+#include "CpuGarbageCollector.h"
+
+void CpuSimulationKernelsLauncher::calcTimestep(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+
+    //not all kernels need to be executed in each time step for performance reasons
+    bool considerForcesFromAngleDifferences = (data.timestep % 3 == 0);
+    bool considerInnerFriction = (data.timestep % 3 == 0);
+
+    {
+        ScopedTiming timing(_timingSink, "preparation and maps");
+        CpuCellProcessor::init(data);
+        CpuCellProcessor::updateMap(data);
+    }
+    {
+        ScopedTiming timing(_timingSink, "physics: forces");
+        if (parameters.motionType == MotionType_Fluid) {
+            CpuCellProcessor::calcFluidForces_reconnectCells_correctOverlap(data);
+        } else {
+            CpuCellProcessor::calcCollisions_reconnectCells_correctOverlap(data);
+        }
+    }
+    {
+        ScopedTiming timing(_timingSink, "physics: integration");
+        CpuCellProcessor::checkForces(data);
+        CpuCellProcessor::applyForces(data);
+        CpuCellProcessor::particleMovement(data);
+
+        CpuCellProcessor::calcConnectionForces(data, considerForcesFromAngleDifferences);
+        CpuCellProcessor::verletPositionUpdate(data);
+        CpuCellProcessor::checkConnections(data);
+        CpuCellProcessor::calcConnectionForces(data, considerForcesFromAngleDifferences);
+        CpuCellProcessor::verletVelocityUpdate(data);
+    }
+    {
+        ScopedTiming timing(_timingSink, "aging and living states");
+        CpuCellProcessor::aging(data);
+        CpuCellProcessor::livingStateTransition(data);
+    }
+    {
+        ScopedTiming timing(_timingSink, "physics: friction");
+        if (considerInnerFriction) {
+            CpuCellProcessor::applyInnerFriction(data);
+        }
+        CpuCellProcessor::applyFriction(data);
+    }
+    {
+        ScopedTiming timing(_timingSink, "structural operations");
+        CpuCellProcessor::decay(data);
+
+        CpuCellConnectionProcessor::processAddOperations(data);
+        CpuCellConnectionProcessor::processDeleteCellOperations(data);
+        CpuCellConnectionProcessor::processDeleteConnectionOperations(data);
+    }
+    {
+        ScopedTiming timing(_timingSink, "garbage collection");
+        CpuGarbageCollector::cleanupAfterTimestep(data);
+    }
+
+    ++data.timestep;
+}
+
+void CpuSimulationKernelsLauncher::prepareForSimulationParametersChanges(CpuSimulationData& data)
+{
+    CpuCellProcessor::resetDensity(data);
+}
+
+void CpuSimulationKernelsLauncher::setTimingSink(TimingSink const& sink)
+{
+    _timingSink = sink;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "EngineInterface/Definitions.h"
+
+#include "CpuSimulationData.h"
+
+//host counterpart of _SimulationKernelsLauncher::calcTimestep
+//ported: cell map, fluid/collision forces, verlet integration, connection forces, friction, aging, living state transitions, decay,
+//structural operations, particle movement and garbage collection
+//not ported: cell functions, mutations, radiation, particle collisions, rigidity and flow fields
+class CpuSimulationKernelsLauncher
+{
+public:
+    void calcTimestep(CpuSimulationData& data);
+    void prepareForSimulationParametersChanges(CpuSimulationData& data);
+
+    void setTimingSink(TimingSink const& sink);
+
+private:
+    TimingSink _timingSink;
+};
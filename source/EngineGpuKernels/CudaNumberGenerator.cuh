@@ -7,11 +7,17 @@
 
 #include <cuda/helper_cuda.h>
 
+#include "Base/RandomStream.h"
+
 #include "Array.cuh"
 #include "CudaMemoryManager.cuh"
 #include "Base.cuh"
 #include "Definitions.cuh"
 
+//in the default mode all threads draw from a shared array of random numbers, i.e. the assignment of numbers to threads depends on the scheduling
+//in the deterministic mode each thread draws from its own counter-based stream (see RandomStream on the host) such that the numbers only depend
+//on the seed, the thread index and the number of previous draws of the thread
+//the counters are sized by reserveThreadCounters for the largest kernel launch such that each counter is owned by exactly one thread
 class CudaNumberGenerator
 {
 private:
@@ -22,13 +28,22 @@ private:
     unsigned long long int* _currentId;
     unsigned int* _currentSmallId;
 
+    bool _deterministic;
+    unsigned long long int _mixedSeed;
+    unsigned long long int* _threadCounters;
+    unsigned long long int _numThreadCounters;
+
 public:
-    void init(int size)
+    void init(int size, uint32_t seed = 0, bool deterministic = false)
     {
         _size = size;
+        _deterministic = deterministic;
+        _mixedSeed = RandomStream::mix(seed);
+        _array = nullptr;
+        _threadCounters = nullptr;
+        _numThreadCounters = 0;
 
         CudaMemoryManager::getInstance().acquireMemory<unsigned int>(1, _currentIndex);
-        CudaMemoryManager::getInstance().acquireMemory<int>(size, _array);
         CudaMemoryManager::getInstance().acquireMemory<unsigned long long int>(1, _currentId);
         CudaMemoryManager::getInstance().acquireMemory<unsigned int>(1, _currentSmallId);
 
@@ -38,13 +53,33 @@ public:
         unsigned int hostCurrentSmallId = 1;
         CHECK_FOR_CUDA_ERROR(cudaMemcpy(_currentSmallId, &hostCurrentSmallId, sizeof(unsigned int), cudaMemcpyHostToDevice));
 
-        std::vector<int> randomNumbers(size);
-        for (int i = 0; i < size; ++i) {
-            randomNumbers[i] = rand();
+        if (!deterministic) {
+            CudaMemoryManager::getInstance().acquireMemory<int>(size, _array);
+            std::vector<int> randomNumbers(size);
+            for (int i = 0; i < size; ++i) {
+                randomNumbers[i] = rand();
+            }
+            CHECK_FOR_CUDA_ERROR(cudaMemcpy(_array, randomNumbers.data(), sizeof(int) * size, cudaMemcpyHostToDevice));
         }
-        CHECK_FOR_CUDA_ERROR(cudaMemcpy(_array, randomNumbers.data(), sizeof(int) * size, cudaMemcpyHostToDevice));
     }
 
+    //only needed in the deterministic mode, grows the counters to numThreads while keeping the existing ones
+    void reserveThreadCounters(unsigned long long int numThreads)
+    {
+        if (!_deterministic || numThreads <= _numThreadCounters) {
+            return;
+        }
+        unsigned long long int* threadCounters;
+        CudaMemoryManager::getInstance().acquireMemory<unsigned long long int>(numThreads, threadCounters);
+        CHECK_FOR_CUDA_ERROR(cudaMemset(threadCounters, 0, sizeof(unsigned long long int) * numThreads));
+        if (_threadCounters) {
+            CHECK_FOR_CUDA_ERROR(
+                cudaMemcpy(threadCounters, _threadCounters, sizeof(unsigned long long int) * _numThreadCounters, cudaMemcpyDeviceToDevice));
+            CudaMemoryManager::getInstance().freeMemory(_threadCounters);
+        }
+        _threadCounters = threadCounters;
+        _numThreadCounters = numThreads;
+    }
 
     __device__ __inline__ int random(int maxVal)
     {
@@ -93,12 +128,40 @@ public:
         CudaMemoryManager::getInstance().freeMemory(_array);
         CudaMemoryManager::getInstance().freeMemory(_currentId);
         CudaMemoryManager::getInstance().freeMemory(_currentSmallId);
+        CudaMemoryManager::getInstance().freeMemory(_threadCounters);
     }
 
 private:
     __device__ __inline__ int getRandomNumber()
     {
+        if (_deterministic) {
+            return getRandomNumberFromStream();
+        }
         int index = atomicInc(_currentIndex, _size - 1);
         return _array[index];
     }
+
+    //same values as RandomStream(seed, stream = thread index).getRandomInt() reduced to [0, RAND_MAX]
+    __device__ __inline__ int getRandomNumberFromStream()
+    {
+        auto threadIndex = static_cast<unsigned long long int>(blockIdx.x) * blockDim.x + threadIdx.x;
+        CUDA_CHECK(threadIndex < _numThreadCounters);
+
+        //the counter of a thread is only accessed by the thread itself
+        auto counter = _threadCounters[threadIndex]++;
+        auto state = mix(_mixedSeed ^ calcStreamOffset(threadIndex));
+        return static_cast<int>((mix(state + (counter + 1) * 0x9e3779b97f4a7c15ull) >> 32) % (static_cast<unsigned long long int>(RAND_MAX) + 1));
+    }
+
+    __device__ __inline__ static unsigned long long int calcStreamOffset(unsigned long long int stream)
+    {
+        return stream * 0xd1b54a32d192ed03ull + 0x8bb84b93962eacc9ull;
+    }
+
+    __device__ __inline__ static unsigned long long int mix(unsigned long long int z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
 };
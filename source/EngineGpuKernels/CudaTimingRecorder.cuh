@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "EngineInterface/TimingSink.h"
+
+#include "Macros.cuh"
+
+//measures the GPU durations of consecutive phases with CUDA events such that the kernel launches remain asynchronous
+//the events are evaluated (and the device synchronized) only in finish() and only if a timing sink is installed
+class CudaTimingRecorder
+{
+public:
+    ~CudaTimingRecorder();
+
+    void setTimingSink(TimingSink const& sink);
+
+    void start();
+    void endPhase(char const* phase);
+    void finish();
+
+private:
+    void recordEvent();
+
+    TimingSink _sink;
+    std::vector<cudaEvent_t> _events;  //reused over time steps
+    std::vector<char const*> _phases;
+    int _numRecordedEvents = 0;
+};
+
+/**
+ * Implementations
+ */
+
+inline CudaTimingRecorder::~CudaTimingRecorder()
+{
+    for (auto const& event : _events) {
+        cudaEventDestroy(event);
+    }
+}
+
+inline void CudaTimingRecorder::setTimingSink(TimingSink const& sink)
+{
+    _sink = sink;
+}
+
+inline void CudaTimingRecorder::start()
+{
+    if (!_sink) {
+        return;
+    }
+    _numRecordedEvents = 0;
+    _phases.clear();
+    recordEvent();
+}
+
+inline void CudaTimingRecorder::endPhase(char const* phase)
+{
+    if (!_sink || _numRecordedEvents == 0) {
+        return;
+    }
+    _phases.emplace_back(phase);
+    recordEvent();
+}
+
+inline void CudaTimingRecorder::finish()
+{
+    if (!_sink || _numRecordedEvents == 0) {
+        return;
+    }
+    CHECK_FOR_CUDA_ERROR(cudaEventSynchronize(_events.at(_numRecordedEvents - 1)));
+    for (int i = 0; i < _numRecordedEvents - 1; ++i) {
+        float durationMs = 0;
+        CHECK_FOR_CUDA_ERROR(cudaEventElapsedTime(&durationMs, _events.at(i), _events.at(i + 1)));
+        _sink->addTiming(_phases.at(i), durationMs);
+    }
+    _numRecordedEvents = 0;
+}
+
+inline void CudaTimingRecorder::recordEvent()
+{
+    if (_numRecordedEvents == toInt(_events.size())) {
+        cudaEvent_t event;
+        CHECK_FOR_CUDA_ERROR(cudaEventCreate(&event));
+        _events.emplace_back(event);
+    }
+    CHECK_FOR_CUDA_ERROR(cudaEventRecord(_events.at(_numRecordedEvents)));
+    ++_numRecordedEvents;
+}
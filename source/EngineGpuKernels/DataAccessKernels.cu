@@ -15,7 +15,7 @@ namespace
         }
     }
 
-    __device__ void createCellTO(Cell* cell, DataTO& dataTO, Cell* cellArrayStart)
+    __device__ void createCellTO(Cell* cell, DataTO& dataTO, Cell* cellArrayStart, InspectedPayloads const& payloads = InspectedPayloads())
     {
         auto cellTOIndex = alienAtomicAdd64(dataTO.numCells, uint64_t(1));
         auto& cellTO = dataTO.cells[cellTOIndex];
@@ -49,20 +49,25 @@ namespace
         cellTO.detectedByCreatureId = cell->detectedByCreatureId;
         cellTO.cellFunctionUsed = cell->cellFunctionUsed;
 
-        copyAuxiliaryData(
-            cell->metadata.nameSize,
-            cell->metadata.name,
-            cellTO.metadata.nameSize,
-            cellTO.metadata.nameDataIndex,
-            *dataTO.numAuxiliaryData,
-            dataTO.auxiliaryData);
-        copyAuxiliaryData(
-            cell->metadata.descriptionSize,
-            cell->metadata.description,
-            cellTO.metadata.descriptionSize,
-            cellTO.metadata.descriptionDataIndex,
-            *dataTO.numAuxiliaryData,
-            dataTO.auxiliaryData);
+        if (payloads.metadata) {
+            copyAuxiliaryData(
+                cell->metadata.nameSize,
+                cell->metadata.name,
+                cellTO.metadata.nameSize,
+                cellTO.metadata.nameDataIndex,
+                *dataTO.numAuxiliaryData,
+                dataTO.auxiliaryData);
+            copyAuxiliaryData(
+                cell->metadata.descriptionSize,
+                cell->metadata.description,
+                cellTO.metadata.descriptionSize,
+                cellTO.metadata.descriptionDataIndex,
+                *dataTO.numAuxiliaryData,
+                dataTO.auxiliaryData);
+        } else {
+            cellTO.metadata.nameSize = 0;
+            cellTO.metadata.descriptionSize = 0;
+        }
 
         cell->tag = cellTOIndex;
         for (int i = 0; i < cell->numConnections; ++i) {
@@ -74,14 +79,16 @@ namespace
 
         switch (cell->cellFunction) {
         case CellFunction_Neuron: {
-            int targetSize;    //not used
-            copyAuxiliaryData<int>(
-                sizeof(NeuronFunction::NeuronState),
-                reinterpret_cast<uint8_t*>(cell->cellFunctionData.neuron.neuronState),
-                targetSize,
-                cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex,
-                *dataTO.numAuxiliaryData,
-                dataTO.auxiliaryData);
+            if (payloads.neuronData) {
+                int targetSize;  //not used
+                copyAuxiliaryData<int>(
+                    sizeof(NeuronFunction::NeuronState),
+                    reinterpret_cast<uint8_t*>(cell->cellFunctionData.neuron.neuronState),
+                    targetSize,
+                    cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex,
+                    *dataTO.numAuxiliaryData,
+                    dataTO.auxiliaryData);
+            }
             for (int i = 0; i < MAX_CHANNELS; ++i) {
                 cellTO.cellFunctionData.neuron.activationFunctions[i] = cell->cellFunctionData.neuron.activationFunctions[i];
             }
@@ -92,13 +99,17 @@ namespace
         case CellFunction_Constructor: {
             cellTO.cellFunctionData.constructor.activationMode = cell->cellFunctionData.constructor.activationMode;
             cellTO.cellFunctionData.constructor.constructionActivationTime = cell->cellFunctionData.constructor.constructionActivationTime;
-            copyAuxiliaryData(
-                cell->cellFunctionData.constructor.genomeSize,
-                cell->cellFunctionData.constructor.genome,
-                cellTO.cellFunctionData.constructor.genomeSize,
-                cellTO.cellFunctionData.constructor.genomeDataIndex,
-                *dataTO.numAuxiliaryData,
-                dataTO.auxiliaryData);
+            if (payloads.genomeData) {
+                copyAuxiliaryData(
+                    cell->cellFunctionData.constructor.genomeSize,
+                    cell->cellFunctionData.constructor.genome,
+                    cellTO.cellFunctionData.constructor.genomeSize,
+                    cellTO.cellFunctionData.constructor.genomeDataIndex,
+                    *dataTO.numAuxiliaryData,
+                    dataTO.auxiliaryData);
+            } else {
+                cellTO.cellFunctionData.constructor.genomeSize = 0;
+            }
             cellTO.cellFunctionData.constructor.numInheritedGenomeNodes = cell->cellFunctionData.constructor.numInheritedGenomeNodes;
             cellTO.cellFunctionData.constructor.lastConstructedCellId = cell->cellFunctionData.constructor.lastConstructedCellId;
             cellTO.cellFunctionData.constructor.genomeCurrentNodeIndex = cell->cellFunctionData.constructor.genomeCurrentNodeIndex;
@@ -132,13 +143,17 @@ namespace
         case CellFunction_Injector: {
             cellTO.cellFunctionData.injector.mode = cell->cellFunctionData.injector.mode;
             cellTO.cellFunctionData.injector.counter = cell->cellFunctionData.injector.counter;
-            copyAuxiliaryData(
-                cell->cellFunctionData.injector.genomeSize,
-                cell->cellFunctionData.injector.genome,
-                cellTO.cellFunctionData.injector.genomeSize,
-                cellTO.cellFunctionData.injector.genomeDataIndex,
-                *dataTO.numAuxiliaryData,
-                dataTO.auxiliaryData);
+            if (payloads.genomeData) {
+                copyAuxiliaryData(
+                    cell->cellFunctionData.injector.genomeSize,
+                    cell->cellFunctionData.injector.genome,
+                    cellTO.cellFunctionData.injector.genomeSize,
+                    cellTO.cellFunctionData.injector.genomeDataIndex,
+                    *dataTO.numAuxiliaryData,
+                    dataTO.auxiliaryData);
+            } else {
+                cellTO.cellFunctionData.injector.genomeSize = 0;
+            }
             cellTO.cellFunctionData.injector.genomeGeneration = cell->cellFunctionData.injector.genomeGeneration;
         } break;
         case CellFunction_Muscle: {
@@ -210,7 +225,7 @@ __global__ void cudaGetSelectedParticleData(SimulationData data, DataTO access)
     }
 }
 
-__global__ void cudaGetInspectedCellDataWithoutConnections(InspectedEntityIds ids, SimulationData data, DataTO dataTO)
+__global__ void cudaGetInspectedCellDataWithoutConnections(InspectedEntityIds ids, InspectedPayloads payloads, SimulationData data, DataTO dataTO)
 {
     auto const& cells = data.objects.cellPointers;
     auto const partition = calcAllThreadsPartition(cells.getNumEntries());
@@ -233,7 +248,7 @@ __global__ void cudaGetInspectedCellDataWithoutConnections(InspectedEntityIds id
             continue;
         }
 
-        createCellTO(cell, dataTO, cellArrayStart);
+        createCellTO(cell, dataTO, cellArrayStart, payloads);
     }
 }
 
@@ -16,7 +16,7 @@
 //tags cell with cellTO index and tags cellTO connections with cell index
 __global__ void cudaGetSelectedCellDataWithoutConnections(SimulationData data, bool includeClusters, DataTO dataTO);
 __global__ void cudaGetSelectedParticleData(SimulationData data, DataTO access);
-__global__ void cudaGetInspectedCellDataWithoutConnections(InspectedEntityIds ids, SimulationData data, DataTO dataTO);
+__global__ void cudaGetInspectedCellDataWithoutConnections(InspectedEntityIds ids, InspectedPayloads payloads, SimulationData data, DataTO dataTO);
 __global__ void cudaGetInspectedParticleData(InspectedEntityIds ids, SimulationData data, DataTO access);
 __global__ void cudaGetOverlayData(int2 rectUpperLeft, int2 rectLowerRight, SimulationData data, DataTO dataTO);
 __global__ void cudaGetCellDataWithoutConnections(int2 rectUpperLeft, int2 rectLowerRight, SimulationData data, DataTO dataTO);
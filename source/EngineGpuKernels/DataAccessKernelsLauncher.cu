@@ -40,10 +40,11 @@ void _DataAccessKernelsLauncher::getInspectedData(
     GpuSettings const& gpuSettings,
     SimulationData const& data,
     InspectedEntityIds entityIds,
+    InspectedPayloads payloads,
     DataTO const& dataTO)
 {
     KERNEL_CALL_1_1(cudaClearDataTO, dataTO);
-    KERNEL_CALL(cudaGetInspectedCellDataWithoutConnections, entityIds, data, dataTO);
+    KERNEL_CALL(cudaGetInspectedCellDataWithoutConnections, entityIds, payloads, data, dataTO);
     KERNEL_CALL(cudaResolveConnections, data, dataTO);
     KERNEL_CALL(cudaGetInspectedParticleData, entityIds, data, dataTO);
 }
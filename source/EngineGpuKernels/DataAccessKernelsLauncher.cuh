@@ -15,7 +15,12 @@ public:
 
     void getData(GpuSettings const& gpuSettings, SimulationData const& data, int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
     void getSelectedData(GpuSettings const& gpuSettings, SimulationData const& data, bool includeClusters, DataTO const& dataTO);
-    void getInspectedData(GpuSettings const& gpuSettings, SimulationData const& data, InspectedEntityIds entityIds, DataTO const& dataTO);
+    void getInspectedData(
+        GpuSettings const& gpuSettings,
+        SimulationData const& data,
+        InspectedEntityIds entityIds,
+        InspectedPayloads payloads,
+        DataTO const& dataTO);
     void getOverlayData(GpuSettings const& gpuSettings, SimulationData const& data, int2 rectUpperLeft, int2 rectLowerRight, DataTO const& dataTO);
 
     void addData(GpuSettings const& gpuSettings, SimulationData const& data, DataTO const& dataTO, bool selectData, bool createIds);
@@ -17,6 +17,7 @@
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineInterface/GpuSettings.h"
 #include "EngineInterface/SpaceCalculator.h"
+#include "EngineInterface/TimingSink.h"
 
 #include "DataAccessKernels.cuh"
 #include "TOs.cuh"
@@ -40,7 +41,6 @@
 #include "RenderingData.cuh"
 #include "SimulationParametersUpdateService.cuh"
 #include "TestKernelsLauncher.cuh"
-#include "StatisticsService.cuh"
 #include "MaxAgeBalancer.cuh"
 
 namespace
@@ -66,7 +66,7 @@ _SimulationCudaFacade::_SimulationCudaFacade(uint64_t timestep, Settings const&
     _cudaSimulationStatistics = std::make_shared<SimulationStatistics>();
     _maxAgeBalancer = std::make_shared<_MaxAgeBalancer>();
 
-    _cudaSimulationData->init({settings.generalSettings.worldSizeX, settings.generalSettings.worldSizeY}, timestep);
+    _cudaSimulationData->init({settings.generalSettings.worldSizeX, settings.generalSettings.worldSizeY}, timestep, settings.gpuSettings);
     _cudaRenderingData->init();
     _cudaSimulationStatistics->init();
     _cudaSelectionResult->init();
@@ -84,6 +84,7 @@ _SimulationCudaFacade::_SimulationCudaFacade(uint64_t timestep, Settings const&
 
     //default array sizes for empty simulation (will be resized later if not sufficient)
     resizeArrays({100000, 100000, 100000});
+    reserveRandomNumberStreams();
 }
 
 _SimulationCudaFacade::~_SimulationCudaFacade()
@@ -128,13 +129,19 @@ void* _SimulationCudaFacade::registerImageResource(GLuint image)
 void _SimulationCudaFacade::calcTimestep(uint64_t timesteps, bool forceUpdateStatistics)
 {
     for (uint64_t i = 0; i < timesteps; ++i) {
-        checkAndProcessSimulationParameterChanges();
+        {
+            ScopedTiming timing(_timingSink, "simulation parameter changes");
+            checkAndProcessSimulationParameterChanges();
+        }
 
         auto simulationData = getSimulationDataIntern();
         _simulationKernels->calcTimestep(_settings, simulationData, *_cudaSimulationStatistics);
         syncAndCheck();
 
-        automaticResizeArrays();
+        {
+            ScopedTiming timing(_timingSink, "array resizing");
+            automaticResizeArrays();
+        }
 
         {
             std::lock_guard lock(_mutexForSimulationData);
@@ -142,10 +149,10 @@ void _SimulationCudaFacade::calcTimestep(uint64_t timesteps, bool forceUpdateSta
         }
         auto statistics = getRawStatistics();
         {
+            ScopedTiming timing(_timingSink, "simulation parameter adaptions");
             std::lock_guard lock(_mutexForSimulationParameters);
             if (SimulationParametersUpdateService::get().updateSimulationParametersAfterTimestep(_settings, _maxAgeBalancer, simulationData, statistics)) {
-                CHECK_FOR_CUDA_ERROR(
-                    cudaMemcpyToSymbol(cudaSimulationParameters, &_settings.simulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+                SimulationParametersUpdateService::get().copyToConstantMemory(_settings.simulationParameters, _simulationParametersOnDevice);
             }
         }
         auto now = std::chrono::steady_clock::now();
@@ -207,6 +214,7 @@ void _SimulationCudaFacade::getSimulationData(
     int2 const& rectLowerRight,
     DataTO const& dataTO)
 {
+    ScopedTiming timing(_timingSink, "data access: get data");
     _dataAccessKernels->getData(_settings.gpuSettings, getSimulationDataIntern(), rectUpperLeft, rectLowerRight, *_cudaAccessTO);
     syncAndCheck();
 
@@ -215,17 +223,18 @@ void _SimulationCudaFacade::getSimulationData(
 
 void _SimulationCudaFacade::getSelectedSimulationData(bool includeClusters, DataTO const& dataTO)
 {
+    ScopedTiming timing(_timingSink, "data access: get selected data");
     _dataAccessKernels->getSelectedData(_settings.gpuSettings, getSimulationDataIntern(), includeClusters, *_cudaAccessTO);
     syncAndCheck();
 
     copyDataTOtoHost(dataTO);
 }
 
-void _SimulationCudaFacade::getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO)
+ArraySizes _SimulationCudaFacade::collectInspectedSimulationData(std::vector<uint64_t> entityIds, InspectedPayloads const& payloads)
 {
     InspectedEntityIds ids;
     if (entityIds.size() > Const::MaxInspectedObjects) {
-        return;
+        return ArraySizes();
     }
     for (int i = 0; i < entityIds.size(); ++i) {
         ids.values[i] = entityIds.at(i);
@@ -233,13 +242,21 @@ void _SimulationCudaFacade::getInspectedSimulationData(std::vector<uint64_t> ent
     if (entityIds.size() < Const::MaxInspectedObjects) {
         ids.values[entityIds.size()] = 0;
     }
-    _dataAccessKernels->getInspectedData(_settings.gpuSettings, getSimulationDataIntern(), ids, *_cudaAccessTO);
+    ScopedTiming timing(_timingSink, "data access: get inspected data");
+    _dataAccessKernels->getInspectedData(_settings.gpuSettings, getSimulationDataIntern(), ids, payloads, *_cudaAccessTO);
     syncAndCheck();
+
+    return {copyToHost(_cudaAccessTO->numCells), copyToHost(_cudaAccessTO->numParticles), copyToHost(_cudaAccessTO->numAuxiliaryData)};
+}
+
+void _SimulationCudaFacade::getInspectedSimulationData(DataTO const& dataTO)
+{
     copyDataTOtoHost(dataTO);
 }
 
 void _SimulationCudaFacade::getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
 {
+    ScopedTiming timing(_timingSink, "data access: get overlay data");
     _dataAccessKernels->getOverlayData(_settings.gpuSettings, getSimulationDataIntern(), rectUpperLeft, rectLowerRight, *_cudaAccessTO);
     syncAndCheck();
 
@@ -251,6 +268,7 @@ void _SimulationCudaFacade::getOverlayData(int2 const& rectUpperLeft, int2 const
 
 void _SimulationCudaFacade::addAndSelectSimulationData(DataTO const& dataTO)
 {
+    ScopedTiming timing(_timingSink, "data access: add data");
     copyDataTOtoDevice(dataTO);
     _editKernels->removeSelection(_settings.gpuSettings, getSimulationDataIntern());
     _dataAccessKernels->addData(_settings.gpuSettings, getSimulationDataIntern(), *_cudaAccessTO, true, true);
@@ -260,6 +278,7 @@ void _SimulationCudaFacade::addAndSelectSimulationData(DataTO const& dataTO)
 
 void _SimulationCudaFacade::setSimulationData(DataTO const& dataTO)
 {
+    ScopedTiming timing(_timingSink, "data access: set data");
     copyDataTOtoDevice(dataTO);
     _dataAccessKernels->clearData(_settings.gpuSettings, getSimulationDataIntern());
     _dataAccessKernels->addData(_settings.gpuSettings, getSimulationDataIntern(), *_cudaAccessTO, false, false);
@@ -393,6 +412,10 @@ void _SimulationCudaFacade::setGpuConstants(GpuSettings const& gpuConstants)
 
     CHECK_FOR_CUDA_ERROR(
         cudaMemcpyToSymbol(cudaThreadSettings, &gpuConstants, sizeof(GpuSettings), 0, cudaMemcpyHostToDevice));
+
+    if (_cudaSimulationData) {
+        reserveRandomNumberStreams();
+    }
 }
 
 SimulationParameters _SimulationCudaFacade::getSimulationParameters() const
@@ -429,6 +452,7 @@ RawStatisticsData _SimulationCudaFacade::getRawStatistics()
 
 void _SimulationCudaFacade::updateStatistics()
 {
+    ScopedTiming timing(_timingSink, "statistics update");
     _statisticsKernels->updateStatistics(_settings.gpuSettings, getSimulationDataIntern(), *_cudaSimulationStatistics);
     syncAndCheck();
 
@@ -436,7 +460,13 @@ void _SimulationCudaFacade::updateStatistics()
         std::lock_guard lock(_mutexForStatistics);
         _statisticsData = _cudaSimulationStatistics->getStatistics();
     }
-    StatisticsService::get().addDataPoint(_statisticsHistory, _statisticsData->timeline, getCurrentTimestep());
+    _statisticsHistory.addDataPoint(_statisticsData->timeline, getCurrentTimestep());
+}
+
+void _SimulationCudaFacade::setTimingSink(TimingSink const& sink)
+{
+    _timingSink = sink;
+    _simulationKernels->setTimingSink(sink);
 }
 
 StatisticsHistory const& _SimulationCudaFacade::getStatisticsHistory() const
@@ -446,7 +476,7 @@ StatisticsHistory const& _SimulationCudaFacade::getStatisticsHistory() const
 
 void _SimulationCudaFacade::setStatisticsHistory(StatisticsHistoryData const& data)
 {
-    StatisticsService::get().rewriteHistory(_statisticsHistory, data, getCurrentTimestep());
+    _statisticsHistory.rewrite(data, getCurrentTimestep());
 }
 
 void _SimulationCudaFacade::resetTimeIntervalStatistics()
@@ -466,7 +496,7 @@ void _SimulationCudaFacade::setCurrentTimestep(uint64_t timestep)
         std::lock_guard lock(_mutexForSimulationData);
         _cudaSimulationData->timestep = timestep;
     }
-    StatisticsService::get().resetTime(_statisticsHistory, timestep);
+    _statisticsHistory.resetTime(timestep);
 }
 
 void _SimulationCudaFacade::clear()
@@ -488,8 +518,7 @@ void _SimulationCudaFacade::testOnly_mutate(uint64_t cellId, MutationType mutati
         std::lock_guard lock(_mutexForSimulationParameters);
         if (_newSimulationParameters) {
             _settings.simulationParameters = *_newSimulationParameters;
-            CHECK_FOR_CUDA_ERROR(
-                cudaMemcpyToSymbol(cudaSimulationParameters, &*_newSimulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+            SimulationParametersUpdateService::get().copyToConstantMemory(_settings.simulationParameters, _simulationParametersOnDevice);
             _newSimulationParameters.reset();
         }
     }
@@ -505,8 +534,7 @@ void _SimulationCudaFacade::testOnly_mutationCheck(uint64_t cellId)
         std::lock_guard lock(_mutexForSimulationParameters);
         if (_newSimulationParameters) {
             _settings.simulationParameters = *_newSimulationParameters;
-            CHECK_FOR_CUDA_ERROR(
-                cudaMemcpyToSymbol(cudaSimulationParameters, &*_newSimulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+            SimulationParametersUpdateService::get().copyToConstantMemory(_settings.simulationParameters, _simulationParametersOnDevice);
             _newSimulationParameters.reset();
         }
     }
@@ -514,6 +542,20 @@ void _SimulationCudaFacade::testOnly_mutationCheck(uint64_t cellId)
     syncAndCheck();
 }
 
+std::vector<uint64_t> _SimulationCudaFacade::testOnly_drawImage(float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, double zoom)
+{
+    checkAndProcessSimulationParameterChanges();
+
+    _cudaRenderingData->resizeImageIfNecessary(imageSize);
+
+    _renderingKernels->drawImage(_settings, rectUpperLeft, rectLowerRight, imageSize, static_cast<float>(zoom), getSimulationDataIntern(), *_cudaRenderingData);
+    syncAndCheck();
+
+    std::vector<uint64_t> result(imageSize.x * imageSize.y);
+    copyToHost(result.data(), _cudaRenderingData->imageData, imageSize.x * imageSize.y);
+    return result;
+}
+
 void _SimulationCudaFacade::initCuda()
 {
     log(Priority::Important, "initialize CUDA");
@@ -660,16 +702,23 @@ void _SimulationCudaFacade::checkAndProcessSimulationParameterChanges()
     if (_newSimulationParameters) {
         _settings.simulationParameters =
             SimulationParametersUpdateService::get().integrateChanges(_settings.simulationParameters, *_newSimulationParameters, _simulationParametersUpdateConfig);
-        CHECK_FOR_CUDA_ERROR(
-            cudaMemcpyToSymbol(cudaSimulationParameters, &_settings.simulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+        SimulationParametersUpdateService::get().copyToConstantMemory(_settings.simulationParameters, _simulationParametersOnDevice);
         _newSimulationParameters.reset();
 
         if (_cudaSimulationData) {
             _simulationKernels->prepareForSimulationParametersChanges(_settings, getSimulationDataIntern());
+            reserveRandomNumberStreams();
         }
     }
 }
 
+//the number of threads may grow with the number of blocks and the smoothing length of the fluid kernel
+void _SimulationCudaFacade::reserveRandomNumberStreams()
+{
+    std::lock_guard lock(_mutexForSimulationData);
+    _cudaSimulationData->reserveRandomNumberStreams(_simulationKernels->calcMaxNumThreads(_settings));
+}
+
 SimulationData _SimulationCudaFacade::getSimulationDataIntern() const
 {
     std::lock_guard lock(_mutexForSimulationData);
@@ -12,6 +12,7 @@
 #include <vector_types.h>
 #include <GL/gl.h>
 
+#include "EngineInterface/InspectedEntityIds.h"
 #include "EngineInterface/RawStatisticsData.h"
 #include "EngineInterface/Settings.h"
 #include "EngineInterface/SelectionShallowData.h"
@@ -45,7 +46,8 @@ public:
     void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom);
     void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
     void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO);
-    void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO);
+    ArraySizes collectInspectedSimulationData(std::vector<uint64_t> entityIds, InspectedPayloads const& payloads);  //returns the sizes of the collected data
+    void getInspectedSimulationData(DataTO const& dataTO);  //copies the data of the last collectInspectedSimulationData call
     void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
     void addAndSelectSimulationData(DataTO const& dataTO);
     void setSimulationData(DataTO const& dataTO);
@@ -90,9 +92,12 @@ public:
 
     void resizeArraysIfNecessary(ArraySizes const& additionals = ArraySizes());
 
+    void setTimingSink(TimingSink const& sink);
+
     // only for tests
     void testOnly_mutate(uint64_t cellId, MutationType mutationType);
     void testOnly_mutationCheck(uint64_t cellId);
+    std::vector<uint64_t> testOnly_drawImage(float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, double zoom);
 
 private:
     void initCuda();
@@ -103,6 +108,7 @@ private:
     void automaticResizeArrays();
     void resizeArrays(ArraySizes const& additionals = ArraySizes());
     void checkAndProcessSimulationParameterChanges();
+    void reserveRandomNumberStreams();
 
     SimulationData getSimulationDataIntern() const;
 
@@ -112,6 +118,7 @@ private:
     mutable std::mutex _mutexForSimulationParameters;
     std::optional<SimulationParameters> _newSimulationParameters;
     SimulationParametersUpdateConfig _simulationParametersUpdateConfig = SimulationParametersUpdateConfig::All;
+    std::optional<SimulationParameters> _simulationParametersOnDevice;  //mirror of the constant memory such that only changes need to be copied
 
     Settings _settings;
 
@@ -136,4 +143,6 @@ private:
     EditKernelsLauncher _editKernels;
     StatisticsKernelsLauncher _statisticsKernels;
     TestKernelsLauncher _testKernels;
+
+    TimingSink _timingSink;
 };
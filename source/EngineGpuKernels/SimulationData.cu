@@ -3,7 +3,7 @@
 #include "ConstantMemory.cuh"
 #include "GarbageCollectorKernels.cuh"
 
-void SimulationData::init(int2 const& worldSize_, uint64_t timestep_)
+void SimulationData::init(int2 const& worldSize_, uint64_t timestep_, GpuSettings const& gpuSettings)
 {
     worldSize = worldSize_;
     timestep = timestep_;
@@ -18,8 +18,8 @@ void SimulationData::init(int2 const& worldSize_, uint64_t timestep_)
     CHECK_FOR_CUDA_ERROR(cudaMemset(externalEnergy, 0, sizeof(double)));
  
     processMemory.init();
-    numberGen1.init(40312357);   //some array size for random numbers (~ 40 MB)
-    numberGen2.init(1536941);  //some array size for random numbers (~ 1.5 MB)
+    numberGen1.init(40312357, gpuSettings.randomSeed, gpuSettings.deterministicRandomNumbers);  //some array size for random numbers (~ 40 MB)
+    numberGen2.init(1536941, gpuSettings.randomSeed + 1, gpuSettings.deterministicRandomNumbers);  //some array size for random numbers (~ 1.5 MB)
 
     structuralOperations.init();
     for (int i = 0; i < CellFunction_WithoutNone_Count; ++i) {
@@ -99,6 +99,12 @@ bool SimulationData::isEmpty()
     return 0 == objects.cells.getNumEntries_host() && 0 == objects.particles.getNumEntries_host();
 }
 
+void SimulationData::reserveRandomNumberStreams(uint64_t numThreads)
+{
+    numberGen1.reserveThreadCounters(numThreads);
+    numberGen2.reserveThreadCounters(numThreads);
+}
+
 void SimulationData::free()
 {
     objects.free();
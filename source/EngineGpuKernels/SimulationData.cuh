@@ -39,7 +39,8 @@ struct SimulationData
     CudaNumberGenerator numberGen1;
     CudaNumberGenerator numberGen2;  //second random number generator used in combination with the first generator for evaluating very low probabilities
 
-    void init(int2 const& worldSize, uint64_t timestep);
+    void init(int2 const& worldSize, uint64_t timestep, GpuSettings const& gpuSettings);
+    void reserveRandomNumberStreams(uint64_t numThreads);
     bool shouldResize(ArraySizes const& additionals);
     void resizeTargetObjects(ArraySizes const& additionals);
     void resizeObjects();
@@ -1,5 +1,7 @@
 ﻿#include "SimulationKernelsLauncher.cuh"
 
+#include <algorithm>
+
 #include "EngineInterface/SpaceCalculator.h"
 
 #include "SimulationKernels.cuh"
@@ -15,6 +17,8 @@ _SimulationKernelsLauncher::_SimulationKernelsLauncher()
 
 namespace 
 {
+    auto constexpr MaxFixedThreadBlockSize = 64;
+
     int calcOptimalThreadsForFluidKernel(SimulationParameters const& parameters)
     {
         auto scanRectLength = ceilf(parameters.motionData.fluidMotion.smoothingLength * 2) * 2 + 1;
@@ -25,6 +29,7 @@ namespace
 void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, SimulationData const& data, SimulationStatistics const& statistics)
 {
     auto const gpuSettings = settings.gpuSettings;
+    _timingRecorder.start();
     KERNEL_CALL_1_1(cudaNextTimestep_prepare, data, statistics);
 
     //not all kernels need to be executed in each time step for performance reasons
@@ -34,6 +39,7 @@ void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, Simulati
 
     KERNEL_CALL(cudaNextTimestep_physics_init, data);
     KERNEL_CALL_MOD(cudaNextTimestep_physics_fillMaps, 64, data);
+    _timingRecorder.endPhase("preparation and maps");
     if (settings.simulationParameters.motionType == MotionType_Fluid) {
         auto threadBlockSize = calcOptimalThreadsForFluidKernel(settings.simulationParameters);
         KERNEL_CALL_MOD(cudaNextTimestep_physics_calcFluidForces, threadBlockSize, data);
@@ -43,11 +49,13 @@ void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, Simulati
     if (settings.simulationParameters.numZones > 0) {
         KERNEL_CALL(cudaApplyFlowFieldSettings, data);
     }
+    _timingRecorder.endPhase("physics: forces");
     KERNEL_CALL_MOD(cudaNextTimestep_physics_applyForces, 16, data);
     KERNEL_CALL_MOD(cudaNextTimestep_physics_calcConnectionForces, 16, data, considerForcesFromAngleDifferences);
     KERNEL_CALL_MOD(cudaNextTimestep_physics_verletPositionUpdate, 16, data);
     KERNEL_CALL_MOD(cudaNextTimestep_physics_calcConnectionForces, 16, data, considerForcesFromAngleDifferences);
     KERNEL_CALL_MOD(cudaNextTimestep_physics_verletVelocityUpdate, 16, data);
+    _timingRecorder.endPhase("physics: integration");
 
     //cell functions
     KERNEL_CALL(cudaNextTimestep_cellFunction_prepare_substep1, data);
@@ -65,11 +73,13 @@ void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, Simulati
     KERNEL_CALL_MOD(cudaNextTimestep_cellFunction_sensor, 64, data, statistics);
     KERNEL_CALL(cudaNextTimestep_cellFunction_reconnector, data, statistics);
     KERNEL_CALL(cudaNextTimestep_cellFunction_detonator, data, statistics);
+    _timingRecorder.endPhase("cell functions");
 
     if (considerInnerFriction) {
         KERNEL_CALL_MOD(cudaNextTimestep_physics_applyInnerFriction, 16, data);
     }
     KERNEL_CALL_MOD(cudaNextTimestep_physics_applyFriction, 16, data);
+    _timingRecorder.endPhase("physics: friction");
 
     if (considerRigidityUpdate && isRigidityUpdateEnabled(settings)) {
         KERNEL_CALL(cudaInitClusterData, data);
@@ -81,13 +91,17 @@ void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, Simulati
         KERNEL_CALL(cudaAccumulateClusterAngularProp, data);
         KERNEL_CALL(cudaApplyClusterData, data);
     }
+    _timingRecorder.endPhase("physics: rigidity");
     KERNEL_CALL_1_1(cudaNextTimestep_structuralOperations_substep1, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep2, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep3, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep4, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep5, data);
+    _timingRecorder.endPhase("structural operations");
 
     _garbageCollector->cleanupAfterTimestep(settings.gpuSettings, data);
+    _timingRecorder.endPhase("garbage collection");
+    _timingRecorder.finish();
 }
 
 void _SimulationKernelsLauncher::prepareForSimulationParametersChanges(Settings const& settings, SimulationData const& data)
@@ -96,6 +110,17 @@ void _SimulationKernelsLauncher::prepareForSimulationParametersChanges(Settings
     KERNEL_CALL(cudaResetDensity, data);
 }
 
+void _SimulationKernelsLauncher::setTimingSink(TimingSink const& sink)
+{
+    _timingRecorder.setTimingSink(sink);
+}
+
+uint64_t _SimulationKernelsLauncher::calcMaxNumThreads(Settings const& settings) const
+{
+    auto maxThreadBlockSize = std::max(MaxFixedThreadBlockSize, calcOptimalThreadsForFluidKernel(settings.simulationParameters));
+    return static_cast<uint64_t>(settings.gpuSettings.numBlocks) * maxThreadBlockSize;
+}
+
 bool _SimulationKernelsLauncher::isRigidityUpdateEnabled(Settings const& settings) const
 {
     for (int i = 0; i < settings.simulationParameters.numZones; ++i) {
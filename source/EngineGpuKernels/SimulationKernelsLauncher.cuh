@@ -2,6 +2,7 @@
 
 #include "EngineInterface/Settings.h"
 
+#include "CudaTimingRecorder.cuh"
 #include "Definitions.cuh"
 #include "Macros.cuh"
 
@@ -13,9 +14,15 @@ public:
     void calcTimestep(Settings const& settings, SimulationData const& simulationData, SimulationStatistics const& statistics);
     void prepareForSimulationParametersChanges(Settings const& settings, SimulationData const& simulationData);
 
+    void setTimingSink(TimingSink const& sink);
+
+    //upper bound of the number of threads of a kernel launch in calcTimestep
+    uint64_t calcMaxNumThreads(Settings const& settings) const;
+
 private:
     bool isRigidityUpdateEnabled(Settings const& settings) const;
 
     GarbageCollectorKernelsLauncher _garbageCollector;
+    CudaTimingRecorder _timingRecorder;
 };
 
@@ -3,9 +3,11 @@
 #include <vector>
 
 #include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/SimulationParametersDiffService.h"
 #include "EngineInterface/SpaceCalculator.h"
 
 #include "Base.cuh"
+#include "ConstantMemory.cuh"
 #include "SimulationData.cuh"
 #include "MaxAgeBalancer.cuh"
 
@@ -96,3 +98,20 @@ bool SimulationParametersUpdateService::updateSimulationParametersAfterTimestep(
 
     return result;
 }
+
+void SimulationParametersUpdateService::copyToConstantMemory(
+    SimulationParameters const& parameters,
+    std::optional<SimulationParameters>& parametersInConstantMemory) const
+{
+    if (!parametersInConstantMemory) {
+        CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(cudaSimulationParameters, &parameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+    } else {
+        auto const& diffService = SimulationParametersDiffService::get();
+        auto changeSet = diffService.calcChangeSet(*parametersInConstantMemory, parameters);
+        for (auto const& range : diffService.calcChangedMemoryRanges(changeSet)) {
+            CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(
+                cudaSimulationParameters, reinterpret_cast<char const*>(&parameters) + range.offset, range.size, range.offset, cudaMemcpyHostToDevice));
+        }
+    }
+    parametersInConstantMemory = parameters;
+}
@@ -23,4 +23,7 @@ public:
         MaxAgeBalancer const& maxAgeBalancer,
         SimulationData const& simulationData,
         RawStatisticsData const& statistics);  //returns true if parameters have been changed
+
+    //copies only the changed memory ranges if the parameters already in constant memory are given, otherwise everything
+    void copyToConstantMemory(SimulationParameters const& parameters, std::optional<SimulationParameters>& parametersInConstantMemory) const;
 };
@@ -1,6 +1,9 @@
 #include "AccessDataTOCache.h"
 
-_AccessDataTOCache::_AccessDataTOCache()
+#include <algorithm>
+
+_AccessDataTOCache::_AccessDataTOCache(bool growMonotonically)
+    : _growMonotonically(growMonotonically)
 {}
 
 _AccessDataTOCache::~_AccessDataTOCache()
@@ -12,34 +15,44 @@ _AccessDataTOCache::~_AccessDataTOCache()
 
 DataTO _AccessDataTOCache::getDataTO(ArraySizes const& arraySizes)
 {
+    ArraySizes newCapacities = arraySizes;
     if (_dataTO) {
-        auto existingArraySizes = getArraySizes(*_dataTO);
-        if (fits(existingArraySizes, arraySizes)) {
+        if (fits(_capacities, arraySizes)) {
             *_dataTO->numCells = 0;
             *_dataTO->numParticles = 0;
             *_dataTO->numAuxiliaryData = 0;
             return *_dataTO;
         } else {
+            if (_growMonotonically) {
+
+                //alternating requests do not reallocate again
+                newCapacities.cellArraySize = std::max(newCapacities.cellArraySize, _capacities.cellArraySize);
+                newCapacities.particleArraySize = std::max(newCapacities.particleArraySize, _capacities.particleArraySize);
+                newCapacities.auxiliaryDataSize = std::max(newCapacities.auxiliaryDataSize, _capacities.auxiliaryDataSize);
+            }
             _dataTO->destroy();
+            _dataTO.reset();
         }
     }
     try {
         DataTO result;
-        result.init(arraySizes);
+        result.init(newCapacities);
         _dataTO = result;
+        _capacities = newCapacities;
+        ++_numAllocations;
         return result;
     } catch (std::bad_alloc const&) {
         throw std::runtime_error("There is not sufficient CPU memory available.");
     }
 }
 
-bool _AccessDataTOCache::fits(ArraySizes const& left, ArraySizes const& right) const
+int _AccessDataTOCache::getNumAllocations() const
 {
-    return left.cellArraySize >= right.cellArraySize && left.particleArraySize >= right.particleArraySize
-        && left.auxiliaryDataSize >= right.auxiliaryDataSize;
+    return _numAllocations;
 }
 
-auto _AccessDataTOCache::getArraySizes(DataTO const& dataTO) const -> ArraySizes
+bool _AccessDataTOCache::fits(ArraySizes const& left, ArraySizes const& right) const
 {
-    return {*dataTO.numCells, *dataTO.numParticles, *dataTO.numAuxiliaryData};
+    return left.cellArraySize >= right.cellArraySize && left.particleArraySize >= right.particleArraySize
+        && left.auxiliaryDataSize >= right.auxiliaryDataSize;
 }
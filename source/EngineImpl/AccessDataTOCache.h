@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "Base/Definitions.h"
 
 #include "EngineInterface/ArraySizes.h"
@@ -10,15 +12,20 @@
 class _AccessDataTOCache
 {
 public:
-    _AccessDataTOCache();
+    //growMonotonically: arrays are never shrunk on reallocation, intended for small buffers with alternating requests
+    _AccessDataTOCache(bool growMonotonically = false);
     ~_AccessDataTOCache();
 
     DataTO getDataTO(ArraySizes const& arraySizes);
 
+    int getNumAllocations() const;
+
 private:
     bool fits(ArraySizes const& left, ArraySizes const& right) const;
-    ArraySizes getArraySizes(DataTO const& dataTO) const;
 
+    bool _growMonotonically = false;
     std::optional<DataTO> _dataTO;
+    ArraySizes _capacities;  //of the allocated arrays, the counts in _dataTO only reflect the last fill
+    int _numAllocations = 0;
 };
 
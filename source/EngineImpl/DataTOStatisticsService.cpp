@@ -0,0 +1,31 @@
+#include "DataTOStatisticsService.h"
+
+#include "EngineInterface/OfflineStatisticsService.h"
+
+RawStatisticsData DataTOStatisticsService::calcStatistics(DataTO const& dataTO, int maxThreads)
+{
+    auto getCell = [&](int index) {
+        auto const& cellTO = dataTO.cells[index];
+        OfflineStatisticsService::CellInput result;
+        result.color = cellTO.color;
+        result.age = static_cast<int>(cellTO.age);
+        result.barrier = cellTO.barrier;
+        result.mutationId = cellTO.mutationId;
+        result.energy = cellTO.energy;
+        result.genomeComplexity = cellTO.genomeComplexity;
+        result.cellFunction = cellTO.cellFunction;
+        if (cellTO.cellFunction == CellFunction_Constructor) {
+            result.genome = dataTO.auxiliaryData + cellTO.cellFunctionData.constructor.genomeDataIndex;
+            result.genomeSize = cellTO.cellFunctionData.constructor.genomeSize;
+        } else if (cellTO.cellFunction == CellFunction_Injector) {
+            result.genome = dataTO.auxiliaryData + cellTO.cellFunctionData.injector.genomeDataIndex;
+            result.genomeSize = cellTO.cellFunctionData.injector.genomeSize;
+        }
+        return result;
+    };
+    auto getParticle = [&](int index) {
+        auto const& particleTO = dataTO.particles[index];
+        return OfflineStatisticsService::ParticleInput{particleTO.color, particleTO.energy};
+    };
+    return OfflineStatisticsService::get().calcStatistics(toInt(*dataTO.numCells), getCell, toInt(*dataTO.numParticles), getParticle, maxThreads);
+}
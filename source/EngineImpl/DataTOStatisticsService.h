@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Base/Singleton.h"
+#include "EngineInterface/RawStatisticsData.h"
+#include "EngineGpuKernels/TOs.cuh"
+
+//statistics of a transfer object as computed by OfflineStatisticsService, avoids the conversion into descriptions
+class DataTOStatisticsService
+{
+    MAKE_SINGLETON(DataTOStatisticsService);
+
+public:
+    RawStatisticsData calcStatistics(DataTO const& dataTO, int maxThreads = 0);
+};
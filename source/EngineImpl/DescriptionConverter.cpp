@@ -173,14 +173,14 @@ ClusteredDataDescription DescriptionConverter::convertTOtoClusteredDataDescripti
     return result;
 }
 
-DataDescription DescriptionConverter::convertTOtoDataDescription(DataTO const& dataTO) const
+DataDescription DescriptionConverter::convertTOtoDataDescription(DataTO const& dataTO, InspectedPayloads const& payloads) const
 {
     DataDescription result;
 
     //cells
     std::vector<CellDescription> cells;
     for (int i = 0; i < *dataTO.numCells; ++i) {
-        cells.emplace_back(createCellDescription(dataTO, i));
+        cells.emplace_back(createCellDescription(dataTO, i, payloads));
     }
     result.addCells(cells);
 
@@ -360,7 +360,7 @@ auto DescriptionConverter::scanAndCreateClusterDescription(
     return result;
 }
 
-CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO, int cellIndex) const
+CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO, int cellIndex, InspectedPayloads const& payloads) const
 {
     CellDescription result;
 
@@ -415,9 +415,11 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
     switch (cellTO.cellFunction) {
     case CellFunction_Neuron: {
         NeuronDescription neuron;
-        std::vector<float> weigthsAndBias;
-        convert(dataTO, sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1), cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex, weigthsAndBias);
-        std::tie(neuron.weights, neuron.biases) = splitWeightsAndBias(weigthsAndBias);
+        if (payloads.neuronData) {
+            std::vector<float> weigthsAndBias;
+            convert(dataTO, sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1), cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex, weigthsAndBias);
+            std::tie(neuron.weights, neuron.biases) = splitWeightsAndBias(weigthsAndBias);
+        }
         for (int i = 0; i < MAX_CHANNELS; ++i) {
             neuron.activationFunctions[i] = cellTO.cellFunctionData.neuron.activationFunctions[i];
         }
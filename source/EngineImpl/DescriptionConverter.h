@@ -5,6 +5,7 @@
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/ArraySizes.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/InspectedEntityIds.h"
 #include "EngineInterface/OverlayDescriptions.h"
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineGpuKernels/TOs.cuh"
@@ -19,7 +20,7 @@ public:
     ArraySizes getArraySizes(ClusteredDataDescription const& data) const;
 
     ClusteredDataDescription convertTOtoClusteredDataDescription(DataTO const& dataTO) const;
-    DataDescription convertTOtoDataDescription(DataTO const& dataTO) const;
+    DataDescription convertTOtoDataDescription(DataTO const& dataTO, InspectedPayloads const& payloads = InspectedPayloads()) const;
     OverlayDescription convertTOtoOverlayDescription(DataTO const& dataTO) const;
     void convertDescriptionToTO(DataTO& result, ClusteredDataDescription const& description) const;
     void convertDescriptionToTO(DataTO& result, DataDescription const& description) const;
@@ -38,7 +39,7 @@ private:
         DataTO const& dataTO,
         int startCellIndex,
         std::unordered_set<int>& freeCellIndices) const;
-    CellDescription createCellDescription(DataTO const& dataTO, int cellIndex) const;
+    CellDescription createCellDescription(DataTO const& dataTO, int cellIndex, InspectedPayloads const& payloads = InspectedPayloads()) const;
 
 	void addCell(
         DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int>& cellIndexTOByIds) const;
@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "EngineInterface/TimingSink.h"
 #include "EngineGpuKernels/TOs.cuh"
 #include "EngineGpuKernels/SimulationCudaFacade.cuh"
 #include "AccessDataTOCache.h"
@@ -12,13 +13,16 @@ namespace
     std::chrono::milliseconds const FrameTimeout(500);
 }
 
-void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters)
+void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters, GpuSettings const& gpuSettings)
 {
     _accessState = 0;
     _settings.generalSettings = generalSettings;
     _settings.simulationParameters = parameters;
+    _settings.gpuSettings = gpuSettings;
     _dataTOCache = std::make_shared<_AccessDataTOCache>();
+    _inspectionTOCache = std::make_shared<_AccessDataTOCache>(true);
     _simulationCudaFacade = std::make_shared<_SimulationCudaFacade>(timestep, _settings);
+    _simulationCudaFacade->setTimingSink(_timingSink);
     _cudaResource = nullptr;
 }
 
@@ -119,6 +123,7 @@ ClusteredDataDescription EngineWorker::getClusteredSimulationData(IntVector2D co
 
         _simulationCudaFacade->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
     }
+    ScopedTiming timing(_timingSink, "conversion: data to description");
     DescriptionConverter converter(_settings.simulationParameters);
 
     auto result = converter.convertTOtoClusteredDataDescription(dataTO);
@@ -133,6 +138,7 @@ DataDescription EngineWorker::getSimulationData(IntVector2D const& rectUpperLeft
     auto dataTO = provideTO();
     _simulationCudaFacade->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
 
+    ScopedTiming timing(_timingSink, "conversion: data to description");
     DescriptionConverter converter(_settings.simulationParameters);
     auto result = converter.convertTOtoDataDescription(dataTO);
     return result;
@@ -146,6 +152,7 @@ ClusteredDataDescription EngineWorker::getSelectedClusteredSimulationData(bool i
     
     _simulationCudaFacade->getSelectedSimulationData(includeClusters, dataTO);
 
+    ScopedTiming timing(_timingSink, "conversion: data to description");
     DescriptionConverter converter(_settings.simulationParameters);
 
     auto result = converter.convertTOtoClusteredDataDescription(dataTO);
@@ -160,6 +167,7 @@ DataDescription EngineWorker::getSelectedSimulationData(bool includeClusters)
     
     _simulationCudaFacade->getSelectedSimulationData(includeClusters, dataTO);
 
+    ScopedTiming timing(_timingSink, "conversion: data to description");
     DescriptionConverter converter(_settings.simulationParameters);
 
     auto result = converter.convertTOtoDataDescription(dataTO);
@@ -167,17 +175,17 @@ DataDescription EngineWorker::getSelectedSimulationData(bool includeClusters)
     return result;
 }
 
-DataDescription EngineWorker::getInspectedSimulationData(std::vector<uint64_t> objectsIds)
+DataDescription EngineWorker::getInspectedSimulationData(std::vector<uint64_t> objectsIds, InspectedPayloads const& payloads)
 {
     EngineWorkerGuard access(this);
 
-    DataTO dataTO = provideTO();
-    
-    _simulationCudaFacade->getInspectedSimulationData(objectsIds, dataTO);
+    DataTO dataTO = provideInspectionTO(_simulationCudaFacade->collectInspectedSimulationData(objectsIds, payloads));
+    _simulationCudaFacade->getInspectedSimulationData(dataTO);
 
+    ScopedTiming timing(_timingSink, "conversion: data to description");
     DescriptionConverter converter(_settings.simulationParameters);
 
-    auto result = converter.convertTOtoDataDescription(dataTO);
+    auto result = converter.convertTOtoDataDescription(dataTO, payloads);
     return result;
 }
 
@@ -208,7 +216,10 @@ void EngineWorker::addAndSelectSimulationData(DataDescription const& dataToUpdat
 
     DataTO dataTO = provideTO();
 
-    converter.convertDescriptionToTO(dataTO, dataToUpdate);
+    {
+        ScopedTiming timing(_timingSink, "conversion: description to data");
+        converter.convertDescriptionToTO(dataTO, dataToUpdate);
+    }
 
     _simulationCudaFacade->addAndSelectSimulationData(dataTO);
 }
@@ -223,7 +234,10 @@ void EngineWorker::setClusteredSimulationData(ClusteredDataDescription const& da
 
     DataTO dataTO = provideTO();
 
-    converter.convertDescriptionToTO(dataTO, dataToUpdate);
+    {
+        ScopedTiming timing(_timingSink, "conversion: description to data");
+        converter.convertDescriptionToTO(dataTO, dataToUpdate);
+    }
 
     _simulationCudaFacade->setSimulationData(dataTO);
 }
@@ -237,7 +251,10 @@ void EngineWorker::setSimulationData(DataDescription const& dataToUpdate)
     _simulationCudaFacade->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
 
     DataTO dataTO = provideTO();
-    converter.convertDescriptionToTO(dataTO, dataToUpdate);
+    {
+        ScopedTiming timing(_timingSink, "conversion: description to data");
+        converter.convertDescriptionToTO(dataTO, dataToUpdate);
+    }
 
     _simulationCudaFacade->setSimulationData(dataTO);
 }
@@ -491,6 +508,13 @@ bool EngineWorker::isSimulationRunning() const
     return _isSimulationRunning.load();
 }
 
+void EngineWorker::setTimingSink(TimingSink const& sink)
+{
+    EngineWorkerGuard access(this);
+    _timingSink = sink;
+    _simulationCudaFacade->setTimingSink(sink);
+}
+
 void EngineWorker::testOnly_mutate(uint64_t cellId, MutationType mutationType)
 {
     EngineWorkerGuard access(this);
@@ -503,11 +527,25 @@ void EngineWorker::testOnly_mutationCheck(uint64_t cellId)
     _simulationCudaFacade->testOnly_mutationCheck(cellId);
 }
 
+std::vector<uint64_t>
+EngineWorker::testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom)
+{
+    EngineWorkerGuard access(this);
+    return _simulationCudaFacade->testOnly_drawImage(
+        {rectUpperLeft.x, rectUpperLeft.y}, {rectLowerRight.x, rectLowerRight.y}, {imageSize.x, imageSize.y}, zoom);
+}
+
 DataTO EngineWorker::provideTO()
 {
     return _dataTOCache->getDataTO(_simulationCudaFacade->getArraySizes());
 }
 
+DataTO EngineWorker::provideInspectionTO(ArraySizes const& collectedSizes)
+{
+    //auxiliary data is sized by what the inspected entities actually carry, the cache only grows when this is exceeded
+    return _inspectionTOCache->getDataTO({Const::MaxInspectedObjects, Const::MaxInspectedObjects, collectedSizes.auxiliaryDataSize});
+}
+
 void EngineWorker::resetTimeIntervalStatistics()
 {
     _simulationCudaFacade->resetTimeIntervalStatistics();
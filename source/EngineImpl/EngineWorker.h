@@ -11,9 +11,11 @@
 
 #include "Base/Definitions.h"
 
+#include "EngineInterface/ArraySizes.h"
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineInterface/GpuSettings.h"
+#include "EngineInterface/InspectedEntityIds.h"
 #include "EngineInterface/RawStatisticsData.h"
 #include "EngineInterface/OverlayDescriptions.h"
 #include "EngineInterface/Settings.h"
@@ -39,7 +41,7 @@ class EngineWorker
 {
     friend class EngineWorkerGuard;
 public:
-    void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters);
+    void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters, GpuSettings const& gpuSettings);
     void clear();
 
     void setImageResource(void* image);
@@ -58,7 +60,7 @@ public:
     DataDescription getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
     ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters);
     DataDescription getSelectedSimulationData(bool includeClusters);
-    DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds);
+    DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds, InspectedPayloads const& payloads);
     RawStatisticsData getRawStatistics() const;
     StatisticsHistory const& getStatisticsHistory() const;
     void setStatisticsHistory(StatisticsHistoryData const& data);
@@ -85,6 +87,7 @@ public:
     void setTpsRestriction(int value);
 
     float getTps() const;
+    void setTimingSink(TimingSink const& sink);
     uint64_t getCurrentTimestep() const;
     void setCurrentTimestep(uint64_t value);
 
@@ -115,9 +118,11 @@ public:
     // for tests only
     void testOnly_mutate(uint64_t cellId, MutationType mutationType);
     void testOnly_mutationCheck(uint64_t cellId);
+    std::vector<uint64_t> testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom);
 
 private:
     DataTO provideTO(); 
+    DataTO provideInspectionTO(ArraySizes const& collectedSizes);
     void resetTimeIntervalStatistics();
     void processJobs();
 
@@ -162,11 +167,13 @@ private:
     std::optional<std::chrono::steady_clock::time_point> _measureTimepoint;
     std::optional<std::chrono::steady_clock::time_point> _slowDownTimepoint;
     std::optional<std::chrono::microseconds> _slowDownOvershot;
+    TimingSink _timingSink;
   
     //internals
     std::optional<GLuint> _imageResource;
     void* _cudaResource = nullptr;
     AccessDataTOCache _dataTOCache;
+    AccessDataTOCache _inspectionTOCache;   //small staging buffer which only holds inspected entities
 };
 
 class EngineWorkerGuard
@@ -7,7 +7,7 @@ void _SimulationFacadeImpl::newSimulation(uint64_t timestep, GeneralSettings con
     _generalSettings = generalSettings;
     _origSettings.generalSettings = generalSettings;
     _origSettings.simulationParameters = parameters;
-    _worker.newSimulation(timestep, generalSettings, parameters);
+    _worker.newSimulation(timestep, generalSettings, parameters, _gpuSettings);
 
     _thread = new std::thread(&EngineWorker::runThreadLoop, &_worker);
 
@@ -102,9 +102,9 @@ DataDescription _SimulationFacadeImpl::getSelectedSimulationData(bool includeClu
     return _worker.getSelectedSimulationData(includeClusters);
 }
 
-DataDescription _SimulationFacadeImpl::getInspectedSimulationData(std::vector<uint64_t> objectIds)
+DataDescription _SimulationFacadeImpl::getInspectedSimulationData(std::vector<uint64_t> objectIds, InspectedPayloads const& payloads)
 {
-    return _worker.getInspectedSimulationData(objectIds);
+    return _worker.getInspectedSimulationData(objectIds, payloads);
 }
 
 void _SimulationFacadeImpl::addAndSelectSimulationData(DataDescription const& dataToAdd)
@@ -373,6 +373,11 @@ float _SimulationFacadeImpl::getTps() const
     return _worker.getTps();
 }
 
+void _SimulationFacadeImpl::setTimingSink(TimingSink const& sink)
+{
+    _worker.setTimingSink(sink);
+}
+
 void _SimulationFacadeImpl::testOnly_mutate(uint64_t cellId, MutationType mutationType)
 {
     _worker.testOnly_mutate(cellId, mutationType);
@@ -382,3 +387,9 @@ void _SimulationFacadeImpl::testOnly_mutationCheck(uint64_t cellId)
 {
     _worker.testOnly_mutationCheck(cellId);
 }
+
+std::vector<uint64_t>
+_SimulationFacadeImpl::testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom)
+{
+    return _worker.testOnly_drawImage(rectUpperLeft, rectLowerRight, imageSize, zoom);
+}
@@ -49,7 +49,7 @@ public:
     DataDescription getSimulationData() override;
     ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters) override;
     DataDescription getSelectedSimulationData(bool includeClusters) override;
-    DataDescription getInspectedSimulationData(std::vector<uint64_t> objectIds) override;
+    DataDescription getInspectedSimulationData(std::vector<uint64_t> objectIds, InspectedPayloads const& payloads) override;
 
     void addAndSelectSimulationData(DataDescription const& dataToAdd) override;
     void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) override;
@@ -113,9 +113,13 @@ public:
 
     float getTps() const override;
 
+    void setTimingSink(TimingSink const& sink) override;
+
     // for tests only
     void testOnly_mutate(uint64_t cellId, MutationType mutationType) override;
     void testOnly_mutationCheck(uint64_t cellId) override;
+    std::vector<uint64_t>
+    testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom) override;
 
 private:
     bool _selectionNeedsUpdate = false;
@@ -0,0 +1,245 @@
+#include "CreatureCensusService.h"
+
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+
+#include "Base/Parallel.h"
+
+#include "OfflineStatisticsService.h"
+
+namespace
+{
+    //column names in order of CellFunction_
+    std::array<char const*, CellFunction_Count> const CellFunctionNames = {
+        "neuron", "transmitter", "constructor", "sensor", "nerve", "attacker", "injector", "muscle", "defender", "reconnector", "detonator", "none"};
+
+    int findRoot(std::vector<int>& parents, int index)
+    {
+        while (parents.at(index) != index) {
+            parents.at(index) = parents.at(parents.at(index));
+            index = parents.at(index);
+        }
+        return index;
+    }
+
+    //returns the creature index for each cell, creatures are numbered in order of their first cell
+    std::vector<int> calcCreatureIndices(std::vector<CellDescription const*> const& cells, int& numCreatures)
+    {
+        auto numCells = toInt(cells.size());
+
+        //cells without creature id are merged via their connections
+        std::vector<int> parents(numCells);
+        std::iota(parents.begin(), parents.end(), 0);
+        std::unordered_map<uint64_t, int> indexById;
+        for (int index = 0; index < numCells; ++index) {
+            if (cells.at(index)->creatureId == 0) {
+                indexById.emplace(cells.at(index)->id, index);
+            }
+        }
+        for (auto const& [id, index] : indexById) {
+            for (auto const& connection : cells.at(index)->connections) {
+                auto findResult = indexById.find(connection.cellId);
+                if (findResult != indexById.end()) {
+                    auto root1 = findRoot(parents, index);
+                    auto root2 = findRoot(parents, findResult->second);
+                    parents.at(std::max(root1, root2)) = std::min(root1, root2);
+                }
+            }
+        }
+
+        std::vector<int> result(numCells);
+        std::unordered_map<int, int> creatureIndexByCreatureId;
+        std::unordered_map<int, int> creatureIndexByRoot;
+        numCreatures = 0;
+        for (int index = 0; index < numCells; ++index) {
+            auto creatureId = cells.at(index)->creatureId;
+            auto& creatureIndexMap = creatureId != 0 ? creatureIndexByCreatureId : creatureIndexByRoot;
+            auto key = creatureId != 0 ? creatureId : findRoot(parents, index);
+            auto [iter, inserted] = creatureIndexMap.emplace(key, numCreatures);
+            if (inserted) {
+                ++numCreatures;
+            }
+            result.at(index) = iter->second;
+        }
+        return result;
+    }
+
+    std::vector<uint8_t> const* getGenome(CellDescription const& cell)
+    {
+        auto cellFunction = cell.getCellFunctionType();
+        if (cellFunction == CellFunction_Constructor) {
+            return &std::get<ConstructorDescription>(*cell.cellFunction).genome;
+        }
+        if (cellFunction == CellFunction_Injector) {
+            return &std::get<InjectorDescription>(*cell.cellFunction).genome;
+        }
+        return nullptr;
+    }
+}
+
+CreatureCensus CreatureCensusService::calcCensus(ClusteredDataDescription const& data, int maxThreads) const
+{
+    std::vector<CellDescription const*> cells;
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            cells.emplace_back(&cell);
+        }
+    }
+    return calcCensus(cells, maxThreads);
+}
+
+CreatureCensus CreatureCensusService::calcCensus(DataDescription const& data, int maxThreads) const
+{
+    std::vector<CellDescription const*> cells;
+    cells.reserve(data.cells.size());
+    for (auto const& cell : data.cells) {
+        cells.emplace_back(&cell);
+    }
+    return calcCensus(cells, maxThreads);
+}
+
+std::string CreatureCensusService::exportToCsv(CreatureCensus const& census) const
+{
+    std::ostringstream stream;
+    stream << std::setprecision(6) << std::fixed;
+    stream << "creature id,mutation id,cells,energy,min x,min y,max x,max y";
+    for (int cellFunction = 0; cellFunction < CellFunction_Count; ++cellFunction) {
+        stream << "," << CellFunctionNames.at(cellFunction) << " cells";
+    }
+    stream << ",genome bytes,genome cells,genome complexity,max age,vel x,vel y" << std::endl;
+    for (int index = 0; index < census.getNumCreatures(); ++index) {
+        stream << census.creatureId.at(index) << "," << census.mutationId.at(index) << "," << census.numCells.at(index) << ","
+               << census.energy.at(index) << "," << census.boundingBoxMin.at(index).x << "," << census.boundingBoxMin.at(index).y << ","
+               << census.boundingBoxMax.at(index).x << "," << census.boundingBoxMax.at(index).y;
+        for (auto const& numCells : census.numCellsByCellFunction.at(index)) {
+            stream << "," << numCells;
+        }
+        stream << "," << census.genomeSize.at(index) << "," << census.numGenomeCells.at(index) << "," << census.genomeComplexity.at(index) << ","
+               << census.maxAge.at(index) << "," << census.velocity.at(index).x << "," << census.velocity.at(index).y << std::endl;
+    }
+    return stream.str();
+}
+
+bool CreatureCensusService::exportToFile(std::filesystem::path const& filename, CreatureCensus const& census) const
+{
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    stream << exportToCsv(census);
+    return static_cast<bool>(stream);
+}
+
+CreatureCensus CreatureCensusService::calcCensus(std::vector<CellDescription const*> const& cells, int maxThreads) const
+{
+    int numCreatures = 0;
+    auto creatureIndices = calcCreatureIndices(cells, numCreatures);
+
+    //sort cells by creature (counting sort preserves the cell order within a creature)
+    CreatureCensus result;
+    result.cellIdsOffset.resize(numCreatures + 1, 0);
+    for (auto const& creatureIndex : creatureIndices) {
+        ++result.cellIdsOffset.at(creatureIndex + 1);
+    }
+    std::partial_sum(result.cellIdsOffset.begin(), result.cellIdsOffset.end(), result.cellIdsOffset.begin());
+    std::vector<int> sortedCellIndices(cells.size());
+    auto nextPositions = result.cellIdsOffset;
+    for (int index = 0; index < toInt(cells.size()); ++index) {
+        sortedCellIndices.at(nextPositions.at(creatureIndices.at(index))++) = index;
+    }
+
+    result.creatureId.resize(numCreatures);
+    result.mutationId.resize(numCreatures);
+    result.numCells.resize(numCreatures);
+    result.energy.resize(numCreatures);
+    result.boundingBoxMin.resize(numCreatures);
+    result.boundingBoxMax.resize(numCreatures);
+    result.numCellsByCellFunction.resize(numCreatures);
+    result.genomeSize.resize(numCreatures);
+    result.numGenomeCells.resize(numCreatures);
+    result.genomeComplexity.resize(numCreatures);
+    result.maxAge.resize(numCreatures);
+    result.velocity.resize(numCreatures);
+    result.cellIds.resize(cells.size());
+
+    //each creature is evaluated by exactly one thread, hence the rows can be written without synchronization
+    Parallel::forEachPartition(
+        numCreatures,
+        [&](ParallelPartition const& partition) {
+            for (int creatureIndex = partition.startIndex; creatureIndex <= partition.endIndex; ++creatureIndex) {
+                auto startPos = result.cellIdsOffset.at(creatureIndex);
+                auto endPos = result.cellIdsOffset.at(creatureIndex + 1);
+                auto const& firstCell = *cells.at(sortedCellIndices.at(startPos));
+
+                auto energy = 0.0;
+                auto boundingBoxMin = firstCell.pos;
+                auto boundingBoxMax = firstCell.pos;
+                std::array<int, CellFunction_Count> numCellsByCellFunction{};
+                std::vector<uint8_t> const* largestGenome = nullptr;
+                auto genomeComplexity = 0.0f;
+                auto maxAge = 0;
+                RealVector2D velocity;
+                for (int pos = startPos; pos < endPos; ++pos) {
+                    auto const& cell = *cells.at(sortedCellIndices.at(pos));
+                    energy += cell.energy;
+                    boundingBoxMin.x = std::min(boundingBoxMin.x, cell.pos.x);
+                    boundingBoxMin.y = std::min(boundingBoxMin.y, cell.pos.y);
+                    boundingBoxMax.x = std::max(boundingBoxMax.x, cell.pos.x);
+                    boundingBoxMax.y = std::max(boundingBoxMax.y, cell.pos.y);
+                    ++numCellsByCellFunction.at(cell.getCellFunctionType());
+                    if (auto genome = getGenome(cell)) {
+                        if (!largestGenome || genome->size() > largestGenome->size()) {
+                            largestGenome = genome;
+                        }
+                    }
+                    genomeComplexity = std::max(genomeComplexity, cell.genomeComplexity);
+                    maxAge = std::max(maxAge, cell.age);
+                    velocity += cell.vel;
+                    result.cellIds.at(pos) = cell.id;
+                }
+                auto numCells = endPos - startPos;
+
+                result.creatureId.at(creatureIndex) = firstCell.creatureId;
+                result.mutationId.at(creatureIndex) = firstCell.mutationId;
+                result.numCells.at(creatureIndex) = numCells;
+                result.energy.at(creatureIndex) = toFloat(energy);
+                result.boundingBoxMin.at(creatureIndex) = boundingBoxMin;
+                result.boundingBoxMax.at(creatureIndex) = boundingBoxMax;
+                result.numCellsByCellFunction.at(creatureIndex) = numCellsByCellFunction;
+                if (largestGenome) {
+                    result.genomeSize.at(creatureIndex) = toInt(largestGenome->size());
+                    result.numGenomeCells.at(creatureIndex) =
+                        OfflineStatisticsService::getNumNodesRecursively(largestGenome->data(), toInt(largestGenome->size()));
+                }
+                result.genomeComplexity.at(creatureIndex) = genomeComplexity;
+                result.maxAge.at(creatureIndex) = maxAge;
+                result.velocity.at(creatureIndex) = velocity / toFloat(numCells);
+            }
+        },
+        maxThreads);
+    return result;
+}
+
+void CreatureCensusService::copyRow(CreatureCensus& target, CreatureCensus const& source, int index) const
+{
+    target.creatureId.emplace_back(source.creatureId.at(index));
+    target.mutationId.emplace_back(source.mutationId.at(index));
+    target.numCells.emplace_back(source.numCells.at(index));
+    target.energy.emplace_back(source.energy.at(index));
+    target.boundingBoxMin.emplace_back(source.boundingBoxMin.at(index));
+    target.boundingBoxMax.emplace_back(source.boundingBoxMax.at(index));
+    target.numCellsByCellFunction.emplace_back(source.numCellsByCellFunction.at(index));
+    target.genomeSize.emplace_back(source.genomeSize.at(index));
+    target.numGenomeCells.emplace_back(source.numGenomeCells.at(index));
+    target.genomeComplexity.emplace_back(source.genomeComplexity.at(index));
+    target.maxAge.emplace_back(source.maxAge.at(index));
+    target.velocity.emplace_back(source.velocity.at(index));
+    target.cellIds.insert(
+        target.cellIds.end(),
+        source.cellIds.begin() + source.cellIdsOffset.at(index),
+        source.cellIds.begin() + source.cellIdsOffset.at(index + 1));
+    target.cellIdsOffset.emplace_back(toInt(target.cellIds.size()));
+}
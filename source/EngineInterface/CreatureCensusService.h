@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Singleton.h"
+#include "Base/Vector2D.h"
+
+#include "CellFunctionConstants.h"
+#include "Descriptions.h"
+
+//columnar table with one row per creature, i.e. all vectors except cellIdsOffset and cellIds have getNumCreatures() entries
+struct CreatureCensus
+{
+    std::vector<int> creatureId;  //0 if the creature has been identified by connectivity
+    std::vector<int> mutationId;
+    std::vector<int> numCells;
+    std::vector<float> energy;
+    std::vector<RealVector2D> boundingBoxMin;  //in world coordinates without considering the torus topology
+    std::vector<RealVector2D> boundingBoxMax;
+    std::vector<std::array<int, CellFunction_Count>> numCellsByCellFunction;
+    std::vector<int> genomeSize;  //in bytes, largest genome of the creature's constructors and injectors
+    std::vector<int> numGenomeCells;  //including repetitions and sub-genomes
+    std::vector<float> genomeComplexity;
+    std::vector<int> maxAge;
+    std::vector<RealVector2D> velocity;  //average cell velocity
+
+    //cell ids of creature i are cellIds[cellIdsOffset[i]], ..., cellIds[cellIdsOffset[i + 1] - 1]
+    std::vector<int> cellIdsOffset;
+    std::vector<uint64_t> cellIds;
+
+    int getNumCreatures() const { return toInt(numCells.size()); }
+};
+
+//cells with the same creature id belong to the same creature, cells without creature id are grouped by their connections
+class CreatureCensusService
+{
+    MAKE_SINGLETON(CreatureCensusService);
+
+public:
+    CreatureCensus calcCensus(ClusteredDataDescription const& data, int maxThreads = 0) const;
+    CreatureCensus calcCensus(DataDescription const& data, int maxThreads = 0) const;
+
+    //filter(census, index) -> bool decides whether a row is kept
+    template <typename FilterFunc>
+    CreatureCensus filter(CreatureCensus const& census, FilterFunc const& filterFunc) const;
+
+    std::string exportToCsv(CreatureCensus const& census) const;
+    bool exportToFile(std::filesystem::path const& filename, CreatureCensus const& census) const;
+
+private:
+    CreatureCensus calcCensus(std::vector<CellDescription const*> const& cells, int maxThreads) const;
+    void copyRow(CreatureCensus& target, CreatureCensus const& source, int index) const;
+};
+
+/**
+ * Implementations
+ */
+
+template <typename FilterFunc>
+CreatureCensus CreatureCensusService::filter(CreatureCensus const& census, FilterFunc const& filterFunc) const
+{
+    CreatureCensus result;
+    result.cellIdsOffset.emplace_back(0);
+    for (int index = 0; index < census.getNumCreatures(); ++index) {
+        if (filterFunc(census, index)) {
+            copyRow(result, census, index);
+        }
+    }
+    return result;
+}
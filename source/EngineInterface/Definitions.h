@@ -36,3 +36,6 @@ using ShapeGenerator = std::shared_ptr<_ShapeGenerator>;
 class ShapeGeneratorResult;
 
 class StatisticsHistory;
+
+class _TimingSink;
+using TimingSink = std::shared_ptr<_TimingSink>;
@@ -5,9 +5,11 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include "Base/NumberGenerator.h"
+#include "Base/Parallel.h"
 #include "Base/Math.h"
+#include "Base/RandomStream.h"
 #include "GenomeDescriptions.h"
-#include "SpaceCalculator.h"
+#include "SpatialGrid.h"
 #include "GenomeDescriptionService.h"
 
 DataDescription DescriptionEditService::createRect(CreateRectParameters const& parameters)
@@ -164,72 +166,253 @@ namespace
     }
 }
 
-void DescriptionEditService::duplicate(ClusteredDataDescription& data, IntVector2D const& origSize, IntVector2D const& size)
+namespace
 {
-    ClusteredDataDescription result;
+    //the new creature id is a function of the original one such that cells of the same creature can be processed independently
+    int getNewCreatureId(int origCreatureId, uint32_t seed)
+    {
+        RandomStream randomStream(seed, static_cast<uint32_t>(origCreatureId));
+        int result = 0;
+        while (result == 0) {
+            result = static_cast<int>(randomStream.getRandomInt());
+        }
+        return result;
+    }
 
-    for (int incX = 0; incX < size.x; incX += origSize.x) {
-        for (int incY = 0; incY < size.y; incY += origSize.y) {
-            generateNewCreatureIds(data);
-
-            for (auto cluster : data.clusters) {
-                auto origPos = cluster.getClusterPosFromCells();
-                RealVector2D clusterPos = {origPos.x + incX, origPos.y + incY};
-                if (clusterPos.x < size.x && clusterPos.y < size.y) {
-                    for (auto& cell : cluster.cells) {
-                        cell.pos = RealVector2D{cell.pos.x + incX, cell.pos.y + incY};
-                        if (incX > 0 || incY > 0) {
-                            removeMetadata(cell);
-                        }
-                    }
-                    generateNewIds(cluster);
+    void generateNewCreatureIds(CellDescription& cell, uint32_t seed)
+    {
+        if (cell.creatureId != 0) {
+            cell.creatureId = getNewCreatureId(cell.creatureId, seed);
+        }
+        if (cell.getCellFunctionType() == CellFunction_Constructor) {
+            auto& offspringCreatureId = std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId;
+            offspringCreatureId = getNewCreatureId(offspringCreatureId, seed);
+        }
+    }
 
-                    result.addCluster(cluster);
-                }
+    //indices of the connected cells within the cluster in the order of the cells and their connections (-1 for cells not present)
+    std::vector<int> calcConnectionIndices(ClusterDescription const& cluster)
+    {
+        std::unordered_map<uint64_t, int> indexById;
+        indexById.reserve(cluster.cells.size());
+        for (int index = 0; index < toInt(cluster.cells.size()); ++index) {
+            indexById.emplace(cluster.cells[index].id, index);
+        }
+        std::vector<int> result;
+        for (auto const& cell : cluster.cells) {
+            for (auto const& connection : cell.connections) {
+                auto findResult = indexById.find(connection.cellId);
+                result.emplace_back(findResult != indexById.end() ? findResult->second : -1);
             }
-            for (auto particle : data.particles) {
-                auto origPos = particle.pos;
-                particle.pos = RealVector2D{origPos.x + incX, origPos.y + incY};
-                if (particle.pos.x < size.x && particle.pos.y < size.y) {
-                    particle.setId(NumberGenerator::get().getId());
-                    result.addParticle(particle);
+        }
+        return result;
+    }
+
+    //moves cells to the periodic images nearest to their connected cells and the cluster center into [0, worldSize)
+    //=> clusters crossing the world boundary become contiguous and keep their connections when the world is enlarged
+    void unwrapCluster(ClusterDescription& cluster, std::vector<int> const& connectionIndices, IntVector2D const& worldSize)
+    {
+        auto numCells = toInt(cluster.cells.size());
+        if (numCells == 0) {
+            return;
+        }
+        std::vector<int> connectionsOffset(numCells + 1, 0);
+        for (int index = 0; index < numCells; ++index) {
+            connectionsOffset[index + 1] = connectionsOffset[index] + toInt(cluster.cells[index].connections.size());
+        }
+
+        auto getImageShift = [](float delta, int size) { return std::round(delta / toFloat(size)) * toFloat(size); };
+        std::vector<bool> visited(numCells, false);
+        std::vector<int> queue;
+        queue.reserve(numCells);
+        for (int root = 0; root < numCells; ++root) {
+            if (visited[root]) {
+                continue;
+            }
+            visited[root] = true;
+            queue.clear();
+            queue.emplace_back(root);
+            for (int queueIndex = 0; queueIndex < toInt(queue.size()); ++queueIndex) {
+                auto index = queue[queueIndex];
+                auto const& pos = cluster.cells[index].pos;
+                for (int i = connectionsOffset[index]; i < connectionsOffset[index + 1]; ++i) {
+                    auto neighborIndex = connectionIndices[i];
+                    if (neighborIndex == -1 || visited[neighborIndex]) {
+                        continue;
+                    }
+                    visited[neighborIndex] = true;
+                    auto& neighborPos = cluster.cells[neighborIndex].pos;
+                    neighborPos.x -= getImageShift(neighborPos.x - pos.x, worldSize.x);
+                    neighborPos.y -= getImageShift(neighborPos.y - pos.y, worldSize.y);
+                    queue.emplace_back(neighborIndex);
                 }
             }
         }
+
+        auto center = cluster.getClusterPosFromCells();
+        RealVector2D shift{std::floor(center.x / toFloat(worldSize.x)) * toFloat(worldSize.x), std::floor(center.y / toFloat(worldSize.y)) * toFloat(worldSize.y)};
+        if (shift.x != 0 || shift.y != 0) {
+            for (auto& cell : cluster.cells) {
+                cell.pos -= shift;
+            }
+        }
     }
-    data = result;
 }
 
-namespace
+void DescriptionEditService::duplicate(ClusteredDataDescription& data, IntVector2D const& origSize, IntVector2D const& size, int maxThreads)
 {
-    std::vector<int> getCellIndicesWithinRadius(
-        DataDescription const& data,
-        std::unordered_map<int, std::unordered_map<int, std::vector<int>>> const& cellIndicesBySlot,
-        RealVector2D const& pos,
-        float radius)
+    auto numClusters = toInt(data.clusters.size());
+    std::vector<std::vector<int>> connectionIndicesByCluster(numClusters);
+    std::vector<RealVector2D> clusterPositions(numClusters);
+    Parallel::forEachPartition(
+        numClusters,
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                auto& cluster = data.clusters[index];
+                connectionIndicesByCluster[index] = calcConnectionIndices(cluster);
+                unwrapCluster(cluster, connectionIndicesByCluster[index], origSize);
+                clusterPositions[index] = cluster.getClusterPosFromCells();
+            }
+        },
+        maxThreads);
+
+    //the target tile set with the copied clusters and particles is determined up front such that the ids can be assigned in bulk
+    struct Tile
     {
-        std::vector<int> result;
-        IntVector2D upperLeftIntPos{toInt(pos.x - radius - 0.5f), toInt(pos.y - radius - 0.5f)};
-        IntVector2D lowerRightIntPos{toInt(pos.x + radius + 0.5f), toInt(pos.y + radius + 0.5f)};
-        for (int x = upperLeftIntPos.x; x <= lowerRightIntPos.x; ++x) {
-            for (int y = upperLeftIntPos.y; y <= lowerRightIntPos.y; ++y) {
-                if (cellIndicesBySlot.find(x) != cellIndicesBySlot.end()) {
-                    if (cellIndicesBySlot.at(x).find(y) != cellIndicesBySlot.at(x).end()) {
-                        for (auto const& cellIndex : cellIndicesBySlot.at(x).at(y)) {
-                            auto const& cell = data.cells.at(cellIndex);
-                            if (Math::length(cell.pos - pos) <= radius) {
-                                result.emplace_back(cellIndex);
-                            }
+        RealVector2D increment;
+    };
+    struct Copy
+    {
+        int tileIndex = 0;
+        int origIndex = 0;
+        uint64_t firstId = 0;
+    };
+    std::vector<Tile> tiles;
+    for (int incX = 0; incX < size.x; incX += origSize.x) {
+        for (int incY = 0; incY < size.y; incY += origSize.y) {
+            tiles.emplace_back(Tile{RealVector2D{toFloat(incX), toFloat(incY)}});
+        }
+    }
+
+    //each pair of tile and original creature id gets its own creature id
+    std::unordered_map<int, int> creatureIdIndexByOrigCreatureId;
+    auto addOrigCreatureId = [&](int creatureId) { creatureIdIndexByOrigCreatureId.emplace(creatureId, toInt(creatureIdIndexByOrigCreatureId.size())); };
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            if (cell.creatureId != 0) {
+                addOrigCreatureId(cell.creatureId);
+            }
+            if (cell.getCellFunctionType() == CellFunction_Constructor) {
+                addOrigCreatureId(std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId);
+            }
+        }
+    }
+    auto numOrigCreatureIds = toInt(creatureIdIndexByOrigCreatureId.size());
+    auto firstCreatureId = NumberGenerator::get().getIds(toInt(tiles.size()) * numOrigCreatureIds);
+    auto getNewCreatureId = [&](int tileIndex, int origCreatureId) {
+        return static_cast<int>(static_cast<uint32_t>(firstCreatureId + tileIndex * numOrigCreatureIds + creatureIdIndexByOrigCreatureId.at(origCreatureId)));
+    };
+    uint64_t numIds = 0;
+    std::vector<Copy> clusterCopies;
+    std::vector<Copy> particleCopies;
+    for (int tileIndex = 0; tileIndex < toInt(tiles.size()); ++tileIndex) {
+        auto const& increment = tiles[tileIndex].increment;
+        for (int index = 0; index < numClusters; ++index) {
+            if (clusterPositions[index].x + increment.x < size.x && clusterPositions[index].y + increment.y < size.y) {
+                clusterCopies.emplace_back(Copy{tileIndex, index, numIds});
+                numIds += data.clusters[index].cells.size();
+            }
+        }
+        for (int index = 0; index < toInt(data.particles.size()); ++index) {
+            auto const& pos = data.particles[index].pos;
+            if (pos.x + increment.x < size.x && pos.y + increment.y < size.y) {
+                particleCopies.emplace_back(Copy{tileIndex, index, numIds});
+                ++numIds;
+            }
+        }
+    }
+    auto firstId = NumberGenerator::get().getIds(toInt(numIds));
+
+    ClusteredDataDescription result;
+    result.clusters.resize(clusterCopies.size());
+    result.particles.resize(particleCopies.size());
+    Parallel::forEachPartition(
+        toInt(clusterCopies.size()),
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                auto const& copy = clusterCopies[index];
+                auto const& tile = tiles[copy.tileIndex];
+                auto const& connectionIndices = connectionIndicesByCluster[copy.origIndex];
+                auto& cluster = result.clusters[index];
+                cluster = data.clusters[copy.origIndex];
+
+                auto connectionIndex = 0;
+                for (int cellIndex = 0; cellIndex < toInt(cluster.cells.size()); ++cellIndex) {
+                    auto& cell = cluster.cells[cellIndex];
+                    cell.id = firstId + copy.firstId + cellIndex;
+                    cell.pos += tile.increment;
+
+                    //connections to cells outside the cluster are dropped and their angles passed to the next connection
+                    std::vector<ConnectionDescription> newConnections;
+                    float angleToAdd = 0;
+                    for (auto connection : cell.connections) {
+                        auto connectedIndex = connectionIndices[connectionIndex++];
+                        if (connectedIndex == -1) {
+                            angleToAdd += connection.angleFromPrevious;
+                        } else {
+                            connection.cellId = firstId + copy.firstId + connectedIndex;
+                            connection.angleFromPrevious += angleToAdd;
+                            angleToAdd = 0;
+                            newConnections.emplace_back(connection);
                         }
                     }
+                    if (angleToAdd > NEAR_ZERO && !newConnections.empty()) {
+                        newConnections.front().angleFromPrevious += angleToAdd;
+                    }
+                    cell.connections = std::move(newConnections);
+
+                    if (copy.tileIndex > 0) {
+                        removeMetadata(cell);
+                    }
+                    if (cell.creatureId != 0) {
+                        cell.creatureId = getNewCreatureId(copy.tileIndex, cell.creatureId);
+                    }
+                    if (cell.getCellFunctionType() == CellFunction_Constructor) {
+                        auto& offspringCreatureId = std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId;
+                        offspringCreatureId = getNewCreatureId(copy.tileIndex, offspringCreatureId);
+                    }
                 }
             }
+        },
+        maxThreads);
+    Parallel::forEachPartition(
+        toInt(particleCopies.size()),
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                auto const& copy = particleCopies[index];
+                auto& particle = result.particles[index];
+                particle = data.particles[copy.origIndex];
+                particle.id = firstId + copy.firstId;
+                particle.pos += tiles[copy.tileIndex].increment;
+            }
+        },
+        maxThreads);
+    data = std::move(result);
+}
+
+namespace
+{
+    std::vector<int> getCellIndicesWithinRadius(SpatialGrid const& cellGrid, RealVector2D const& pos, float radius)
+    {
+        std::vector<std::pair<float, int>> distanceAndIndices;
+        cellGrid.forEachWithinRadius(pos, radius, [&](int index, float distance) { distanceAndIndices.emplace_back(distance, index); });
+        std::sort(distanceAndIndices.begin(), distanceAndIndices.end());
+
+        std::vector<int> result;
+        result.reserve(distanceAndIndices.size());
+        for (auto const& [distance, index] : distanceAndIndices) {
+            result.emplace_back(index);
         }
-        std::sort(result.begin(), result.end(), [&](int index1, int index2) {
-            auto const& cell1 = data.cells.at(index1);
-            auto const& cell2 = data.cells.at(index2);
-            return Math::length(cell1.pos - pos) < Math::length(cell2.pos - pos);
-        });
         return result;
     }
 }
@@ -270,18 +453,21 @@ DataDescription DescriptionEditService::randomMultiply(
     DataDescription&& existentData,
     bool& overlappingCheckSuccessful)
 {
+    if (parameters._parallelPlacement) {
+        return randomMultiplyParallel(input, parameters, worldSize, existentData, overlappingCheckSuccessful);
+    }
+
     overlappingCheckSuccessful = true;
-    SpaceCalculator spaceCalculator(worldSize);
-    std::unordered_map<IntVector2D, std::vector<RealVector2D>> cellPosBySlot;
+    SpatialGrid cellGrid(worldSize, 2.0f);
 
-    //create map for overlapping check
+    //create grid for overlapping check
     if (parameters._overlappingCheck) {
-        int index = 0;
+        std::vector<RealVector2D> cellPositions;
+        cellPositions.reserve(existentData.cells.size());
         for (auto const& cell : existentData.cells) {
-            auto intPos = toIntVector2D(spaceCalculator.getCorrectedPosition(cell.pos));
-            cellPosBySlot[intPos].emplace_back(cell.pos);
-            ++index;
+            cellPositions.emplace_back(cell.pos);
         }
+        cellGrid.build(cellPositions);
     }
 
     //do multiplication
@@ -306,9 +492,9 @@ DataDescription DescriptionEditService::randomMultiply(
             overlapping = false;
             if (parameters._overlappingCheck) {
                 for (auto const& cell : copy.cells) {
-                    auto pos = spaceCalculator.getCorrectedPosition(cell.pos);
-                    if (isCellPresent(cellPosBySlot, spaceCalculator, pos, 2.0f)) {
+                    if (cellGrid.isOccupied(cell.pos, 2.0f)) {
                         overlapping = true;
+                        break;
                     }
                 }
             }
@@ -322,17 +508,204 @@ DataDescription DescriptionEditService::randomMultiply(
         generateNewCreatureIds(copy);
         result.add(copy);
 
-        //add copy to existentData for overlapping check
+        //add copy to grid for overlapping check
         if (parameters._overlappingCheck) {
             for (auto const& cell : copy.cells) {
-                auto index = toInt(existentData.cells.size());
-                existentData.cells.emplace_back(cell);
-                auto intPos = toIntVector2D(spaceCalculator.getCorrectedPosition(cell.pos));
-                cellPosBySlot[intPos].emplace_back(cell.pos);
+                cellGrid.insert(cell.pos);
+            }
+        }
+    }
+
+    return result;
+}
+
+namespace
+{
+    auto constexpr MaxPlacementAttemptsPerCopy = 200;
+    auto constexpr MinPlacementCandidatesPerRound = 64;
+
+    struct PlacementCandidate
+    {
+        RealVector2D shift;
+        float angle = 0;
+        RealVector2D velDelta;
+        float angularVelDelta = 0;
+    };
+}
+
+DataDescription DescriptionEditService::randomMultiplyParallel(
+    DataDescription const& input,
+    RandomMultiplyParameters const& parameters,
+    IntVector2D const& worldSize,
+    DataDescription const& existentData,
+    bool& overlappingCheckSuccessful)
+{
+    overlappingCheckSuccessful = true;
+    auto& numberGen = NumberGenerator::get();
+
+    DataDescription result = input;
+    generateNewIds(result);
+    if (input.isEmpty() || parameters._number <= 0) {
+        return result;
+    }
+
+    //read-only snapshot for overlapping check
+    SpatialGrid cellGrid(worldSize, 2.0f);
+    if (parameters._overlappingCheck) {
+        std::vector<RealVector2D> cellPositions;
+        cellPositions.reserve(existentData.cells.size());
+        for (auto const& cell : existentData.cells) {
+            cellPositions.emplace_back(cell.pos);
+        }
+        cellGrid.build(cellPositions);
+    }
+
+    auto center = input.calcCenter();
+    std::vector<RealVector2D> relCellPositions;
+    relCellPositions.reserve(input.cells.size());
+    for (auto const& cell : input.cells) {
+        relCellPositions.emplace_back(cell.pos - center);
+    }
+    auto calcCellPositions = [&](PlacementCandidate const& candidate, std::vector<RealVector2D>& cellPositions) {
+        auto rotationMatrix = Math::calcRotationMatrix(candidate.angle);
+        for (size_t i = 0; i < relCellPositions.size(); ++i) {
+            cellPositions[i] = center + candidate.shift + rotationMatrix * relCellPositions[i];
+        }
+    };
+    auto createCandidate = [&] {
+        PlacementCandidate result;
+        result.shift = {toFloat(numberGen.getRandomReal(0, toInt(worldSize.x))), toFloat(numberGen.getRandomReal(0, toInt(worldSize.y)))};
+        result.angle = toFloat(toInt(numberGen.getRandomReal(parameters._minAngle, parameters._maxAngle)));
+        result.velDelta = {
+            toFloat(numberGen.getRandomReal(parameters._minVelX, parameters._maxVelX)),
+            toFloat(numberGen.getRandomReal(parameters._minVelY, parameters._maxVelY))};
+        result.angularVelDelta = toFloat(numberGen.getRandomReal(parameters._minAngularVel, parameters._maxAngularVel));
+        return result;
+    };
+
+    //place copies in rounds: candidates are tested concurrently against the snapshot, conflicts among them are resolved in candidate order
+    std::vector<PlacementCandidate> acceptedCandidates;
+    acceptedCandidates.reserve(parameters._number);
+    auto remainingAttempts = parameters._number * MaxPlacementAttemptsPerCopy;
+    while (toInt(acceptedCandidates.size()) < parameters._number) {
+        auto numMissingCopies = parameters._number - toInt(acceptedCandidates.size());
+        if (!parameters._overlappingCheck || remainingAttempts <= 0) {
+            if (remainingAttempts <= 0) {
+                overlappingCheckSuccessful = false;
+            }
+            for (int i = 0; i < numMissingCopies; ++i) {
+                acceptedCandidates.emplace_back(createCandidate());
             }
+            break;
+        }
+
+        auto numCandidates = std::min(remainingAttempts, std::max(2 * numMissingCopies, MinPlacementCandidatesPerRound));
+        remainingAttempts -= numCandidates;
+        std::vector<PlacementCandidate> candidates;
+        candidates.reserve(numCandidates);
+        for (int i = 0; i < numCandidates; ++i) {
+            candidates.emplace_back(createCandidate());
+        }
+
+        std::vector<char> overlapping(numCandidates, false);
+        Parallel::forEachPartition(numCandidates, [&](ParallelPartition const& partition) {
+            std::vector<RealVector2D> cellPositions(relCellPositions.size());
+            for (int i = partition.startIndex; i <= partition.endIndex; ++i) {
+                calcCellPositions(candidates[i], cellPositions);
+                for (auto const& pos : cellPositions) {
+                    if (cellGrid.isOccupied(pos, 2.0f)) {
+                        overlapping[i] = true;
+                        break;
+                    }
+                }
+            }
+        });
+
+        auto roundGridCellSize = std::sqrt(toFloat(worldSize.x) * toFloat(worldSize.y) / toFloat(std::max(1, numCandidates * toInt(relCellPositions.size()))));
+        SpatialGrid roundGrid(worldSize, std::max(2.0f, roundGridCellSize));
+        std::vector<RealVector2D> cellPositions(relCellPositions.size());
+        for (int i = 0; i < numCandidates && toInt(acceptedCandidates.size()) < parameters._number; ++i) {
+            if (overlapping[i]) {
+                continue;
+            }
+            calcCellPositions(candidates[i], cellPositions);
+            auto conflicting = std::any_of(cellPositions.begin(), cellPositions.end(), [&](auto const& pos) { return roundGrid.isOccupied(pos, 2.0f); });
+            if (conflicting) {
+                continue;
+            }
+            for (auto const& pos : cellPositions) {
+                roundGrid.insert(pos);
+            }
+            acceptedCandidates.emplace_back(candidates[i]);
+        }
+        for (int i = 0; i < roundGrid.getNumEntries(); ++i) {
+            cellGrid.insert(roundGrid.getPos(i));
         }
     }
 
+    //draw new ids sequentially
+    std::unordered_map<uint64_t, int> cellIndexById;
+    for (auto const& [index, cell] : input.cells | boost::adaptors::indexed(0)) {
+        cellIndexById.emplace(cell.id, toInt(index));
+    }
+    std::unordered_map<int, int> creatureIdIndexByOrigCreatureId;
+    auto addOrigCreatureId = [&](int creatureId) { creatureIdIndexByOrigCreatureId.emplace(creatureId, toInt(creatureIdIndexByOrigCreatureId.size())); };
+    for (auto const& cell : input.cells) {
+        if (cell.creatureId != 0) {
+            addOrigCreatureId(cell.creatureId);
+        }
+        if (cell.getCellFunctionType() == CellFunction_Constructor) {
+            addOrigCreatureId(std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId);
+        }
+    }
+    auto numCopies = toInt(acceptedCandidates.size());
+    std::vector<uint64_t> firstCellIds(numCopies);
+    std::vector<int> newCreatureIds(numCopies * creatureIdIndexByOrigCreatureId.size());
+    for (int i = 0; i < numCopies; ++i) {
+        firstCellIds[i] = numberGen.getIds(toInt(input.cells.size()));
+    }
+    for (auto& creatureId : newCreatureIds) {
+        do {
+            creatureId = numberGen.getRandomInt();
+        } while (creatureId == 0);
+    }
+
+    //materialize accepted copies directly into the result
+    auto templateData = input;
+    removeMetadata(templateData);
+    auto numOrigCells = result.cells.size();
+    auto numOrigParticles = result.particles.size();
+    result.cells.resize(numOrigCells + input.cells.size() * numCopies);
+    result.particles.resize(numOrigParticles + input.particles.size() * numCopies);
+    Parallel::forEachPartition(numCopies, [&](ParallelPartition const& partition) {
+        for (int i = partition.startIndex; i <= partition.endIndex; ++i) {
+            auto const& candidate = acceptedCandidates[i];
+            auto copy = templateData;
+            copy.shift(candidate.shift);
+            copy.rotate(candidate.angle);
+            copy.accelerate(candidate.velDelta, candidate.angularVelDelta);
+
+            auto getNewCreatureId = [&](int origCreatureId) {
+                return newCreatureIds[i * creatureIdIndexByOrigCreatureId.size() + creatureIdIndexByOrigCreatureId.at(origCreatureId)];
+            };
+            for (size_t index = 0; index < copy.cells.size(); ++index) {
+                auto& cell = copy.cells[index];
+                cell.id = firstCellIds[i] + index;
+                for (auto& connection : cell.connections) {
+                    connection.cellId = firstCellIds[i] + cellIndexById.at(connection.cellId);
+                }
+                if (cell.creatureId != 0) {
+                    cell.creatureId = getNewCreatureId(cell.creatureId);
+                }
+                if (cell.getCellFunctionType() == CellFunction_Constructor) {
+                    auto& offspringCreatureId = std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId;
+                    offspringCreatureId = getNewCreatureId(offspringCreatureId);
+                }
+            }
+            std::move(copy.cells.begin(), copy.cells.end(), result.cells.begin() + numOrigCells + i * input.cells.size());
+            std::move(copy.particles.begin(), copy.particles.end(), result.particles.begin() + numOrigParticles + i * input.particles.size());
+        }
+    });
     return result;
 }
 
@@ -343,33 +716,33 @@ void DescriptionEditService::addIfSpaceAvailable(
     float distance,
     IntVector2D const& worldSize)
 {
-    SpaceCalculator space(worldSize);
+    cellOccupancy.setWorldSize(worldSize);
 
     for (auto const& cell : toAdd.cells) {
-        if (!isCellPresent(cellOccupancy, space, cell.pos, distance)) {
+        if (!cellOccupancy.isOccupied(cell.pos, distance)) {
             result.addCell(cell);
-            cellOccupancy[toIntVector2D(cell.pos)].emplace_back(cell.pos);
+            cellOccupancy.insert(cell.pos);
         }
     }
 }
 
 void DescriptionEditService::reconnectCells(DataDescription& data, float maxDistance)
 {
-    std::unordered_map<int, std::unordered_map<int, std::vector<int>>> cellIndicesBySlot;
-
-    int index = 0;
+    std::vector<RealVector2D> cellPositions;
+    cellPositions.reserve(data.cells.size());
     for (auto& cell : data.cells) {
         cell.connections.clear();
-        cellIndicesBySlot[toInt(cell.pos.x)][toInt(cell.pos.y)].emplace_back(toInt(index));
-        ++index;
+        cellPositions.emplace_back(cell.pos);
     }
+    SpatialGrid cellGrid(maxDistance);
+    cellGrid.build(cellPositions);
 
     std::unordered_map<uint64_t, int> cache;
     for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
         cache.emplace(cell.id, static_cast<int>(index));
     }
     for (auto& cell : data.cells) {
-        auto nearbyCellIndices = getCellIndicesWithinRadius(data, cellIndicesBySlot, cell.pos, maxDistance);
+        auto nearbyCellIndices = getCellIndicesWithinRadius(cellGrid, cell.pos, maxDistance);
         for (auto const& nearbyCellIndex : nearbyCellIndices) {
             auto const& nearbyCell = data.cells.at(nearbyCellIndex);
             if (cell.id != nearbyCell.id && cell.connections.size() < cell.maxConnections && nearbyCell.connections.size() < nearbyCell.maxConnections
@@ -418,16 +791,49 @@ void DescriptionEditService::correctConnections(ClusteredDataDescription& data,
     }
 }
 
-void DescriptionEditService::randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes)
+namespace
 {
-    for (auto& cluster : data.clusters) {
-        auto newColor = colorCodes[NumberGenerator::get().getRandomInt(toInt(colorCodes.size()))];
-        for (auto& cell : cluster.cells) {
-            cell.color = newColor;
+    //calls func(cluster, randomStream) in parallel, each cluster draws from its own random stream such that the result does not depend on the
+    //number of threads and only on the state of the number generator
+    template <typename Func>
+    void forEachClusterParallel(ClusteredDataDescription& data, Func const& func, int maxThreads)
+    {
+        auto seed = NumberGenerator::get().getRandomInt();
+        Parallel::forEachPartition(
+            toInt(data.clusters.size()),
+            [&](ParallelPartition const& partition) {
+                for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                    RandomStream randomStream(seed, index);
+                    func(data.clusters[index], randomStream);
+                }
+            },
+            maxThreads);
+    }
+
+    //uniformly distributed in [min, max], the bounds are swapped if max < min
+    int getRandomIntInRange(RandomStream& randomStream, int min, int max)
+    {
+        if (max < min) {
+            std::swap(min, max);
         }
+        auto range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+        return toInt(min + static_cast<int64_t>(randomStream.getRandomInt() % range));
     }
 }
 
+void DescriptionEditService::randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, int maxThreads)
+{
+    forEachClusterParallel(
+        data,
+        [&](ClusterDescription& cluster, RandomStream& randomStream) {
+            auto newColor = colorCodes[randomStream.getRandomInt(toInt(colorCodes.size()))];
+            for (auto& cell : cluster.cells) {
+                cell.color = newColor;
+            }
+        },
+        maxThreads);
+}
+
 namespace
 {
     void colorizeGenomeNodes(std::vector<uint8_t>& genome, int color)
@@ -443,61 +849,76 @@ namespace
     }
 }
 
-void DescriptionEditService::randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes)
+void DescriptionEditService::randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, int maxThreads)
 {
-    for (auto& cluster : data.clusters) {
-        auto newColor = colorCodes[NumberGenerator::get().getRandomInt(toInt(colorCodes.size()))];
-        for (auto& cell : cluster.cells) {
-            if (cell.hasGenome()) {
-                colorizeGenomeNodes(cell.getGenomeRef(), newColor);
+    forEachClusterParallel(
+        data,
+        [&](ClusterDescription& cluster, RandomStream& randomStream) {
+            auto newColor = colorCodes[randomStream.getRandomInt(toInt(colorCodes.size()))];
+            for (auto& cell : cluster.cells) {
+                if (cell.hasGenome()) {
+                    colorizeGenomeNodes(cell.getGenomeRef(), newColor);
+                }
             }
-        }
-    }
+        },
+        maxThreads);
 }
 
-void DescriptionEditService::randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy)
+void DescriptionEditService::randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy, int maxThreads)
 {
-    for (auto& cluster : data.clusters) {
-        auto energy = NumberGenerator::get().getRandomReal(toDouble(minEnergy), toDouble(maxEnergy));
-        for (auto& cell : cluster.cells) {
-            cell.energy = energy;
-        }
-    }
+    forEachClusterParallel(
+        data,
+        [&](ClusterDescription& cluster, RandomStream& randomStream) {
+            auto energy = randomStream.getRandomFloat(minEnergy, maxEnergy);
+            for (auto& cell : cluster.cells) {
+                cell.energy = energy;
+            }
+        },
+        maxThreads);
 }
 
-void DescriptionEditService::randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge)
+void DescriptionEditService::randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge, int maxThreads)
 {
-    for (auto& cluster : data.clusters) {
-        auto age = NumberGenerator::get().getRandomReal(toDouble(minAge), toDouble(maxAge));
-        for (auto& cell : cluster.cells) {
-            cell.age = age;
-        }
-    }
+    forEachClusterParallel(
+        data,
+        [&](ClusterDescription& cluster, RandomStream& randomStream) {
+            auto age = getRandomIntInRange(randomStream, minAge, maxAge);
+            for (auto& cell : cluster.cells) {
+                cell.age = age;
+            }
+        },
+        maxThreads);
 }
 
-void DescriptionEditService::randomizeCountdowns(ClusteredDataDescription& data, int minValue, int maxValue)
+void DescriptionEditService::randomizeCountdowns(ClusteredDataDescription& data, int minValue, int maxValue, int maxThreads)
 {
-    for (auto& cluster : data.clusters) {
-        auto countdown = NumberGenerator::get().getRandomReal(toDouble(minValue), toDouble(maxValue));
-        for (auto& cell : cluster.cells) {
-            if (cell.getCellFunctionType() == CellFunction_Detonator) {
-                std::get<DetonatorDescription>(*cell.cellFunction).countdown = countdown;
+    forEachClusterParallel(
+        data,
+        [&](ClusterDescription& cluster, RandomStream& randomStream) {
+            auto countdown = getRandomIntInRange(randomStream, minValue, maxValue);
+            for (auto& cell : cluster.cells) {
+                if (cell.getCellFunctionType() == CellFunction_Detonator) {
+                    std::get<DetonatorDescription>(*cell.cellFunction).countdown = countdown;
+                }
             }
-        }
-    }
+        },
+        maxThreads);
 }
 
-void DescriptionEditService::randomizeMutationIds(ClusteredDataDescription& data)
+void DescriptionEditService::randomizeMutationIds(ClusteredDataDescription& data, int maxThreads)
 {
-    for (auto& cluster : data.clusters) {
-        auto mutationId = NumberGenerator::get().getRandomInt() % 65536;
-        for (auto& cell : cluster.cells) {
-            cell.mutationId = toInt(mutationId);
-            if (cell.getCellFunctionType() == CellFunction_Constructor) {
-                std::get<ConstructorDescription>(*cell.cellFunction).offspringMutationId = toInt(mutationId);
+    forEachClusterParallel(
+        data,
+        [&](ClusterDescription& cluster, RandomStream& randomStream) {
+            auto mutationId = toInt(randomStream.getRandomInt() % 65536);
+            for (auto& cell : cluster.cells) {
+                cell.mutationId = mutationId;
+                if (cell.getCellFunctionType() == CellFunction_Constructor) {
+                    std::get<ConstructorDescription>(*cell.cellFunction).offspringMutationId = mutationId;
+                }
             }
-        }
-    }
+        },
+        maxThreads);
 }
 
 void DescriptionEditService::generateExecutionOrderNumbers(DataDescription& data, std::unordered_set<uint64_t> const& cellIds, int maxBranchNumbers)
@@ -558,95 +979,35 @@ void DescriptionEditService::removeMetadata(DataDescription& data)
     }
 }
 
-namespace
-{
-    int getNewCreatureId(int origCreatureId, std::unordered_map<int, int>& origToNewCreatureIdMap)
-    {
-        auto findResult = origToNewCreatureIdMap.find(origCreatureId);
-        if (findResult != origToNewCreatureIdMap.end()) {
-            return findResult->second;
-        } else {
-            int newCreatureId = 0;
-            while (newCreatureId == 0) {
-                newCreatureId = NumberGenerator::get().getRandomInt();
-            }
-            origToNewCreatureIdMap.emplace(origCreatureId, newCreatureId);
-            return newCreatureId;
-        }
-    };
-
-}
-
 void DescriptionEditService::generateNewCreatureIds(DataDescription& data)
 {
-    std::unordered_map<int, int> origToNewCreatureIdMap;
+    auto seed = NumberGenerator::get().getRandomInt();
     for (auto& cell : data.cells) {
-        if (cell.creatureId != 0) {
-            cell.creatureId = getNewCreatureId(cell.creatureId, origToNewCreatureIdMap);
-        }
-        if (cell.getCellFunctionType() == CellFunction_Constructor) {
-            auto& offspringCreatureId = std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId;
-            offspringCreatureId = getNewCreatureId(offspringCreatureId, origToNewCreatureIdMap);
-        }
+        ::generateNewCreatureIds(cell, seed);
     }
 }
 
-void DescriptionEditService::generateNewCreatureIds(ClusteredDataDescription& data)
+void DescriptionEditService::generateNewCreatureIds(ClusteredDataDescription& data, int maxThreads)
 {
-    std::unordered_map<int, int> origToNewCreatureIdMap;
-    for (auto& cluster: data.clusters) {
-        for (auto& cell : cluster.cells) {
-            if (cell.creatureId != 0) {
-                cell.creatureId = getNewCreatureId(cell.creatureId, origToNewCreatureIdMap);
-            }
-            if (cell.getCellFunctionType() == CellFunction_Constructor) {
-                auto& offspringCreatureId = std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId;
-                offspringCreatureId = getNewCreatureId(offspringCreatureId, origToNewCreatureIdMap);
+    auto seed = NumberGenerator::get().getRandomInt();
+    Parallel::forEachPartition(
+        toInt(data.clusters.size()),
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                for (auto& cell : data.clusters[index].cells) {
+                    ::generateNewCreatureIds(cell, seed);
+                }
             }
-        }
-    }
+        },
+        maxThreads);
 }
 
-
 void DescriptionEditService::removeMetadata(CellDescription& cell)
 {
     cell.metadata.description.clear();
     cell.metadata.name.clear();
 }
 
-bool DescriptionEditService::isCellPresent(Occupancy const& cellPosBySlot, SpaceCalculator const& spaceCalculator, RealVector2D const& posToCheck, float distance)
-{
-    auto intPos = toIntVector2D(posToCheck);
-
-    auto getMatchingSlots = [&cellPosBySlot](IntVector2D const& intPos) {
-        auto findResult = cellPosBySlot.find(intPos);
-        if (findResult != cellPosBySlot.end()) {
-            return findResult->second;
-        }
-        return std::vector<RealVector2D>{};
-    };
-
-    auto isOccupied = [&](std::vector<RealVector2D> const& cellPositions) {
-        for (auto const& cellPos : cellPositions) {
-            auto otherPos = spaceCalculator.getCorrectedPosition(cellPos);
-            if (Math::length(posToCheck - otherPos) < distance) {
-                return true;
-            }
-        }
-        return false;
-    };
-
-    auto distanceInt = toInt(ceilf(distance));
-    for (int dx = -distanceInt; dx <= distanceInt; ++dx) {
-        for (int dy = -distanceInt; dy <= distanceInt; ++dy) {
-            if (isOccupied(getMatchingSlots({intPos.x + dx, intPos.y + dy}))) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
 uint64_t DescriptionEditService::getId(CellOrParticleDescription const& entity)
 {
     if (std::holds_alternative<CellDescription>(entity)) {
@@ -4,6 +4,7 @@
 #include "Base/Singleton.h"
 
 #include "Descriptions.h"
+#include "SpatialGrid.h"
 
 class DescriptionEditService
 {
@@ -57,7 +58,9 @@ public:
     };
     DataDescription createUnconnectedCircle(CreateUnconnectedCircleParameters const& parameters);
 
-    void duplicate(ClusteredDataDescription& data, IntVector2D const& origWorldSize, IntVector2D const& worldSize);
+    //tiles the content of the original world over the enlarged world, the tiles are processed in parallel
+    //each copied cell and particle gets a new id, each tile gets new creature ids and clusters crossing the world boundary are kept contiguous
+    void duplicate(ClusteredDataDescription& data, IntVector2D const& origWorldSize, IntVector2D const& worldSize, int maxThreads = 0);
 
     struct GridMultiplyParameters
     {
@@ -88,6 +91,7 @@ public:
         MEMBER_DECLARATION(RandomMultiplyParameters, float, minAngularVel, 0);
         MEMBER_DECLARATION(RandomMultiplyParameters, float, maxAngularVel, 0);
         MEMBER_DECLARATION(RandomMultiplyParameters, bool, overlappingCheck, false);
+        MEMBER_DECLARATION(RandomMultiplyParameters, bool, parallelPlacement, false);
     };
     DataDescription randomMultiply(
         DataDescription const& input,
@@ -96,7 +100,7 @@ public:
         DataDescription&& existentData,
         bool& overlappingCheckSuccessful);
 
-    using Occupancy = std::unordered_map<IntVector2D, std::vector<RealVector2D>>;
+    using Occupancy = SpatialGrid;
     void
     addIfSpaceAvailable(DataDescription& result, Occupancy& cellOccupancy, DataDescription const& toAdd, float distance, IntVector2D const& worldSize);
 
@@ -104,12 +108,14 @@ public:
     void removeStickiness(DataDescription& data);
     void correctConnections(ClusteredDataDescription& data, IntVector2D const& worldSize);
 
-    void randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes);
-    void randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes);
-    void randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy);
-    void randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge);
-    void randomizeCountdowns(ClusteredDataDescription& data, int minValue, int maxValue);
-    void randomizeMutationIds(ClusteredDataDescription& data);
+    //the following operations run in parallel over the clusters, each cluster draws from its own random stream
+    //=> for a given state of the NumberGenerator the result does not depend on maxThreads (0 = number of hardware threads)
+    void randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, int maxThreads = 0);
+    void randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, int maxThreads = 0);
+    void randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy, int maxThreads = 0);
+    void randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge, int maxThreads = 0);
+    void randomizeCountdowns(ClusteredDataDescription& data, int minValue, int maxValue, int maxThreads = 0);
+    void randomizeMutationIds(ClusteredDataDescription& data, int maxThreads = 0);
 
     void generateExecutionOrderNumbers(DataDescription& data, std::unordered_set<uint64_t> const& cellIds, int maxBranchNumbers);
 
@@ -119,14 +125,16 @@ public:
     std::vector<CellOrParticleDescription> getConstructorToMainGenomes(DataDescription const& data);
 
     void removeMetadata(DataDescription& data);
-    void generateNewCreatureIds(DataDescription& data);
-    void generateNewCreatureIds(ClusteredDataDescription& data);
+    void generateNewCreatureIds(DataDescription& data);  //equal creature ids are mapped to equal new ones
+    void generateNewCreatureIds(ClusteredDataDescription& data, int maxThreads = 0);  //in parallel over the clusters
 
 private:
+    DataDescription randomMultiplyParallel(
+        DataDescription const& input,
+        RandomMultiplyParameters const& parameters,
+        IntVector2D const& worldSize,
+        DataDescription const& existentData,
+        bool& overlappingCheckSuccessful);
+
     void removeMetadata(CellDescription& cell);
-    bool isCellPresent(
-        Occupancy const& cellPosBySlot,
-        SpaceCalculator const& spaceCalculator,
-        RealVector2D const& posToCheck,
-        float distance);
 };
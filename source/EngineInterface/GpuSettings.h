@@ -1,12 +1,18 @@
 #pragma once
 
+#include <cstdint>
+
 struct GpuSettings
 {
     int numBlocks = 16384;
 
+    //random numbers are drawn from counter-based streams per thread which are seeded with randomSeed, takes effect when a simulation is created
+    bool deterministicRandomNumbers = false;
+    uint32_t randomSeed = 0;
+
     bool operator==(GpuSettings const& other) const
     {
-        return numBlocks == other.numBlocks;
+        return numBlocks == other.numBlocks && deterministicRandomNumbers == other.deterministicRandomNumbers && randomSeed == other.randomSeed;
     }
 
     bool operator!=(GpuSettings const& other) const { return !operator==(other); }
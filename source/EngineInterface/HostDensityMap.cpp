@@ -0,0 +1,176 @@
+#include "HostDensityMap.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "EngineConstants.h"
+
+HostDensityMap::HostDensityMap(IntVector2D const& worldSize, int slotSize)
+    : _slotSize(slotSize)
+    , _densityMapSize{worldSize.x / slotSize, worldSize.y / slotSize}
+{
+    auto numSlots = static_cast<size_t>(_densityMapSize.x) * _densityMapSize.y;
+    _colorDensityMap.resize(numSlots, 0);
+    _otherMutantDensityMap.resize(numSlots, 0);
+    _sameMutantDensityMap1.resize(numSlots, 0);
+    _sameMutantDensityMap2.resize(numSlots, 0);
+    _specificMutantDensityMap.resize(numSlots, 0);
+    _lessGenomeComplexityDensityMap1.resize(numSlots, 0);
+    _lessGenomeComplexityDensityMap2.resize(numSlots, 0);
+    _moreGenomeComplexityDensityMap1.resize(numSlots, 0);
+    _moreGenomeComplexityDensityMap2.resize(numSlots, 0);
+}
+
+void HostDensityMap::addCell(uint64_t timestep, RealVector2D const& pos, int color, uint32_t mutationId, float genomeComplexity)
+{
+    auto index = getIndex(pos);
+    if (index == -1) {
+        return;
+    }
+    color = ((color % MAX_COLORS) + MAX_COLORS) % MAX_COLORS;
+    _colorDensityMap[index] += (1ull << (color * 8)) | (1ull << 56);
+
+    if (mutationId == 0) {
+        _specificMutantDensityMap[index] += 1;
+    } else if (mutationId == 1) {
+        _specificMutantDensityMap[index] += 0x100;
+    } else {
+        {
+            auto bucket = calcOtherMutantsBucket(mutationId, timestep);
+            _otherMutantDensityMap[index] += 0x0101010101010101ull ^ (1ull << (bucket * 8));
+        }
+        {
+            uint64_t bucket1 = mutationId % 3;
+            uint64_t bucket2 = mutationId % 5;
+            uint64_t bucket3 = mutationId % 7;
+            _sameMutantDensityMap1[index] += (1ull << (bucket1 * 8)) | (1ull << ((bucket2 + 3) * 8));
+            _sameMutantDensityMap2[index] += 1ull << (bucket3 * 8);
+        }
+        {
+            //less complex mutants are counted in all buckets above, more complex mutants in all buckets below
+            auto bucket = 32 - countLeadingZeros(convertGenomeComplexityToIntValue(genomeComplexity));
+            if (bucket < 8) {
+                auto lessBitset = 1ull << (bucket * 8);
+                auto moreBitset = lessBitset;
+                for (int i = 0; i < 7; ++i) {
+                    lessBitset |= lessBitset << 8;
+                    moreBitset |= moreBitset >> 8;
+                }
+                _lessGenomeComplexityDensityMap1[index] += lessBitset;
+                _lessGenomeComplexityDensityMap2[index] += 0x0101010101010101ull;
+                _moreGenomeComplexityDensityMap1[index] += moreBitset;
+            } else if (bucket < 16) {
+                auto lessBitset = 1ull << ((bucket - 8) * 8);
+                auto moreBitset = lessBitset;
+                for (int i = 0; i < 7; ++i) {
+                    lessBitset |= lessBitset << 8;
+                    moreBitset |= moreBitset >> 8;
+                }
+                _lessGenomeComplexityDensityMap2[index] += lessBitset;
+                _moreGenomeComplexityDensityMap2[index] += moreBitset;
+                _moreGenomeComplexityDensityMap1[index] += 0x0101010101010101ull;
+            }
+        }
+    }
+}
+
+uint32_t HostDensityMap::getCellDensity(RealVector2D const& pos) const
+{
+    auto index = getIndex(pos);
+    return index != -1 ? static_cast<uint32_t>((_colorDensityMap[index] >> 56) & 0xff) : 0;
+}
+
+uint32_t HostDensityMap::getColorDensity(RealVector2D const& pos, int color) const
+{
+    auto index = getIndex(pos);
+    return index != -1 ? static_cast<uint32_t>((_colorDensityMap[index] >> (color * 8)) & 0xff) : 0;
+}
+
+uint32_t HostDensityMap::getOtherMutantDensity(uint64_t timestep, RealVector2D const& pos, uint32_t mutationId) const
+{
+    auto index = getIndex(pos);
+    if (index == -1) {
+        return 0;
+    }
+    auto bucket = calcOtherMutantsBucket(mutationId, timestep);
+    return static_cast<uint32_t>((_otherMutantDensityMap[index] >> (bucket * 8)) & 0xff);
+}
+
+uint32_t HostDensityMap::getSameMutantDensity(RealVector2D const& pos, uint32_t mutationId) const
+{
+    auto index = getIndex(pos);
+    if (index == -1) {
+        return 0;
+    }
+    uint64_t bucket1 = mutationId % 3;
+    uint64_t bucket2 = mutationId % 5;
+    uint64_t bucket3 = mutationId % 7;
+    auto densityMapEntry = _sameMutantDensityMap1[index];
+    auto density1 = (densityMapEntry >> (bucket1 * 8)) & 0xff;
+    auto density2 = (densityMapEntry >> ((bucket2 + 3) * 8)) & 0xff;
+    auto density3 = (_sameMutantDensityMap2[index] >> (bucket3 * 8)) & 0xff;
+    return static_cast<uint32_t>(std::min({density1, density2, density3}));
+}
+
+uint32_t HostDensityMap::getEmergentCellDensity(RealVector2D const& pos) const
+{
+    auto index = getIndex(pos);
+    return index != -1 ? (_specificMutantDensityMap[index] >> 8) & 0xff : 0;
+}
+
+uint32_t HostDensityMap::getZeroMutantDensity(RealVector2D const& pos) const
+{
+    auto index = getIndex(pos);
+    return index != -1 ? _specificMutantDensityMap[index] & 0xff : 0;
+}
+
+uint32_t HostDensityMap::getLessComplexMutantDensity(RealVector2D const& pos, float genomeComplexity) const
+{
+    auto index = getIndex(pos);
+    if (index == -1) {
+        return 0;
+    }
+    auto bucket = std::min(16, std::max(0, 31 - countLeadingZeros(convertGenomeComplexityToIntValue(genomeComplexity))));
+    if (bucket < 8) {
+        return static_cast<uint32_t>((_lessGenomeComplexityDensityMap1[index] >> (bucket * 8)) & 0xff);
+    } else {
+        return static_cast<uint32_t>((_lessGenomeComplexityDensityMap2[index] >> ((bucket - 8) * 8)) & 0xff);
+    }
+}
+
+uint32_t HostDensityMap::getMoreComplexMutantDensity(RealVector2D const& pos, float genomeComplexity) const
+{
+    auto index = getIndex(pos);
+    if (index == -1) {
+        return 0;
+    }
+    auto bucket = std::min(16, std::max(0, 33 - countLeadingZeros(convertGenomeComplexityToIntValue(genomeComplexity))));
+    if (bucket < 8) {
+        return static_cast<uint32_t>((_moreGenomeComplexityDensityMap1[index] >> (bucket * 8)) & 0xff);
+    } else {
+        return static_cast<uint32_t>((_moreGenomeComplexityDensityMap2[index] >> ((bucket - 8) * 8)) & 0xff);
+    }
+}
+
+int HostDensityMap::getIndex(RealVector2D const& pos) const
+{
+    auto index = toInt(pos.x) / _slotSize + toInt(pos.y) / _slotSize * _densityMapSize.x;
+    return index >= 0 && index < _densityMapSize.x * _densityMapSize.y ? index : -1;
+}
+
+//timestep is used as an offset to avoid same buckets for different mutationIds for all times
+uint64_t HostDensityMap::calcOtherMutantsBucket(uint32_t mutationId, uint64_t timestep)
+{
+    return mutationId != 0 ? (static_cast<uint64_t>(mutationId) + timestep / 23) % 8 : 0;
+}
+
+uint32_t HostDensityMap::convertGenomeComplexityToIntValue(float genomeComplexity)
+{
+    return toInt(genomeComplexity * 10);
+}
+
+//corresponds to __clz
+int HostDensityMap::countLeadingZeros(uint32_t value)
+{
+    return std::countl_zero(value);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Vector2D.h"
+
+//host counterpart of DensityMap in the CUDA kernels with the same slot layout and bit packing, i.e. densities are saturated in the same way
+//all queries are const and can be called concurrently after the map has been filled
+class HostDensityMap
+{
+public:
+    static auto constexpr DefaultSlotSize = 8;  //as in PreprocessedSimulationData
+
+    HostDensityMap(IntVector2D const& worldSize, int slotSize = DefaultSlotSize);
+
+    void addCell(uint64_t timestep, RealVector2D const& pos, int color, uint32_t mutationId, float genomeComplexity);
+
+    uint32_t getCellDensity(RealVector2D const& pos) const;
+    uint32_t getColorDensity(RealVector2D const& pos, int color) const;
+    uint32_t getOtherMutantDensity(uint64_t timestep, RealVector2D const& pos, uint32_t mutationId) const;
+    uint32_t getSameMutantDensity(RealVector2D const& pos, uint32_t mutationId) const;
+    uint32_t getEmergentCellDensity(RealVector2D const& pos) const;
+    uint32_t getZeroMutantDensity(RealVector2D const& pos) const;
+    uint32_t getLessComplexMutantDensity(RealVector2D const& pos, float genomeComplexity) const;
+    uint32_t getMoreComplexMutantDensity(RealVector2D const& pos, float genomeComplexity) const;
+
+private:
+    int getIndex(RealVector2D const& pos) const;  //-1 if outside
+
+    static uint64_t calcOtherMutantsBucket(uint32_t mutationId, uint64_t timestep);
+    static uint32_t convertGenomeComplexityToIntValue(float genomeComplexity);
+    static int countLeadingZeros(uint32_t value);
+
+    int _slotSize;
+    IntVector2D _densityMapSize;
+    std::vector<uint64_t> _colorDensityMap;
+    std::vector<uint64_t> _otherMutantDensityMap;
+    std::vector<uint64_t> _sameMutantDensityMap1;
+    std::vector<uint64_t> _sameMutantDensityMap2;
+    std::vector<uint32_t> _specificMutantDensityMap;
+    std::vector<uint64_t> _lessGenomeComplexityDensityMap1;
+    std::vector<uint64_t> _lessGenomeComplexityDensityMap2;
+    std::vector<uint64_t> _moreGenomeComplexityDensityMap1;
+    std::vector<uint64_t> _moreGenomeComplexityDensityMap2;
+};
@@ -0,0 +1,287 @@
+#include "HostSensorScanner.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "Base/Math.h"
+#include "Base/Parallel.h"
+
+HostSensorScanner::HostSensorScanner(DataDescription const& data, IntVector2D const& worldSize, SimulationParameters const& parameters, uint64_t timestep)
+    : _data(data)
+    , _worldSize(worldSize)
+    , _parameters(parameters)
+    , _timestep(timestep)
+    , _densityMap(worldSize)
+    , _cellMap(static_cast<size_t>(worldSize.x) * worldSize.y, -1)
+{
+    _cellIndexById.reserve(data.cells.size());
+    for (int index = 0; index < toInt(data.cells.size()); ++index) {
+        auto const& cell = data.cells[index];
+        _densityMap.addCell(timestep, cell.pos, cell.color, static_cast<uint32_t>(cell.mutationId), cell.genomeComplexity);
+        _cellIndexById.emplace(cell.id, index);
+
+        auto& mapEntry = _cellMap[getCellMapIndex(cell.pos)];
+        if (mapEntry == -1) {
+            mapEntry = index;
+        }
+    }
+}
+
+HostDensityMap const& HostSensorScanner::getDensityMap() const
+{
+    return _densityMap;
+}
+
+SensorScanResult HostSensorScanner::scan(uint64_t sensorCellId) const
+{
+    auto findResult = _cellIndexById.find(sensorCellId);
+    if (findResult == _cellIndexById.end()) {
+        throw std::runtime_error("Cell " + std::to_string(sensorCellId) + " not found.");
+    }
+    auto const& cell = _data.cells[findResult->second];
+    return scan(cell, calcRefScanAngle(cell));
+}
+
+SensorScanResult HostSensorScanner::scan(CellDescription const& sensorCell, float refScanAngle) const
+{
+    if (sensorCell.getCellFunctionType() != CellFunction_Sensor) {
+        throw std::runtime_error("Cell " + std::to_string(sensorCell.id) + " is not a sensor.");
+    }
+    auto const& sensor = std::get<SensorDescription>(*sensorCell.cellFunction);
+    auto minDensity = toInt(sensor.minDensity * 64);
+    auto minRange = sensor.minRange.value_or(-1);
+    auto restrictToColor = sensor.restrictToColor.value_or(255);
+    auto restrictToMutants = sensor.restrictToMutants;
+
+    auto startRadius = calcStartDistanceForScanning(restrictToColor, restrictToMutants, sensorCell.color);
+    auto maxRange = _parameters.cellFunctionSensorRange[sensorCell.color];
+    if (sensor.maxRange.has_value() && *sensor.maxRange >= 0) {
+        maxRange = std::min(maxRange, toFloat(*sensor.maxRange));
+    }
+
+    //the minimum of the combined values yields the closest position, then the highest density and then the smallest angle
+    uint64_t lookupResult = 0xffffffffffffffffull;
+    bool blockedByWall[NumScanAngles] = {};
+    for (float radius = startRadius; radius <= maxRange; radius += ScanStep) {
+        if (minRange >= 0 && minRange > radius) {
+            continue;
+        }
+        for (int angleIndex = 0; angleIndex < NumScanAngles; ++angleIndex) {
+            float angle = 360.0f / NumScanAngles * angleIndex;
+            auto scanPos = sensorCell.pos + Math::unitVectorOfAngle(angle) * radius;
+            correctPosition(scanPos);
+
+            uint32_t density = 0;
+            if (!blockedByWall[angleIndex]) {
+                if (restrictToMutants == SensorRestrictToMutants_NoRestriction || restrictToMutants == SensorRestrictToMutants_RestrictToHandcraftedCells
+                    || _densityMap.getZeroMutantDensity(scanPos) == 0) {
+                    density = getCellDensity(sensorCell, restrictToColor, restrictToMutants, scanPos);
+                } else {
+                    blockedByWall[angleIndex] = true;
+                }
+            }
+            if (density < static_cast<uint32_t>(minDensity)) {
+                continue;
+            }
+            auto relAngleData = static_cast<uint32_t>(convertAngleToData(Math::subtractAngle(angle, refScanAngle)));
+            auto combined = static_cast<uint64_t>(radius) << 48 | static_cast<uint64_t>(density) << 40 | static_cast<uint64_t>(relAngleData) << 32;
+            lookupResult = std::min(lookupResult, combined);
+        }
+    }
+
+    SensorScanResult result;
+    if (lookupResult == 0xffffffffffffffffull) {
+        return result;
+    }
+    result.found = true;
+    result.density = static_cast<uint32_t>((lookupResult >> 40) & 0xff);
+    result.relAngle = convertDataToAngle(static_cast<uint8_t>((lookupResult >> 32) & 0xff));
+    result.distance = toFloat(lookupResult >> 48);
+
+    auto scanPos = sensorCell.pos + Math::unitVectorOfAngle(refScanAngle + result.relAngle) * result.distance;
+    result.detectedCellIds = getDetectedCellIds(sensorCell, scanPos);
+    result.target = getCorrectedDirection(scanPos - sensorCell.pos);
+
+    result.channels[0] = 1;
+    result.channels[1] = toFloat(result.density) / 64;
+    result.channels[2] = 1.0f - std::min(1.0f, result.distance / 256);
+    result.channels[3] = !_parameters.cellFunctionMuscleMovementTowardTargetedObject ? result.relAngle / 360.0f : 0;  //same condition as in the kernel
+    return result;
+}
+
+std::vector<std::pair<uint64_t, SensorScanResult>> HostSensorScanner::scanAllSensors(int maxThreads) const
+{
+    std::vector<int> sensorCellIndices;
+    for (int index = 0; index < toInt(_data.cells.size()); ++index) {
+        if (_data.cells[index].getCellFunctionType() == CellFunction_Sensor) {
+            sensorCellIndices.emplace_back(index);
+        }
+    }
+    std::vector<std::pair<uint64_t, SensorScanResult>> result(sensorCellIndices.size());
+    Parallel::forEachPartition(
+        toInt(sensorCellIndices.size()),
+        [&](ParallelPartition const& partition) {
+            for (int i = partition.startIndex; i <= partition.endIndex; ++i) {
+                auto const& cell = _data.cells[sensorCellIndices[i]];
+                result[i] = {cell.id, scan(cell, calcRefScanAngle(cell))};
+            }
+        },
+        maxThreads);
+    return result;
+}
+
+float HostSensorScanner::calcRefScanAngle(CellDescription const& cell) const
+{
+    RealVector2D direction;
+    for (auto const& connection : cell.connections) {
+        auto findResult = _cellIndexById.find(connection.cellId);
+        if (findResult == _cellIndexById.end()) {
+            continue;
+        }
+        auto const& connectedCell = _data.cells[findResult->second];
+        if (connectedCell.executionOrderNumber == cell.inputExecutionOrderNumber.value_or(-1) && !connectedCell.outputBlocked) {
+            auto directionDelta = getCorrectedDirection(cell.pos - connectedCell.pos);
+            Math::normalize(directionDelta);
+            direction += directionDelta;
+        }
+    }
+    Math::normalize(direction);
+    return Math::angleOfVector(direction);
+}
+
+uint32_t HostSensorScanner::getCellDensity(
+    CellDescription const& cell,
+    int restrictToColor,
+    SensorRestrictToMutants restrictToMutants,
+    RealVector2D const& scanPos) const
+{
+    if (restrictToMutants == SensorRestrictToMutants_NoRestriction) {
+        return restrictToColor == 255 ? _densityMap.getCellDensity(scanPos) : _densityMap.getColorDensity(scanPos, restrictToColor);
+    }
+    auto mutationId = static_cast<uint32_t>(cell.mutationId);
+    uint32_t result = 0;
+    if (restrictToMutants == SensorRestrictToMutants_RestrictToSameMutants) {
+        result = _densityMap.getSameMutantDensity(scanPos, mutationId);
+    } else if (restrictToMutants == SensorRestrictToMutants_RestrictToOtherMutants) {
+        result = _densityMap.getOtherMutantDensity(_timestep, scanPos, mutationId);
+    } else if (restrictToMutants == SensorRestrictToMutants_RestrictToFreeCells) {
+        result = _densityMap.getEmergentCellDensity(scanPos);
+    } else if (restrictToMutants == SensorRestrictToMutants_RestrictToHandcraftedCells) {
+        result = _densityMap.getZeroMutantDensity(scanPos);
+    } else if (restrictToMutants == SensorRestrictToMutants_RestrictToLessComplexMutants) {
+        result = _densityMap.getLessComplexMutantDensity(scanPos, cell.genomeComplexity);
+    } else if (restrictToMutants == SensorRestrictToMutants_RestrictToMoreComplexMutants) {
+        result = _densityMap.getMoreComplexMutantDensity(scanPos, cell.genomeComplexity);
+    }
+    if (restrictToColor != 255) {
+        result = std::min(result, _densityMap.getColorDensity(scanPos, restrictToColor));
+    }
+    return result;
+}
+
+std::vector<uint64_t> HostSensorScanner::getDetectedCellIds(CellDescription const& cell, RealVector2D const& scanPos) const
+{
+    auto const& sensor = std::get<SensorDescription>(*cell.cellFunction);
+    auto restrictToColor = sensor.restrictToColor.value_or(255);
+    auto restrictToMutants = sensor.restrictToMutants;
+
+    std::vector<uint64_t> result;
+    for (float dx = -3.0f; dx < 3.0f + NEAR_ZERO; dx += 1.0f) {
+        for (float dy = -3.0f; dy < 3.0f + NEAR_ZERO; dy += 1.0f) {
+            auto otherCellIndex = getFirstCellIndex(scanPos + RealVector2D{dx, dy});
+            if (otherCellIndex == -1) {
+                continue;
+            }
+            auto const& otherCell = _data.cells[otherCellIndex];
+            if (otherCell.id == cell.id) {
+                continue;
+            }
+            if (restrictToColor != 255 && otherCell.color != restrictToColor) {
+                continue;
+            }
+            if (restrictToMutants == SensorRestrictToMutants_RestrictToSameMutants && cell.mutationId != otherCell.mutationId) {
+                continue;
+            }
+            if (restrictToMutants == SensorRestrictToMutants_RestrictToOtherMutants
+                && (cell.mutationId == otherCell.mutationId || otherCell.mutationId == 0 || otherCell.mutationId == 1
+                    || static_cast<uint8_t>(cell.mutationId & 0xff) == otherCell.ancestorMutationId)) {
+                continue;
+            }
+            if (restrictToMutants == SensorRestrictToMutants_RestrictToFreeCells && otherCell.mutationId != 1) {
+                continue;
+            }
+            if (restrictToMutants == SensorRestrictToMutants_RestrictToHandcraftedCells && otherCell.mutationId != 0) {
+                continue;
+            }
+            if (restrictToMutants == SensorRestrictToMutants_RestrictToLessComplexMutants
+                && (otherCell.genomeComplexity >= cell.genomeComplexity || otherCell.mutationId == 0 || otherCell.mutationId == 1)) {
+                continue;
+            }
+            if (restrictToMutants == SensorRestrictToMutants_RestrictToMoreComplexMutants
+                && (otherCell.genomeComplexity <= cell.genomeComplexity || otherCell.mutationId == 0 || otherCell.mutationId == 1)) {
+                continue;
+            }
+            result.emplace_back(otherCell.id);
+        }
+    }
+    return result;
+}
+
+void HostSensorScanner::correctPosition(RealVector2D& pos) const
+{
+    auto intPartX = toInt(std::floor(pos.x));
+    auto intPartY = toInt(std::floor(pos.y));
+    RealVector2D fracPart{pos.x - toFloat(intPartX), pos.y - toFloat(intPartY)};
+    intPartX = ((intPartX % _worldSize.x) + _worldSize.x) % _worldSize.x;
+    intPartY = ((intPartY % _worldSize.y) + _worldSize.y) % _worldSize.y;
+    pos = {toFloat(intPartX) + fracPart.x, toFloat(intPartY) + fracPart.y};
+}
+
+RealVector2D HostSensorScanner::getCorrectedDirection(RealVector2D const& disp) const
+{
+    return {std::remainder(disp.x, toFloat(_worldSize.x)), std::remainder(disp.y, toFloat(_worldSize.y))};
+}
+
+int HostSensorScanner::getCellMapIndex(RealVector2D const& pos) const
+{
+    //wrapping the floored coordinates avoids float rounding issues, e.g. -1e-8 + worldSize.x would be rounded to worldSize.x
+    auto x = ((toInt(std::floor(pos.x)) % _worldSize.x) + _worldSize.x) % _worldSize.x;
+    auto y = ((toInt(std::floor(pos.y)) % _worldSize.y) + _worldSize.y) % _worldSize.y;
+    return x + y * _worldSize.x;
+}
+
+int HostSensorScanner::getFirstCellIndex(RealVector2D const& pos) const
+{
+    return _cellMap[getCellMapIndex(pos)];
+}
+
+float HostSensorScanner::calcStartDistanceForScanning(int restrictToColor, SensorRestrictToMutants restrictToMutants, int color)
+{
+    return (restrictToColor == 255 || restrictToColor == color)
+            && (restrictToMutants == SensorRestrictToMutants_NoRestriction || restrictToMutants == SensorRestrictToMutants_RestrictToSameMutants)
+        ? 14.0f
+        : 0.0f;
+}
+
+uint8_t HostSensorScanner::convertAngleToData(float angle)
+{
+    //0 to 180 degree => 0 to 128
+    //-180 to 0 degree => 128 to 256 (= 0)
+    angle = std::remainder(std::remainder(angle, 360.0f) + 360.0f, 360.0f);
+    if (angle > 180.0f) {
+        angle -= 360.0f;
+    }
+    return static_cast<uint8_t>(static_cast<int>(angle * 128.0f / 180.0f));
+}
+
+float HostSensorScanner::convertDataToAngle(uint8_t b)
+{
+    //0 to 127 => 0 to 179 degree
+    //128 to 255 => -179 to 0 degree
+    if (b < 128) {
+        return (0.5f + static_cast<float>(b)) * (180.0f / 128.0f);
+    } else {
+        return (-256.0f - 0.5f + static_cast<float>(b)) * (180.0f / 128.0f);
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Base/Vector2D.h"
+
+#include "Descriptions.h"
+#include "HostDensityMap.h"
+#include "SimulationParameters.h"
+
+struct SensorScanResult
+{
+    bool found = false;
+    uint32_t density = 0;  //density value of the density map at the target
+    float distance = 0;
+    float relAngle = 0;  //relative to the reference scan angle, in degrees between -180 and 180
+
+    //output of the sensor: channels 0 to 3, the direction to the target and the cells which would be flagged as detected
+    std::array<float, 4> channels = {0, 0, 0, 0};
+    RealVector2D target;
+    std::vector<uint64_t> detectedCellIds;
+};
+
+//host counterpart of the scanning in SensorProcessor: the density map and the cell map are built in one pass over the data
+//and all scan functions are const and can be called concurrently
+//sensors are scanned regardless of their input signal; a snapshot needs to be taken after the density map update, i.e. data and timestep belong together
+class HostSensorScanner
+{
+public:
+    //data is referenced and needs to outlive the scanner
+    HostSensorScanner(DataDescription const& data, IntVector2D const& worldSize, SimulationParameters const& parameters, uint64_t timestep);
+
+    HostDensityMap const& getDensityMap() const;
+
+    //the reference scan angle is derived from the input cells as in CellFunctionProcessor::calcSignalDirection
+    SensorScanResult scan(uint64_t sensorCellId) const;
+    SensorScanResult scan(CellDescription const& sensorCell, float refScanAngle) const;
+
+    //returns the results for all sensor cells in the order of the data
+    std::vector<std::pair<uint64_t, SensorScanResult>> scanAllSensors(int maxThreads = 0) const;
+
+private:
+    static int constexpr NumScanAngles = 64;
+    static float constexpr ScanStep = 8.0f;
+
+    float calcRefScanAngle(CellDescription const& cell) const;
+    uint32_t getCellDensity(CellDescription const& cell, int restrictToColor, SensorRestrictToMutants restrictToMutants, RealVector2D const& scanPos) const;
+    std::vector<uint64_t> getDetectedCellIds(CellDescription const& cell, RealVector2D const& scanPos) const;
+
+    void correctPosition(RealVector2D& pos) const;
+    RealVector2D getCorrectedDirection(RealVector2D const& disp) const;
+    int getCellMapIndex(RealVector2D const& pos) const;
+    int getFirstCellIndex(RealVector2D const& pos) const;  //-1 if none
+
+    static float calcStartDistanceForScanning(int restrictToColor, SensorRestrictToMutants restrictToMutants, int color);
+    static uint8_t convertAngleToData(float angle);
+    static float convertDataToAngle(uint8_t b);
+
+    DataDescription const& _data;
+    IntVector2D _worldSize;
+    SimulationParameters _parameters;
+    uint64_t _timestep = 0;
+
+    HostDensityMap _densityMap;
+    std::vector<int> _cellMap;  //first cell index for each integer position, -1 = empty
+    std::unordered_map<uint64_t, int> _cellIndexById;
+};
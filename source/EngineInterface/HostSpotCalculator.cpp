@@ -0,0 +1,208 @@
+#include "HostSpotCalculator.h"
+
+namespace
+{
+    //equals std::remainder(disp, size) for |disp| < size since the subtraction is exact then (Sterbenz lemma), but can be vectorized
+    float remainderForSmallDisplacement(float disp, float size)
+    {
+        auto result = disp > size / 2 ? disp - size : disp;
+        return result < -size / 2 ? result + size : result;
+    }
+
+    bool isInsideWorld(float pos, float size)
+    {
+        return pos >= 0 && pos < size;
+    }
+}
+
+HostSpotCalculator::HostSpotCalculator(SimulationParameters const& parameters, IntVector2D const& worldSize)
+    : _parameters(parameters)
+    , _worldSize{toFloat(worldSize.x), toFloat(worldSize.y)}
+{}
+
+float HostSpotCalculator::calcParameter(
+    float SimulationParametersZoneValues::*value,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    RealVector2D const& worldPos) const
+{
+    float spotValues[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            spotValues[numValues++] = _parameters.zone[i].values.*value;
+        }
+    }
+    return calcResultingValue(worldPos, _parameters.baseValues.*value, spotValues, valueActivated);
+}
+
+float HostSpotCalculator::calcParameter(
+    ColorVector<float> SimulationParametersZoneValues::*value,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    RealVector2D const& worldPos,
+    int color) const
+{
+    float spotValues[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            spotValues[numValues++] = (_parameters.zone[i].values.*value)[color];
+        }
+    }
+    return calcResultingValue(worldPos, (_parameters.baseValues.*value)[color], spotValues, valueActivated);
+}
+
+int HostSpotCalculator::calcParameter(
+    int SimulationParametersZoneValues::*value,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    RealVector2D const& worldPos) const
+{
+    float spotValues[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            spotValues[numValues++] = toFloat(_parameters.zone[i].values.*value);
+        }
+    }
+    return toInt(calcResultingValue(worldPos, toFloat(_parameters.baseValues.*value), spotValues, valueActivated));
+}
+
+bool HostSpotCalculator::calcParameter(
+    bool SimulationParametersZoneValues::*value,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    RealVector2D const& worldPos) const
+{
+    float spotValues[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            spotValues[numValues++] = _parameters.zone[i].values.*value ? 1.0f : 0.0f;
+        }
+    }
+    return calcResultingValue(worldPos, _parameters.baseValues.*value ? 1.0f : 0.0f, spotValues, valueActivated) > 0.5f;
+}
+
+float HostSpotCalculator::calcParameter(
+    ColorMatrix<float> SimulationParametersZoneValues::*value,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    RealVector2D const& worldPos,
+    int color1,
+    int color2) const
+{
+    float spotValues[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            spotValues[numValues++] = (_parameters.zone[i].values.*value)[color1][color2];
+        }
+    }
+    return calcResultingValue(worldPos, (_parameters.baseValues.*value)[color1][color2], spotValues, valueActivated);
+}
+
+int HostSpotCalculator::getFirstMatchingSpotOrBase(RealVector2D const& worldPos, bool SimulationParametersZoneActivatedValues::*valueActivated) const
+{
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            auto delta = getCorrectedDirection(RealVector2D{_parameters.zone[i].posX, _parameters.zone[i].posY} - worldPos);
+            if (calcWeight(delta, i) < NEAR_ZERO) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+RealVector2D HostSpotCalculator::getCorrectedDirection(RealVector2D const& disp) const
+{
+    return {std::remainder(disp.x, _worldSize.x), std::remainder(disp.y, _worldSize.y)};
+}
+
+float HostSpotCalculator::calcWeight(RealVector2D const& delta, int spotIndex) const
+{
+    auto const& spot = _parameters.zone[spotIndex];
+    if (spot.shapeType == SpotShapeType_Rectangular) {
+        float result = 0;
+        if (std::abs(delta.x) > spot.shapeData.rectangularSpot.width / 2 || std::abs(delta.y) > spot.shapeData.rectangularSpot.height / 2) {
+            RealVector2D distanceFromRect{
+                std::max(0.0f, std::abs(delta.x) - spot.shapeData.rectangularSpot.width / 2),
+                std::max(0.0f, std::abs(delta.y) - spot.shapeData.rectangularSpot.height / 2)};
+            result = std::min(1.0f, std::sqrt(distanceFromRect.x * distanceFromRect.x + distanceFromRect.y * distanceFromRect.y) / (spot.fadeoutRadius + 1));
+        }
+        return result;
+    } else {
+        auto distance = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+        auto coreRadius = spot.shapeData.circularSpot.coreRadius;
+        auto fadeoutRadius = spot.fadeoutRadius + 1;
+        return distance < coreRadius ? 0.0f : std::min(1.0f, (distance - coreRadius) / fadeoutRadius);
+    }
+}
+
+void HostSpotCalculator::calcResultingValuesForBlock(
+    RealVector2D const* positions,
+    int numPositions,
+    float baseValue,
+    float const* spotValues,
+    int const* zoneIndices,
+    int numValues,
+    float* result) const
+{
+    float spotWeights[MAX_ZONES][BlockSize];
+    float baseFactors[BlockSize];
+    float sums[BlockSize];
+    RealVector2D deltas[BlockSize];
+    std::fill(baseFactors, baseFactors + numPositions, 1.0f);
+    std::fill(sums, sums + numPositions, 0.0f);
+
+    auto positionsInsideWorld = true;
+    for (int j = 0; j < numPositions; ++j) {
+        positionsInsideWorld &= isInsideWorld(positions[j].x, _worldSize.x) && isInsideWorld(positions[j].y, _worldSize.y);
+    }
+
+    //same operations as in calcWeight and mix but zone by zone over all positions
+    for (int i = 0; i < numValues; ++i) {
+        auto const& spot = _parameters.zone[zoneIndices[i]];
+        auto weights = spotWeights[i];
+        if (positionsInsideWorld && isInsideWorld(spot.posX, _worldSize.x) && isInsideWorld(spot.posY, _worldSize.y)) {
+            for (int j = 0; j < numPositions; ++j) {
+                deltas[j] = {
+                    remainderForSmallDisplacement(spot.posX - positions[j].x, _worldSize.x), remainderForSmallDisplacement(spot.posY - positions[j].y, _worldSize.y)};
+            }
+        } else {
+            for (int j = 0; j < numPositions; ++j) {
+                deltas[j] = getCorrectedDirection(RealVector2D{spot.posX, spot.posY} - positions[j]);
+            }
+        }
+        if (spot.shapeType == SpotShapeType_Rectangular) {
+            auto halfWidth = spot.shapeData.rectangularSpot.width / 2;
+            auto halfHeight = spot.shapeData.rectangularSpot.height / 2;
+            auto fadeoutRadius = spot.fadeoutRadius + 1;
+            for (int j = 0; j < numPositions; ++j) {
+                auto deltaX = std::abs(deltas[j].x);
+                auto deltaY = std::abs(deltas[j].y);
+                auto distanceX = std::max(0.0f, deltaX - halfWidth);
+                auto distanceY = std::max(0.0f, deltaY - halfHeight);
+                weights[j] = deltaX > halfWidth || deltaY > halfHeight ? std::min(1.0f, std::sqrt(distanceX * distanceX + distanceY * distanceY) / fadeoutRadius)
+                                                                       : 0.0f;
+            }
+        } else {
+            auto coreRadius = spot.shapeData.circularSpot.coreRadius;
+            auto fadeoutRadius = spot.fadeoutRadius + 1;
+            for (int j = 0; j < numPositions; ++j) {
+                auto distance = std::sqrt(deltas[j].x * deltas[j].x + deltas[j].y * deltas[j].y);
+                weights[j] = distance < coreRadius ? 0.0f : std::min(1.0f, (distance - coreRadius) / fadeoutRadius);
+            }
+        }
+        for (int j = 0; j < numPositions; ++j) {
+            baseFactors[j] *= weights[j];
+            sums[j] += 1.0f - weights[j];
+        }
+    }
+    for (int j = 0; j < numPositions; ++j) {
+        sums[j] += baseFactors[j];
+        result[j] = baseValue * baseFactors[j];
+    }
+    for (int i = 0; i < numValues; ++i) {
+        for (int j = 0; j < numPositions; ++j) {
+            result[j] += spotValues[i] * (1.0f - spotWeights[i][j]) / sums[j];
+        }
+    }
+}
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Parallel.h"
+#include "Base/Vector2D.h"
+
+#include "SimulationParameters.h"
+
+//host counterpart of SpotCalculator in the CUDA kernels: evaluates the zone-dependent parameters with the same weighting
+//the bulk functions process blocks of positions zone by zone such that the inner loops run over contiguous arrays
+class HostSpotCalculator
+{
+public:
+    HostSpotCalculator(SimulationParameters const& parameters, IntVector2D const& worldSize);
+
+    template <typename T>
+    T calcResultingValue(RealVector2D const& worldPos, T const& baseValue, T const (&spotValues)[MAX_ZONES], bool SimulationParametersZoneActivatedValues::*valueActivated) const;
+    template <typename T>
+    T calcResultingValue(RealVector2D const& worldPos, T const& baseValue, T const (&spotValues)[MAX_ZONES]) const;
+    template <typename T>
+    T calcResultingFlowField(RealVector2D const& worldPos, T const& baseValue, T const (&spotValues)[MAX_ZONES]) const;
+
+    float calcParameter(float SimulationParametersZoneValues::*value, bool SimulationParametersZoneActivatedValues::*valueActivated, RealVector2D const& worldPos) const;
+    float calcParameter(
+        ColorVector<float> SimulationParametersZoneValues::*value,
+        bool SimulationParametersZoneActivatedValues::*valueActivated,
+        RealVector2D const& worldPos,
+        int color) const;
+    int calcParameter(int SimulationParametersZoneValues::*value, bool SimulationParametersZoneActivatedValues::*valueActivated, RealVector2D const& worldPos) const;
+    bool calcParameter(bool SimulationParametersZoneValues::*value, bool SimulationParametersZoneActivatedValues::*valueActivated, RealVector2D const& worldPos) const;
+    float calcParameter(
+        ColorMatrix<float> SimulationParametersZoneValues::*value,
+        bool SimulationParametersZoneActivatedValues::*valueActivated,
+        RealVector2D const& worldPos,
+        int color1,
+        int color2) const;
+
+    //return -1 for base
+    int getFirstMatchingSpotOrBase(RealVector2D const& worldPos, bool SimulationParametersZoneActivatedValues::*valueActivated) const;
+
+    //bulk evaluation: getValue(SimulationParametersZoneValues const&) -> float selects the parameter, results are identical to calcParameter
+    template <typename GetValueFunc>
+    std::vector<float> calcParameters(
+        std::vector<RealVector2D> const& positions,
+        GetValueFunc const& getValue,
+        bool SimulationParametersZoneActivatedValues::*valueActivated,
+        int maxThreads = 0) const;
+
+    //evaluates the centers of a resolution.x * resolution.y grid covering the world, the result is stored row by row
+    template <typename GetValueFunc>
+    std::vector<float> calcParameterMap(
+        IntVector2D const& resolution,
+        GetValueFunc const& getValue,
+        bool SimulationParametersZoneActivatedValues::*valueActivated,
+        int maxThreads = 0) const;
+
+private:
+    static auto constexpr BlockSize = 256;
+
+    RealVector2D getCorrectedDirection(RealVector2D const& disp) const;
+    float calcWeight(RealVector2D const& delta, int spotIndex) const;
+
+    template <typename T>
+    T mix(T const& baseValue, T const* spotValues, float const* spotWeights, int numValues) const;
+
+    //zoneIndices and spotValues contain numValues entries, positions and result point to numPositions <= BlockSize entries
+    void calcResultingValuesForBlock(
+        RealVector2D const* positions,
+        int numPositions,
+        float baseValue,
+        float const* spotValues,
+        int const* zoneIndices,
+        int numValues,
+        float* result) const;
+
+    template <typename GetPositionFunc, typename GetValueFunc>
+    std::vector<float> calcParametersIntern(
+        int numPositions,
+        GetPositionFunc const& getPosition,
+        GetValueFunc const& getValue,
+        bool SimulationParametersZoneActivatedValues::*valueActivated,
+        int maxThreads) const;
+
+    SimulationParameters const& _parameters;
+    RealVector2D _worldSize;
+};
+
+/**
+ * Implementations
+ */
+
+template <typename T>
+T HostSpotCalculator::calcResultingValue(
+    RealVector2D const& worldPos,
+    T const& baseValue,
+    T const (&spotValues)[MAX_ZONES],
+    bool SimulationParametersZoneActivatedValues::*valueActivated) const
+{
+    if (0 == _parameters.numZones) {
+        return baseValue;
+    }
+    float spotWeights[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            auto delta = getCorrectedDirection(RealVector2D{_parameters.zone[i].posX, _parameters.zone[i].posY} - worldPos);
+            spotWeights[numValues++] = calcWeight(delta, i);
+        }
+    }
+    return mix(baseValue, spotValues, spotWeights, numValues);
+}
+
+template <typename T>
+T HostSpotCalculator::calcResultingValue(RealVector2D const& worldPos, T const& baseValue, T const (&spotValues)[MAX_ZONES]) const
+{
+    if (0 == _parameters.numZones) {
+        return baseValue;
+    }
+    float spotWeights[MAX_ZONES];
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        auto delta = getCorrectedDirection(RealVector2D{_parameters.zone[i].posX, _parameters.zone[i].posY} - worldPos);
+        spotWeights[i] = calcWeight(delta, i);
+    }
+    return mix(baseValue, spotValues, spotWeights, _parameters.numZones);
+}
+
+template <typename T>
+T HostSpotCalculator::calcResultingFlowField(RealVector2D const& worldPos, T const& baseValue, T const (&spotValues)[MAX_ZONES]) const
+{
+    if (0 == _parameters.numZones) {
+        return baseValue;
+    }
+    float spotWeights[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].flowType != FlowType_None) {
+            auto delta = getCorrectedDirection(RealVector2D{_parameters.zone[i].posX, _parameters.zone[i].posY} - worldPos);
+            spotWeights[numValues++] = calcWeight(delta, i);
+        }
+    }
+    return mix(baseValue, spotValues, spotWeights, numValues);
+}
+
+template <typename GetValueFunc>
+std::vector<float> HostSpotCalculator::calcParameters(
+    std::vector<RealVector2D> const& positions,
+    GetValueFunc const& getValue,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    int maxThreads) const
+{
+    return calcParametersIntern(
+        toInt(positions.size()), [&](int index) { return positions[index]; }, getValue, valueActivated, maxThreads);
+}
+
+template <typename GetValueFunc>
+std::vector<float> HostSpotCalculator::calcParameterMap(
+    IntVector2D const& resolution,
+    GetValueFunc const& getValue,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    int maxThreads) const
+{
+    RealVector2D gridDistance{_worldSize.x / toFloat(resolution.x), _worldSize.y / toFloat(resolution.y)};
+    return calcParametersIntern(
+        resolution.x * resolution.y,
+        [&](int index) {
+            return RealVector2D{(toFloat(index % resolution.x) + 0.5f) * gridDistance.x, (toFloat(index / resolution.x) + 0.5f) * gridDistance.y};
+        },
+        getValue,
+        valueActivated,
+        maxThreads);
+}
+
+template <typename T>
+T HostSpotCalculator::mix(T const& baseValue, T const* spotValues, float const* spotWeights, int numValues) const
+{
+    float baseFactor = 1;
+    float sum = 0;
+    for (int i = 0; i < numValues; ++i) {
+        baseFactor *= spotWeights[i];
+        sum += 1.0f - spotWeights[i];
+    }
+    sum += baseFactor;
+    T result = baseValue * baseFactor;
+    for (int i = 0; i < numValues; ++i) {
+        result += spotValues[i] * (1.0f - spotWeights[i]) / sum;
+    }
+    return result;
+}
+
+template <typename GetPositionFunc, typename GetValueFunc>
+std::vector<float> HostSpotCalculator::calcParametersIntern(
+    int numPositions,
+    GetPositionFunc const& getPosition,
+    GetValueFunc const& getValue,
+    bool SimulationParametersZoneActivatedValues::*valueActivated,
+    int maxThreads) const
+{
+    auto baseValue = getValue(_parameters.baseValues);
+    float spotValues[MAX_ZONES];
+    int zoneIndices[MAX_ZONES];
+    int numValues = 0;
+    for (int i = 0; i < _parameters.numZones; ++i) {
+        if (_parameters.zone[i].activatedValues.*valueActivated) {
+            spotValues[numValues] = getValue(_parameters.zone[i].values);
+            zoneIndices[numValues] = i;
+            ++numValues;
+        }
+    }
+
+    std::vector<float> result(numPositions, baseValue);
+    if (0 == _parameters.numZones) {
+        return result;
+    }
+    auto numBlocks = (numPositions + BlockSize - 1) / BlockSize;
+    Parallel::forEachPartition(
+        numBlocks,
+        [&](ParallelPartition const& partition) {
+            RealVector2D positions[BlockSize];
+            for (int block = partition.startIndex; block <= partition.endIndex; ++block) {
+                auto startIndex = block * BlockSize;
+                auto numBlockPositions = std::min(BlockSize, numPositions - startIndex);
+                for (int i = 0; i < numBlockPositions; ++i) {
+                    positions[i] = getPosition(startIndex + i);
+                }
+                calcResultingValuesForBlock(positions, numBlockPositions, baseValue, spotValues, zoneIndices, numValues, result.data() + startIndex);
+            }
+        },
+        maxThreads);
+    return result;
+}
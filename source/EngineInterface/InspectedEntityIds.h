@@ -10,4 +10,12 @@ namespace Const
 struct InspectedEntityIds
 {
     uint64_t values[Const::MaxInspectedObjects];
-};
\ No newline at end of file
+};
+
+//variable-sized data which is only transferred for inspected entities when requested
+struct InspectedPayloads
+{
+    bool neuronData = true;
+    bool genomeData = true;
+    bool metadata = true;
+};
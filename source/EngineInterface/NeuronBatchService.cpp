@@ -0,0 +1,84 @@
+#include "NeuronBatchService.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Math.h"
+
+NeuronBatch NeuronBatchService::createBatch(std::vector<NeuronDescription> const& neurons) const
+{
+    NeuronBatch result;
+    result.numNeurons = toInt(neurons.size());
+    result.stride = (result.numNeurons + NeuronBatchLaneWidth - 1) / NeuronBatchLaneWidth * NeuronBatchLaneWidth;
+    result.weights.resize(MAX_CHANNELS * MAX_CHANNELS * result.stride, 0);
+    result.biases.resize(MAX_CHANNELS * result.stride, 0);
+    result.activationFunctions.resize(MAX_CHANNELS * result.stride, NeuronActivationFunction_Sigmoid);
+
+    for (int neuronIndex = 0; neuronIndex < result.numNeurons; ++neuronIndex) {
+        auto const& neuron = neurons[neuronIndex];
+        for (int row = 0; row < MAX_CHANNELS; ++row) {
+            for (int col = 0; col < MAX_CHANNELS; ++col) {
+                result.weights[(row * MAX_CHANNELS + col) * result.stride + neuronIndex] = neuron.weights[row][col];
+            }
+            result.biases[row * result.stride + neuronIndex] = neuron.biases[row];
+            result.activationFunctions[row * result.stride + neuronIndex] = neuron.activationFunctions[row];
+        }
+    }
+    return result;
+}
+
+NeuronBatchResult NeuronBatchService::evaluate(NeuronBatch const& batch, std::vector<std::vector<float>> const& inputSignals) const
+{
+    NeuronBatchResult result;
+    result.numNeurons = batch.numNeurons;
+    result.numSignals = toInt(inputSignals.size());
+    result.channels.resize(result.numSignals * MAX_CHANNELS * result.numNeurons);
+
+    auto const stride = batch.stride;
+    std::vector<float> sums(stride);
+    for (int signalIndex = 0; signalIndex < result.numSignals; ++signalIndex) {
+        auto const& input = inputSignals[signalIndex];
+        CHECK(input.size() == MAX_CHANNELS);
+
+        for (int row = 0; row < MAX_CHANNELS; ++row) {
+
+            //matrix-vector product for all neurons at once: inner loops run over contiguous neuron lanes
+            float* sumsPtr = sums.data();
+            float const* biasPtr = batch.biases.data() + row * stride;
+            for (int n = 0; n < stride; ++n) {
+                sumsPtr[n] = biasPtr[n];
+            }
+            for (int col = 0; col < MAX_CHANNELS; ++col) {
+                auto inputValue = input[col];
+                float const* weightPtr = batch.weights.data() + (row * MAX_CHANNELS + col) * stride;
+                for (int n = 0; n < stride; ++n) {
+                    sumsPtr[n] += weightPtr[n] * inputValue;
+                }
+            }
+
+            auto const* activationFunctionPtr = batch.activationFunctions.data() + row * stride;
+            auto* outputPtr = result.channels.data() + (signalIndex * MAX_CHANNELS + row) * result.numNeurons;
+            for (int n = 0; n < result.numNeurons; ++n) {
+                outputPtr[n] = applyActivationFunction(activationFunctionPtr[n], sumsPtr[n]);
+            }
+        }
+    }
+    return result;
+}
+
+float NeuronBatchService::applyActivationFunction(NeuronActivationFunction activationFunction, float x) const
+{
+    switch (activationFunction) {
+    case NeuronActivationFunction_Sigmoid:
+        return Math::sigmoid(x);
+    case NeuronActivationFunction_BinaryStep:
+        return Math::binaryStep(x);
+    case NeuronActivationFunction_Identity:
+        return std::max(-1.0f, std::min(1.0f, x));
+    case NeuronActivationFunction_Abs:
+        return std::min(1.0f, std::abs(x));
+    case NeuronActivationFunction_Gaussian:
+        return Math::gaussian(x);
+    }
+    return 0;
+}
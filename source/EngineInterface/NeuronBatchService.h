@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/Singleton.h"
+
+#include "Descriptions.h"
+
+//structure-of-arrays storage of many neuron networks: each matrix entry, bias and activation function is stored contiguously over all neurons
+struct NeuronBatch
+{
+    int numNeurons = 0;
+    int stride = 0;  //numNeurons padded to a multiple of NeuronBatchLaneWidth
+
+    std::vector<float> weights;  //index: (row * MAX_CHANNELS + col) * stride + neuronIndex
+    std::vector<float> biases;   //index: row * stride + neuronIndex
+    std::vector<NeuronActivationFunction> activationFunctions;  //index: row * stride + neuronIndex
+};
+
+struct NeuronBatchResult
+{
+    int numNeurons = 0;
+    int numSignals = 0;
+    std::vector<float> channels;  //index: (signalIndex * MAX_CHANNELS + channel) * numNeurons + neuronIndex
+
+    float at(int neuronIndex, int signalIndex, int channel) const { return channels[(signalIndex * MAX_CHANNELS + channel) * numNeurons + neuronIndex]; }
+};
+
+constexpr int NeuronBatchLaneWidth = 8;
+
+class NeuronBatchService
+{
+    MAKE_SINGLETON(NeuronBatchService);
+
+public:
+    NeuronBatch createBatch(std::vector<NeuronDescription> const& neurons) const;
+
+    //evaluates every neuron network of the batch for every input signal (each consisting of MAX_CHANNELS values)
+    NeuronBatchResult evaluate(NeuronBatch const& batch, std::vector<std::vector<float>> const& inputSignals) const;
+
+    //same semantics as in NeuronProcessor::applyActivationFunction, maps to [-1, 1]
+    float applyActivationFunction(NeuronActivationFunction activationFunction, float x) const;
+};
@@ -0,0 +1,284 @@
+#include "OfflineStatisticsService.h"
+
+#include <algorithm>
+#include <ranges>
+
+#include "GenomeConstants.h"
+
+namespace
+{
+    auto constexpr MutantToColorCountMapSize = 1 << 20;  //mutation ids are hashed as on the GPU
+    auto constexpr MinColonySize = 20;
+    auto constexpr MaxSubGenomeRecursionDepth = 15;
+
+    //out-of-range reads yield 0 since genomes from files may be truncated
+    uint8_t readByte(uint8_t const* genome, int genomeSize, int pos)
+    {
+        return pos >= 0 && pos < genomeSize ? genome[pos] : 0;
+    }
+
+    bool convertByteToBool(uint8_t b)
+    {
+        return static_cast<int8_t>(b) > 0;
+    }
+
+    CellFunction getCellFunctionType(uint8_t const* genome, int genomeSize, int nodeAddress)
+    {
+        return readByte(genome, genomeSize, nodeAddress) % CellFunction_Count;
+    }
+
+    int getCellFunctionFixedBytes(CellFunction cellFunction)
+    {
+        return cellFunction == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+    }
+
+    bool isMakeSelfCopy(uint8_t const* genome, int genomeSize, int nodeAddress)
+    {
+        auto cellFunction = getCellFunctionType(genome, genomeSize, nodeAddress);
+        return convertByteToBool(readByte(genome, genomeSize, nodeAddress + Const::CellBasicBytes + getCellFunctionFixedBytes(cellFunction)));
+    }
+
+    int getSubGenomeSize(uint8_t const* genome, int genomeSize, int nodeAddress)
+    {
+        auto cellFunction = getCellFunctionType(genome, genomeSize, nodeAddress);
+        auto subGenomeSizeIndex = nodeAddress + Const::CellBasicBytes + getCellFunctionFixedBytes(cellFunction) + 1;
+        auto size = static_cast<int>(readByte(genome, genomeSize, subGenomeSizeIndex)) | (static_cast<int>(readByte(genome, genomeSize, subGenomeSizeIndex + 1)) << 8);
+        return std::max(std::min(size, genomeSize - (subGenomeSizeIndex + 2)), 0);
+    }
+
+    int getCellFunctionDataSize(uint8_t const* genome, int genomeSize, int nodeAddress)
+    {
+        switch (getCellFunctionType(genome, genomeSize, nodeAddress)) {
+        case CellFunction_Neuron:
+            return Const::NeuronBytes;
+        case CellFunction_Transmitter:
+            return Const::TransmitterBytes;
+        case CellFunction_Constructor:
+            return isMakeSelfCopy(genome, genomeSize, nodeAddress) ? Const::ConstructorFixedBytes + 1
+                                                                   : Const::ConstructorFixedBytes + 3 + getSubGenomeSize(genome, genomeSize, nodeAddress);
+        case CellFunction_Sensor:
+            return Const::SensorBytes;
+        case CellFunction_Nerve:
+            return Const::NerveBytes;
+        case CellFunction_Attacker:
+            return Const::AttackerBytes;
+        case CellFunction_Injector:
+            return isMakeSelfCopy(genome, genomeSize, nodeAddress) ? Const::InjectorFixedBytes + 1
+                                                                   : Const::InjectorFixedBytes + 3 + getSubGenomeSize(genome, genomeSize, nodeAddress);
+        case CellFunction_Muscle:
+            return Const::MuscleBytes;
+        case CellFunction_Defender:
+            return Const::DefenderBytes;
+        case CellFunction_Reconnector:
+            return Const::ReconnectorBytes;
+        case CellFunction_Detonator:
+            return Const::DetonatorBytes;
+        default:
+            return 0;
+        }
+    }
+
+    int getNumBranches(uint8_t const* genome, int genomeSize, int headerAddress)
+    {
+        auto separating = convertByteToBool(readByte(genome, genomeSize, headerAddress + Const::GenomeHeaderSeparationPos));
+        return separating ? 1 : (readByte(genome, genomeSize, headerAddress + Const::GenomeHeaderNumBranchesPos) + 5) % 6 + 1;
+    }
+
+    int getNumRepetitionsCountingInfinityAsOne(uint8_t const* genome, int genomeSize, int headerAddress)
+    {
+        auto result = std::max(1, static_cast<int>(readByte(genome, genomeSize, headerAddress + Const::GenomeHeaderNumRepetitionsPos)));
+        return result == 255 ? 1 : result;
+    }
+
+    OfflineStatisticsService::CellInput createCellInput(CellDescription const& cell)
+    {
+        OfflineStatisticsService::CellInput result;
+        result.color = cell.color;
+        result.age = cell.age;
+        result.barrier = cell.barrier;
+        result.mutationId = static_cast<uint32_t>(cell.mutationId);
+        result.energy = cell.energy;
+        result.genomeComplexity = cell.genomeComplexity;
+        result.cellFunction = cell.getCellFunctionType();
+        if (result.cellFunction == CellFunction_Constructor) {
+            auto const& genome = std::get<ConstructorDescription>(*cell.cellFunction).genome;
+            result.genome = genome.data();
+            result.genomeSize = toInt(genome.size());
+        } else if (result.cellFunction == CellFunction_Injector) {
+            auto const& genome = std::get<InjectorDescription>(*cell.cellFunction).genome;
+            result.genome = genome.data();
+            result.genomeSize = toInt(genome.size());
+        }
+        return result;
+    }
+
+    OfflineStatisticsService::ParticleInput createParticleInput(ParticleDescription const& particle)
+    {
+        return {particle.color, particle.energy};
+    }
+}
+
+RawStatisticsData OfflineStatisticsService::calcStatistics(ClusteredDataDescription const& data, int maxThreads)
+{
+    std::vector<CellDescription const*> cells;
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            cells.emplace_back(&cell);
+        }
+    }
+    return calcStatistics(
+        toInt(cells.size()),
+        [&](int index) { return createCellInput(*cells.at(index)); },
+        toInt(data.particles.size()),
+        [&](int index) { return createParticleInput(data.particles.at(index)); },
+        maxThreads);
+}
+
+RawStatisticsData OfflineStatisticsService::calcStatistics(DataDescription const& data, int maxThreads)
+{
+    return calcStatistics(
+        toInt(data.cells.size()),
+        [&](int index) { return createCellInput(data.cells.at(index)); },
+        toInt(data.particles.size()),
+        [&](int index) { return createParticleInput(data.particles.at(index)); },
+        maxThreads);
+}
+
+bool OfflineStatisticsService::containsSelfReplication(uint8_t const* genome, int genomeSize)
+{
+    for (int nodeAddress = Const::GenomeHeaderSize; nodeAddress < genomeSize;) {
+        auto cellFunction = getCellFunctionType(genome, genomeSize, nodeAddress);
+        if ((cellFunction == CellFunction_Constructor || cellFunction == CellFunction_Injector) && isMakeSelfCopy(genome, genomeSize, nodeAddress)) {
+            return true;
+        }
+        nodeAddress += Const::CellBasicBytes + getCellFunctionDataSize(genome, genomeSize, nodeAddress);
+    }
+    return false;
+}
+
+int OfflineStatisticsService::getNumNodesRecursively(uint8_t const* genome, int genomeSize)
+{
+    if (genomeSize < Const::GenomeHeaderSize) {
+        return 0;
+    }
+    int subGenomeEndAddresses[MaxSubGenomeRecursionDepth];
+    int subGenomeNumRepetitions[MaxSubGenomeRecursionDepth + 1];
+    int depth = 0;
+    subGenomeNumRepetitions[0] = getNumRepetitionsCountingInfinityAsOne(genome, genomeSize, 0);
+
+    auto result = 0;
+    for (auto nodeAddress = Const::GenomeHeaderSize; nodeAddress < genomeSize;) {
+        auto cellFunction = getCellFunctionType(genome, genomeSize, nodeAddress);
+        result += subGenomeNumRepetitions[depth];
+
+        auto goToNextSibling = true;
+        if ((cellFunction == CellFunction_Constructor || cellFunction == CellFunction_Injector) && !isMakeSelfCopy(genome, genomeSize, nodeAddress)
+            && depth < MaxSubGenomeRecursionDepth) {
+            auto subGenomeSize = getSubGenomeSize(genome, genomeSize, nodeAddress);
+            nodeAddress += Const::CellBasicBytes + getCellFunctionFixedBytes(cellFunction) + 3;
+            subGenomeEndAddresses[depth++] = nodeAddress + subGenomeSize;
+
+            auto numBranches = getNumBranches(genome, genomeSize, nodeAddress);
+            auto numRepetitions = getNumRepetitionsCountingInfinityAsOne(genome, genomeSize, nodeAddress);
+            subGenomeNumRepetitions[depth] = subGenomeNumRepetitions[depth - 1] * numRepetitions * numBranches;
+            nodeAddress += Const::GenomeHeaderSize;
+            goToNextSibling = false;
+        }
+        if (goToNextSibling) {
+            nodeAddress += Const::CellBasicBytes + getCellFunctionDataSize(genome, genomeSize, nodeAddress);
+        }
+        while (depth > 0 && subGenomeEndAddresses[depth - 1] == nodeAddress) {
+            --depth;
+        }
+    }
+    return result;
+}
+
+void OfflineStatisticsService::addCell(PartialStatistics& statistics, CellInput const& cell) const
+{
+    auto& timestep = statistics.timestep;
+    ++timestep.numCells[cell.color];
+    if (cell.mutationId == Const::MutationIdForFreeCell) {
+        ++timestep.numFreeCells[cell.color];
+    }
+    statistics.totalEnergy[cell.color] += cell.energy;
+    if (cell.cellFunction == CellFunction_Constructor && containsSelfReplication(cell.genome, cell.genomeSize)) {
+        ++timestep.numSelfReplicators[cell.color];
+        auto& mutant = statistics.mutants[cell.mutationId % MutantToColorCountMapSize];
+        ++mutant.count;
+        mutant.color = std::max(mutant.color, cell.color);
+        mutant.genomeComplexity += cell.genomeComplexity;
+        timestep.numGenomeCells[cell.color] += getNumNodesRecursively(cell.genome, cell.genomeSize);
+        timestep.genomeComplexity[cell.color] += cell.genomeComplexity;
+        statistics.replicatorColorsAndComplexities.emplace_back(cell.color, cell.genomeComplexity);
+    }
+    if (cell.cellFunction == CellFunction_Injector && containsSelfReplication(cell.genome, cell.genomeSize)) {
+        ++timestep.numViruses[cell.color];
+    }
+    if (!cell.barrier) {
+        statistics.maxAge = std::max(statistics.maxAge, cell.age);
+    }
+}
+
+void OfflineStatisticsService::addParticle(PartialStatistics& statistics, ParticleInput const& particle) const
+{
+    ++statistics.timestep.numParticles[particle.color];
+    statistics.totalEnergy[particle.color] += particle.energy;
+}
+
+RawStatisticsData OfflineStatisticsService::mergeStatistics(std::vector<PartialStatistics> const& partialStatistics) const
+{
+    RawStatisticsData result;
+    auto& timestep = result.timeline.timestep;
+    ColorVector<double> totalEnergy = {0, 0, 0, 0, 0, 0, 0};
+    std::unordered_map<uint32_t, MutantStatistics> mutants;
+    result.histogram.maxValue = 0;
+    for (auto const& partial : partialStatistics) {
+        for (int color = 0; color < MAX_COLORS; ++color) {
+            timestep.numCells[color] += partial.timestep.numCells[color];
+            timestep.numSelfReplicators[color] += partial.timestep.numSelfReplicators[color];
+            timestep.numViruses[color] += partial.timestep.numViruses[color];
+            timestep.numFreeCells[color] += partial.timestep.numFreeCells[color];
+            timestep.numParticles[color] += partial.timestep.numParticles[color];
+            timestep.numGenomeCells[color] += partial.timestep.numGenomeCells[color];
+            timestep.genomeComplexity[color] += partial.timestep.genomeComplexity[color];
+            totalEnergy[color] += partial.totalEnergy[color];
+        }
+        for (auto const& [key, partialMutant] : partial.mutants) {
+            auto& mutant = mutants[key];
+            mutant.count += partialMutant.count;
+            mutant.color = std::max(mutant.color, partialMutant.color);
+            mutant.genomeComplexity += partialMutant.genomeComplexity;
+        }
+        result.histogram.maxValue = std::max(result.histogram.maxValue, partial.maxAge);
+    }
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        timestep.totalEnergy[color] = toFloat(totalEnergy[color]);
+
+        //corresponds to SimulationStatistics::halveNumConnections
+        timestep.numFreeCells[color] /= 2;
+    }
+
+    for (auto const& mutant : mutants | std::views::values) {
+        if (mutant.count >= MinColonySize) {
+            ++timestep.numColonies[mutant.color];
+            timestep.maxGenomeComplexityOfColonies[mutant.color] =
+                std::max(timestep.maxGenomeComplexityOfColonies[mutant.color], mutant.genomeComplexity / toFloat(mutant.count));
+        }
+    }
+
+    auto numReplicators = 0;
+    auto summedGenomeComplexity = 0.0;
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        numReplicators += timestep.numSelfReplicators[color];
+        summedGenomeComplexity += toDouble(timestep.genomeComplexity[color]);
+    }
+    auto averageGenomeComplexity = summedGenomeComplexity / toDouble(numReplicators);
+    for (auto const& partial : partialStatistics) {
+        for (auto const& [color, genomeComplexity] : partial.replicatorColorsAndComplexities) {
+            auto variance = toDouble(genomeComplexity) - averageGenomeComplexity;
+            timestep.genomeComplexityVariance[color] += variance * variance / toDouble(numReplicators);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Base/Parallel.h"
+#include "Base/Singleton.h"
+
+#include "CellFunctionConstants.h"
+#include "Descriptions.h"
+#include "RawStatisticsData.h"
+
+//computes the time step statistics and the age histogram of a simulation state on the host with the same definitions as StatisticsKernels.cu
+//accumulated statistics (e.g. number of attacks) are gathered during the simulation and cannot be recomputed from a state, hence they remain zero
+class OfflineStatisticsService
+{
+    MAKE_SINGLETON(OfflineStatisticsService);
+
+public:
+    RawStatisticsData calcStatistics(ClusteredDataDescription const& data, int maxThreads = 0);
+    RawStatisticsData calcStatistics(DataDescription const& data, int maxThreads = 0);
+
+    //view on a cell independent of its representation, genome is the constructor or injector genome (if any)
+    struct CellInput
+    {
+        int color = 0;
+        int age = 0;
+        bool barrier = false;
+        uint32_t mutationId = 0;
+        float energy = 0;
+        float genomeComplexity = 0;
+        CellFunction cellFunction = CellFunction_None;
+        uint8_t const* genome = nullptr;
+        int genomeSize = 0;
+    };
+    struct ParticleInput
+    {
+        int color = 0;
+        float energy = 0;
+    };
+
+    //getCell(int index) -> CellInput and getParticle(int index) -> ParticleInput are called concurrently
+    template <typename GetCellFunc, typename GetParticleFunc>
+    RawStatisticsData calcStatistics(int numCells, GetCellFunc const& getCell, int numParticles, GetParticleFunc const& getParticle, int maxThreads = 0);
+
+    //genome functions corresponding to GenomeDecoder
+    static bool containsSelfReplication(uint8_t const* genome, int genomeSize);
+    static int getNumNodesRecursively(uint8_t const* genome, int genomeSize);  //including repetitions and separated parts
+
+private:
+    struct MutantStatistics
+    {
+        int color = 0;
+        int count = 0;
+        float genomeComplexity = 0;
+    };
+    struct PartialStatistics
+    {
+        TimestepStatistics timestep;
+        ColorVector<double> totalEnergy = {0, 0, 0, 0, 0, 0, 0};
+        std::unordered_map<uint32_t, MutantStatistics> mutants;
+        std::vector<std::pair<int, float>> replicatorColorsAndComplexities;
+        int maxAge = 0;
+    };
+    void addCell(PartialStatistics& statistics, CellInput const& cell) const;
+    void addParticle(PartialStatistics& statistics, ParticleInput const& particle) const;
+    RawStatisticsData mergeStatistics(std::vector<PartialStatistics> const& partialStatistics) const;
+};
+
+/**
+ * Implementations
+ */
+
+template <typename GetCellFunc, typename GetParticleFunc>
+RawStatisticsData OfflineStatisticsService::calcStatistics(
+    int numCells,
+    GetCellFunc const& getCell,
+    int numParticles,
+    GetParticleFunc const& getParticle,
+    int maxThreads)
+{
+    auto numThreads = maxThreads > 0 ? maxThreads : Parallel::getNumThreads();
+    //each partition is processed by one call and gets its own partial result
+    std::vector<PartialStatistics> partialStatistics(numThreads * 2);
+    std::atomic<int> numUsedPartialStatistics = 0;
+    Parallel::forEachPartition(
+        numCells,
+        [&](ParallelPartition const& partition) {
+            auto& statistics = partialStatistics.at(numUsedPartialStatistics++);
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                addCell(statistics, getCell(index));
+            }
+        },
+        numThreads);
+    Parallel::forEachPartition(
+        numParticles,
+        [&](ParallelPartition const& partition) {
+            auto& statistics = partialStatistics.at(numUsedPartialStatistics++);
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                addParticle(statistics, getParticle(index));
+            }
+        },
+        numThreads);
+    auto result = mergeStatistics(partialStatistics);
+
+    //histogram requires the maximum age of all cells
+    auto maxAge = result.histogram.maxValue;
+    std::vector<std::vector<int>> partialHistograms(numThreads, std::vector<int>(MAX_COLORS * MAX_HISTOGRAM_SLOTS, 0));
+    std::atomic<int> numUsedPartialHistograms = 0;
+    Parallel::forEachPartition(
+        numCells,
+        [&](ParallelPartition const& partition) {
+            auto& histogram = partialHistograms.at(numUsedPartialHistograms++);
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                auto cell = getCell(index);
+                if (cell.barrier) {
+                    continue;
+                }
+                auto slot = static_cast<int>(static_cast<int64_t>(cell.age) * MAX_HISTOGRAM_SLOTS / (static_cast<int64_t>(maxAge) + 1));
+                ++histogram.at(cell.color * MAX_HISTOGRAM_SLOTS + slot);
+            }
+        },
+        numThreads);
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        for (int slot = 0; slot < MAX_HISTOGRAM_SLOTS; ++slot) {
+            result.histogram.numCellsByColorBySlot[color][slot] = 0;
+            for (auto const& histogram : partialHistograms) {
+                result.histogram.numCellsByColorBySlot[color][slot] += histogram.at(color * MAX_HISTOGRAM_SLOTS + slot);
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,229 @@
+#include "OverviewPyramid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Parallel.h"
+
+#include "Colors.h"
+
+namespace
+{
+    void addToTile(OverviewTile& tile, CellDescription const& cell)
+    {
+        ++tile.numCells;
+        ++tile.numCellsByColor[((cell.color % MAX_COLORS) + MAX_COLORS) % MAX_COLORS];
+        tile.energy += cell.energy;
+    }
+
+    void addToTile(OverviewTile& tile, ParticleDescription const& particle)
+    {
+        ++tile.numParticles;
+        tile.energy += particle.energy;
+    }
+}
+
+void OverviewTile::operator+=(OverviewTile const& other)
+{
+    numCells += other.numCells;
+    numParticles += other.numParticles;
+    energy += other.energy;
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        numCellsByColor[i] += other.numCellsByColor[i];
+    }
+}
+
+uint32_t OverviewTile::getAverageCellColor() const
+{
+    if (numCells == 0) {
+        return 0;
+    }
+    uint64_t r = 0, g = 0, b = 0;
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        auto color = Const::IndividualCellColors[i];
+        r += ((color >> 16) & 0xff) * numCellsByColor[i];
+        g += ((color >> 8) & 0xff) * numCellsByColor[i];
+        b += (color & 0xff) * numCellsByColor[i];
+    }
+    return static_cast<uint32_t>(r / numCells) << 16 | static_cast<uint32_t>(g / numCells) << 8 | static_cast<uint32_t>(b / numCells);
+}
+
+OverviewPyramid::OverviewPyramid(IntVector2D const& worldSize, int baseTileSize)
+    : _worldSize(worldSize)
+    , _baseTileSize(std::max(1, baseTileSize))
+{
+    IntVector2D levelSize{std::max(1, (worldSize.x + _baseTileSize - 1) / _baseTileSize), std::max(1, (worldSize.y + _baseTileSize - 1) / _baseTileSize)};
+    while (true) {
+        _levelSizes.emplace_back(levelSize);
+        _tilesByLevel.emplace_back(static_cast<size_t>(levelSize.x) * levelSize.y);
+        _changedTilesByLevel.emplace_back();
+        if (levelSize.x == 1 && levelSize.y == 1) {
+            break;
+        }
+        levelSize = {(levelSize.x + 1) / 2, (levelSize.y + 1) / 2};
+    }
+}
+
+void OverviewPyramid::update(DataDescription const& data, int maxThreads)
+{
+    std::vector<OverviewTile> baseTiles(_tilesByLevel.front().size());
+    for (auto const& cell : data.cells) {
+        addToTile(baseTiles[getBaseTileIndex(cell.pos)], cell);
+    }
+    for (auto const& particle : data.particles) {
+        addToTile(baseTiles[getBaseTileIndex(particle.pos)], particle);
+    }
+    updateBaseLevel(std::move(baseTiles), maxThreads);
+}
+
+void OverviewPyramid::update(ClusteredDataDescription const& data, int maxThreads)
+{
+    std::vector<OverviewTile> baseTiles(_tilesByLevel.front().size());
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            addToTile(baseTiles[getBaseTileIndex(cell.pos)], cell);
+        }
+    }
+    for (auto const& particle : data.particles) {
+        addToTile(baseTiles[getBaseTileIndex(particle.pos)], particle);
+    }
+    updateBaseLevel(std::move(baseTiles), maxThreads);
+}
+
+int OverviewPyramid::getNumLevels() const
+{
+    return toInt(_levelSizes.size());
+}
+
+IntVector2D OverviewPyramid::getLevelSize(int level) const
+{
+    return _levelSizes.at(level);
+}
+
+float OverviewPyramid::getTileSize(int level) const
+{
+    return toFloat(_baseTileSize) * std::pow(2.0f, toFloat(level));
+}
+
+OverviewTile const& OverviewPyramid::getTile(int level, IntVector2D const& tilePos) const
+{
+    auto const& levelSize = _levelSizes.at(level);
+    return _tilesByLevel[level].at(tilePos.x + tilePos.y * levelSize.x);
+}
+
+OverviewTile const& OverviewPyramid::getTotal() const
+{
+    return _tilesByLevel.back().front();
+}
+
+std::vector<int> const& OverviewPyramid::getChangedTiles(int level) const
+{
+    return _changedTilesByLevel.at(level);
+}
+
+int OverviewPyramid::calcLevel(float zoom) const
+{
+    auto result = 0;
+    while (result + 1 < getNumLevels() && getTileSize(result + 1) * zoom <= 1.0f) {
+        ++result;
+    }
+    return result;
+}
+
+std::vector<uint8_t> OverviewPyramid::createRgbImage(int level) const
+{
+    auto const& tiles = _tilesByLevel.at(level);
+    uint32_t maxNumCells = 0;
+    for (auto const& tile : tiles) {
+        maxNumCells = std::max(maxNumCells, tile.numCells);
+    }
+
+    std::vector<uint8_t> result(tiles.size() * 3, 0);
+    if (maxNumCells == 0) {
+        return result;
+    }
+    auto logMaxNumCells = std::log(1.0f + toFloat(maxNumCells));
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        auto const& tile = tiles[i];
+        if (tile.numCells == 0) {
+            continue;
+        }
+        auto intensity = std::log(1.0f + toFloat(tile.numCells)) / logMaxNumCells;
+        auto color = tile.getAverageCellColor();
+        result[i * 3] = static_cast<uint8_t>(toFloat((color >> 16) & 0xff) * intensity);
+        result[i * 3 + 1] = static_cast<uint8_t>(toFloat((color >> 8) & 0xff) * intensity);
+        result[i * 3 + 2] = static_cast<uint8_t>(toFloat(color & 0xff) * intensity);
+    }
+    return result;
+}
+
+void OverviewPyramid::updateBaseLevel(std::vector<OverviewTile>&& baseTiles, int maxThreads)
+{
+    //changed tiles of level 0
+    auto& prevBaseTiles = _tilesByLevel.front();
+    std::vector<uint8_t> changed(baseTiles.size(), 0);
+    Parallel::forEachPartition(
+        toInt(baseTiles.size()),
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                changed[index] = !_built || baseTiles[index] != prevBaseTiles[index] ? 1 : 0;
+            }
+        },
+        maxThreads);
+    prevBaseTiles = std::move(baseTiles);
+
+    auto& changedBaseTiles = _changedTilesByLevel.front();
+    changedBaseTiles.clear();
+    for (int index = 0; index < toInt(changed.size()); ++index) {
+        if (changed[index]) {
+            changedBaseTiles.emplace_back(index);
+        }
+    }
+
+    //propagate the changes upwards, each changed tile is recalculated from its children
+    for (int level = 1; level < getNumLevels(); ++level) {
+        auto const& childLevelSize = _levelSizes[level - 1];
+        auto const& levelSize = _levelSizes[level];
+        auto& changedTiles = _changedTilesByLevel[level];
+        changedTiles.clear();
+        for (auto const& childIndex : _changedTilesByLevel[level - 1]) {
+            auto index = (childIndex % childLevelSize.x) / 2 + (childIndex / childLevelSize.x) / 2 * levelSize.x;
+            if (changedTiles.empty() || changedTiles.back() != index) {
+                changedTiles.emplace_back(index);
+            }
+        }
+        std::sort(changedTiles.begin(), changedTiles.end());
+        changedTiles.erase(std::unique(changedTiles.begin(), changedTiles.end()), changedTiles.end());
+
+        auto const& childTiles = _tilesByLevel[level - 1];
+        auto& tiles = _tilesByLevel[level];
+        Parallel::forEachPartition(
+            toInt(changedTiles.size()),
+            [&](ParallelPartition const& partition) {
+                for (int i = partition.startIndex; i <= partition.endIndex; ++i) {
+                    auto index = changedTiles[i];
+                    auto x = index % levelSize.x;
+                    auto y = index / levelSize.x;
+                    OverviewTile tile;
+                    for (int childY = y * 2; childY < std::min(y * 2 + 2, childLevelSize.y); ++childY) {
+                        for (int childX = x * 2; childX < std::min(x * 2 + 2, childLevelSize.x); ++childX) {
+                            tile += childTiles[childX + childY * childLevelSize.x];
+                        }
+                    }
+                    tiles[index] = tile;
+                }
+            },
+            maxThreads);
+    }
+    _built = true;
+}
+
+int OverviewPyramid::getBaseTileIndex(RealVector2D const& pos) const
+{
+    auto const& levelSize = _levelSizes.front();
+    auto x = toInt(std::floor(pos.x)) % _worldSize.x;
+    auto y = toInt(std::floor(pos.y)) % _worldSize.y;
+    x = std::min(levelSize.x - 1, (x < 0 ? x + _worldSize.x : x) / _baseTileSize);
+    y = std::min(levelSize.y - 1, (y < 0 ? y + _worldSize.y : y) / _baseTileSize);
+    return x + y * levelSize.x;
+}
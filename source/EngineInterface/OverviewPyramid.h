@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Vector2D.h"
+
+#include "Descriptions.h"
+#include "EngineConstants.h"
+
+//aggregate of the cells and particles within a square region of the world
+struct OverviewTile
+{
+    uint32_t numCells = 0;
+    uint32_t numParticles = 0;
+    float energy = 0;  //of cells and particles
+    std::array<uint32_t, MAX_COLORS> numCellsByColor = {};
+
+    auto operator<=>(OverviewTile const&) const = default;
+    void operator+=(OverviewTile const& other);
+
+    uint32_t getAverageCellColor() const;  //0xRRGGBB weighted by the number of cells per color, 0 for empty tiles
+};
+
+//multi-resolution overview of a world snapshot for minimaps, zoomed-out views and thumbnails
+//level 0 consists of tiles with baseTileSize x baseTileSize world units, each tile of level n + 1 aggregates up to 2 x 2 tiles of level n
+//and the last level consists of a single tile => queries do not depend on the number of cells
+class OverviewPyramid
+{
+public:
+    static auto constexpr DefaultBaseTileSize = 8;
+
+    OverviewPyramid(IntVector2D const& worldSize, int baseTileSize = DefaultBaseTileSize);
+
+    //only tiles whose content differs from the previous snapshot are recalculated, the first call builds the whole pyramid
+    void update(DataDescription const& data, int maxThreads = 0);
+    void update(ClusteredDataDescription const& data, int maxThreads = 0);
+
+    int getNumLevels() const;
+    IntVector2D getLevelSize(int level) const;  //number of tiles per row and column
+    float getTileSize(int level) const;  //in world units
+    OverviewTile const& getTile(int level, IntVector2D const& tilePos) const;
+    OverviewTile const& getTotal() const;
+
+    //indices (y * levelSize.x + x) of the tiles changed by the last update, ascending
+    std::vector<int> const& getChangedTiles(int level) const;
+
+    //coarsest level whose tiles still cover at most one pixel at the given zoom (pixels per world unit)
+    int calcLevel(float zoom) const;
+
+    //8-bit RGB triples row by row, one pixel per tile: average cell color scaled logarithmically by the cell density relative to the densest tile
+    std::vector<uint8_t> createRgbImage(int level) const;
+
+private:
+    void updateBaseLevel(std::vector<OverviewTile>&& baseTiles, int maxThreads);
+    int getBaseTileIndex(RealVector2D const& pos) const;
+
+    IntVector2D _worldSize;
+    int _baseTileSize;
+    bool _built = false;
+    std::vector<IntVector2D> _levelSizes;
+    std::vector<std::vector<OverviewTile>> _tilesByLevel;
+    std::vector<std::vector<int>> _changedTilesByLevel;
+};
@@ -0,0 +1,313 @@
+#include "PatternAnalysisService.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "Base/Parallel.h"
+#include "Base/RandomStream.h"
+
+namespace
+{
+    //cell network in compressed sparse row format, the labels are refined until the partition of the cells is stable
+    struct CellNetwork
+    {
+        std::vector<uint64_t> labels;
+        std::vector<int> neighborsOffset;  //neighbors of cell i are neighbors[neighborsOffset[i]], ..., neighbors[neighborsOffset[i + 1] - 1] (sorted)
+        std::vector<int> neighbors;
+        uint64_t hash = 0;
+
+        int getNumCells() const { return toInt(labels.size()); }
+        int getNumNeighbors(int index) const { return neighborsOffset[index + 1] - neighborsOffset[index]; }
+        bool isConnected(int index1, int index2) const
+        {
+            return std::binary_search(neighbors.begin() + neighborsOffset[index1], neighbors.begin() + neighborsOffset[index1 + 1], index2);
+        }
+    };
+
+    uint64_t combine(uint64_t hash, uint64_t value)
+    {
+        return RandomStream::mix(hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2)));
+    }
+
+    uint64_t calcCellLabel(CellDescription const& cell)
+    {
+        int values[] = {
+            cell.maxConnections,
+            toInt(cell.connections.size()),
+            static_cast<int>(cell.livingState),
+            cell.inputExecutionOrderNumber.has_value() ? 1 : 0,
+            cell.inputExecutionOrderNumber.value_or(0),
+            cell.outputBlocked ? 1 : 0,
+            cell.executionOrderNumber,
+            cell.color,
+            static_cast<int>(cell.getCellFunctionType())};
+        uint64_t result = 0;
+        for (auto value : values) {
+            result = combine(result, static_cast<uint64_t>(static_cast<int64_t>(value)));
+        }
+        return result;
+    }
+
+    int calcNumDistinctLabels(std::vector<uint64_t> labels)
+    {
+        std::sort(labels.begin(), labels.end());
+        return toInt(std::unique(labels.begin(), labels.end()) - labels.begin());
+    }
+
+    CellNetwork createCellNetwork(ClusterDescription const& cluster)
+    {
+        CellNetwork result;
+        auto numCells = toInt(cluster.cells.size());
+
+        std::unordered_map<uint64_t, int> indexById;
+        indexById.reserve(numCells);
+        for (int index = 0; index < numCells; ++index) {
+            indexById.emplace(cluster.cells[index].id, index);
+        }
+
+        result.labels.reserve(numCells);
+        result.neighborsOffset.reserve(numCells + 1);
+        result.neighborsOffset.emplace_back(0);
+        for (auto const& cell : cluster.cells) {
+            result.labels.emplace_back(calcCellLabel(cell));
+            auto startIndex = toInt(result.neighbors.size());
+            for (auto const& connection : cell.connections) {
+                auto findResult = indexById.find(connection.cellId);
+                if (findResult != indexById.end()) {
+                    result.neighbors.emplace_back(findResult->second);
+                }
+            }
+            std::sort(result.neighbors.begin() + startIndex, result.neighbors.end());
+            result.neighbors.erase(std::unique(result.neighbors.begin() + startIndex, result.neighbors.end()), result.neighbors.end());
+            result.neighborsOffset.emplace_back(toInt(result.neighbors.size()));
+        }
+
+        //Weisfeiler-Lehman refinement: each label is combined with the sorted labels of the neighbors
+        auto numDistinctLabels = calcNumDistinctLabels(result.labels);
+        std::vector<uint64_t> newLabels(numCells);
+        std::vector<uint64_t> neighborLabels;
+        for (int iteration = 0; iteration < numCells; ++iteration) {
+            for (int index = 0; index < numCells; ++index) {
+                neighborLabels.clear();
+                for (int i = result.neighborsOffset[index]; i < result.neighborsOffset[index + 1]; ++i) {
+                    neighborLabels.emplace_back(result.labels[result.neighbors[i]]);
+                }
+                std::sort(neighborLabels.begin(), neighborLabels.end());
+                auto label = result.labels[index];
+                for (auto const& neighborLabel : neighborLabels) {
+                    label = combine(label, neighborLabel);
+                }
+                newLabels[index] = label;
+            }
+            result.labels.swap(newLabels);
+            auto newNumDistinctLabels = calcNumDistinctLabels(result.labels);
+            if (newNumDistinctLabels == numDistinctLabels) {
+                break;
+            }
+            numDistinctLabels = newNumDistinctLabels;
+        }
+
+        auto sortedLabels = result.labels;
+        std::sort(sortedLabels.begin(), sortedLabels.end());
+        result.hash = combine(static_cast<uint64_t>(numCells), static_cast<uint64_t>(result.neighbors.size()));
+        for (auto const& label : sortedLabels) {
+            result.hash = combine(result.hash, label);
+        }
+        return result;
+    }
+
+    //breadth-first order such that each cell except the first one of a connected component follows one of its neighbors
+    void calcTraversalOrder(CellNetwork const& network, std::vector<int>& order, std::vector<int>& predecessors)
+    {
+        auto numCells = network.getNumCells();
+        std::vector<bool> visited(numCells, false);
+        order.clear();
+        predecessors.clear();
+        for (int root = 0; root < numCells; ++root) {
+            if (visited[root]) {
+                continue;
+            }
+            visited[root] = true;
+            auto queueStart = toInt(order.size());
+            order.emplace_back(root);
+            predecessors.emplace_back(-1);
+            for (auto queueIndex = queueStart; queueIndex < toInt(order.size()); ++queueIndex) {
+                auto index = order[queueIndex];
+                for (int i = network.neighborsOffset[index]; i < network.neighborsOffset[index + 1]; ++i) {
+                    auto neighbor = network.neighbors[i];
+                    if (!visited[neighbor]) {
+                        visited[neighbor] = true;
+                        order.emplace_back(neighbor);
+                        predecessors.emplace_back(index);
+                    }
+                }
+            }
+        }
+    }
+
+    //exact test by backtracking, candidates are restricted to cells with equal refined labels
+    bool isIsomorphicNetwork(CellNetwork const& network1, CellNetwork const& network2)
+    {
+        auto numCells = network1.getNumCells();
+        if (network1.hash != network2.hash || numCells != network2.getNumCells() || network1.neighbors.size() != network2.neighbors.size()) {
+            return false;
+        }
+        if (numCells == 0) {
+            return true;
+        }
+
+        std::vector<int> order;
+        std::vector<int> predecessors;
+        calcTraversalOrder(network1, order, predecessors);
+
+        auto isMatching = [&](std::vector<int> const& mapping, std::vector<bool> const& used, int index1, int index2) {
+            if (used[index2] || network1.labels[index1] != network2.labels[index2] || network1.getNumNeighbors(index1) != network2.getNumNeighbors(index2)) {
+                return false;
+            }
+            for (int i = network1.neighborsOffset[index1]; i < network1.neighborsOffset[index1 + 1]; ++i) {
+                auto mappedNeighbor = mapping[network1.neighbors[i]];
+                if (mappedNeighbor != -1 && !network2.isConnected(index2, mappedNeighbor)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        //iterative to cope with large clusters, nextCandidates[depth] is the position in the candidate list of order[depth]
+        std::vector<int> mapping(numCells, -1);
+        std::vector<bool> used(numCells, false);
+        std::vector<int> nextCandidates(numCells, 0);
+        int depth = 0;
+        while (depth >= 0) {
+            if (depth == numCells) {
+                return true;
+            }
+            auto index1 = order[depth];
+            if (mapping[index1] != -1) {
+                used[mapping[index1]] = false;
+                mapping[index1] = -1;
+            }
+
+            //cells following a neighbor must be mapped to a neighbor of the neighbor's image
+            auto predecessor = predecessors[depth];
+            auto mappedPredecessor = predecessor != -1 ? mapping[predecessor] : -1;
+            auto numCandidates = predecessor != -1 ? network2.getNumNeighbors(mappedPredecessor) : numCells;
+            auto found = false;
+            while (nextCandidates[depth] < numCandidates) {
+                auto candidate = predecessor != -1 ? network2.neighbors[network2.neighborsOffset[mappedPredecessor] + nextCandidates[depth]] : nextCandidates[depth];
+                ++nextCandidates[depth];
+                if (isMatching(mapping, used, index1, candidate)) {
+                    mapping[index1] = candidate;
+                    used[candidate] = true;
+                    found = true;
+                    break;
+                }
+            }
+            if (found) {
+                ++depth;
+            } else {
+                nextCandidates[depth] = 0;
+                --depth;
+            }
+        }
+        return false;
+    }
+}
+
+std::vector<PatternClass> PatternAnalysisService::calcPatternClasses(ClusteredDataDescription const& data, int maxThreads) const
+{
+    auto numClusters = toInt(data.clusters.size());
+    std::vector<CellNetwork> networks(numClusters);
+    Parallel::forEachPartition(
+        numClusters,
+        [&](ParallelPartition const& partition) {
+            for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+                networks[index] = createCellNetwork(data.clusters[index]);
+            }
+        },
+        maxThreads);
+
+    //only clusters with equal hashes can be isomorphic
+    std::unordered_map<uint64_t, int> bucketIndexByHash;
+    std::vector<std::vector<int>> buckets;
+    for (int index = 0; index < numClusters; ++index) {
+        auto [iter, inserted] = bucketIndexByHash.emplace(networks[index].hash, toInt(buckets.size()));
+        if (inserted) {
+            buckets.emplace_back();
+        }
+        buckets[iter->second].emplace_back(index);
+    }
+
+    //exact verification protects against hash collisions and networks which are not distinguished by the refinement
+    std::vector<std::vector<PatternClass>> patternClassesByBucket(buckets.size());
+    Parallel::forEachPartition(
+        toInt(buckets.size()),
+        [&](ParallelPartition const& partition) {
+            for (int bucketIndex = partition.startIndex; bucketIndex <= partition.endIndex; ++bucketIndex) {
+                auto& patternClasses = patternClassesByBucket[bucketIndex];
+                for (auto const& clusterIndex : buckets[bucketIndex]) {
+                    auto findResult = std::find_if(patternClasses.begin(), patternClasses.end(), [&](PatternClass const& patternClass) {
+                        return isIsomorphicNetwork(networks[clusterIndex], networks[patternClass.clusterIndices.front()]);
+                    });
+                    if (findResult != patternClasses.end()) {
+                        findResult->clusterIndices.emplace_back(clusterIndex);
+                    } else {
+                        patternClasses.emplace_back(PatternClass{{clusterIndex}});
+                    }
+                }
+            }
+        },
+        maxThreads);
+
+    std::vector<PatternClass> result;
+    for (auto& patternClasses : patternClassesByBucket) {
+        for (auto& patternClass : patternClasses) {
+            result.emplace_back(std::move(patternClass));
+        }
+    }
+    std::sort(result.begin(), result.end(), [](PatternClass const& patternClass1, PatternClass const& patternClass2) {
+        if (patternClass1.getNumElements() != patternClass2.getNumElements()) {
+            return patternClass1.getNumElements() > patternClass2.getNumElements();
+        }
+        return patternClass1.clusterIndices.front() < patternClass2.clusterIndices.front();
+    });
+    return result;
+}
+
+uint64_t PatternAnalysisService::calcHash(ClusterDescription const& cluster) const
+{
+    return createCellNetwork(cluster).hash;
+}
+
+bool PatternAnalysisService::isIsomorphic(ClusterDescription const& cluster1, ClusterDescription const& cluster2) const
+{
+    return isIsomorphicNetwork(createCellNetwork(cluster1), createCellNetwork(cluster2));
+}
+
+std::string PatternAnalysisService::exportToCsv(std::vector<PatternClass> const& patternClasses, ClusteredDataDescription const& data) const
+{
+    std::ostringstream stream;
+    stream << "pattern,exemplars,cells,representant cell id" << std::endl;
+    for (int index = 0; index < toInt(patternClasses.size()); ++index) {
+        auto const& patternClass = patternClasses.at(index);
+        auto const& representant = data.clusters.at(patternClass.clusterIndices.front());
+        stream << index + 1 << "," << patternClass.getNumElements() << "," << representant.cells.size() << ","
+               << (representant.cells.empty() ? 0 : representant.cells.front().id) << std::endl;
+    }
+    return stream.str();
+}
+
+bool PatternAnalysisService::exportToFile(
+    std::filesystem::path const& filename,
+    std::vector<PatternClass> const& patternClasses,
+    ClusteredDataDescription const& data) const
+{
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    stream << exportToCsv(patternClasses, data);
+    return static_cast<bool>(stream);
+}
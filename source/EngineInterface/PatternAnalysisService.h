@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Singleton.h"
+
+#include "Descriptions.h"
+
+//clusters whose cell networks are isomorphic, i.e. equal up to a renumbering of the cells
+struct PatternClass
+{
+    std::vector<int> clusterIndices;  //ascending, the first cluster serves as representant
+
+    int getNumElements() const { return toInt(clusterIndices.size()); }
+};
+
+//cells are compared by their connection structure, color, cell function, living state and execution order settings
+//positions, distances and angles are not taken into account
+class PatternAnalysisService
+{
+    MAKE_SINGLETON(PatternAnalysisService);
+
+public:
+    //the classes are sorted by decreasing number of elements
+    std::vector<PatternClass> calcPatternClasses(ClusteredDataDescription const& data, int maxThreads = 0) const;
+
+    //equal for isomorphic clusters (Weisfeiler-Lehman refinement of the cell attributes along the connections)
+    uint64_t calcHash(ClusterDescription const& cluster) const;
+
+    bool isIsomorphic(ClusterDescription const& cluster1, ClusterDescription const& cluster2) const;
+
+    std::string exportToCsv(std::vector<PatternClass> const& patternClasses, ClusteredDataDescription const& data) const;
+    bool exportToFile(std::filesystem::path const& filename, std::vector<PatternClass> const& patternClasses, ClusteredDataDescription const& data) const;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "Definitions.h"
+#include "InspectedEntityIds.h"
 #include "OverlayDescriptions.h"
 #include "SelectionShallowData.h"
 #include "Settings.h"
@@ -40,7 +41,7 @@ public:
     virtual DataDescription getSimulationData() = 0;
     virtual ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters) = 0;
     virtual DataDescription getSelectedSimulationData(bool includeClusters) = 0;
-    virtual DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds) = 0;
+    virtual DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds, InspectedPayloads const& payloads = InspectedPayloads()) = 0;
 
     virtual void addAndSelectSimulationData(DataDescription const& dataToAdd) = 0;
     virtual void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) = 0;
@@ -104,7 +105,13 @@ public:
 
     virtual float getTps() const = 0;
 
+    //the sink receives the durations of the phases of each time step and of the data accesses; nullptr disables the measurements
+    virtual void setTimingSink(TimingSink const& sink) = 0;
+
     //for tests
     virtual void testOnly_mutate(uint64_t cellId, MutationType mutationType) = 0;
     virtual void testOnly_mutationCheck(uint64_t cellId) = 0;
+    //returns the accumulation image of the rendering kernels without an image resource (same format as SoftwareRenderService)
+    virtual std::vector<uint64_t>
+    testOnly_drawImage(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom) = 0;
 };
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SimulationParametersSchema.h"
+
+struct ParameterChange
+{
+    ParameterScope scope = ParameterScope::Global;
+    int elementIndex = 0;  //index of the radiation source or zone, not used for global fields
+    int fieldIndex = 0;  //index in SimulationParametersSchema::getFields(scope)
+
+    //raw bytes of the field followed by its activation flag (if present)
+    std::vector<uint8_t> oldValue;
+    std::vector<uint8_t> newValue;
+};
+
+//field-level difference between two instances of SimulationParameters
+struct SimulationParametersChangeSet
+{
+    std::vector<ParameterChange> changes;
+
+    bool isEmpty() const { return changes.empty(); }
+};
+
+//byte range within SimulationParameters
+struct ParameterMemoryRange
+{
+    size_t offset = 0;
+    size_t size = 0;
+};
@@ -0,0 +1,156 @@
+#include "SimulationParametersDiffService.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Base/Definitions.h"
+
+namespace
+{
+    size_t getValueSize(ParameterField const& field)
+    {
+        return field.getNumElements() * field.getElementSize();
+    }
+
+    bool isEqual(ParameterField const& field, void const* object1, void const* object2)
+    {
+        if (std::memcmp(field.getValue<char>(object1), field.getValue<char>(object2), getValueSize(field)) != 0) {
+            return false;
+        }
+        return !field.activatedOffset || *field.getActivated(object1) == *field.getActivated(object2);
+    }
+
+    std::vector<uint8_t> getBytes(ParameterField const& field, void const* object)
+    {
+        auto value = field.getValue<uint8_t>(object);
+        std::vector<uint8_t> result(value, value + getValueSize(field));
+        if (field.activatedOffset) {
+            result.emplace_back(*field.getActivated(object) ? 1 : 0);
+        }
+        return result;
+    }
+}
+
+SimulationParametersChangeSet SimulationParametersDiffService::calcChangeSet(SimulationParameters const& from, SimulationParameters const& to) const
+{
+    SimulationParametersChangeSet result;
+    calcChanges(result.changes, ParameterScope::Global, 0, &from, &to, false);
+    return result;
+}
+
+void SimulationParametersDiffService::applyChangeSet(SimulationParameters& parameters, SimulationParametersChangeSet const& changeSet) const
+{
+    for (auto const& change : changeSet.changes) {
+        setValues(parameters, change, change.newValue);
+    }
+}
+
+void SimulationParametersDiffService::revertChangeSet(SimulationParameters& parameters, SimulationParametersChangeSet const& changeSet) const
+{
+    for (auto it = changeSet.changes.rbegin(); it != changeSet.changes.rend(); ++it) {
+        setValues(parameters, *it, it->oldValue);
+    }
+}
+
+std::set<int> SimulationParametersDiffService::getChangedElements(SimulationParametersChangeSet const& changeSet, ParameterScope scope) const
+{
+    std::set<int> result;
+    for (auto const& change : changeSet.changes) {
+        if (change.scope == scope) {
+            result.insert(change.elementIndex);
+        }
+    }
+    return result;
+}
+
+std::string SimulationParametersDiffService::getName(ParameterChange const& change) const
+{
+    auto const& schema = SimulationParametersSchema::get();
+    auto const& name = schema.getFields(change.scope).at(change.fieldIndex).name;
+    if (change.scope == ParameterScope::Global) {
+        return name;
+    }
+    return schema.getArrayField(change.scope).name + "." + std::to_string(change.elementIndex) + "." + name;
+}
+
+std::vector<ParameterMemoryRange> SimulationParametersDiffService::calcChangedMemoryRanges(SimulationParametersChangeSet const& changeSet, size_t maxGap)
+    const
+{
+    std::vector<ParameterMemoryRange> ranges;
+    for (auto const& change : changeSet.changes) {
+        auto const& field = SimulationParametersSchema::get().getFields(change.scope).at(change.fieldIndex);
+        auto elementOffset = getElementOffset(change.scope, change.elementIndex);
+        ranges.emplace_back(ParameterMemoryRange{elementOffset + field.offset, getValueSize(field)});
+        if (field.activatedOffset) {
+            ranges.emplace_back(ParameterMemoryRange{elementOffset + *field.activatedOffset, sizeof(bool)});
+        }
+    }
+    std::sort(ranges.begin(), ranges.end(), [](auto const& range1, auto const& range2) { return range1.offset < range2.offset; });
+
+    std::vector<ParameterMemoryRange> result;
+    for (auto const& range : ranges) {
+        if (!result.empty() && range.offset <= result.back().offset + result.back().size + maxGap) {
+            auto& lastRange = result.back();
+            lastRange.size = std::max(lastRange.offset + lastRange.size, range.offset + range.size) - lastRange.offset;
+        } else {
+            result.emplace_back(range);
+        }
+    }
+    return result;
+}
+
+void SimulationParametersDiffService::calcChanges(
+    std::vector<ParameterChange>& changes,
+    ParameterScope scope,
+    int elementIndex,
+    void const* from,
+    void const* to,
+    bool complete) const
+{
+    auto const& fields = SimulationParametersSchema::get().getFields(scope);
+    for (int fieldIndex = 0; fieldIndex < toInt(fields.size()); ++fieldIndex) {
+        auto const& field = fields[fieldIndex];
+        if (field.array) {
+            auto fromCount = field.getArrayCount(from);
+            auto toCount = field.getArrayCount(to);
+            for (int index = 0; index < std::max(fromCount, toCount); ++index) {
+                auto elementOffset = field.offset + index * field.array->elementSize;
+                calcChanges(
+                    changes,
+                    field.array->elementScope,
+                    index,
+                    static_cast<char const*>(from) + elementOffset,
+                    static_cast<char const*>(to) + elementOffset,
+                    index >= fromCount || index >= toCount);
+            }
+            continue;
+        }
+        if (!field.exists(from) && !field.exists(to)) {
+            continue;
+        }
+        if (!complete && isEqual(field, from, to)) {
+            continue;
+        }
+        changes.emplace_back(ParameterChange{scope, elementIndex, fieldIndex, getBytes(field, from), getBytes(field, to)});
+    }
+}
+
+void SimulationParametersDiffService::setValues(SimulationParameters& parameters, ParameterChange const& change, std::vector<uint8_t> const& value) const
+{
+    auto const& field = SimulationParametersSchema::get().getFields(change.scope).at(change.fieldIndex);
+    auto object = reinterpret_cast<char*>(&parameters) + getElementOffset(change.scope, change.elementIndex);
+    auto valueSize = getValueSize(field);
+    std::memcpy(field.getValue<char>(object), value.data(), valueSize);
+    if (field.activatedOffset) {
+        *field.getActivated(object) = value.at(valueSize) != 0;
+    }
+}
+
+size_t SimulationParametersDiffService::getElementOffset(ParameterScope scope, int elementIndex) const
+{
+    if (scope == ParameterScope::Global) {
+        return 0;
+    }
+    auto const& arrayField = SimulationParametersSchema::get().getArrayField(scope);
+    return arrayField.offset + elementIndex * arrayField.array->elementSize;
+}
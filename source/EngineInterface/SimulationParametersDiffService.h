@@ -0,0 +1,42 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Base/Singleton.h"
+#include "SimulationParameters.h"
+#include "SimulationParametersChangeSet.h"
+
+//calculates and applies change sets along SimulationParametersSchema
+class SimulationParametersDiffService
+{
+    MAKE_SINGLETON(SimulationParametersDiffService);
+
+public:
+    //radiation sources and zones which are added or removed are contained completely in the change set
+    SimulationParametersChangeSet calcChangeSet(SimulationParameters const& from, SimulationParameters const& to) const;
+
+    void applyChangeSet(SimulationParameters& parameters, SimulationParametersChangeSet const& changeSet) const;  //sets the new values
+    void revertChangeSet(SimulationParameters& parameters, SimulationParametersChangeSet const& changeSet) const;  //sets the old values
+
+    //indices of the radiation sources or zones with changes
+    std::set<int> getChangedElements(SimulationParametersChangeSet const& changeSet, ParameterScope scope) const;
+
+    //e.g. "spots.1.friction"
+    std::string getName(ParameterChange const& change) const;
+
+    //sorted and merged byte ranges of the changed fields, ranges with a gap of at most maxGap bytes are combined
+    std::vector<ParameterMemoryRange> calcChangedMemoryRanges(SimulationParametersChangeSet const& changeSet, size_t maxGap = 64) const;
+
+private:
+    void calcChanges(
+        std::vector<ParameterChange>& changes,
+        ParameterScope scope,
+        int elementIndex,
+        void const* from,
+        void const* to,
+        bool complete) const;
+    void setValues(SimulationParameters& parameters, ParameterChange const& change, std::vector<uint8_t> const& value) const;
+    size_t getElementOffset(ParameterScope scope, int elementIndex) const;
+};
@@ -0,0 +1,469 @@
+#include "SimulationParametersSchema.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Base/Definitions.h"
+
+//accessor of a (nested) member, only used for determining its type and offset
+#define FIELD(member) [](auto& object) -> auto& { return object.member; }
+
+namespace
+{
+    template <typename T>
+    ParameterType getParameterType()
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            return ParameterType::Bool;
+        } else if constexpr (std::is_same_v<T, int>) {
+            return ParameterType::Int;
+        } else if constexpr (std::is_same_v<T, uint32_t>) {
+            return ParameterType::UInt32;
+        } else if constexpr (std::is_same_v<T, float>) {
+            return ParameterType::Float;
+        } else {
+            static_assert(sizeof(T) == 0, "Unsupported parameter type.");
+        }
+    }
+
+    template <typename Object>
+    class FieldListBuilder
+    {
+    public:
+        FieldListBuilder(std::vector<ParameterField>& fields, ParameterScope scope)
+            : _fields(fields)
+            , _scope(scope)
+        {}
+
+        template <typename Accessor>
+        FieldListBuilder& add(std::string const& name, Accessor const& accessor)
+        {
+            using T = std::remove_cvref_t<decltype(accessor(_reference))>;
+
+            ParameterField field;
+            field.name = name;
+            field.scope = _scope;
+            field.offset = getOffset(accessor);
+            if constexpr (std::is_same_v<T, Char64>) {
+                field.type = ParameterType::Char64;
+            } else if constexpr (std::rank_v<T> == 2) {
+                field.type = getParameterType<std::remove_all_extents_t<T>>();
+                field.shape = ParameterShape::ColorMatrix;
+            } else if constexpr (std::rank_v<T> == 1) {
+                field.type = getParameterType<std::remove_all_extents_t<T>>();
+                field.shape = ParameterShape::ColorVector;
+            } else {
+                field.type = getParameterType<T>();
+            }
+            _fields.emplace_back(field);
+            return *this;
+        }
+
+        template <typename ArrayAccessor, typename CountAccessor>
+        FieldListBuilder& addArray(std::string const& name, ArrayAccessor const& arrayAccessor, CountAccessor const& countAccessor, ParameterScope elementScope)
+        {
+            using T = std::remove_cvref_t<decltype(arrayAccessor(_reference))>;
+            static_assert(std::rank_v<T> == 1);
+
+            ParameterField field;
+            field.name = name;
+            field.scope = _scope;
+            field.offset = getOffset(arrayAccessor);
+            field.array = ParameterArray{elementScope, getOffset(countAccessor), sizeof(std::remove_extent_t<T>), static_cast<int>(std::extent_v<T>)};
+            _fields.emplace_back(field);
+            return *this;
+        }
+
+        template <typename Accessor>
+        FieldListBuilder& activatedBy(Accessor const& accessor)
+        {
+            _fields.back().activatedOffset = getOffset(accessor);
+            return *this;
+        }
+
+        FieldListBuilder& transient()
+        {
+            _fields.back().persistent = false;
+            return *this;
+        }
+
+        template <typename Accessor>
+        FieldListBuilder& onlyIf(Accessor const& selectorAccessor, int selectorValue)
+        {
+            _fields.back().condition = ParameterCondition{getOffset(selectorAccessor), selectorValue};
+            return *this;
+        }
+
+    private:
+        template <typename Accessor>
+        size_t getOffset(Accessor const& accessor) const
+        {
+            return reinterpret_cast<char const*>(&accessor(_reference)) - reinterpret_cast<char const*>(&_reference);
+        }
+
+        std::vector<ParameterField>& _fields;
+        ParameterScope _scope;
+        Object _reference;
+    };
+
+    //FNV-1a
+    void hashBytes(uint64_t& hash, void const* data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char const*>(data)[i];
+            hash *= 0x100000001b3ull;
+        }
+    }
+
+    void hashFields(uint64_t& hash, std::vector<ParameterField> const& fields)
+    {
+        for (auto const& field : fields) {
+            hashBytes(hash, field.name.data(), field.name.size() + 1);
+            int properties[] = {
+                static_cast<int>(field.type),
+                static_cast<int>(field.shape),
+                field.activatedOffset.has_value(),
+                field.persistent,
+                field.condition ? field.condition->selectorValue : -1,
+                field.array ? static_cast<int>(field.array->elementScope) : -1};
+            hashBytes(hash, properties, sizeof(properties));
+        }
+    }
+}
+
+int ParameterField::getNumElements() const
+{
+    switch (shape) {
+    case ParameterShape::ColorVector:
+        return MAX_COLORS;
+    case ParameterShape::ColorMatrix:
+        return MAX_COLORS * MAX_COLORS;
+    default:
+        return 1;
+    }
+}
+
+size_t ParameterField::getElementSize() const
+{
+    switch (type) {
+    case ParameterType::Bool:
+        return sizeof(bool);
+    case ParameterType::Char64:
+        return sizeof(Char64);
+    default:
+        return sizeof(int32_t);
+    }
+}
+
+bool ParameterField::exists(void const* object) const
+{
+    if (!condition) {
+        return true;
+    }
+    return *reinterpret_cast<int const*>(static_cast<char const*>(object) + condition->selectorOffset) == condition->selectorValue;
+}
+
+int ParameterField::getArrayCount(void const* object) const
+{
+    auto count = *reinterpret_cast<int const*>(static_cast<char const*>(object) + array->countOffset);
+    return std::max(0, std::min(array->maxCount, count));
+}
+
+bool* ParameterField::getActivated(void* object) const
+{
+    return reinterpret_cast<bool*>(static_cast<char*>(object) + *activatedOffset);
+}
+
+bool const* ParameterField::getActivated(void const* object) const
+{
+    return reinterpret_cast<bool const*>(static_cast<char const*>(object) + *activatedOffset);
+}
+
+std::vector<ParameterField> const& SimulationParametersSchema::getFields(ParameterScope scope) const
+{
+    switch (scope) {
+    case ParameterScope::RadiationSource:
+        return _radiationSourceFields;
+    case ParameterScope::Zone:
+        return _zoneFields;
+    default:
+        return _globalFields;
+    }
+}
+
+int SimulationParametersSchema::getFieldIndex(ParameterScope scope, std::string const& name) const
+{
+    auto const& fields = getFields(scope);
+    for (int i = 0; i < toInt(fields.size()); ++i) {
+        if (fields[i].name == name) {
+            return i;
+        }
+    }
+    throw std::runtime_error("Unknown simulation parameter '" + name + "'.");
+}
+
+ParameterField const& SimulationParametersSchema::getArrayField(ParameterScope elementScope) const
+{
+    for (auto const& field : _globalFields) {
+        if (field.array && field.array->elementScope == elementScope) {
+            return field;
+        }
+    }
+    throw std::runtime_error("No array of simulation parameters for the given scope.");
+}
+
+uint64_t SimulationParametersSchema::getSchemaHash() const
+{
+    return _schemaHash;
+}
+
+SimulationParametersSchema::SimulationParametersSchema()
+{
+    FieldListBuilder<SimulationParameters> global(_globalFields, ParameterScope::Global);
+    global.add("project name", FIELD(projectName));
+    global.add("background color", FIELD(backgroundColor));
+    global.add("cell colorization", FIELD(cellColoring));
+    global.add("cell glow.coloring", FIELD(cellGlowColoring));
+    global.add("cell glow.radius", FIELD(cellGlowRadius));
+    global.add("cell glow.strength", FIELD(cellGlowStrength));
+    global.add("highlighted cell function", FIELD(highlightedCellFunction));
+    global.add("zoom level.neural activity", FIELD(zoomLevelNeuronalActivity));
+    global.add("borderless rendering", FIELD(borderlessRendering));
+    global.add("mark reference domain", FIELD(markReferenceDomain));
+    global.add("show radiation sources", FIELD(showRadiationSources));
+    global.add("grid lines", FIELD(gridLines));
+    global.add("attack visualization", FIELD(attackVisualization));
+    global.add("muscle movement visualization", FIELD(muscleMovementVisualization));
+    global.add("cek", FIELD(cellRadius));
+    global.add("time step size", FIELD(timestepSize));
+    global.add("motion.type", FIELD(motionType));
+    global.add("fluid.smoothing length", FIELD(motionData.fluidMotion.smoothingLength)).onlyIf(FIELD(motionType), MotionType_Fluid);
+    global.add("fluid.pressure strength", FIELD(motionData.fluidMotion.pressureStrength)).onlyIf(FIELD(motionType), MotionType_Fluid);
+    global.add("fluid.viscosity strength", FIELD(motionData.fluidMotion.viscosityStrength)).onlyIf(FIELD(motionType), MotionType_Fluid);
+    global.add("motion.collision.max distance", FIELD(motionData.collisionMotion.cellMaxCollisionDistance)).onlyIf(FIELD(motionType), MotionType_Collision);
+    global.add("motion.collision.repulsion strength", FIELD(motionData.collisionMotion.cellRepulsionStrength)).onlyIf(FIELD(motionType), MotionType_Collision);
+    global.add("inner friction", FIELD(innerFriction)).transient();
+    global.add("friction", FIELD(baseValues.friction));
+    global.add("rigidity", FIELD(baseValues.rigidity));
+    global.add("cell.max velocity", FIELD(cellMaxVelocity));
+    global.add("cell.max binding distance", FIELD(cellMaxBindingDistance));
+    global.add("cell.normal energy", FIELD(cellNormalEnergy));
+    global.add("cell.min distance", FIELD(cellMinDistance));
+    global.add("cell.max force", FIELD(baseValues.cellMaxForce));
+    global.add("cell.max force decay probability", FIELD(cellMaxForceDecayProb));
+    global.add("cell.max execution order number", FIELD(cellNumExecutionOrderNumbers));
+    global.add("cell.min energy", FIELD(baseValues.cellMinEnergy));
+    global.add("cell.fusion velocity", FIELD(baseValues.cellFusionVelocity));
+    global.add("cell.max binding energy", FIELD(baseValues.cellMaxBindingEnergy));
+    global.add("cell.max age", FIELD(cellMaxAge));
+    global.add("cell.max age.balance.enabled", FIELD(cellMaxAgeBalancer));
+    global.add("cell.max age.balance.interval", FIELD(cellMaxAgeBalancerInterval));
+    global.add("cell.inactive max age activated", FIELD(cellInactiveMaxAgeActivated));
+    global.add("cell.inactive max age", FIELD(baseValues.cellInactiveMaxAge));
+    global.add("cell.nutrient max age activated", FIELD(cellEmergentMaxAgeActivated));
+    global.add("cell.nutrient max age", FIELD(cellEmergentMaxAge));
+    global.add("cell.reset age after activation", FIELD(cellResetAgeAfterActivation));
+    global.add("cell.color transition rules.duration", FIELD(baseValues.cellColorTransitionDuration));
+    global.add("cell.color transition rules.target color", FIELD(baseValues.cellColorTransitionTargetColor));
+    global.add("genome complexity.genome complexity ramification factor", FIELD(genomeComplexityRamificationFactor));
+    global.add("genome complexity.genome complexity size factor", FIELD(genomeComplexitySizeFactor));
+    global.add("genome complexity.genome complexity neuron factor", FIELD(genomeComplexityNeuronFactor));
+    global.add("genome complexity.genome complexity depth level", FIELD(genomeComplexityDepthLevel));
+    global.add("radiation.factor", FIELD(baseValues.radiationCellAgeStrength));
+    global.add("radiation.probability", FIELD(radiationProb));
+    global.add("radiation.velocity multiplier", FIELD(radiationVelocityMultiplier));
+    global.add("radiation.velocity perturbation", FIELD(radiationVelocityPerturbation));
+    global.add("radiation.disable sources", FIELD(baseValues.radiationDisableSources));
+    global.add("radiation.absorption", FIELD(baseValues.radiationAbsorption));
+    global.add("radiation.absorption velocity penalty", FIELD(radiationAbsorptionHighVelocityPenalty));
+    global.add("radiation.absorption low velocity penalty", FIELD(baseValues.radiationAbsorptionLowVelocityPenalty));
+    global.add("radiation.absorption low connection penalty", FIELD(radiationAbsorptionLowConnectionPenalty));
+    global.add("radiation.absorption low genome complexity penalty", FIELD(baseValues.radiationAbsorptionLowGenomeComplexityPenalty));
+    global.add("high radiation.min cell energy", FIELD(highRadiationMinCellEnergy));
+    global.add("high radiation.factor", FIELD(highRadiationFactor));
+    global.add("radiation.min cell age", FIELD(radiationMinCellAge));
+    global.add("cell.function.constructor.external energy", FIELD(externalEnergy));
+    global.add("cell.function.constructor.external energy supply rate", FIELD(externalEnergyInflowFactor));
+    global.add("cell.function.constructor.pump energy factor", FIELD(externalEnergyConditionalInflowFactor));
+    global.add("cell.function.constructor.external energy backflow", FIELD(externalEnergyBackflowFactor));
+    global.add("cell.function.constructor.external energy inflow only for non-self-replicators", FIELD(externalEnergyInflowOnlyForNonSelfReplicators));
+    global.add("cell.function.constructor.external energy backflow limit", FIELD(externalEnergyBackflowLimit));
+    global.add("cell.death consequences", FIELD(cellDeathConsequences));
+    global.add("cell.death probability", FIELD(baseValues.cellDeathProbability));
+    global.add("cell.function.constructor.connecting cell max distance", FIELD(cellFunctionConstructorConnectingCellMaxDistance));
+    global.add("cell.function.constructor.activity threshold", FIELD(cellFunctionConstructorSignalThreshold));
+    global.add("cell.function.constructor.completeness check for self-replication", FIELD(cellFunctionConstructorCheckCompletenessForSelfReplication));
+    global.add("cell.copy mutation.neuron data", FIELD(baseValues.cellCopyMutationNeuronData));
+    global.add("cell.copy mutation.neuron data.weights", FIELD(cellCopyMutationNeuronDataWeight));
+    global.add("cell.copy mutation.neuron data.biases", FIELD(cellCopyMutationNeuronDataBias));
+    global.add("cell.copy mutation.neuron data.activation functions", FIELD(cellCopyMutationNeuronDataActivationFunction));
+    global.add("cell.copy mutation.neuron data.reinforcement", FIELD(cellCopyMutationNeuronDataReinforcement));
+    global.add("cell.copy mutation.neuron data.damping", FIELD(cellCopyMutationNeuronDataDamping));
+    global.add("cell.copy mutation.neuron data.offset", FIELD(cellCopyMutationNeuronDataOffset));
+    global.add("cell.copy mutation.cell properties", FIELD(baseValues.cellCopyMutationCellProperties));
+    global.add("cell.copy mutation.geometry", FIELD(baseValues.cellCopyMutationGeometry));
+    global.add("cell.copy mutation.custom geometry", FIELD(baseValues.cellCopyMutationCustomGeometry));
+    global.add("cell.copy mutation.cell function", FIELD(baseValues.cellCopyMutationCellFunction));
+    global.add("cell.copy mutation.insertion", FIELD(baseValues.cellCopyMutationInsertion));
+    global.add("cell.copy mutation.deletion", FIELD(baseValues.cellCopyMutationDeletion));
+    global.add("cell.copy mutation.deletion.min size", FIELD(cellCopyMutationDeletionMinSize));
+    global.add("cell.copy mutation.translation", FIELD(baseValues.cellCopyMutationTranslation));
+    global.add("cell.copy mutation.duplication", FIELD(baseValues.cellCopyMutationDuplication));
+    global.add("cell.copy mutation.cell color", FIELD(baseValues.cellCopyMutationCellColor));
+    global.add("cell.copy mutation.subgenome color", FIELD(baseValues.cellCopyMutationSubgenomeColor));
+    global.add("cell.copy mutation.genome color", FIELD(baseValues.cellCopyMutationGenomeColor));
+    global.add("cell.copy mutation.color transition", FIELD(cellCopyMutationColorTransitions));
+    global.add("cell.copy mutation.self replication flag", FIELD(cellCopyMutationSelfReplication));
+    global.add("cell.copy mutation.prevent depth increase", FIELD(cellCopyMutationPreventDepthIncrease));
+    global.add("cell.function.injector.radius", FIELD(cellFunctionInjectorRadius));
+    global.add("cell.function.injector.duration", FIELD(cellFunctionInjectorDurationColorMatrix));
+    global.add("cell.function.injector.activity threshold", FIELD(cellFunctionInjectorSignalThreshold)).transient();
+    global.add("cell.function.attacker.radius", FIELD(cellFunctionAttackerRadius));
+    global.add("cell.function.attacker.strength", FIELD(cellFunctionAttackerStrength));
+    global.add("cell.function.attacker.energy distribution radius", FIELD(cellFunctionAttackerEnergyDistributionRadius));
+    global.add("cell.function.attacker.energy distribution value", FIELD(cellFunctionAttackerEnergyDistributionValue));
+    global.add("cell.function.attacker.color inhomogeneity factor", FIELD(cellFunctionAttackerColorInhomogeneityFactor));
+    global.add("cell.function.attacker.activity threshold", FIELD(cellFunctionAttackerSignalThreshold));
+    global.add("cell.function.attacker.energy cost", FIELD(baseValues.cellFunctionAttackerEnergyCost));
+    global.add("cell.function.attacker.geometry deviation exponent", FIELD(baseValues.cellFunctionAttackerGeometryDeviationExponent));
+    global.add("cell.function.attacker.food chain color matrix", FIELD(baseValues.cellFunctionAttackerFoodChainColorMatrix));
+    global.add("cell.function.attacker.connections mismatch penalty", FIELD(baseValues.cellFunctionAttackerConnectionsMismatchPenalty));
+    global.add("cell.function.attacker.genome size bonus", FIELD(baseValues.cellFunctionAttackerGenomeComplexityBonus));
+    global.add("cell.function.attacker.same mutant penalty", FIELD(cellFunctionAttackerSameMutantPenalty));
+    global.add("cell.function.attacker.new complex mutant penalty", FIELD(baseValues.cellFunctionAttackerNewComplexMutantPenalty));
+    global.add("cell.function.attacker.sensor detection factor", FIELD(cellFunctionAttackerSensorDetectionFactor));
+    global.add("cell.function.attacker.destroy cells", FIELD(cellFunctionAttackerDestroyCells));
+    global.add("cell.function.defender.against attacker strength", FIELD(cellFunctionDefenderAgainstAttackerStrength));
+    global.add("cell.function.defender.against injector strength", FIELD(cellFunctionDefenderAgainstInjectorStrength));
+    global.add("cell.function.transmitter.energy distribution same creature", FIELD(cellFunctionTransmitterEnergyDistributionSameCreature));
+    global.add("cell.function.transmitter.energy distribution radius", FIELD(cellFunctionTransmitterEnergyDistributionRadius));
+    global.add("cell.function.transmitter.energy distribution value", FIELD(cellFunctionTransmitterEnergyDistributionValue));
+    global.add("cell.function.muscle.contraction expansion delta", FIELD(cellFunctionMuscleContractionExpansionDelta));
+    global.add("cell.function.muscle.movement acceleration", FIELD(cellFunctionMuscleMovementAcceleration));
+    global.add("cell.function.muscle.bending angle", FIELD(cellFunctionMuscleBendingAngle));
+    global.add("cell.function.muscle.bending acceleration", FIELD(cellFunctionMuscleBendingAcceleration));
+    global.add("cell.function.muscle.bending acceleration threshold", FIELD(cellFunctionMuscleBendingAccelerationThreshold));
+    global.add("cell.function.muscle.movement toward targeted object", FIELD(cellFunctionMuscleMovementTowardTargetedObject));
+    global.add("cell.function.muscle.energy cost", FIELD(cellFunctionMuscleEnergyCost));
+    global.add("particle.transformation allowed", FIELD(particleTransformationAllowed));
+    global.add("particle.transformation.random cell function", FIELD(particleTransformationRandomCellFunction));
+    global.add("particle.transformation.max genome size", FIELD(particleTransformationMaxGenomeSize));
+    global.add("particle.split energy", FIELD(particleSplitEnergy));
+    global.add("cell.function.sensor.range", FIELD(cellFunctionSensorRange));
+    global.add("cell.function.sensor.activity threshold", FIELD(cellFunctionSensorSignalThreshold));
+    global.add("cell.function.reconnector.radius", FIELD(cellFunctionReconnectorRadius));
+    global.add("cell.function.reconnector.activity threshold", FIELD(cellFunctionReconnectorSignalThreshold));
+    global.add("cell.function.detonator.radius", FIELD(cellFunctionDetonatorRadius));
+    global.add("cell.function.detonator.chain explosion probability", FIELD(cellFunctionDetonatorChainExplosionProbability));
+    global.add("cell.function.detonator.activity threshold", FIELD(cellFunctionDetonatorSignalThreshold));
+    global.add("legacy.cell.function.muscle.movement angle from sensor", FIELD(legacyCellFunctionMuscleMovementAngleFromSensor));
+
+    //particle sources
+    global.add("particle sources.num sources", FIELD(numRadiationSources));
+    global.add("particle sources.base strength pinned", FIELD(baseStrengthRatioPinned));
+    global.addArray("particle sources", FIELD(radiationSource), FIELD(numRadiationSources), ParameterScope::RadiationSource);
+
+    //zones
+    global.add("spots.num spots", FIELD(numZones));
+    global.addArray("spots", FIELD(zone), FIELD(numZones), ParameterScope::Zone);
+
+    //features
+    global.add("features.genome complexity measurement", FIELD(features.genomeComplexityMeasurement));
+    global.add("features.additional absorption control", FIELD(features.advancedAbsorptionControl));
+    global.add("features.additional attacker control", FIELD(features.advancedAttackerControl));
+    global.add("features.external energy", FIELD(features.externalEnergyControl));
+    global.add("features.cell color transition rules", FIELD(features.cellColorTransitionRules));
+    global.add("features.cell age limiter", FIELD(features.cellAgeLimiter));
+    global.add("features.cell glow", FIELD(features.cellGlow));
+    global.add("features.legacy modes", FIELD(features.legacyModes));
+    global.add("features.customize neuron mutations", FIELD(features.customizeNeuronMutations));
+    global.add("features.customize deletion mutations", FIELD(features.customizeDeletionMutations));
+
+    FieldListBuilder<RadiationSource> source(_radiationSourceFields, ParameterScope::RadiationSource);
+    source.add("name", FIELD(name));
+    source.add("location index", FIELD(locationIndex));
+    source.add("pos.x", FIELD(posX));
+    source.add("pos.y", FIELD(posY));
+    source.add("vel.x", FIELD(velX));
+    source.add("vel.y", FIELD(velY));
+    source.add("use angle", FIELD(useAngle));
+    source.add("strength", FIELD(strength));
+    source.add("strength pinned", FIELD(strengthPinned));
+    source.add("angle", FIELD(angle));
+    source.add("shape.type", FIELD(shapeType));
+    source.add("shape.circular.radius", FIELD(shapeData.circularRadiationSource.radius)).onlyIf(FIELD(shapeType), SpotShapeType_Circular);
+    source.add("shape.rectangular.width", FIELD(shapeData.rectangularRadiationSource.width)).onlyIf(FIELD(shapeType), SpotShapeType_Rectangular);
+    source.add("shape.rectangular.height", FIELD(shapeData.rectangularRadiationSource.height)).onlyIf(FIELD(shapeType), SpotShapeType_Rectangular);
+
+    FieldListBuilder<SimulationParametersZone> zone(_zoneFields, ParameterScope::Zone);
+    zone.add("name", FIELD(name));
+    zone.add("location index", FIELD(locationIndex));
+    zone.add("color", FIELD(color));
+    zone.add("pos.x", FIELD(posX));
+    zone.add("pos.y", FIELD(posY));
+    zone.add("vel.x", FIELD(velX));
+    zone.add("vel.y", FIELD(velY));
+    zone.add("shape.type", FIELD(shapeType));
+    zone.add("shape.circular.core radius", FIELD(shapeData.circularSpot.coreRadius)).onlyIf(FIELD(shapeType), SpotShapeType_Circular);
+    zone.add("shape.rectangular.core width", FIELD(shapeData.rectangularSpot.width)).onlyIf(FIELD(shapeType), SpotShapeType_Rectangular);
+    zone.add("shape.rectangular.core height", FIELD(shapeData.rectangularSpot.height)).onlyIf(FIELD(shapeType), SpotShapeType_Rectangular);
+    zone.add("flow.type", FIELD(flowType));
+    zone.add("flow.radial.orientation", FIELD(flowData.radialFlow.orientation)).onlyIf(FIELD(flowType), FlowType_Radial);
+    zone.add("flow.radial.strength", FIELD(flowData.radialFlow.strength)).onlyIf(FIELD(flowType), FlowType_Radial);
+    zone.add("flow.radial.drift angle", FIELD(flowData.radialFlow.driftAngle)).onlyIf(FIELD(flowType), FlowType_Radial);
+    zone.add("flow.central.strength", FIELD(flowData.centralFlow.strength)).onlyIf(FIELD(flowType), FlowType_Central);
+    zone.add("flow.linear.angle", FIELD(flowData.linearFlow.angle)).onlyIf(FIELD(flowType), FlowType_Linear);
+    zone.add("flow.linear.strength", FIELD(flowData.linearFlow.strength)).onlyIf(FIELD(flowType), FlowType_Linear);
+    zone.add("fadeout radius", FIELD(fadeoutRadius));
+    zone.add("friction", FIELD(values.friction)).activatedBy(FIELD(activatedValues.friction));
+    zone.add("rigidity", FIELD(values.rigidity)).activatedBy(FIELD(activatedValues.rigidity));
+    zone.add("radiation.disable sources", FIELD(values.radiationDisableSources)).activatedBy(FIELD(activatedValues.radiationDisableSources));
+    zone.add("radiation.absorption", FIELD(values.radiationAbsorption)).activatedBy(FIELD(activatedValues.radiationAbsorption));
+    zone.add("radiation.absorption low velocity penalty", FIELD(values.radiationAbsorptionLowVelocityPenalty))
+        .activatedBy(FIELD(activatedValues.radiationAbsorptionLowVelocityPenalty));
+    zone.add("radiation.absorption low genome complexity penalty", FIELD(values.radiationAbsorptionLowGenomeComplexityPenalty))
+        .activatedBy(FIELD(activatedValues.radiationAbsorptionLowGenomeComplexityPenalty));
+    zone.add("radiation.factor", FIELD(values.radiationCellAgeStrength)).activatedBy(FIELD(activatedValues.radiationCellAgeStrength));
+    zone.add("cell.max force", FIELD(values.cellMaxForce)).activatedBy(FIELD(activatedValues.cellMaxForce));
+    zone.add("cell.min energy", FIELD(values.cellMinEnergy)).activatedBy(FIELD(activatedValues.cellMinEnergy));
+    zone.add("cell.death probability", FIELD(values.cellDeathProbability)).activatedBy(FIELD(activatedValues.cellDeathProbability));
+    zone.add("cell.fusion velocity", FIELD(values.cellFusionVelocity)).activatedBy(FIELD(activatedValues.cellFusionVelocity));
+    zone.add("cell.max binding energy", FIELD(values.cellMaxBindingEnergy)).activatedBy(FIELD(activatedValues.cellMaxBindingEnergy));
+    zone.add("cell.inactive max age", FIELD(values.cellInactiveMaxAge)).activatedBy(FIELD(activatedValues.cellInactiveMaxAge));
+    zone.add("cell.color transition rules.activated", FIELD(activatedValues.cellColorTransition));
+    zone.add("cell.color transition rules.duration", FIELD(values.cellColorTransitionDuration));
+    zone.add("cell.color transition rules.target color", FIELD(values.cellColorTransitionTargetColor));
+    zone.add("cell.function.attacker.energy cost", FIELD(values.cellFunctionAttackerEnergyCost))
+        .activatedBy(FIELD(activatedValues.cellFunctionAttackerEnergyCost));
+    zone.add("cell.function.attacker.food chain color matrix", FIELD(values.cellFunctionAttackerFoodChainColorMatrix))
+        .activatedBy(FIELD(activatedValues.cellFunctionAttackerFoodChainColorMatrix));
+    zone.add("cell.function.attacker.genome size bonus", FIELD(values.cellFunctionAttackerGenomeComplexityBonus))
+        .activatedBy(FIELD(activatedValues.cellFunctionAttackerGenomeComplexityBonus));
+    zone.add("cell.function.attacker.new complex mutant penalty", FIELD(values.cellFunctionAttackerNewComplexMutantPenalty))
+        .activatedBy(FIELD(activatedValues.cellFunctionAttackerNewComplexMutantPenalty));
+    zone.add("cell.function.attacker.geometry deviation exponent", FIELD(values.cellFunctionAttackerGeometryDeviationExponent))
+        .activatedBy(FIELD(activatedValues.cellFunctionAttackerGeometryDeviationExponent));
+    zone.add("cell.function.attacker.connections mismatch penalty", FIELD(values.cellFunctionAttackerConnectionsMismatchPenalty))
+        .activatedBy(FIELD(activatedValues.cellFunctionAttackerConnectionsMismatchPenalty));
+    zone.add("cell.copy mutation.neuron data", FIELD(values.cellCopyMutationNeuronData)).activatedBy(FIELD(activatedValues.cellCopyMutationNeuronData));
+    zone.add("cell.copy mutation.cell properties", FIELD(values.cellCopyMutationCellProperties))
+        .activatedBy(FIELD(activatedValues.cellCopyMutationCellProperties));
+    zone.add("cell.copy mutation.geometry", FIELD(values.cellCopyMutationGeometry)).activatedBy(FIELD(activatedValues.cellCopyMutationGeometry));
+    zone.add("cell.copy mutation.custom geometry", FIELD(values.cellCopyMutationCustomGeometry))
+        .activatedBy(FIELD(activatedValues.cellCopyMutationCustomGeometry));
+    zone.add("cell.copy mutation.cell function", FIELD(values.cellCopyMutationCellFunction)).activatedBy(FIELD(activatedValues.cellCopyMutationCellFunction));
+    zone.add("cell.copy mutation.insertion", FIELD(values.cellCopyMutationInsertion)).activatedBy(FIELD(activatedValues.cellCopyMutationInsertion));
+    zone.add("cell.copy mutation.deletion", FIELD(values.cellCopyMutationDeletion)).activatedBy(FIELD(activatedValues.cellCopyMutationDeletion));
+    zone.add("cell.copy mutation.translation", FIELD(values.cellCopyMutationTranslation)).activatedBy(FIELD(activatedValues.cellCopyMutationTranslation));
+    zone.add("cell.copy mutation.duplication", FIELD(values.cellCopyMutationDuplication)).activatedBy(FIELD(activatedValues.cellCopyMutationDuplication));
+    zone.add("cell.copy mutation.cell color", FIELD(values.cellCopyMutationCellColor)).activatedBy(FIELD(activatedValues.cellCopyMutationCellColor));
+    zone.add("cell.copy mutation.subgenome color", FIELD(values.cellCopyMutationSubgenomeColor))
+        .activatedBy(FIELD(activatedValues.cellCopyMutationSubgenomeColor));
+    zone.add("cell.copy mutation.genome color", FIELD(values.cellCopyMutationGenomeColor)).activatedBy(FIELD(activatedValues.cellCopyMutationGenomeColor));
+
+    _schemaHash = 0xcbf29ce484222325ull;
+    hashFields(_schemaHash, _globalFields);
+    hashFields(_schemaHash, _radiationSourceFields);
+    hashFields(_schemaHash, _zoneFields);
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Base/Singleton.h"
+#include "SimulationParameters.h"
+
+enum class ParameterType
+{
+    Bool,
+    Int,
+    UInt32,
+    Float,
+    Char64
+};
+
+enum class ParameterShape
+{
+    Scalar,
+    ColorVector,
+    ColorMatrix
+};
+
+//the offsets of the fields refer to SimulationParameters, RadiationSource or SimulationParametersZone, respectively
+enum class ParameterScope
+{
+    Global,
+    RadiationSource,
+    Zone
+};
+
+//the field only exists if the int at selectorOffset has the given value (used for the members of unions)
+struct ParameterCondition
+{
+    size_t selectorOffset = 0;
+    int selectorValue = 0;
+};
+
+//the field stands for the first 'count' elements of an array whose element fields are described by elementScope
+struct ParameterArray
+{
+    ParameterScope elementScope = ParameterScope::RadiationSource;
+    size_t countOffset = 0;
+    size_t elementSize = 0;
+    int maxCount = 0;
+};
+
+struct ParameterField
+{
+    std::string name;  //relative node name in the settings file, also serves as stable identifier
+    ParameterScope scope = ParameterScope::Global;
+    ParameterType type = ParameterType::Float;
+    ParameterShape shape = ParameterShape::Scalar;
+    size_t offset = 0;
+    std::optional<size_t> activatedOffset;  //bool telling whether a zone value overrides the base value
+    std::optional<ParameterCondition> condition;
+    std::optional<ParameterArray> array;
+    bool persistent = true;  //transient fields are not written to settings files
+
+    int getNumElements() const;
+    size_t getElementSize() const;
+
+    bool exists(void const* object) const;
+    int getArrayCount(void const* object) const;
+
+    template <typename T>
+    T* getValue(void* object) const;
+    template <typename T>
+    T const* getValue(void const* object) const;
+    bool* getActivated(void* object) const;
+    bool const* getActivated(void const* object) const;
+};
+
+//describes all persisted fields of the simulation parameters in the order of the settings file
+//in contrast to encoding each field by hand, codecs, diffs and hashes can be written generically on top of this table
+class SimulationParametersSchema
+{
+    MAKE_SINGLETON_NO_DEFAULT_CONSTRUCTION(SimulationParametersSchema);
+
+public:
+    std::vector<ParameterField> const& getFields(ParameterScope scope) const;
+    int getFieldIndex(ParameterScope scope, std::string const& name) const;  //throws std::runtime_error for unknown names
+    ParameterField const& getArrayField(ParameterScope elementScope) const;
+
+    //changes if fields are added, removed, renamed or reordered
+    uint64_t getSchemaHash() const;
+
+private:
+    SimulationParametersSchema();
+
+    std::vector<ParameterField> _globalFields;
+    std::vector<ParameterField> _radiationSourceFields;
+    std::vector<ParameterField> _zoneFields;
+    uint64_t _schemaHash = 0;
+};
+
+/**
+ * Implementations
+ */
+
+template <typename T>
+T* ParameterField::getValue(void* object) const
+{
+    return reinterpret_cast<T*>(static_cast<char*>(object) + offset);
+}
+
+template <typename T>
+T const* ParameterField::getValue(void const* object) const
+{
+    return reinterpret_cast<T const*>(static_cast<char const*>(object) + offset);
+}
@@ -0,0 +1,811 @@
+#include "SoftwareRenderService.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "Base/Math.h"
+#include "Base/Parallel.h"
+
+#include "Colors.h"
+#include "HostSpotCalculator.h"
+#include "SpaceCalculator.h"
+
+namespace
+{
+    auto constexpr ZoomLevelForConnections = 1.0f;
+    auto constexpr ZoomLevelForShadedCells = 10.0f;
+    auto constexpr ZoomLevelForArrows = 15.0f;
+
+    struct FloatColor
+    {
+        float r = 0;
+        float g = 0;
+        float b = 0;
+
+        FloatColor operator*(float factor) const { return {r * factor, g * factor, b * factor}; }
+        FloatColor operator/(float divisor) const { return {r / divisor, g / divisor, b / divisor}; }
+        void operator+=(FloatColor const& other)
+        {
+            r += other.r;
+            g += other.g;
+            b += other.b;
+        }
+    };
+
+    //part of the image which is rasterized by one worker: rows [startRow, endRow]
+    struct Tile
+    {
+        uint64_t* imageData;
+        IntVector2D imageSize;
+        int startRow;
+        int endRow;
+
+        bool containsIndex(int index) const { return index >= startRow * imageSize.x && index < (endRow + 1) * imageSize.x; }
+        bool overlapsRows(float minY, float maxY) const { return maxY >= toFloat(startRow - 2) && minY <= toFloat(endRow + 2); }
+    };
+
+    //negative values are saturated to 0 as by the float-to-integer conversion on the device
+    uint64_t toChannelValue(float value, float scale)
+    {
+        return static_cast<uint64_t>(std::max(0.0f, value * scale));
+    }
+
+    void drawPixel(Tile const& tile, int index, FloatColor const& color)
+    {
+        if (tile.containsIndex(index)) {
+            tile.imageData[index] = toChannelValue(color.g, 225.0f) << 16 | toChannelValue(color.r, 225.0f) << 0 | toChannelValue(color.b, 225.0f) << 32;
+        }
+    }
+
+    void drawAddingPixel(Tile const& tile, int index, FloatColor const& colorToAdd)
+    {
+        if (tile.containsIndex(index)) {
+            tile.imageData[index] +=
+                toChannelValue(colorToAdd.g, 255.0f) << 16 | toChannelValue(colorToAdd.r, 255.0f) << 0 | toChannelValue(colorToAdd.b, 255.0f) << 32;
+        }
+    }
+
+    FloatColor colorToFloatColor(uint32_t value)
+    {
+        return FloatColor{toFloat(value & 0xff) / 255, toFloat((value >> 8) & 0xff) / 255, toFloat((value >> 16) & 0xff) / 255};
+    }
+
+    uint32_t convertHSVtoRGB(float h, float s, float v)
+    {
+        auto c = v * s;
+        auto x = c * (1 - std::abs(fmodf((h / 60), 2) - 1));
+        auto m = v - c;
+
+        float r_ = 0, g_ = 0, b_ = 0;
+        if (0 <= h && h < 60.0f) {
+            r_ = c;
+            g_ = x;
+            b_ = 0;
+        }
+        if (60.0f <= h && h < 120.0f) {
+            r_ = x;
+            g_ = c;
+            b_ = 0;
+        }
+        if (120.0f <= h && h < 180.0f) {
+            r_ = 0;
+            g_ = c;
+            b_ = x;
+        }
+        if (180.0f <= h && h < 240.0f) {
+            r_ = 0;
+            g_ = x;
+            b_ = c;
+        }
+        if (240.0f <= h && h < 300.0f) {
+            r_ = x;
+            g_ = 0;
+            b_ = c;
+        }
+        if (300.0f <= h && h <= 360.0f) {
+            r_ = c;
+            g_ = 0;
+            b_ = x;
+        }
+        return (toInt((r_ + m) * 255) << 16) | (toInt((g_ + m) * 255) << 8) | toInt((b_ + m) * 255);
+    }
+
+    FloatColor calcColor(CellDescription const& cell, SimulationParameters const& parameters, CellColoring cellColoring, bool primary)
+    {
+        float factor = std::max(30.0f, std::min(300.0f, cell.energy)) / 340.0f;
+        auto cellFunction = cell.getCellFunctionType();
+
+        uint32_t cellColor = 0;
+        if (cellColoring == CellColoring_None) {
+            cellColor = 0xbfbfbf;
+        }
+        if (cellColoring == CellColoring_CellColor) {
+            cellColor = Const::IndividualCellColors[static_cast<unsigned char>(cell.color) % 7];
+        }
+        if (cellColoring == CellColoring_MutationId || (cellColoring == CellColoring_MutationId_AllCellFunctions && primary)) {
+            auto colorNumber = cell.mutationId == 0 ? 30 : (cell.mutationId == 1 ? 18 : cell.mutationId + 17);  //6 for zero mutant color
+            auto h = std::abs(toInt((colorNumber * 12107) % 360));
+            auto s = 0.6f + toFloat(std::abs(toInt(colorNumber * 13111)) % 400) / 1000;
+            cellColor = convertHSVtoRGB(toFloat(h), s, 1.0f);
+        }
+        if (cellColoring == CellColoring_LivingState) {
+            switch (cell.livingState) {
+            case LivingState_Ready:
+                cellColor = 0x1010ff;
+                break;
+            case LivingState_UnderConstruction:
+                cellColor = 0x10ff10;
+                break;
+            case LivingState_Activating:
+                cellColor = 0xffffff;
+                break;
+            case LivingState_Detaching:
+                cellColor = 0xbf4040;
+                break;
+            case LivingState_Reviving:
+                cellColor = 0x4040bf;
+                break;
+            case LivingState_Dying:
+                cellColor = 0xff1010;
+                break;
+            default:
+                cellColor = 0x000000;
+                break;
+            }
+        }
+        if (cellColoring == CellColoring_GenomeSize) {
+            cellColor = convertHSVtoRGB(toFloat(std::min(360.0f, 240.0f + powf(cell.genomeComplexity, 0.3f) * 15.0f)), 1.0f, 1.0f);
+        }
+        if (cellColoring == CellColoring_CellFunction) {
+            if (cellFunction == parameters.highlightedCellFunction) {
+                auto h = (toFloat(cellFunction) / toFloat(CellFunction_Count - 1)) * 360.0f;
+                cellColor = convertHSVtoRGB(h, 0.7f, 1.0f);
+                factor = 2.0f;
+            } else {
+                cellColor = 0x404040;
+            }
+        }
+        if (cellColoring == CellColoring_AllCellFunctions || (cellColoring == CellColoring_MutationId_AllCellFunctions && !primary)) {
+            auto h = (toFloat(cellFunction) / toFloat(CellFunction_Count - 1)) * 360.0f;
+            cellColor = convertHSVtoRGB(h, 0.7f, 1.0f);
+        }
+
+        return {
+            toFloat((cellColor >> 16) & 0xff) / 256.0f * factor,
+            toFloat((cellColor >> 8) & 0xff) / 256.0f * factor,
+            toFloat(cellColor & 0xff) / 256.0f * factor};
+    }
+
+    FloatColor calcColor(ParticleDescription const& particle)
+    {
+        auto intensity = std::max(std::min((toInt(particle.energy) + 10.0f) * 5, 450.0f), 20.0f) / 1000.0f;
+        intensity = std::max(0.08f, intensity);
+        return {intensity, intensity, intensity / 2};
+    }
+
+    bool isActive(CellDescription const& cell)
+    {
+        return std::any_of(cell.signal.channels.begin(), cell.signal.channels.end(), [](float channel) { return std::abs(channel) > NEAR_ZERO; });
+    }
+
+    void drawDot(Tile const& tile, RealVector2D const& pos, FloatColor const& colorToAdd)
+    {
+        IntVector2D intPos{toInt(pos.x), toInt(pos.y)};
+        auto const& imageSize = tile.imageSize;
+        if (intPos.x >= 0 && intPos.y >= 0 && intPos.y < imageSize.y) {
+
+            RealVector2D posFrac{pos.x - intPos.x, pos.y - intPos.y};
+            auto index = intPos.x + intPos.y * imageSize.x;
+
+            if (intPos.x < imageSize.x) {
+                drawAddingPixel(tile, index, colorToAdd * (1.0f - posFrac.x) * (1.0f - posFrac.y));
+                drawAddingPixel(tile, index + imageSize.x, colorToAdd * (1.0f - posFrac.x) * posFrac.y);
+            }
+            if (intPos.x + 1 < imageSize.x) {
+                drawAddingPixel(tile, index + 1, colorToAdd * posFrac.x * (1.0f - posFrac.y));
+                drawAddingPixel(tile, index + imageSize.x + 1, colorToAdd * posFrac.x * posFrac.y);
+            }
+        }
+    }
+
+    void drawCircle(Tile const& tile, RealVector2D const& pos, FloatColor color, float radius, bool shaded = true, bool inverted = false)
+    {
+        if (!tile.overlapsRows(pos.y - radius - 1, pos.y + radius + 1)) {
+            return;
+        }
+        if (radius > 2.0 - NEAR_ZERO) {
+            auto radiusSquared = radius * radius;
+            for (float x = -radius; x <= radius; x += 1.0f) {
+                for (float y = -radius; y <= radius; y += 1.0f) {
+                    if (!tile.overlapsRows(pos.y + y, pos.y + y)) {
+                        continue;
+                    }
+                    auto rSquared = x * x + y * y;
+                    if (rSquared <= radiusSquared) {
+                        auto factor = inverted ? (rSquared / radiusSquared) * 2 : (1.0f - rSquared / radiusSquared) * 2;
+                        auto angle = Math::angleOfVector({x, y});
+                        if (shaded) {
+                            angle -= 45.0f;
+                            if (angle > 180.0f) {
+                                angle -= 360.0f;
+                            }
+                            if (angle < -180.0f) {
+                                angle += 360.0f;
+                            }
+                            factor *= 40.0f / (std::abs(angle) + 1.0f);
+
+                            factor = std::min(factor, 1.0f);
+                        }
+                        if (inverted && sqrtf(rSquared) > radius - 2.0f) {
+                            factor = 1.5f;
+                        }
+                        drawDot(tile, pos + RealVector2D{x, y}, color * factor);
+                    }
+                }
+            }
+        } else {
+            color = color * (radius * 2);
+            drawDot(tile, pos, color);
+            color = color * 0.45f;
+            drawDot(tile, pos + RealVector2D{1, 0}, color);
+            drawDot(tile, pos + RealVector2D{-1, 0}, color);
+            drawDot(tile, pos + RealVector2D{0, 1}, color);
+            drawDot(tile, pos + RealVector2D{0, -1}, color);
+        }
+    }
+
+    //counterpart of drawCircle_block which is used for the glow
+    void drawGlowCircle(Tile const& tile, RealVector2D const& pos, FloatColor color, float radius)
+    {
+        if (!tile.overlapsRows(pos.y - radius - 1, pos.y + radius + 1)) {
+            return;
+        }
+        if (radius > 2.0 - NEAR_ZERO) {
+            auto radiusSquared = radius * radius;
+            auto length = 2 * toInt(radius) + 1;
+            auto startY = std::max(0, toInt(toFloat(tile.startRow - 2) - pos.y + radius));
+            auto endY = std::min(length - 1, toInt(toFloat(tile.endRow + 2) - pos.y + radius) + 1);
+            for (int indexY = startY; indexY <= endY; ++indexY) {
+                for (int indexX = 0; indexX < length; ++indexX) {
+                    auto x = toFloat(indexX) - radius;
+                    auto y = toFloat(indexY) - radius;
+                    auto rSquared = x * x + y * y;
+                    if (rSquared <= radiusSquared) {
+                        auto factor = (1.0f - rSquared / radiusSquared) * 2;
+                        drawDot(tile, pos + RealVector2D{x, y}, color * factor);
+                    }
+                }
+            }
+        } else {
+            color = color * (radius * 2);
+            drawDot(tile, pos, color);
+            color = color * 0.3f;
+            drawDot(tile, pos + RealVector2D{1, 0}, color);
+            drawDot(tile, pos + RealVector2D{-1, 0}, color);
+            drawDot(tile, pos + RealVector2D{0, 1}, color);
+            drawDot(tile, pos + RealVector2D{0, -1}, color);
+        }
+    }
+
+    void drawLine(Tile const& tile, RealVector2D const& start, RealVector2D const& end, FloatColor const& color, float pixelDistance = 1.5f)
+    {
+        if (!tile.overlapsRows(std::min(start.y, end.y), std::max(start.y, end.y))) {
+            return;
+        }
+        float dist = Math::length(end - start);
+        RealVector2D const v = {(end.x - start.x) / dist * pixelDistance, (end.y - start.y) / dist * pixelDistance};
+        auto pos = start;
+
+        for (float d = 0; d <= dist; d += pixelDistance) {
+            drawDot(tile, pos, color);
+            pos = pos + v;
+        }
+    }
+
+    bool isContainedInImage(IntVector2D const& imageSize, RealVector2D const& pos)
+    {
+        return pos.x >= 0 && pos.x <= toFloat(imageSize.x) && pos.y >= 0 && pos.y <= toFloat(imageSize.y);
+    }
+
+    using PrimitiveType = int;
+    enum PrimitiveType_
+    {
+        PrimitiveType_Circle,
+        PrimitiveType_GlowCircle,
+        PrimitiveType_Line
+    };
+
+    //shape in image coordinates which is created once and rasterized by every tile it overlaps
+    struct Primitive
+    {
+        PrimitiveType type = PrimitiveType_Circle;
+        RealVector2D pos;  //center of circles, start of lines
+        RealVector2D end;
+        FloatColor color;
+        float radius = 0;
+        float pixelDistance = 1.5f;
+        bool shaded = true;
+        bool inverted = false;
+
+        float getMinY() const { return type == PrimitiveType_Line ? std::min(pos.y, end.y) : pos.y - radius; }
+        float getMaxY() const { return type == PrimitiveType_Line ? std::max(pos.y, end.y) : pos.y + radius; }
+    };
+
+    Primitive createCircle(RealVector2D const& pos, FloatColor const& color, float radius, bool shaded = true, bool inverted = false)
+    {
+        return Primitive{.type = PrimitiveType_Circle, .pos = pos, .color = color, .radius = radius, .shaded = shaded, .inverted = inverted};
+    }
+
+    Primitive createLine(RealVector2D const& start, RealVector2D const& end, FloatColor const& color, float pixelDistance = 1.5f)
+    {
+        return Primitive{.type = PrimitiveType_Line, .pos = start, .end = end, .color = color, .pixelDistance = pixelDistance};
+    }
+
+    void drawPrimitive(Tile const& tile, Primitive const& primitive)
+    {
+        switch (primitive.type) {
+        case PrimitiveType_Circle:
+            drawCircle(tile, primitive.pos, primitive.color, primitive.radius, primitive.shaded, primitive.inverted);
+            break;
+        case PrimitiveType_GlowCircle:
+            drawGlowCircle(tile, primitive.pos, primitive.color, primitive.radius);
+            break;
+        case PrimitiveType_Line:
+            drawLine(tile, primitive.pos, primitive.end, primitive.color, primitive.pixelDistance);
+            break;
+        }
+    }
+
+    class Rasterizer
+    {
+    public:
+        Rasterizer(
+            DataDescription const& data,
+            IntVector2D const& worldSize,
+            SimulationParameters const& parameters,
+            SoftwareRenderService::RenderParameters const& renderParameters)
+            : _data(data)
+            , _worldSize(worldSize)
+            , _parameters(parameters)
+            , _renderParameters(renderParameters)
+            , _space(worldSize)
+            , _spotCalculator(parameters, worldSize)
+        {
+            for (int i = 0; i < parameters.numZones; ++i) {
+                _zoneColors[i] = colorToFloatColor(parameters.zone[i].color);
+            }
+            _zoom = renderParameters._zoom;
+            _imageSize = renderParameters._imageSize;
+            _rectUpperLeft = renderParameters._rectUpperLeft;
+            _rectLowerRight = _rectUpperLeft + RealVector2D{toFloat(_imageSize.x), toFloat(_imageSize.y)} / _zoom;
+            _universeImageSize = RealVector2D{toFloat(worldSize.x), toFloat(worldSize.y)} * _zoom;
+            _tileHeight = std::max(1, renderParameters._tileHeight);
+            _numTiles = (_imageSize.y + _tileHeight - 1) / _tileHeight;
+        }
+
+        std::vector<uint64_t> render()
+        {
+            std::vector<uint64_t> result(static_cast<size_t>(_imageSize.x) * _imageSize.y, 0);
+            if (result.empty()) {
+                return result;
+            }
+            createPrimitives();
+            auto primitiveIndicesByTile = assignToTiles(_primitives);
+            auto glowPrimitiveIndicesByTile = assignToTiles(_glowPrimitives);
+
+            //same drawing order as in _RenderingKernelsLauncher::drawImage
+            Parallel::forEachPartition(
+                _numTiles,
+                [&](ParallelPartition const& partition) {
+                    for (int tileIndex = partition.startIndex; tileIndex <= partition.endIndex; ++tileIndex) {
+                        Tile tile{result.data(), _imageSize, tileIndex * _tileHeight, std::min(_imageSize.y, (tileIndex + 1) * _tileHeight) - 1};
+                        drawBackground(tile);
+                        for (auto const& primitiveIndex : primitiveIndicesByTile[tileIndex]) {
+                            drawPrimitive(tile, _primitives[primitiveIndex]);
+                        }
+                        if (_parameters.showRadiationSources) {
+                            drawRadiationSources(tile);
+                        }
+                        for (auto const& primitiveIndex : glowPrimitiveIndicesByTile[tileIndex]) {
+                            drawPrimitive(tile, _glowPrimitives[primitiveIndex]);
+                        }
+                    }
+                },
+                _renderParameters._maxThreads);
+
+            if (_parameters.borderlessRendering) {
+                drawRepetition(result);
+            }
+            return result;
+        }
+
+    private:
+        RealVector2D mapWorldPosToImagePos(RealVector2D const& pos) const
+        {
+            RealVector2D result{(pos.x - _rectUpperLeft.x) * _zoom, (pos.y - _rectUpperLeft.y) * _zoom};
+            if (_parameters.borderlessRendering) {
+                result.x = Math::modulo(result.x, _universeImageSize.x);
+                result.y = Math::modulo(result.y, _universeImageSize.y);
+            }
+            return result;
+        }
+
+        bool isLineVisible(RealVector2D const& startImagePos, RealVector2D const& endImagePos) const
+        {
+            return std::abs(startImagePos.x - endImagePos.x) < _universeImageSize.x / 2 && std::abs(startImagePos.y - endImagePos.y) < _universeImageSize.y / 2;
+        }
+
+        void createPrimitives()
+        {
+            std::vector<int> visibleCellIndices;
+            for (int i = 0; i < toInt(_data.cells.size()); ++i) {
+                if (isContainedInImage(_imageSize, mapWorldPosToImagePos(_data.cells[i].pos))) {
+                    visibleCellIndices.emplace_back(i);
+                }
+            }
+            if (_zoom >= ZoomLevelForConnections) {
+                _cellIndexById.reserve(_data.cells.size());
+                for (int i = 0; i < toInt(_data.cells.size()); ++i) {
+                    _cellIndexById.emplace(_data.cells[i].id, i);
+                }
+            }
+
+            //primitives of disjoint cell ranges are created on worker threads and concatenated afterwards
+            auto maxThreads = _renderParameters._maxThreads > 0 ? _renderParameters._maxThreads : Parallel::getNumThreads();
+            auto numPartitions = std::max(1, std::min(toInt(visibleCellIndices.size()), maxThreads));
+            std::vector<std::vector<Primitive>> primitivesByPartition(numPartitions);
+            std::vector<std::vector<Primitive>> glowPrimitivesByPartition(numPartitions);
+            Parallel::forEachPartition(
+                numPartitions,
+                [&](ParallelPartition const& partitions) {
+                    for (int partitionIndex = partitions.startIndex; partitionIndex <= partitions.endIndex; ++partitionIndex) {
+                        auto partition = Parallel::calcPartition(toInt(visibleCellIndices.size()), partitionIndex, numPartitions);
+                        for (int i = partition.startIndex; i <= partition.endIndex; ++i) {
+                            addCellPrimitives(primitivesByPartition[partitionIndex], glowPrimitivesByPartition[partitionIndex], visibleCellIndices[i]);
+                        }
+                    }
+                },
+                _renderParameters._maxThreads);
+            for (int i = 0; i < numPartitions; ++i) {
+                _primitives.insert(_primitives.end(), primitivesByPartition[i].begin(), primitivesByPartition[i].end());
+                _glowPrimitives.insert(_glowPrimitives.end(), glowPrimitivesByPartition[i].begin(), glowPrimitivesByPartition[i].end());
+            }
+
+            for (auto const& particle : _data.particles) {
+                if (isContainedInImage(_imageSize, mapWorldPosToImagePos(particle.pos))) {
+                    auto imagePos = mapWorldPosToImagePos(_space.getCorrectedPosition(particle.pos));
+                    _primitives.emplace_back(createCircle(imagePos, calcColor(particle), _zoom / 3));
+                }
+            }
+        }
+
+        std::vector<std::vector<int>> assignToTiles(std::vector<Primitive> const& primitives) const
+        {
+            std::vector<std::vector<int>> result(_numTiles);
+            for (int i = 0; i < toInt(primitives.size()); ++i) {
+                auto const& primitive = primitives[i];
+
+                //drawn dots may extend up to 2 rows beyond the geometric extent
+                auto minY = primitive.getMinY() - 2;
+                auto maxY = primitive.getMaxY() + 2;
+                if (maxY < 0 || minY >= toFloat(_imageSize.y)) {
+                    continue;
+                }
+                auto startTile = std::max(0, toInt(minY) / _tileHeight);
+                auto endTile = std::min(_numTiles - 1, toInt(maxY) / _tileHeight);
+                for (int tileIndex = startTile; tileIndex <= endTile; ++tileIndex) {
+                    result[tileIndex].emplace_back(i);
+                }
+            }
+            return result;
+        }
+
+        void drawBackground(Tile const& tile) const
+        {
+            IntVector2D outsideRectUpperLeft{-std::min(toInt(_rectUpperLeft.x * _zoom), 0), -std::min(toInt(_rectUpperLeft.y * _zoom), 0)};
+            IntVector2D outsideRectLowerRight{
+                _imageSize.x - std::max(toInt((_rectLowerRight.x - _worldSize.x) * _zoom), 0),
+                _imageSize.y - std::max(toInt((_rectLowerRight.y - _worldSize.y) * _zoom), 0)};
+
+            auto baseColor = colorToFloatColor(_parameters.backgroundColor);
+            auto const viewWidth = std::max(1.0f, _rectLowerRight.x - _rectUpperLeft.x);
+            auto const pixelInWorldSize = viewWidth / toFloat(_worldSize.x);
+            auto const gridDistance = powf(10.0f, truncf(log10f(viewWidth))) / 10.0f;
+            auto const maxGridDistance = viewWidth / 10;
+            auto const gridRemainder = (maxGridDistance - gridDistance) / maxGridDistance;
+
+            for (int y = tile.startRow; y <= tile.endRow; ++y) {
+                for (int x = 0; x < _imageSize.x; ++x) {
+                    auto index = x + y * _imageSize.x;
+                    RealVector2D worldPos{toFloat(x) / _zoom + _rectUpperLeft.x, toFloat(y) / _zoom + _rectUpperLeft.y};
+
+                    if (!_parameters.borderlessRendering
+                        && (x < outsideRectUpperLeft.x || y < outsideRectUpperLeft.y || x >= outsideRectLowerRight.x || y >= outsideRectLowerRight.y)) {
+                        tile.imageData[index] = 0;
+                    } else {
+                        drawPixel(tile, index, calcBackgroundColor(worldPos, baseColor));
+                    }
+
+                    if (_parameters.gridLines) {
+                        auto drawGridLine = [&](float distance, float weight) {
+                            if (std::abs(distance) <= pixelInWorldSize * 8) {
+                                auto viewDistance = std::max(0.0f, 0.1f - std::abs(distance) * _zoom / 10) * weight * 0.7f;
+                                drawAddingPixel(tile, index, {viewDistance, viewDistance, viewDistance});
+                            }
+                        };
+                        drawGridLine(Math::modulo(worldPos.x + gridDistance / 2, gridDistance) - gridDistance / 2, gridRemainder);
+                        drawGridLine(Math::modulo(worldPos.y + gridDistance / 2, gridDistance) - gridDistance / 2, gridRemainder);
+                        drawGridLine(Math::modulo(worldPos.x + gridDistance / 20, gridDistance / 10) - gridDistance / 20, 1.0f - gridRemainder);
+                        drawGridLine(Math::modulo(worldPos.y + gridDistance / 20, gridDistance / 10) - gridDistance / 20, 1.0f - gridRemainder);
+                    }
+                }
+            }
+        }
+
+        FloatColor calcBackgroundColor(RealVector2D const& worldPos, FloatColor const& baseColor) const
+        {
+            return _spotCalculator.calcResultingValue(worldPos, baseColor, _zoneColors);
+        }
+
+        void addCellPrimitives(std::vector<Primitive>& primitives, std::vector<Primitive>& glowPrimitives, int cellIndex) const
+        {
+            auto const& cell = _data.cells[cellIndex];
+            auto const& cellPos = cell.pos;
+            auto cellImagePos = mapWorldPosToImagePos(cellPos);
+            auto shadedCells = _zoom >= ZoomLevelForShadedCells;
+            auto cellRadius = _zoom * _parameters.cellRadius;
+            auto cellFunction = cell.getCellFunctionType();
+            auto coloring = _parameters.cellColoring;
+
+            //draw primary color for cell
+            auto primaryColor = calcColor(cell, _parameters, coloring, true) * 0.85f;
+            primitives.emplace_back(createCircle(cellImagePos, primaryColor * 0.45f, cellRadius * 8 / 5, false, false));
+
+            //draw secondary color for cell
+            auto secondaryColor =
+                coloring == CellColoring_MutationId_AllCellFunctions ? calcColor(cell, _parameters, coloring, false) * 0.5f : primaryColor * 0.6f;
+            primitives.emplace_back(createCircle(cellImagePos, secondaryColor, cellRadius, shadedCells, true));
+
+            //draw signal
+            if (isActive(cell) && _zoom >= _parameters.zoomLevelNeuronalActivity) {
+                primitives.emplace_back(createCircle(cellImagePos, FloatColor{0.3f, 0.3f, 0.3f}, cellRadius, shadedCells));
+            }
+
+            //attack events are not part of the descriptions and therefore not drawn
+
+            //draw muscle movements
+            if (_parameters.muscleMovementVisualization && cellFunction == CellFunction_Muscle) {
+                auto const& muscle = std::get<MuscleDescription>(*cell.cellFunction);
+                if (muscle.lastMovementX != 0 || muscle.lastMovementY != 0) {
+                    RealVector2D lastMovement{muscle.lastMovementX, muscle.lastMovementY};
+                    auto lastMovementLength = Math::length(lastMovement);
+                    if (lastMovementLength > 0.05f) {
+                        lastMovement = lastMovement / lastMovementLength * 0.05f;
+                    }
+
+                    auto color = FloatColor{0.7f, 0.7f, 0.7f} * std::min(1.0f, _zoom * 0.1f);
+                    auto endPos = cellPos + lastMovement * 100;
+                    auto endImagePos = mapWorldPosToImagePos(endPos);
+                    if (isLineVisible(cellImagePos, endImagePos)) {
+                        primitives.emplace_back(createLine(cellImagePos, endImagePos, color));
+                    }
+
+                    auto arrowImagePos1 = mapWorldPosToImagePos(endPos + RealVector2D{-lastMovement.x + lastMovement.y, -lastMovement.x - lastMovement.y} * 20);
+                    if (isLineVisible(arrowImagePos1, endImagePos)) {
+                        primitives.emplace_back(createLine(arrowImagePos1, endImagePos, color));
+                    }
+
+                    auto arrowImagePos2 = mapWorldPosToImagePos(endPos + RealVector2D{-lastMovement.x - lastMovement.y, +lastMovement.x - lastMovement.y} * 20);
+                    if (isLineVisible(arrowImagePos2, endImagePos)) {
+                        primitives.emplace_back(createLine(arrowImagePos2, endImagePos, color));
+                    }
+                }
+            }
+
+            //draw detonation
+            if (cellFunction == CellFunction_Detonator) {
+                auto const& detonator = std::get<DetonatorDescription>(*cell.cellFunction);
+                if (detonator.state == DetonatorState_Activated && detonator.countdown < 2) {
+                    auto radius = toFloat((_renderParameters._timestep - cell.executionOrderNumber + 5) % 6 + (6 - detonator.countdown * 6));
+                    radius *= radius;
+                    radius *= _parameters.cellFunctionDetonatorRadius[cell.color] * _zoom / 36;
+                    primitives.emplace_back(createCircle(cellImagePos, FloatColor{0.3f, 0.3f, 0.0f}, radius, shadedCells));
+                }
+            }
+
+            //draw connections
+            auto lineColor = primaryColor * (std::min((_zoom - 1.0f) / 3, 1.0f) * 2 * 0.7f);
+            if (_zoom >= ZoomLevelForConnections) {
+                for (auto const& connection : cell.connections) {
+                    auto otherCell = findCell(connection.cellId);
+                    if (!otherCell) {
+                        continue;
+                    }
+                    auto otherCellPos = cellPos + _space.getCorrectedDirection(otherCell->pos - cellPos);
+
+                    auto distFromCellCenter = normalized(otherCellPos - cellPos) / 4;
+                    auto const startImagePos = mapWorldPosToImagePos(cellPos + distFromCellCenter);
+                    auto const endImagePos = mapWorldPosToImagePos(otherCellPos - distFromCellCenter);
+                    if (isLineVisible(startImagePos, endImagePos)) {
+                        primitives.emplace_back(createLine(startImagePos, endImagePos, lineColor));
+                    }
+                }
+            }
+
+            //draw arrows
+            if (_zoom >= ZoomLevelForArrows && cell.inputExecutionOrderNumber && *cell.inputExecutionOrderNumber != cell.executionOrderNumber) {
+                for (auto const& connection : cell.connections) {
+                    auto otherCell = findCell(connection.cellId);
+                    if (!otherCell || otherCell->executionOrderNumber != *cell.inputExecutionOrderNumber || otherCell->outputBlocked) {
+                        continue;
+                    }
+                    auto otherCellPos = cellPos + _space.getCorrectedDirection(otherCell->pos - cellPos);
+
+                    auto const otherCellImagePos = mapWorldPosToImagePos(otherCellPos);
+                    if (!isContainedInImage(_imageSize, otherCellImagePos)) {
+                        continue;
+                    }
+                    auto const arrowEnd = mapWorldPosToImagePos(cellPos + normalized(otherCellPos - cellPos) / 4);
+                    if (!isContainedInImage(_imageSize, arrowEnd)) {
+                        continue;
+                    }
+                    auto direction = normalized(arrowEnd - otherCellImagePos);
+                    {
+                        auto arrowPartStart = RealVector2D{-direction.x + direction.y, -direction.x - direction.y} * _zoom / 14 + arrowEnd;
+                        if (isLineVisible(arrowPartStart, arrowEnd)) {
+                            primitives.emplace_back(createLine(arrowPartStart, arrowEnd, lineColor, 0.5f));
+                        }
+                    }
+                    {
+                        auto arrowPartStart = RealVector2D{-direction.x - direction.y, direction.x - direction.y} * _zoom / 14 + arrowEnd;
+                        if (isLineVisible(arrowPartStart, arrowEnd)) {
+                            primitives.emplace_back(createLine(arrowPartStart, arrowEnd, lineColor, 0.5f));
+                        }
+                    }
+                }
+            }
+
+            //draw glow
+            if (_parameters.features.cellGlow) {
+                auto glowColor = calcColor(cell, _parameters, _parameters.cellGlowColoring, true) * _parameters.cellGlowStrength * 0.1f;
+                glowPrimitives.emplace_back(
+                    Primitive{.type = PrimitiveType_GlowCircle, .pos = cellImagePos, .color = glowColor, .radius = _zoom * _parameters.cellGlowRadius});
+            }
+        }
+
+        void drawRadiationSources(Tile const& tile) const
+        {
+            for (int i = 0; i < _parameters.numRadiationSources; ++i) {
+                RealVector2D sourcePos{_parameters.radiationSource[i].posX, _parameters.radiationSource[i].posY};
+                auto imagePos = mapWorldPosToImagePos(sourcePos);
+                if (!isContainedInImage(_imageSize, imagePos)) {
+                    continue;
+                }
+                auto drawCrossPixel = [&](int drawX, int drawY) {
+                    if (0 <= drawX && drawX < _imageSize.x && 0 <= drawY && drawY < _imageSize.y) {
+                        auto index = drawX + drawY * _imageSize.x;
+                        if (tile.containsIndex(index)) {
+                            tile.imageData[index] = 0x0000000001ff;
+                        }
+                    }
+                };
+                for (int dx = -5; dx <= 5; ++dx) {
+                    drawCrossPixel(toInt(imagePos.x) + dx, toInt(imagePos.y));
+                }
+                for (int dy = -5; dy <= 5; ++dy) {
+                    drawCrossPixel(toInt(imagePos.x), toInt(imagePos.y) + dy);
+                }
+            }
+        }
+
+        //reads from a copy such that the result does not depend on the order in which the pixels are processed
+        void drawRepetition(std::vector<uint64_t>& image) const
+        {
+            auto source = image;
+            Parallel::forEachPartition(
+                _imageSize.y,
+                [&](ParallelPartition const& partition) {
+                    for (int y = partition.startIndex; y <= partition.endIndex; ++y) {
+                        for (int x = 0; x < _imageSize.x; ++x) {
+                            if (x < toInt(_universeImageSize.x) && y < toInt(_universeImageSize.y)) {
+                                continue;
+                            }
+                            RealVector2D worldPos{toFloat(x) / _zoom + _rectUpperLeft.x, toFloat(y) / _zoom + _rectUpperLeft.y};
+                            auto refPos = mapWorldPosToImagePos(worldPos);
+                            IntVector2D refIntPos{toInt(refPos.x), toInt(refPos.y)};
+                            if (refIntPos.x >= 0 && refIntPos.x < _imageSize.x && refIntPos.y >= 0 && refIntPos.y < _imageSize.y) {
+                                image[x + y * _imageSize.x] = source[refIntPos.x + refIntPos.y * _imageSize.x];
+                            }
+                        }
+                    }
+                },
+                _renderParameters._maxThreads);
+        }
+
+        CellDescription const* findCell(uint64_t id) const
+        {
+            auto findResult = _cellIndexById.find(id);
+            return findResult != _cellIndexById.end() ? &_data.cells[findResult->second] : nullptr;
+        }
+
+        static RealVector2D normalized(RealVector2D v)
+        {
+            Math::normalize(v);
+            return v;
+        }
+
+        DataDescription const& _data;
+        IntVector2D _worldSize;
+        SimulationParameters const& _parameters;
+        SoftwareRenderService::RenderParameters _renderParameters;
+        SpaceCalculator _space;
+        HostSpotCalculator _spotCalculator;
+        FloatColor _zoneColors[MAX_ZONES];
+
+        float _zoom = 1.0f;
+        IntVector2D _imageSize;
+        RealVector2D _rectUpperLeft;
+        RealVector2D _rectLowerRight;
+        RealVector2D _universeImageSize;
+        int _tileHeight = 1;
+        int _numTiles = 0;
+
+        std::unordered_map<uint64_t, int> _cellIndexById;
+        std::vector<Primitive> _primitives;  //cells and particles
+        std::vector<Primitive> _glowPrimitives;  //drawn after radiation sources
+    };
+
+    float mapColor(float value, SoftwareRenderService::ToneMappingParameters const& parameters)
+    {
+        return ((sqrtf(value * 256.0f) - 0.7f) * parameters._contrast + 0.5f) * parameters._brightness;
+    }
+}
+
+std::vector<uint64_t> SoftwareRenderService::renderAccumulationImage(
+    DataDescription const& data,
+    IntVector2D const& worldSize,
+    SimulationParameters const& parameters,
+    RenderParameters const& renderParameters) const
+{
+    return Rasterizer(data, worldSize, parameters, renderParameters).render();
+}
+
+std::vector<uint8_t>
+SoftwareRenderService::convertToRgb(std::vector<uint64_t> const& accumulationImage, IntVector2D const& imageSize, ToneMappingParameters const& parameters) const
+{
+    CHECK(accumulationImage.size() == static_cast<size_t>(imageSize.x) * imageSize.y);
+
+    auto getChannel = [&](int x, int y, int channel) {
+        x = std::min(x, imageSize.x - 1);
+        y = std::min(y, imageSize.y - 1);
+        return toFloat((accumulationImage[x + y * imageSize.x] >> (16 * channel)) & 0xffff) / 65535.0f;
+    };
+
+    std::vector<uint8_t> result(accumulationImage.size() * 3);
+    Parallel::forEachPartition(imageSize.y, [&](ParallelPartition const& partition) {
+        for (int y = partition.startIndex; y <= partition.endIndex; ++y) {
+            for (int x = 0; x < imageSize.x; ++x) {
+                for (int channel = 0; channel < 3; ++channel) {
+
+                    //the view shader adds the mapped pixel and the mapped average of its 2x2 neighborhood
+                    auto average =
+                        (getChannel(x, y, channel) + getChannel(x + 1, y, channel) + getChannel(x, y + 1, channel) + getChannel(x + 1, y + 1, channel)) / 4;
+                    auto value = mapColor(getChannel(x, y, channel), parameters) + mapColor(average, parameters);
+                    result[(x + y * imageSize.x) * 3 + channel] = static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+                }
+            }
+        }
+    });
+    return result;
+}
+
+std::vector<uint8_t> SoftwareRenderService::renderRgbImage(
+    DataDescription const& data,
+    IntVector2D const& worldSize,
+    SimulationParameters const& parameters,
+    RenderParameters const& renderParameters,
+    ToneMappingParameters const& toneMappingParameters) const
+{
+    return convertToRgb(renderAccumulationImage(data, worldSize, parameters, renderParameters), renderParameters._imageSize, toneMappingParameters);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Singleton.h"
+#include "Base/Vector2D.h"
+
+#include "Descriptions.h"
+#include "SimulationParameters.h"
+
+//host port of the drawing pipeline in RenderingKernels.cu for rendering snapshots without a GPU
+class SoftwareRenderService
+{
+    MAKE_SINGLETON(SoftwareRenderService);
+
+public:
+    struct RenderParameters
+    {
+        MEMBER_DECLARATION(RenderParameters, RealVector2D, rectUpperLeft, RealVector2D({0, 0}));
+        MEMBER_DECLARATION(RenderParameters, IntVector2D, imageSize, IntVector2D({800, 600}));
+        MEMBER_DECLARATION(RenderParameters, float, zoom, 1.0f);
+        MEMBER_DECLARATION(RenderParameters, uint64_t, timestep, 0);
+        MEMBER_DECLARATION(RenderParameters, int, tileHeight, 32);
+        MEMBER_DECLARATION(RenderParameters, int, maxThreads, 0);  //0 = number of hardware threads
+    };
+
+    //returns pixels in the accumulation format of the CUDA kernels: red | green << 16 | blue << 32 with 16 bits per channel
+    //the image is divided into tiles of rows which are rasterized on worker threads; the result does not depend on the number of threads
+    std::vector<uint64_t> renderAccumulationImage(
+        DataDescription const& data,
+        IntVector2D const& worldSize,
+        SimulationParameters const& parameters,
+        RenderParameters const& renderParameters) const;
+
+    struct ToneMappingParameters
+    {
+        MEMBER_DECLARATION(ToneMappingParameters, float, brightness, 1.0f);
+        MEMBER_DECLARATION(ToneMappingParameters, float, contrast, 1.0f);
+    };
+
+    //applies the color mapping of shader.fs (without glow and motion blur effects) and returns 8-bit RGB triples row by row
+    std::vector<uint8_t>
+    convertToRgb(std::vector<uint64_t> const& accumulationImage, IntVector2D const& imageSize, ToneMappingParameters const& parameters) const;
+
+    std::vector<uint8_t> renderRgbImage(
+        DataDescription const& data,
+        IntVector2D const& worldSize,
+        SimulationParameters const& parameters,
+        RenderParameters const& renderParameters,
+        ToneMappingParameters const& toneMappingParameters) const;
+};
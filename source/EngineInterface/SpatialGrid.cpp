@@ -0,0 +1,196 @@
+#include "SpatialGrid.h"
+
+#include <algorithm>
+
+#include "Base/Math.h"
+
+namespace
+{
+    auto constexpr MaxBuckets = 1 << 22;
+    auto constexpr MinChainedEntriesForRebuild = 64;
+}
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : _cellSize(cellSize)
+{}
+
+SpatialGrid::SpatialGrid(IntVector2D const& worldSize, float cellSize)
+    : _cellSize(cellSize)
+{
+    setWorldSize(worldSize);
+}
+
+void SpatialGrid::setWorldSize(IntVector2D const& worldSize)
+{
+    if (_spaceCalculator && _worldSize == worldSize) {
+        return;
+    }
+    _worldSize = worldSize;
+    _spaceCalculator.emplace(worldSize);
+    for (auto& pos : _positions) {
+        pos = _spaceCalculator->getCorrectedPosition(pos);
+    }
+    rebuild();
+}
+
+std::optional<IntVector2D> SpatialGrid::getWorldSize() const
+{
+    if (_spaceCalculator) {
+        return _worldSize;
+    }
+    return std::nullopt;
+}
+
+void SpatialGrid::build(std::vector<RealVector2D> const& positions)
+{
+    _positions = positions;
+    if (_spaceCalculator) {
+        for (auto& pos : _positions) {
+            pos = _spaceCalculator->getCorrectedPosition(pos);
+        }
+    }
+    rebuild();
+}
+
+int SpatialGrid::insert(RealVector2D const& pos)
+{
+    auto index = toInt(_positions.size());
+    _positions.emplace_back(_spaceCalculator ? _spaceCalculator->getCorrectedPosition(pos) : pos);
+
+    auto numChainedEntries = index + 1 - _numBuiltEntries;
+    if (_bucketStarts.empty() || numChainedEntries > std::max(MinChainedEntriesForRebuild, _numBuiltEntries)) {
+        rebuild();
+        return index;
+    }
+    auto bucketIndex = getBucketIndex(getBucket(_positions.back()));
+    _chainNext.emplace_back(_chainHeads[bucketIndex]);
+    _chainHeads[bucketIndex] = index;
+    return index;
+}
+
+void SpatialGrid::clear()
+{
+    _positions.clear();
+    rebuild();
+}
+
+int SpatialGrid::getNumEntries() const
+{
+    return toInt(_positions.size());
+}
+
+RealVector2D const& SpatialGrid::getPos(int index) const
+{
+    return _positions[index];
+}
+
+std::vector<int> SpatialGrid::getIndicesWithinRadius(RealVector2D const& pos, float radius) const
+{
+    std::vector<int> result;
+    forEachWithinRadius(pos, radius, [&](int index, float) { result.emplace_back(index); });
+    return result;
+}
+
+bool SpatialGrid::isOccupied(RealVector2D const& pos, float distance) const
+{
+    auto correctedPos = _spaceCalculator ? _spaceCalculator->getCorrectedPosition(pos) : pos;
+    auto result = false;
+    forEachCandidate(correctedPos, distance, [&](int index) {
+        if (calcDistance(correctedPos, _positions[index]) < distance) {
+            result = true;
+            return false;
+        }
+        return true;
+    });
+    return result;
+}
+
+void SpatialGrid::rebuild()
+{
+    //determine grid layout
+    auto cellSize = _cellSize;
+    if (_spaceCalculator) {
+        _origin = {0, 0};
+        auto calcNumBuckets = [&] {
+            return IntVector2D{std::max(1, toInt(toFloat(_worldSize.x) / cellSize)), std::max(1, toInt(toFloat(_worldSize.y) / cellSize))};
+        };
+        for (_numBuckets = calcNumBuckets(); toDouble(_numBuckets.x) * _numBuckets.y > MaxBuckets; _numBuckets = calcNumBuckets()) {
+            cellSize *= 2;
+        }
+        _bucketSize = {toFloat(_worldSize.x) / toFloat(_numBuckets.x), toFloat(_worldSize.y) / toFloat(_numBuckets.y)};
+    } else {
+        RealVector2D upperBound;
+        if (!_positions.empty()) {
+            _origin = _positions.front();
+            upperBound = _positions.front();
+            for (auto const& pos : _positions) {
+                _origin = {std::min(_origin.x, pos.x), std::min(_origin.y, pos.y)};
+                upperBound = {std::max(upperBound.x, pos.x), std::max(upperBound.y, pos.y)};
+            }
+        }
+        auto calcNumBuckets = [&] {
+            return IntVector2D{toInt((upperBound.x - _origin.x) / cellSize) + 1, toInt((upperBound.y - _origin.y) / cellSize) + 1};
+        };
+        for (_numBuckets = calcNumBuckets(); toDouble(_numBuckets.x) * _numBuckets.y > MaxBuckets; _numBuckets = calcNumBuckets()) {
+            cellSize *= 2;
+        }
+        _bucketSize = {cellSize, cellSize};
+    }
+    auto numBuckets = _numBuckets.x * _numBuckets.y;
+
+    //counting sort of the entries into the buckets
+    std::vector<int> bucketIndices(_positions.size());
+    _bucketStarts.assign(numBuckets + 1, 0);
+    for (int i = 0; i < toInt(_positions.size()); ++i) {
+        bucketIndices[i] = getBucketIndex(getBucket(_positions[i]));
+        ++_bucketStarts[bucketIndices[i] + 1];
+    }
+    for (int i = 0; i < numBuckets; ++i) {
+        _bucketStarts[i + 1] += _bucketStarts[i];
+    }
+    _sortedIndices.resize(_positions.size());
+    std::vector<int> insertPositions(_bucketStarts.begin(), _bucketStarts.end() - 1);
+    for (int i = 0; i < toInt(_positions.size()); ++i) {
+        _sortedIndices[insertPositions[bucketIndices[i]]++] = i;
+    }
+
+    _numBuiltEntries = toInt(_positions.size());
+    _chainHeads.assign(numBuckets, -1);
+    _chainNext.clear();
+}
+
+IntVector2D SpatialGrid::getBucket(RealVector2D const& pos) const
+{
+    auto x = toInt(std::floor((pos.x - _origin.x) / _bucketSize.x));
+    auto y = toInt(std::floor((pos.y - _origin.y) / _bucketSize.y));
+    return {std::max(0, std::min(_numBuckets.x - 1, x)), std::max(0, std::min(_numBuckets.y - 1, y))};
+}
+
+int SpatialGrid::getBucketIndex(IntVector2D const& bucket) const
+{
+    auto x = ((bucket.x % _numBuckets.x) + _numBuckets.x) % _numBuckets.x;
+    auto y = ((bucket.y % _numBuckets.y) + _numBuckets.y) % _numBuckets.y;
+    return y * _numBuckets.x + x;
+}
+
+float SpatialGrid::calcDistance(RealVector2D const& a, RealVector2D const& b) const
+{
+    auto displacement = b - a;
+    if (_spaceCalculator) {
+
+        //both positions are already corrected, hence a single wrap per coordinate is sufficient
+        auto worldSizeX = toFloat(_worldSize.x);
+        auto worldSizeY = toFloat(_worldSize.y);
+        if (displacement.x > worldSizeX / 2) {
+            displacement.x -= worldSizeX;
+        } else if (displacement.x < -worldSizeX / 2) {
+            displacement.x += worldSizeX;
+        }
+        if (displacement.y > worldSizeY / 2) {
+            displacement.y -= worldSizeY;
+        } else if (displacement.y < -worldSizeY / 2) {
+            displacement.y += worldSizeY;
+        }
+    }
+    return Math::length(displacement);
+}
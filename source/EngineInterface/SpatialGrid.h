@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cmath>
+#include <optional>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Vector2D.h"
+
+#include "SpaceCalculator.h"
+
+//flat uniform grid for radius queries on point sets
+//entries are stored in compressed buckets (CSR) after build(), single insertions are chained per bucket until the next rebuild
+//with a world size the space is treated as toroidal, otherwise the grid covers the bounding box of the entries
+class SpatialGrid
+{
+public:
+    explicit SpatialGrid(float cellSize = 1.0f);
+    SpatialGrid(IntVector2D const& worldSize, float cellSize = 1.0f);
+
+    void setWorldSize(IntVector2D const& worldSize);
+    std::optional<IntVector2D> getWorldSize() const;
+
+    void build(std::vector<RealVector2D> const& positions);
+    int insert(RealVector2D const& pos);  //returns the index of the new entry
+    void clear();
+
+    int getNumEntries() const;
+    RealVector2D const& getPos(int index) const;
+
+    //func(int index, float distance) is called for all entries with distance <= radius
+    template <typename Func>
+    void forEachWithinRadius(RealVector2D const& pos, float radius, Func const& func) const;
+
+    std::vector<int> getIndicesWithinRadius(RealVector2D const& pos, float radius) const;
+    bool isOccupied(RealVector2D const& pos, float distance) const;  //checks for entries with distance < given distance
+
+private:
+    void rebuild();
+    IntVector2D getBucket(RealVector2D const& pos) const;
+    int getBucketIndex(IntVector2D const& bucket) const;
+    float calcDistance(RealVector2D const& a, RealVector2D const& b) const;
+
+    template <typename Func>
+    void forEachCandidate(RealVector2D const& pos, float radius, Func const& func) const;  //func(int index) returns false to stop
+
+    float _cellSize = 1.0f;
+    std::optional<SpaceCalculator> _spaceCalculator;
+    IntVector2D _worldSize;
+
+    RealVector2D _origin;
+    RealVector2D _bucketSize;
+    IntVector2D _numBuckets;
+
+    std::vector<RealVector2D> _positions;
+
+    //entries from last rebuild
+    int _numBuiltEntries = 0;
+    std::vector<int> _bucketStarts;
+    std::vector<int> _sortedIndices;
+
+    //entries inserted since last rebuild
+    std::vector<int> _chainHeads;
+    std::vector<int> _chainNext;
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void SpatialGrid::forEachWithinRadius(RealVector2D const& pos, float radius, Func const& func) const
+{
+    auto correctedPos = _spaceCalculator ? _spaceCalculator->getCorrectedPosition(pos) : pos;
+    forEachCandidate(correctedPos, radius, [&](int index) {
+        auto distance = calcDistance(correctedPos, _positions[index]);
+        if (distance <= radius) {
+            func(index, distance);
+        }
+        return true;
+    });
+}
+
+template <typename Func>
+void SpatialGrid::forEachCandidate(RealVector2D const& pos, float radius, Func const& func) const
+{
+    if (_positions.empty() || _bucketStarts.empty()) {
+        return;
+    }
+    auto calcRange = [&](float coord, float origin, float bucketSize, int numBuckets) {
+        auto lower = toInt(std::floor((coord - radius - origin) / bucketSize));
+        auto upper = toInt(std::floor((coord + radius - origin) / bucketSize));
+        if (_spaceCalculator) {
+            if (upper - lower + 1 >= numBuckets) {
+                return std::make_pair(0, numBuckets - 1);
+            }
+            return std::make_pair(lower, upper);
+        }
+        return std::make_pair(std::max(0, std::min(numBuckets - 1, lower)), std::max(0, std::min(numBuckets - 1, upper)));
+    };
+    auto [lowerX, upperX] = calcRange(pos.x, _origin.x, _bucketSize.x, _numBuckets.x);
+    auto [lowerY, upperY] = calcRange(pos.y, _origin.y, _bucketSize.y, _numBuckets.y);
+
+    for (int y = lowerY; y <= upperY; ++y) {
+        for (int x = lowerX; x <= upperX; ++x) {
+            auto bucketIndex = getBucketIndex({x, y});
+            for (int i = _bucketStarts[bucketIndex]; i < _bucketStarts[bucketIndex + 1]; ++i) {
+                if (!func(_sortedIndices[i])) {
+                    return;
+                }
+            }
+            for (int index = _chainHeads[bucketIndex]; index != -1; index = _chainNext[index - _numBuiltEntries]) {
+                if (!func(index)) {
+                    return;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#include "StatisticsDownsamplingService.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Base/Definitions.h"
+
+std::vector<int> StatisticsDownsamplingService::calcMinMaxIndices(double const* timePoints, double const* values, int count, int numBuckets) const
+{
+    std::vector<int> result;
+    if (count <= 4 * std::max(1, numBuckets)) {
+        result.resize(std::max(0, count));
+        std::iota(result.begin(), result.end(), 0);
+        return result;
+    }
+
+    auto startTime = timePoints[0];
+    auto timeRange = timePoints[count - 1] - startTime;
+    auto getBucket = [&](int index) {
+        return timeRange > 0 ? std::min(numBuckets - 1, toInt(toDouble(numBuckets) * (timePoints[index] - startTime) / timeRange)) : 0;
+    };
+
+    result.reserve(4 * numBuckets);
+    for (int bucketStart = 0; bucketStart < count;) {
+        auto bucket = getBucket(bucketStart);
+        auto minIndex = bucketStart;
+        auto maxIndex = bucketStart;
+        auto bucketEnd = bucketStart + 1;
+        for (; bucketEnd < count && getBucket(bucketEnd) == bucket; ++bucketEnd) {
+            if (values[bucketEnd] < values[minIndex]) {
+                minIndex = bucketEnd;
+            }
+            if (values[bucketEnd] > values[maxIndex]) {
+                maxIndex = bucketEnd;
+            }
+        }
+        int indices[] = {bucketStart, std::min(minIndex, maxIndex), std::max(minIndex, maxIndex), bucketEnd - 1};
+        for (auto index : indices) {
+            if (result.empty() || result.back() != index) {
+                result.emplace_back(index);
+            }
+        }
+        bucketStart = bucketEnd;
+    }
+    return result;
+}
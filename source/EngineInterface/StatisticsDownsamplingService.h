@@ -0,0 +1,17 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/Singleton.h"
+
+//reduces time series to the data points which are visible in a plot of a given pixel width
+class StatisticsDownsamplingService
+{
+    MAKE_SINGLETON(StatisticsDownsamplingService);
+
+public:
+    //divides the time range into numBuckets intervals of equal length and keeps the first, last, minimal and maximal point of each interval
+    //=> a line plot with one interval per pixel column looks the same as for all data points, in particular peaks are preserved
+    //timePoints must be sorted, returns sorted indices (all indices if there are not more than 4 * numBuckets data points)
+    std::vector<int> calcMinMaxIndices(double const* timePoints, double const* values, int count, int numBuckets) const;
+};
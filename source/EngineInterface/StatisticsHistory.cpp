@@ -1,5 +1,11 @@
 #include "StatisticsHistory.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Definitions.h"
+
+#include "StatisticsConverterService.h"
 
 StatisticsHistoryData StatisticsHistory::getCopiedData() const
 {
@@ -22,3 +28,102 @@ StatisticsHistoryData const& StatisticsHistory::getDataRef() const
 {
     return _data;
 }
+
+void StatisticsHistory::addDataPoint(TimelineStatistics const& newRawStatistics, uint64_t timestep)
+{
+    std::lock_guard lock(_mutex);
+
+    if (!_data.empty() && _data.back().time > toDouble(timestep) + NEAR_ZERO) {
+        _data.clear();
+    }
+
+    if (!_lastRawStatistics || _data.empty() || toDouble(timestep) - _data.back().time > _longtermTimestepDelta / 100 * (_numDataPoints + 1)) {
+        auto newDataPoint = [&] {
+            if (!_lastRawStatistics && !_data.empty()) {
+
+                //reuse last entry if no raw statistics is available
+                auto result = _data.back();
+                result.time = toDouble(timestep);
+                return result;
+            } else {
+                return StatisticsConverterService::get().convert(newRawStatistics, timestep, toDouble(timestep), _lastRawStatistics, _lastTimestep);
+            }
+        }();
+
+        _lastRawStatistics = newRawStatistics;
+        _lastTimestep = timestep;
+        _accumulatedDataPoint = _accumulatedDataPoint.has_value() ? *_accumulatedDataPoint + newDataPoint : newDataPoint;
+        ++_numDataPoints;
+    }
+
+    if (_accumulatedDataPoint.has_value() && (_data.empty() || toDouble(timestep) - _data.back().time > _longtermTimestepDelta)) {
+        auto newDataPoint = *_accumulatedDataPoint / _numDataPoints;
+        _numDataPoints = 0;
+        _accumulatedDataPoint.reset();
+
+        //remove last entry if timestep has not changed
+        if (!_data.empty() && std::abs(_data.back().time - toDouble(timestep)) < NEAR_ZERO) {
+            _data.pop_back();
+        }
+        _data.emplace_back(newDataPoint);
+
+        //compress history after MaxSamples
+        if (_data.size() > MaxSamples) {
+            std::vector<DataPointCollection> newData;
+            newData.reserve(_data.size() / 2);
+            for (size_t i = 0; i < (_data.size() - 1) / 2; ++i) {
+                DataPointCollection interpolatedDataPoint = (_data.at(i * 2) + _data.at(i * 2 + 1)) / 2.0;
+                interpolatedDataPoint.time = _data.at(i * 2).time;
+                newData.emplace_back(interpolatedDataPoint);
+            }
+            newData.emplace_back(_data.back());
+            _data.swap(newData);
+
+            _longtermTimestepDelta *= 2.0;
+        }
+    }
+}
+
+void StatisticsHistory::resetTime(uint64_t timestep)
+{
+    std::lock_guard lock(_mutex);
+    if (_data.empty()) {
+        return;
+    }
+
+    auto prevTimestep = _data.back().time;
+    if (prevTimestep > 0) {
+        _longtermTimestepDelta *= toDouble(timestep) / prevTimestep;
+        if (_longtermTimestepDelta < DefaultTimeStepDelta) {
+            _longtermTimestepDelta = DefaultTimeStepDelta;
+        }
+    } else {
+        _longtermTimestepDelta = DefaultTimeStepDelta;
+    }
+
+    std::vector<DataPointCollection> newData;
+    newData.reserve(_data.size());
+    for (size_t i = 0; i < _data.size(); ++i) {
+        if (_data.at(i).time < toDouble(timestep)) {
+            newData.emplace_back(_data.at(i));
+        }
+    }
+    _data.swap(newData);
+    _accumulatedDataPoint.reset();
+    _numDataPoints = 0;
+}
+
+void StatisticsHistory::rewrite(StatisticsHistoryData const& newData, uint64_t timestep)
+{
+    std::lock_guard lock(_mutex);
+    _accumulatedDataPoint.reset();
+    _numDataPoints = 0;
+    _lastRawStatistics.reset();
+    _lastTimestep.reset();
+    if (!newData.empty()) {
+        _longtermTimestepDelta = std::max(DefaultTimeStepDelta, (toDouble(timestep) - newData.front().time) / toDouble(newData.size()));
+    } else {
+        _longtermTimestepDelta = DefaultTimeStepDelta;
+    }
+    _data = newData;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <optional>
 #include <vector>
 
 #include "DataPointCollection.h"
@@ -8,16 +9,33 @@
 
 using StatisticsHistoryData = std::vector<DataPointCollection>;
 
+//long-term time series of the statistics, the resolution is halved each time the number of data points exceeds MaxSamples
 class StatisticsHistory
 {
 public:
+    static auto constexpr MaxSamples = 1000;
+
     StatisticsHistoryData getCopiedData() const;
 
     std::mutex& getMutex() const;
     StatisticsHistoryData& getDataRef();
     StatisticsHistoryData const& getDataRef() const;
 
+    void addDataPoint(TimelineStatistics const& newRawStatistics, uint64_t timestep);
+    void resetTime(uint64_t timestep);  //removes the data points from timestep on
+    void rewrite(StatisticsHistoryData const& newData, uint64_t timestep);
+
 private:
+    static auto constexpr DefaultTimeStepDelta = 10.0;
+
     mutable std::mutex _mutex;
     StatisticsHistoryData _data;
+
+    double _longtermTimestepDelta = DefaultTimeStepDelta;
+
+    int _numDataPoints = 0;
+    std::optional<DataPointCollection> _accumulatedDataPoint;
+
+    std::optional<TimelineStatistics> _lastRawStatistics;
+    std::optional<uint64_t> _lastTimestep;
 };
@@ -0,0 +1,75 @@
+#include "TimingSink.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "Base/Definitions.h"
+
+void _AccumulatingTimingSink::addTiming(std::string const& phase, double durationMs)
+{
+    std::lock_guard lock(_mutex);
+    auto findResult = _indexByPhase.find(phase);
+    if (findResult == _indexByPhase.end()) {
+        findResult = _indexByPhase.emplace(phase, _statistics.size()).first;
+        _statistics.emplace_back(PhaseStatistics{.phase = phase, .minMs = durationMs, .maxMs = durationMs});
+    }
+    auto& statistics = _statistics.at(findResult->second);
+    ++statistics.count;
+    statistics.totalMs += durationMs;
+    statistics.minMs = std::min(statistics.minMs, durationMs);
+    statistics.maxMs = std::max(statistics.maxMs, durationMs);
+}
+
+auto _AccumulatingTimingSink::getStatistics() const -> std::vector<PhaseStatistics>
+{
+    std::lock_guard lock(_mutex);
+    return _statistics;
+}
+
+void _AccumulatingTimingSink::reset()
+{
+    std::lock_guard lock(_mutex);
+    _statistics.clear();
+    _indexByPhase.clear();
+}
+
+std::string _AccumulatingTimingSink::exportToJson() const
+{
+    std::ostringstream stream;
+    stream << std::setprecision(6) << std::fixed;
+    stream << "{" << std::endl << "  \"phases\": [";
+    auto statistics = getStatistics();
+    for (size_t i = 0; i < statistics.size(); ++i) {
+        auto const& entry = statistics.at(i);
+        stream << (i == 0 ? "" : ",") << std::endl;
+        stream << "    {\"phase\": \"" << entry.phase << "\", \"count\": " << entry.count << ", \"total ms\": " << entry.totalMs
+               << ", \"average ms\": " << entry.totalMs / toDouble(entry.count) << ", \"min ms\": " << entry.minMs << ", \"max ms\": " << entry.maxMs
+               << "}";
+    }
+    stream << std::endl << "  ]" << std::endl << "}" << std::endl;
+    return stream.str();
+}
+
+std::string _AccumulatingTimingSink::exportToCsv() const
+{
+    std::ostringstream stream;
+    stream << std::setprecision(6) << std::fixed;
+    stream << "phase,count,total ms,average ms,min ms,max ms" << std::endl;
+    for (auto const& entry : getStatistics()) {
+        stream << "\"" << entry.phase << "\"," << entry.count << "," << entry.totalMs << "," << entry.totalMs / toDouble(entry.count) << "," << entry.minMs
+               << "," << entry.maxMs << std::endl;
+    }
+    return stream.str();
+}
+
+bool _AccumulatingTimingSink::exportToFile(std::filesystem::path const& filename) const
+{
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    stream << (filename.extension() == ".csv" ? exportToCsv() : exportToJson());
+    return static_cast<bool>(stream);
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Definitions.h"
+
+//receives the durations of named phases, e.g. the stages of a time step
+//no sink is installed by default, in which case no measurements are taken at all
+class _TimingSink
+{
+public:
+    virtual ~_TimingSink() = default;
+
+    virtual void addTiming(std::string const& phase, double durationMs) = 0;
+};
+
+//accumulates the timings per phase (in order of their first occurrence) and exports them as JSON or CSV
+class _AccumulatingTimingSink : public _TimingSink
+{
+public:
+    struct PhaseStatistics
+    {
+        std::string phase;
+        uint64_t count = 0;
+        double totalMs = 0;
+        double minMs = 0;
+        double maxMs = 0;
+    };
+
+    void addTiming(std::string const& phase, double durationMs) override;
+
+    std::vector<PhaseStatistics> getStatistics() const;
+    void reset();
+
+    std::string exportToJson() const;
+    std::string exportToCsv() const;
+    bool exportToFile(std::filesystem::path const& filename) const;  //format is determined by the extension (.json or .csv)
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<PhaseStatistics> _statistics;
+    std::unordered_map<std::string, size_t> _indexByPhase;
+};
+
+//measures the wall-clock time of a scope on the host and reports it to the sink if one is installed
+class ScopedTiming
+{
+public:
+    ScopedTiming(TimingSink const& sink, char const* phase);
+    ~ScopedTiming();
+
+    ScopedTiming(ScopedTiming const&) = delete;
+    ScopedTiming& operator=(ScopedTiming const&) = delete;
+
+private:
+    _TimingSink* _sink;
+    char const* _phase;
+    std::chrono::steady_clock::time_point _startTimepoint;
+};
+
+/**
+ * Implementations
+ */
+
+inline ScopedTiming::ScopedTiming(TimingSink const& sink, char const* phase)
+    : _sink(sink.get())
+    , _phase(phase)
+{
+    if (_sink) {
+        _startTimepoint = std::chrono::steady_clock::now();
+    }
+}
+
+inline ScopedTiming::~ScopedTiming()
+{
+    if (_sink) {
+        auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _startTimepoint);
+        _sink->addTiming(_phase, duration.count());
+    }
+}
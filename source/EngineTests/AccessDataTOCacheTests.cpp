@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/InspectedEntityIds.h"
+#include "EngineImpl/AccessDataTOCache.h"
+
+class AccessDataTOCacheTests : public ::testing::Test
+{
+public:
+    AccessDataTOCacheTests() = default;
+    ~AccessDataTOCacheTests() = default;
+
+protected:
+    //simulates a transfer from the device which leaves fill counts below the requested sizes
+    void fill(DataTO const& dataTO, ArraySizes const& numEntries)
+    {
+        *dataTO.numCells = numEntries.cellArraySize;
+        *dataTO.numParticles = numEntries.particleArraySize;
+        *dataTO.numAuxiliaryData = numEntries.auxiliaryDataSize;
+    }
+};
+
+TEST_F(AccessDataTOCacheTests, repeatedInspection_noReallocation)
+{
+    _AccessDataTOCache cache(true);
+    ArraySizes request{Const::MaxInspectedObjects, Const::MaxInspectedObjects, 1000};
+
+    auto dataTO = cache.getDataTO(request);
+    for (int i = 0; i < 10; ++i) {
+        fill(dataTO, {2, 0, 300});
+        auto nextDataTO = cache.getDataTO(request);
+        EXPECT_EQ(dataTO, nextDataTO);
+        EXPECT_EQ(0, *nextDataTO.numCells);
+        EXPECT_EQ(0, *nextDataTO.numParticles);
+        EXPECT_EQ(0, *nextDataTO.numAuxiliaryData);
+    }
+    EXPECT_EQ(1, cache.getNumAllocations());
+}
+
+TEST_F(AccessDataTOCacheTests, smallerRequest_noReallocation)
+{
+    _AccessDataTOCache cache;
+    cache.getDataTO({100, 100, 1000});
+    cache.getDataTO({10, 100, 0});
+    cache.getDataTO({100, 1, 999});
+    EXPECT_EQ(1, cache.getNumAllocations());
+}
+
+TEST_F(AccessDataTOCacheTests, largerRequest_growsOnce)
+{
+    _AccessDataTOCache cache(true);
+    cache.getDataTO({100, 100, 1000});
+    cache.getDataTO({100, 100, 2000});
+    EXPECT_EQ(2, cache.getNumAllocations());
+
+    //capacities of the other arrays are retained after growing
+    cache.getDataTO({100, 100, 1000});
+    cache.getDataTO({100, 100, 2000});
+    EXPECT_EQ(2, cache.getNumAllocations());
+}
+
+TEST_F(AccessDataTOCacheTests, largerRequest_exactSizes)
+{
+    _AccessDataTOCache cache;
+    cache.getDataTO({100, 100, 1000});
+    cache.getDataTO({50, 100, 2000});
+    EXPECT_EQ(2, cache.getNumAllocations());
+
+    //the cell array was shrunk on reallocation
+    cache.getDataTO({100, 100, 2000});
+    EXPECT_EQ(3, cache.getNumAllocations());
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationFacade.h"
+#include "EngineInterface/StatisticsHistory.h"
+#include "EngineInterface/TimingSink.h"
+#include "EngineCpu/CpuSimulationFacade.h"
+
+namespace
+{
+    IntVector2D const UniverseSize{200, 200};
+}
+
+//tests of the host backend which do not need a GPU, see CpuSimulationParityTests for the comparison with the CUDA engine
+class CpuSimulationFacadeTests : public ::testing::Test
+{
+public:
+    CpuSimulationFacadeTests()
+    {
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            _parameters.baseValues.radiationCellAgeStrength[i] = 0;
+            _parameters.baseValues.radiationAbsorption[i] = 0;
+            _parameters.baseValues.cellDeathProbability[i] = 0;
+        }
+        _parameters.cellMaxForceDecayProb = 0;
+    }
+
+    ~CpuSimulationFacadeTests() = default;
+
+protected:
+    SimulationFacade createCpuSimulationFacade(int maxThreads = 0) const
+    {
+        auto result = std::make_shared<_CpuSimulationFacade>(maxThreads);
+        result->newSimulation(0, GeneralSettings{UniverseSize.x, UniverseSize.y}, _parameters);
+        return result;
+    }
+
+    std::vector<DataDescription> recordTrajectory(SimulationFacade const& simulationFacade, DataDescription const& origData, int timesteps) const
+    {
+        std::vector<DataDescription> result;
+        simulationFacade->setSimulationData(origData);
+        for (int i = 0; i < timesteps; ++i) {
+            simulationFacade->calcTimesteps(1);
+            auto data = simulationFacade->getSimulationData();
+            std::ranges::sort(data.cells, {}, &CellDescription::id);
+            std::ranges::sort(data.particles, {}, &ParticleDescription::id);
+            result.emplace_back(data);
+        }
+        return result;
+    }
+
+    double getEnergy(DataDescription const& data) const
+    {
+        double result = 0;
+        for (auto const& cell : data.cells) {
+            result += cell.energy;
+        }
+        for (auto const& particle : data.particles) {
+            result += particle.energy;
+        }
+        return result;
+    }
+
+    SimulationParameters _parameters;
+};
+
+TEST_F(CpuSimulationFacadeTests, dyingCells)
+{
+    auto data = DescriptionEditService::get().createRect(
+        DescriptionEditService::CreateRectParameters().width(4).height(4).center({100.0f, 100.0f}).energy(_parameters.baseValues.cellMinEnergy[0] / 2));
+    _parameters.cellDeathConsequences = CellDeathConsquences_None;
+    _parameters.baseValues.cellDeathProbability[0] = 1.0f;
+
+    auto cpuFacade = createCpuSimulationFacade();
+    cpuFacade->setSimulationData(data);
+    cpuFacade->calcTimesteps(10);
+
+    auto cpuData = cpuFacade->getSimulationData();
+    EXPECT_EQ(0, cpuData.cells.size());
+    EXPECT_EQ(data.cells.size(), cpuData.particles.size());
+    EXPECT_NEAR(getEnergy(data), getEnergy(cpuData), getEnergy(data) * 0.001);
+}
+
+TEST_F(CpuSimulationFacadeTests, independentOfNumberOfThreads)
+{
+    auto data = DescriptionEditService::get().createRect(
+        DescriptionEditService::CreateRectParameters().width(10).height(10).center({100.0f, 100.0f}).removeStickiness(true));
+    auto otherData = DescriptionEditService::get().createHex(DescriptionEditService::CreateHexParameters().layers(4).center({120.0f, 100.0f}));
+    for (auto& cell : otherData.cells) {
+        cell.vel = {-0.3f, 0.05f};
+    }
+    data.add(otherData);
+
+    auto singleThreadTrajectory = recordTrajectory(createCpuSimulationFacade(1), data, 50);
+    auto multiThreadTrajectory = recordTrajectory(createCpuSimulationFacade(4), data, 50);
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_TRUE(singleThreadTrajectory.at(i) == multiThreadTrajectory.at(i)) << "timestep " << i;
+    }
+}
+
+TEST_F(CpuSimulationFacadeTests, unsupportedOperations)
+{
+    auto cpuFacade = createCpuSimulationFacade();
+    EXPECT_THROW(cpuFacade->applyCataclysm(1), std::runtime_error);
+    EXPECT_THROW(cpuFacade->getSelectionShallowData(), std::runtime_error);
+}
+
+TEST_F(CpuSimulationFacadeTests, newSimulation_twice)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(5).height(5).center({100.0f, 100.0f}));
+
+    auto cpuFacade = createCpuSimulationFacade();
+    cpuFacade->setSimulationData(data);
+    cpuFacade->runSimulation();
+
+    cpuFacade->newSimulation(0, GeneralSettings{UniverseSize.x, UniverseSize.y}, _parameters);
+    EXPECT_FALSE(cpuFacade->isSimulationRunning());
+    EXPECT_TRUE(cpuFacade->getSimulationData().isEmpty());
+
+    cpuFacade->setSimulationData(data);
+    cpuFacade->calcTimesteps(10);
+    EXPECT_EQ(10, cpuFacade->getCurrentTimestep());
+    EXPECT_EQ(25, cpuFacade->getSimulationData().cells.size());
+}
+
+TEST_F(CpuSimulationFacadeTests, timingsPerPhase)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(5).height(5).center({100.0f, 100.0f}));
+
+    auto cpuFacade = createCpuSimulationFacade();
+    auto timingSink = std::make_shared<_AccumulatingTimingSink>();
+    cpuFacade->setTimingSink(timingSink);
+    cpuFacade->setSimulationData(data);
+    cpuFacade->calcTimesteps(10);
+
+    auto statistics = timingSink->getStatistics();
+    auto findPhase = [&](std::string const& phase) { return std::ranges::find(statistics, phase, &_AccumulatingTimingSink::PhaseStatistics::phase); };
+    ASSERT_NE(statistics.end(), findPhase("conversion: description to data"));
+    ASSERT_NE(statistics.end(), findPhase("physics: forces"));
+    EXPECT_EQ(1, findPhase("conversion: description to data")->count);
+    EXPECT_EQ(10, findPhase("physics: forces")->count);
+    EXPECT_LE(findPhase("physics: forces")->minMs, findPhase("physics: forces")->maxMs);
+}
+
+TEST_F(CpuSimulationFacadeTests, statistics)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(5).height(5).center({100.0f, 100.0f}));
+
+    auto cpuFacade = createCpuSimulationFacade();
+    cpuFacade->setSimulationData(data);
+    cpuFacade->calcTimesteps(100);
+
+    auto statistics = cpuFacade->getRawStatistics().timeline.timestep;
+    EXPECT_EQ(25, statistics.numCells[0]);
+    EXPECT_NEAR(getEnergy(data), statistics.totalEnergy[0], getEnergy(data) * 0.001);
+
+    auto history = cpuFacade->getStatisticsHistory().getCopiedData();
+    ASSERT_FALSE(history.empty());
+    EXPECT_GT(history.back().time, 0.0);
+    EXPECT_DOUBLE_EQ(25.0, history.back().numCells.values[0]);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "Base/Math.h"
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationFacade.h"
+#include "EngineCpu/CpuSimulationFacade.h"
+#include "IntegrationTestFramework.h"
+
+namespace
+{
+    IntVector2D const UniverseSize{200, 200};
+}
+
+class CpuSimulationParityTests : public IntegrationTestFramework
+{
+public:
+    CpuSimulationParityTests()
+        : IntegrationTestFramework(std::nullopt, UniverseSize)
+    {
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            _parameters.baseValues.radiationAbsorption[i] = 0;
+            _parameters.baseValues.cellDeathProbability[i] = 0;
+        }
+        _parameters.cellMaxForceDecayProb = 0;
+        _simulationFacade->setSimulationParameters(_parameters);
+    }
+
+    ~CpuSimulationParityTests() = default;
+
+protected:
+    static auto constexpr Precision = 0.01f;
+
+    SimulationFacade createCpuSimulationFacade(int maxThreads = 0) const
+    {
+        auto result = std::make_shared<_CpuSimulationFacade>(maxThreads);
+        result->newSimulation(0, GeneralSettings{UniverseSize.x, UniverseSize.y}, _parameters);
+        return result;
+    }
+
+    std::vector<DataDescription> recordTrajectory(SimulationFacade const& simulationFacade, DataDescription const& origData, int timesteps) const
+    {
+        std::vector<DataDescription> result;
+        simulationFacade->setSimulationData(origData);
+        for (int i = 0; i < timesteps; ++i) {
+            simulationFacade->calcTimesteps(1);
+            result.emplace_back(simulationFacade->getSimulationData());
+        }
+        return result;
+    }
+
+    void expectParity(DataDescription const& expected, DataDescription const& actual, int timestep) const
+    {
+        ASSERT_EQ(expected.cells.size(), actual.cells.size()) << "timestep " << timestep;
+        auto actualCellById = getCellById(actual);
+        for (auto const& expectedCell : expected.cells) {
+            auto findResult = actualCellById.find(expectedCell.id);
+            ASSERT_TRUE(findResult != actualCellById.end()) << "timestep " << timestep;
+            auto const& actualCell = findResult->second;
+            EXPECT_LT(Math::length(expectedCell.pos - actualCell.pos), Precision) << "timestep " << timestep << ", cell " << expectedCell.id;
+            EXPECT_LT(Math::length(expectedCell.vel - actualCell.vel), Precision) << "timestep " << timestep << ", cell " << expectedCell.id;
+            EXPECT_TRUE(approxCompare(expectedCell.energy, actualCell.energy)) << "timestep " << timestep << ", cell " << expectedCell.id;
+            EXPECT_EQ(expectedCell.connections.size(), actualCell.connections.size()) << "timestep " << timestep << ", cell " << expectedCell.id;
+        }
+    }
+
+    void expectParity(DataDescription const& origData, int timesteps) const
+    {
+        auto gpuTrajectory = recordTrajectory(_simulationFacade, origData, timesteps);
+        auto cpuTrajectory = recordTrajectory(createCpuSimulationFacade(), origData, timesteps);
+        for (int i = 0; i < timesteps; ++i) {
+            expectParity(gpuTrajectory.at(i), cpuTrajectory.at(i), i);
+            if (HasFailure()) {
+                return;
+            }
+        }
+    }
+};
+
+TEST_F(CpuSimulationParityTests, singleCell)
+{
+    auto data = DataDescription().addCell(CellDescription().setId(1).setPos({100.0f, 100.0f}).setVel({0.3f, -0.1f}));
+
+    expectParity(data, 100);
+}
+
+TEST_F(CpuSimulationParityTests, rotatingCluster)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(4).height(4).center({100.0f, 100.0f}));
+    for (auto& cell : data.cells) {
+        auto relPos = cell.pos - RealVector2D{100.0f, 100.0f};
+        cell.vel = RealVector2D{-relPos.y, relPos.x} * 0.05f;
+    }
+
+    expectParity(data, 100);
+}
+
+TEST_F(CpuSimulationParityTests, collidingClusters)
+{
+    auto data = DescriptionEditService::get().createRect(
+        DescriptionEditService::CreateRectParameters().width(3).height(3).center({90.0f, 100.0f}).removeStickiness(true));
+    auto otherData = DescriptionEditService::get().createRect(
+        DescriptionEditService::CreateRectParameters().width(3).height(3).center({110.0f, 100.5f}).removeStickiness(true));
+    for (auto& cell : data.cells) {
+        cell.vel = {0.2f, 0};
+    }
+    for (auto& cell : otherData.cells) {
+        cell.vel = {-0.2f, 0};
+    }
+    data.add(otherData);
+
+    expectParity(data, 100);
+}
+
+TEST_F(CpuSimulationParityTests, fusingCells)
+{
+    auto data = DataDescription().addCells(
+        {CellDescription().setId(1).setPos({100.0f, 100.0f}).setVel({0.5f, 0}).setMaxConnections(2),
+         CellDescription().setId(2).setPos({102.0f, 100.0f}).setVel({-0.5f, 0}).setMaxConnections(2)});
+    _parameters.baseValues.cellFusionVelocity = 0.5f;
+    _simulationFacade->setSimulationParameters(_parameters);
+
+    expectParity(data, 20);
+}
+
+TEST_F(CpuSimulationParityTests, frictionZone)
+{
+    auto data = DataDescription().addCells(
+        {CellDescription().setId(1).setPos({70.0f, 100.0f}).setVel({0.4f, 0}), CellDescription().setId(2).setPos({130.0f, 100.0f}).setVel({0.4f, 0.1f})});
+    _parameters.numZones = 1;
+    _parameters.zone[0].posX = 100.0f;
+    _parameters.zone[0].posY = 100.0f;
+    _parameters.zone[0].shapeData.circularSpot.coreRadius = 20.0f;
+    _parameters.zone[0].fadeoutRadius = 20.0f;
+    _parameters.zone[0].values.friction = 0.05f;
+    _parameters.zone[0].activatedValues.friction = true;
+    _simulationFacade->setSimulationParameters(_parameters);
+
+    expectParity(data, 100);
+}
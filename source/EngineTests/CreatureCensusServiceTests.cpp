@@ -0,0 +1,118 @@
+#include "EngineInterface/CreatureCensusService.h"
+
+#include <gtest/gtest.h>
+
+#include "Base/Definitions.h"
+#include "EngineInterface/DescriptionEditService.h"
+
+class CreatureCensusServiceTests : public ::testing::Test
+{
+public:
+    CreatureCensusServiceTests() = default;
+    ~CreatureCensusServiceTests() = default;
+
+protected:
+    DataDescription createCreature(int width, int height, RealVector2D const& center, int creatureId) const
+    {
+        auto result = DescriptionEditService::get().createRect(
+            DescriptionEditService::CreateRectParameters().width(width).height(height).center(center).energy(10.0f).randomCreatureId(false));
+        for (auto& cell : result.cells) {
+            cell.creatureId = creatureId;
+        }
+        return result;
+    }
+
+    void assignIds(DataDescription& data) const
+    {
+        std::unordered_map<uint64_t, uint64_t> newIdByOldId;
+        for (auto& cell : data.cells) {
+            auto newId = newIdByOldId.size() + 1;
+            newIdByOldId.emplace(cell.id, newId);
+            cell.id = newId;
+        }
+        for (auto& cell : data.cells) {
+            for (auto& connection : cell.connections) {
+                connection.cellId = newIdByOldId.at(connection.cellId);
+            }
+        }
+    }
+};
+
+TEST_F(CreatureCensusServiceTests, creaturesByCreatureId)
+{
+    DataDescription data;
+    data.add(createCreature(4, 5, {10.0f, 10.0f}, 7));
+    data.add(createCreature(2, 3, {50.0f, 10.0f}, 9));
+    data.cells.front().setCellFunction(ConstructorDescription().setGenome(std::vector<uint8_t>(30, 0)));
+    data.cells.back().setAge(120).setVel({1.0f, 0});
+
+    auto census = CreatureCensusService::get().calcCensus(data);
+
+    ASSERT_EQ(2, census.getNumCreatures());
+    EXPECT_EQ(7, census.creatureId.at(0));
+    EXPECT_EQ(9, census.creatureId.at(1));
+    EXPECT_EQ(20, census.numCells.at(0));
+    EXPECT_EQ(6, census.numCells.at(1));
+    EXPECT_FLOAT_EQ(200.0f, census.energy.at(0));
+    EXPECT_FLOAT_EQ(3.0f, census.boundingBoxMax.at(0).x - census.boundingBoxMin.at(0).x);
+    EXPECT_FLOAT_EQ(4.0f, census.boundingBoxMax.at(0).y - census.boundingBoxMin.at(0).y);
+    EXPECT_EQ(1, census.numCellsByCellFunction.at(0).at(CellFunction_Constructor));
+    EXPECT_EQ(19, census.numCellsByCellFunction.at(0).at(CellFunction_None));
+    EXPECT_EQ(30, census.genomeSize.at(0));
+    EXPECT_EQ(0, census.genomeSize.at(1));
+    EXPECT_EQ(120, census.maxAge.at(1));
+    EXPECT_FLOAT_EQ(1.0f / 6, census.velocity.at(1).x);
+    EXPECT_EQ(26, toInt(census.cellIds.size()));
+    EXPECT_EQ(20, census.cellIdsOffset.at(1));
+}
+
+TEST_F(CreatureCensusServiceTests, creaturesByConnectivity)
+{
+    DataDescription data;
+    data.add(createCreature(3, 3, {10.0f, 10.0f}, 0));
+    data.add(createCreature(4, 4, {50.0f, 10.0f}, 0));
+    data.add(createCreature(2, 2, {90.0f, 10.0f}, 5));
+    assignIds(data);
+
+    auto census = CreatureCensusService::get().calcCensus(data);
+
+    ASSERT_EQ(3, census.getNumCreatures());
+    EXPECT_EQ(9, census.numCells.at(0));
+    EXPECT_EQ(16, census.numCells.at(1));
+    EXPECT_EQ(4, census.numCells.at(2));
+    EXPECT_EQ(0, census.creatureId.at(0));
+    EXPECT_EQ(5, census.creatureId.at(2));
+}
+
+TEST_F(CreatureCensusServiceTests, independentOfNumberOfThreads)
+{
+    DataDescription data;
+    for (int i = 0; i < 50; ++i) {
+        data.add(createCreature(1 + i % 4, 2 + i % 3, {toFloat(i) * 10.0f, 10.0f}, i % 3 == 0 ? 0 : i + 1));
+    }
+    assignIds(data);
+
+    auto singleThreadCensus = CreatureCensusService::get().calcCensus(data, 1);
+    auto multiThreadCensus = CreatureCensusService::get().calcCensus(data, 8);
+
+    EXPECT_EQ(singleThreadCensus.numCells, multiThreadCensus.numCells);
+    EXPECT_EQ(singleThreadCensus.energy, multiThreadCensus.energy);
+    EXPECT_EQ(singleThreadCensus.cellIds, multiThreadCensus.cellIds);
+    EXPECT_EQ(singleThreadCensus.cellIdsOffset, multiThreadCensus.cellIdsOffset);
+}
+
+TEST_F(CreatureCensusServiceTests, filter)
+{
+    DataDescription data;
+    data.add(createCreature(4, 5, {10.0f, 10.0f}, 1));
+    data.add(createCreature(2, 3, {50.0f, 10.0f}, 2));
+    data.add(createCreature(5, 5, {90.0f, 10.0f}, 3));
+
+    auto census = CreatureCensusService::get().calcCensus(data);
+    auto largeCreatures = CreatureCensusService::get().filter(census, [](auto const& census, int index) { return census.numCells.at(index) >= 20; });
+
+    ASSERT_EQ(2, largeCreatures.getNumCreatures());
+    EXPECT_EQ(1, largeCreatures.creatureId.at(0));
+    EXPECT_EQ(3, largeCreatures.creatureId.at(1));
+    EXPECT_EQ((std::vector<int>{0, 20, 45}), largeCreatures.cellIdsOffset);
+}
@@ -0,0 +1,361 @@
+#include "EngineInterface/DescriptionEditService.h"
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "Base/Definitions.h"
+#include "Base/Math.h"
+#include "Base/NumberGenerator.h"
+#include "EngineInterface/GenomeDescriptionService.h"
+#include "EngineInterface/SpatialGrid.h"
+
+class DescriptionEditServiceTests : public ::testing::Test
+{
+public:
+    DescriptionEditServiceTests() = default;
+    ~DescriptionEditServiceTests() = default;
+
+protected:
+    bool areConnectionsValid(DataDescription const& data) const
+    {
+        auto cellIds = data.getCellIds();
+        for (auto const& cell : data.cells) {
+            for (auto const& connection : cell.connections) {
+                if (!cellIds.contains(connection.cellId)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool areCopiesOverlapping(DataDescription const& data, int cellsPerCopy, IntVector2D const& worldSize, float distance) const
+    {
+        SpatialGrid grid(worldSize, distance);
+        std::vector<RealVector2D> positions;
+        for (auto const& cell : data.cells) {
+            positions.emplace_back(cell.pos);
+        }
+        grid.build(positions);
+        for (int i = 0; i < toInt(positions.size()); ++i) {
+            for (auto const& otherIndex : grid.getIndicesWithinRadius(positions[i], distance - NEAR_ZERO)) {
+                if (otherIndex / cellsPerCopy != i / cellsPerCopy) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    //each cluster consists of a constructor cell and a detonator cell
+    ClusteredDataDescription createClusters(int numClusters) const
+    {
+        auto genome = GenomeDescriptionService::get().convertDescriptionToBytes(GenomeDescription().setCells({CellGenomeDescription(), CellGenomeDescription()}));
+        ClusteredDataDescription result;
+        for (int i = 0; i < numClusters; ++i) {
+            ClusterDescription cluster;
+            cluster.addCell(CellDescription()
+                                .setId(2 * i + 1)
+                                .setCreatureId(i % 10 + 1)
+                                .setCellFunction(ConstructorDescription().setGenome(genome)));
+            cluster.addCell(CellDescription().setId(2 * i + 2).setCreatureId(i % 10 + 1).setCellFunction(DetonatorDescription()));
+            result.addCluster(cluster);
+        }
+        return result;
+    }
+
+    //chains of three cells within a world of size 100 x 100, the last chain crosses the world boundary
+    ClusteredDataDescription createTilingWorld() const
+    {
+        ClusteredDataDescription result;
+        auto addChain = [&](std::vector<RealVector2D> const& positions, int creatureId) {
+            ClusterDescription cluster;
+            auto firstId = static_cast<uint64_t>(result.clusters.size() * 3 + 1);
+            for (int i = 0; i < toInt(positions.size()); ++i) {
+                std::vector<ConnectionDescription> connections;
+                if (i > 0) {
+                    connections.emplace_back(ConnectionDescription().setCellId(firstId + i - 1).setDistance(1.5f));
+                }
+                if (i + 1 < toInt(positions.size())) {
+                    connections.emplace_back(ConnectionDescription().setCellId(firstId + i + 1).setDistance(1.5f));
+                }
+                cluster.addCell(CellDescription().setId(firstId + i).setPos(positions.at(i)).setCreatureId(creatureId).setConnectingCells(connections));
+            }
+            result.addCluster(cluster);
+        };
+        for (int i = 0; i < 20; ++i) {
+            auto x = toFloat((i * 37) % 90 + 5);
+            auto y = toFloat((i * 53) % 90 + 5);
+            addChain({{x, y}, {x + 1.5f, y}, {x + 3.0f, y}}, i % 5 + 1);
+        }
+        addChain({{98.0f, 50.0f}, {99.5f, 50.0f}, {1.0f, 50.0f}}, 6);
+        result.clusters.front().cells.front().setMetadata(CellMetadataDescription().setName("origin"));
+
+        for (int i = 0; i < 10; ++i) {
+            result.addParticle(ParticleDescription().setId(1000 + i).setPos({toFloat(i * 10 + 2), toFloat(i * 7 + 3)}));
+        }
+        return result;
+    }
+
+    void applyMassOperations(ClusteredDataDescription& data, int maxThreads) const
+    {
+        auto& service = DescriptionEditService::get();
+        service.randomizeCellColors(data, {1, 3, 5}, maxThreads);
+        service.randomizeGenomeColors(data, {2, 4}, maxThreads);
+        service.randomizeEnergies(data, 50.0f, 150.0f, maxThreads);
+        service.randomizeAges(data, 10, 1000, maxThreads);
+        service.randomizeCountdowns(data, 5, 20, maxThreads);
+        service.randomizeMutationIds(data, maxThreads);
+        service.generateNewCreatureIds(data, maxThreads);
+    }
+};
+
+TEST_F(DescriptionEditServiceTests, randomMultiply_parallelPlacement)
+{
+    auto input = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(3).height(3).center({10.0f, 10.0f}));
+    IntVector2D worldSize{400, 400};
+
+    auto overlappingCheckSuccessful = false;
+    auto result = DescriptionEditService::get().randomMultiply(
+        input,
+        DescriptionEditService::RandomMultiplyParameters().number(500).overlappingCheck(true).parallelPlacement(true),
+        worldSize,
+        DataDescription(input),
+        overlappingCheckSuccessful);
+
+    EXPECT_TRUE(overlappingCheckSuccessful);
+    ASSERT_EQ(501 * 9, result.cells.size());
+    EXPECT_EQ(result.cells.size(), result.getCellIds().size());
+    EXPECT_TRUE(areConnectionsValid(result));
+    EXPECT_FALSE(areCopiesOverlapping(DataDescription().addCells({result.cells.begin() + 9, result.cells.end()}), 9, worldSize, 2.0f));
+
+    std::unordered_set<int> creatureIds;
+    for (auto const& cell : result.cells) {
+        creatureIds.insert(cell.creatureId);
+    }
+    EXPECT_EQ(501, creatureIds.size());
+}
+
+TEST_F(DescriptionEditServiceTests, randomMultiply_parallelPlacement_withoutOverlappingCheck)
+{
+    auto input = DescriptionEditService::get().createHex(DescriptionEditService::CreateHexParameters().layers(3));
+
+    auto overlappingCheckSuccessful = false;
+    auto result = DescriptionEditService::get().randomMultiply(
+        input, DescriptionEditService::RandomMultiplyParameters().number(100).parallelPlacement(true), {100, 100}, DataDescription(), overlappingCheckSuccessful);
+
+    EXPECT_TRUE(overlappingCheckSuccessful);
+    EXPECT_EQ(101 * input.cells.size(), result.cells.size());
+    EXPECT_EQ(result.cells.size(), result.getCellIds().size());
+    EXPECT_TRUE(areConnectionsValid(result));
+}
+
+TEST_F(DescriptionEditServiceTests, randomMultiply_parallelPlacement_noSpace)
+{
+    auto input = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(10).height(10));
+
+    auto overlappingCheckSuccessful = true;
+    auto result = DescriptionEditService::get().randomMultiply(
+        input,
+        DescriptionEditService::RandomMultiplyParameters().number(20).overlappingCheck(true).parallelPlacement(true),
+        {20, 20},
+        DataDescription(input),
+        overlappingCheckSuccessful);
+
+    EXPECT_FALSE(overlappingCheckSuccessful);
+    EXPECT_EQ(21 * 100, result.cells.size());
+    EXPECT_TRUE(areConnectionsValid(result));
+}
+
+TEST_F(DescriptionEditServiceTests, massOperations_independentOfNumThreads)
+{
+    auto data1 = createClusters(1000);
+    auto data2 = data1;
+
+    NumberGenerator::get().setSeed(42);
+    applyMassOperations(data1, 1);
+    NumberGenerator::get().setSeed(42);
+    applyMassOperations(data2, 8);
+    EXPECT_EQ(data1, data2);
+
+    auto data3 = createClusters(1000);
+    NumberGenerator::get().setSeed(43);
+    applyMassOperations(data3, 8);
+    EXPECT_NE(data1, data3);
+}
+
+TEST_F(DescriptionEditServiceTests, massOperations_values)
+{
+    auto data = createClusters(10000);
+    applyMassOperations(data, 0);
+
+    std::set<int> colors;
+    std::set<int> countdowns;
+    std::unordered_map<int, int> newCreatureIdByOrigCreatureId;
+    auto sumEnergies = 0.0;
+    for (int index = 0; index < toInt(data.clusters.size()); ++index) {
+        auto const& cluster = data.clusters.at(index);
+        auto const& cell1 = cluster.cells.at(0);
+        auto const& cell2 = cluster.cells.at(1);
+        EXPECT_EQ(cell1.color, cell2.color);
+        EXPECT_EQ(cell1.energy, cell2.energy);
+        EXPECT_EQ(cell1.age, cell2.age);
+        EXPECT_EQ(cell1.mutationId, cell2.mutationId);
+        EXPECT_EQ(cell1.mutationId, std::get<ConstructorDescription>(*cell1.cellFunction).offspringMutationId);
+        EXPECT_TRUE(cell1.energy >= 50.0f && cell1.energy < 150.0f);
+        EXPECT_TRUE(cell1.age >= 10 && cell1.age <= 1000);
+        auto countdown = std::get<DetonatorDescription>(*cell2.cellFunction).countdown;
+        EXPECT_TRUE(countdown >= 5 && countdown <= 20);
+        countdowns.insert(countdown);
+        colors.insert(cell1.color);
+        sumEnergies += cell1.energy;
+
+        auto genome = GenomeDescriptionService::get().convertBytesToDescription(std::get<ConstructorDescription>(*cell1.cellFunction).genome);
+        EXPECT_TRUE(genome.cells.at(0).color == 2 || genome.cells.at(0).color == 4);
+        EXPECT_EQ(genome.cells.at(0).color, genome.cells.at(1).color);
+
+        EXPECT_NE(0, cell1.creatureId);
+        auto [iter, inserted] = newCreatureIdByOrigCreatureId.emplace(index % 10 + 1, cell1.creatureId);
+        EXPECT_EQ(iter->second, cell1.creatureId);
+        EXPECT_EQ(cell1.creatureId, cell2.creatureId);
+    }
+    EXPECT_EQ((std::set<int>{1, 3, 5}), colors);
+    EXPECT_EQ(16, countdowns.size());  //both bounds are included
+    EXPECT_NEAR(100.0, sumEnergies / 10000, 2.0);
+    EXPECT_EQ(10, newCreatureIdByOrigCreatureId.size());
+}
+
+TEST_F(DescriptionEditServiceTests, massOperations_swappedBounds)
+{
+    auto data = createClusters(1000);
+    DescriptionEditService::get().randomizeAges(data, 20, 10);
+    DescriptionEditService::get().randomizeCountdowns(data, 7, 7);
+
+    for (auto const& cluster : data.clusters) {
+        EXPECT_TRUE(cluster.cells.at(0).age >= 10 && cluster.cells.at(0).age <= 20);
+        EXPECT_EQ(7, std::get<DetonatorDescription>(*cluster.cells.at(1).cellFunction).countdown);
+    }
+}
+
+TEST_F(DescriptionEditServiceTests, duplicate_tiling)
+{
+    auto data = createTilingWorld();
+    auto origData = data;
+    DescriptionEditService::get().duplicate(data, {100, 100}, {200, 200}, 4);
+
+    ASSERT_EQ(origData.clusters.size() * 4, data.clusters.size());
+    ASSERT_EQ(origData.particles.size() * 4, data.particles.size());
+
+    std::set<uint64_t> ids;
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            ids.insert(cell.id);
+        }
+    }
+    for (auto const& particle : data.particles) {
+        ids.insert(particle.id);
+    }
+    EXPECT_EQ((origData.clusters.size() * 3 + origData.particles.size()) * 4, ids.size());
+
+    auto numCellsWithMetadata = 0;
+    std::set<int> creatureIds;
+    for (auto const& cluster : data.clusters) {
+        std::unordered_map<uint64_t, CellDescription const*> cellById;
+        for (auto const& cell : cluster.cells) {
+            cellById.emplace(cell.id, &cell);
+        }
+        for (auto const& cell : cluster.cells) {
+            EXPECT_TRUE(cell.pos.x >= -3.0f && cell.pos.x < 203.0f && cell.pos.y >= 0 && cell.pos.y < 200.0f);
+            ASSERT_EQ(cell.id == cluster.cells.at(1).id ? 2 : 1, cell.connections.size());
+            for (auto const& connection : cell.connections) {
+                ASSERT_TRUE(cellById.contains(connection.cellId));
+                auto const& connectedCell = *cellById.at(connection.cellId);
+                EXPECT_TRUE(std::abs(Math::length(cell.pos - connectedCell.pos) - 1.5f) < NEAR_ZERO);
+                EXPECT_TRUE(std::ranges::any_of(connectedCell.connections, [&](auto const& otherConnection) { return otherConnection.cellId == cell.id; }));
+            }
+            if (!cell.metadata.name.empty()) {
+                ++numCellsWithMetadata;
+            }
+            creatureIds.insert(cell.creatureId);
+        }
+    }
+    EXPECT_EQ(1, numCellsWithMetadata);
+    EXPECT_EQ(6 * 4, creatureIds.size());
+
+    //the tile at (0, 100) follows the tile at (0, 0)
+    for (int i = 0; i < toInt(origData.particles.size()); ++i) {
+        EXPECT_EQ(origData.particles.at(i).pos, data.particles.at(i).pos);
+        EXPECT_EQ(origData.particles.at(i).pos + RealVector2D(0, 100.0f), data.particles.at(i + origData.particles.size()).pos);
+    }
+}
+
+TEST_F(DescriptionEditServiceTests, duplicate_uniqueCreatureIds)
+{
+    ClusteredDataDescription data;
+    for (int i = 0; i < 2000; ++i) {
+        ConstructorDescription constructor;
+        constructor.offspringCreatureId = i + 1;
+        ClusterDescription cluster;
+        cluster.addCell(CellDescription()
+                            .setId(i + 1)
+                            .setPos({toFloat(i % 50) * 2.0f + 0.5f, toFloat(i / 50) * 2.0f + 0.5f})
+                            .setCreatureId(i + 1)
+                            .setCellFunction(constructor));
+        data.addCluster(cluster);
+    }
+    DescriptionEditService::get().duplicate(data, {100, 100}, {400, 400}, 4);
+
+    ASSERT_EQ(2000 * 16, data.clusters.size());
+    std::set<int> creatureIds;
+    for (auto const& cluster : data.clusters) {
+        auto const& cell = cluster.cells.at(0);
+        EXPECT_NE(0, cell.creatureId);
+        EXPECT_EQ(cell.creatureId, std::get<ConstructorDescription>(*cell.cellFunction).offspringCreatureId);
+        creatureIds.insert(cell.creatureId);
+    }
+    EXPECT_EQ(2000 * 16, creatureIds.size());
+}
+
+TEST_F(DescriptionEditServiceTests, duplicate_partialTile)
+{
+    auto data = createTilingWorld();
+    auto origData = data;
+    DescriptionEditService::get().duplicate(data, {100, 100}, {150, 100});
+
+    auto numExpectedClusters = origData.clusters.size();
+    for (auto const& cluster : origData.clusters) {
+        if (cluster.getClusterPosFromCells().x < 50.0f) {
+            ++numExpectedClusters;
+        }
+    }
+    EXPECT_EQ(numExpectedClusters, data.clusters.size());
+    for (auto const& cluster : data.clusters) {
+        EXPECT_TRUE(cluster.getClusterPosFromCells().x < 150.0f);
+    }
+}
+
+TEST_F(DescriptionEditServiceTests, duplicate_connectionOutsideCluster)
+{
+    ClusteredDataDescription data;
+    ClusterDescription cluster;
+    cluster.addCell(CellDescription().setId(1).setPos({10.0f, 10.0f}).setConnectingCells({
+        ConnectionDescription().setCellId(2).setDistance(1.0f).setAngleFromPrevious(90.0f),
+        ConnectionDescription().setCellId(3).setDistance(1.0f).setAngleFromPrevious(270.0f),
+    }));
+    cluster.addCell(CellDescription().setId(2).setPos({11.0f, 10.0f}).setConnectingCells({
+        ConnectionDescription().setCellId(1).setDistance(1.0f).setAngleFromPrevious(360.0f),
+    }));
+    data.addCluster(cluster);
+    DescriptionEditService::get().duplicate(data, {100, 100}, {200, 100});
+
+    ASSERT_EQ(2, data.clusters.size());
+    for (auto const& cluster : data.clusters) {
+        auto const& cell = cluster.cells.at(0);
+        ASSERT_EQ(1, cell.connections.size());
+        EXPECT_EQ(cluster.cells.at(1).id, cell.connections.at(0).cellId);
+        EXPECT_TRUE(std::abs(cell.connections.at(0).angleFromPrevious - 360.0f) < NEAR_ZERO);
+    }
+}
@@ -0,0 +1,174 @@
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/HostSensorScanner.h"
+
+#include <gtest/gtest.h>
+
+class HostSensorScannerTests : public ::testing::Test
+{
+public:
+    HostSensorScannerTests() = default;
+    ~HostSensorScannerTests() = default;
+
+protected:
+    static inline IntVector2D const WorldSize{400, 200};
+
+    DataDescription createSensorCreature(uint64_t sensorId, RealVector2D const& pos, SensorDescription const& sensor = SensorDescription(), int mutationId = 0)
+    {
+        DataDescription result;
+        result.addCells(
+            {CellDescription()
+                 .setId(sensorId)
+                 .setPos(pos)
+                 .setMaxConnections(2)
+                 .setExecutionOrderNumber(0)
+                 .setInputExecutionOrderNumber(5)
+                 .setMutationId(mutationId)
+                 .setCellFunction(sensor),
+             CellDescription()
+                 .setId(sensorId + 1)
+                 .setPos(pos + RealVector2D{1.0f, 0.0f})
+                 .setMaxConnections(1)
+                 .setExecutionOrderNumber(5)
+                 .setMutationId(mutationId)
+                 .setCellFunction(NerveDescription())});
+        result.addConnection(sensorId, sensorId + 1);
+        return result;
+    }
+
+    DataDescription createRect(RealVector2D const& center, int width, int height, int mutationId) const
+    {
+        auto result = DescriptionEditService::get().createRect(
+            DescriptionEditService::CreateRectParameters().center(center).width(width).height(height).cellDistance(0.5f));
+        for (auto& cell : result.cells) {
+            cell.mutationId = mutationId;
+        }
+        return result;
+    }
+
+    SimulationParameters _parameters;
+};
+
+TEST_F(HostSensorScannerTests, densityMap)
+{
+    HostDensityMap densityMap(WorldSize);
+    densityMap.addCell(0, {10.0f, 10.0f}, 2, 0, 0);
+    densityMap.addCell(0, {11.0f, 12.0f}, 2, 1, 0);
+    densityMap.addCell(0, {12.0f, 14.0f}, 3, 6, 0);
+    densityMap.addCell(0, {13.0f, 15.0f}, 3, 6, 0);
+
+    EXPECT_EQ(4, densityMap.getCellDensity({9.0f, 9.0f}));
+    EXPECT_EQ(0, densityMap.getCellDensity({30.0f, 30.0f}));
+    EXPECT_EQ(2, densityMap.getColorDensity({9.0f, 9.0f}, 2));
+    EXPECT_EQ(2, densityMap.getColorDensity({9.0f, 9.0f}, 3));
+    EXPECT_EQ(1, densityMap.getZeroMutantDensity({9.0f, 9.0f}));
+    EXPECT_EQ(1, densityMap.getEmergentCellDensity({9.0f, 9.0f}));
+    EXPECT_EQ(2, densityMap.getSameMutantDensity({9.0f, 9.0f}, 6));
+    EXPECT_EQ(0, densityMap.getOtherMutantDensity(0, {9.0f, 9.0f}, 6));
+    EXPECT_EQ(2, densityMap.getOtherMutantDensity(0, {9.0f, 9.0f}, 7));
+}
+
+TEST_F(HostSensorScannerTests, densityMap_outsideWorld)
+{
+    HostDensityMap densityMap(WorldSize);
+    densityMap.addCell(0, {10.0f, 500.0f}, 0, 0, 0);
+
+    EXPECT_EQ(0, densityMap.getCellDensity({10.0f, 500.0f}));
+    EXPECT_EQ(0, densityMap.getCellDensity({10.0f, 196.0f}));
+}
+
+TEST_F(HostSensorScannerTests, foundAtFront)
+{
+    auto data = createSensorCreature(1, {100.0f, 100.0f});
+    data.add(createRect({10.0f, 100.0f}, 16, 16, 0));
+
+    HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+    auto result = scanner.scan(1);
+
+    EXPECT_TRUE(result.found);
+    EXPECT_EQ(1.0f, result.channels[0]);
+    EXPECT_TRUE(result.channels[1] > 0.3f);
+    EXPECT_TRUE(result.distance > 80.0f);
+    EXPECT_TRUE(result.distance < 105.0f);
+    EXPECT_TRUE(std::abs(result.relAngle) < 15.0f);
+    EXPECT_TRUE(result.target.x < -80.0f);
+    EXPECT_FALSE(result.detectedCellIds.empty());
+}
+
+TEST_F(HostSensorScannerTests, cellAtTinyNegativePosition)
+{
+    auto data = createSensorCreature(1, {100.0f, 8.0f});
+    data.add(createRect({10.0f, 8.0f}, 16, 16, 0));
+    data.addCell(CellDescription().setId(1000).setPos({-1e-8f, -1e-8f}));
+
+    HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+    auto result = scanner.scan(1);
+
+    EXPECT_TRUE(result.found);
+    EXPECT_TRUE(std::abs(result.relAngle) < 15.0f);
+    EXPECT_FALSE(result.detectedCellIds.empty());
+}
+
+TEST_F(HostSensorScannerTests, notFound)
+{
+    auto data = createSensorCreature(1, {100.0f, 100.0f});
+    data.add(createRect({300.0f, 100.0f}, 16, 16, 0));
+
+    HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+    auto result = scanner.scan(1);
+
+    EXPECT_FALSE(result.found);
+    EXPECT_EQ(0.0f, result.channels[0]);
+    EXPECT_TRUE(result.detectedCellIds.empty());
+}
+
+TEST_F(HostSensorScannerTests, otherMutantsBlockedByWall)
+{
+    auto sensor = SensorDescription().setRestrictToMutants(SensorRestrictToMutants_RestrictToOtherMutants);
+    auto data = createSensorCreature(1, {100.0f, 100.0f}, sensor, 7);
+    data.add(createRect({10.0f, 100.0f}, 16, 16, 5));
+    {
+        HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+        EXPECT_TRUE(scanner.scan(1).found);
+    }
+    data.add(createRect({50.0f, 100.0f}, 16, 80, 0));
+    {
+        HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+        EXPECT_FALSE(scanner.scan(1).found);
+    }
+}
+
+TEST_F(HostSensorScannerTests, unknownCell)
+{
+    auto data = createSensorCreature(1, {100.0f, 100.0f});
+    HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+
+    EXPECT_THROW(scanner.scan(5), std::runtime_error);
+    EXPECT_THROW(scanner.scan(2), std::runtime_error);
+}
+
+TEST_F(HostSensorScannerTests, scanAllSensors_independentOfNumberOfThreads)
+{
+    DataDescription data;
+    for (int i = 0; i < 20; ++i) {
+        data.add(createSensorCreature(1 + i * 2, {10.0f + toFloat(i) * 19.0f, 50.0f + toFloat(i % 5) * 30.0f}));
+    }
+    data.add(createRect({200.0f, 100.0f}, 20, 20, 0));
+
+    HostSensorScanner scanner(data, WorldSize, _parameters, 0);
+    auto expected = scanner.scanAllSensors(1);
+    auto actual = scanner.scanAllSensors(4);
+
+    ASSERT_EQ(20, expected.size());
+    ASSERT_EQ(expected.size(), actual.size());
+    auto numFound = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i].first, actual[i].first);
+        EXPECT_EQ(expected[i].second.found, actual[i].second.found);
+        EXPECT_EQ(expected[i].second.channels, actual[i].second.channels);
+        EXPECT_EQ(expected[i].second.detectedCellIds, actual[i].second.detectedCellIds);
+        if (expected[i].second.found) {
+            ++numFound;
+        }
+    }
+    EXPECT_TRUE(numFound > 0);
+}
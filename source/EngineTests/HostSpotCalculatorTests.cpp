@@ -0,0 +1,137 @@
+#include "EngineInterface/HostSpotCalculator.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+class HostSpotCalculatorTests : public ::testing::Test
+{
+public:
+    HostSpotCalculatorTests()
+    {
+        _parameters.baseValues.friction = 0.1f;
+        _parameters.baseValues.cellMinEnergy[2] = 40.0f;
+    }
+    ~HostSpotCalculatorTests() = default;
+
+protected:
+    static inline IntVector2D const WorldSize{1000, 500};
+
+    void addCircularZone(RealVector2D const& pos, float coreRadius, float fadeoutRadius, float friction)
+    {
+        auto& zone = _parameters.zone[_parameters.numZones++];
+        zone.posX = pos.x;
+        zone.posY = pos.y;
+        zone.shapeType = SpotShapeType_Circular;
+        zone.shapeData.circularSpot.coreRadius = coreRadius;
+        zone.fadeoutRadius = fadeoutRadius;
+        zone.values.friction = friction;
+        zone.activatedValues.friction = true;
+    }
+
+    void addRectangularZone(RealVector2D const& pos, float width, float height, float fadeoutRadius, float friction, float cellMinEnergy)
+    {
+        auto& zone = _parameters.zone[_parameters.numZones++];
+        zone.posX = pos.x;
+        zone.posY = pos.y;
+        zone.shapeType = SpotShapeType_Rectangular;
+        zone.shapeData.rectangularSpot.width = width;
+        zone.shapeData.rectangularSpot.height = height;
+        zone.fadeoutRadius = fadeoutRadius;
+        zone.values.friction = friction;
+        zone.activatedValues.friction = true;
+        zone.values.cellMinEnergy[2] = cellMinEnergy;
+        zone.activatedValues.cellMinEnergy = true;
+    }
+
+    float calcFriction(RealVector2D const& pos) const
+    {
+        return HostSpotCalculator(_parameters, WorldSize)
+            .calcParameter(&SimulationParametersZoneValues::friction, &SimulationParametersZoneActivatedValues::friction, pos);
+    }
+
+    SimulationParameters _parameters;
+};
+
+TEST_F(HostSpotCalculatorTests, noZones)
+{
+    EXPECT_EQ(0.1f, calcFriction({100.0f, 100.0f}));
+}
+
+TEST_F(HostSpotCalculatorTests, circularZone)
+{
+    addCircularZone({500.0f, 250.0f}, 50.0f, 100.0f, 0.5f);
+
+    EXPECT_FLOAT_EQ(0.5f, calcFriction({500.0f, 250.0f}));
+    EXPECT_FLOAT_EQ(0.5f, calcFriction({540.0f, 250.0f}));
+    EXPECT_FLOAT_EQ(0.1f, calcFriction({700.0f, 250.0f}));
+
+    auto fadingFriction = calcFriction({600.0f, 250.0f});
+    EXPECT_LT(0.1f, fadingFriction);
+    EXPECT_GT(0.5f, fadingFriction);
+}
+
+TEST_F(HostSpotCalculatorTests, zoneAcrossWorldBoundary)
+{
+    addCircularZone({10.0f, 10.0f}, 50.0f, 10.0f, 0.5f);
+
+    EXPECT_FLOAT_EQ(0.5f, calcFriction({980.0f, 490.0f}));
+}
+
+TEST_F(HostSpotCalculatorTests, inactiveValue)
+{
+    addRectangularZone({500.0f, 250.0f}, 100.0f, 100.0f, 10.0f, 0.5f, 20.0f);
+    _parameters.zone[0].activatedValues.friction = false;
+
+    HostSpotCalculator calculator(_parameters, WorldSize);
+    EXPECT_FLOAT_EQ(0.1f, calcFriction({500.0f, 250.0f}));
+    EXPECT_FLOAT_EQ(
+        20.0f,
+        calculator.calcParameter(&SimulationParametersZoneValues::cellMinEnergy, &SimulationParametersZoneActivatedValues::cellMinEnergy, {500.0f, 250.0f}, 2));
+    EXPECT_EQ(0, calculator.getFirstMatchingSpotOrBase({500.0f, 250.0f}, &SimulationParametersZoneActivatedValues::cellMinEnergy));
+    EXPECT_EQ(-1, calculator.getFirstMatchingSpotOrBase({500.0f, 250.0f}, &SimulationParametersZoneActivatedValues::friction));
+}
+
+TEST_F(HostSpotCalculatorTests, bulkEvaluationMatchesSingleEvaluation)
+{
+    addCircularZone({200.0f, 100.0f}, 30.0f, 80.0f, 0.5f);
+    addRectangularZone({300.0f, 150.0f}, 100.0f, 60.0f, 40.0f, 0.0f, 20.0f);
+    addCircularZone({950.0f, 480.0f}, 10.0f, 200.0f, 0.3f);
+
+    std::mt19937 randomEngine(0);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<RealVector2D> positions;
+    for (int i = 0; i < 1000; ++i) {
+        positions.emplace_back(RealVector2D{distribution(randomEngine) * WorldSize.x, distribution(randomEngine) * WorldSize.y});
+    }
+
+    HostSpotCalculator calculator(_parameters, WorldSize);
+    auto frictions = calculator.calcParameters(
+        positions, [](SimulationParametersZoneValues const& values) { return values.friction; }, &SimulationParametersZoneActivatedValues::friction, 3);
+    auto minEnergies = calculator.calcParameters(
+        positions,
+        [](SimulationParametersZoneValues const& values) { return values.cellMinEnergy[2]; },
+        &SimulationParametersZoneActivatedValues::cellMinEnergy);
+
+    ASSERT_EQ(positions.size(), frictions.size());
+    for (int i = 0; i < toInt(positions.size()); ++i) {
+        EXPECT_EQ(calcFriction(positions[i]), frictions[i]);
+        EXPECT_EQ(
+            calculator.calcParameter(&SimulationParametersZoneValues::cellMinEnergy, &SimulationParametersZoneActivatedValues::cellMinEnergy, positions[i], 2),
+            minEnergies[i]);
+    }
+}
+
+TEST_F(HostSpotCalculatorTests, parameterMap)
+{
+    addCircularZone({500.0f, 250.0f}, 50.0f, 100.0f, 0.5f);
+
+    auto map = HostSpotCalculator(_parameters, WorldSize)
+                   .calcParameterMap(
+                       {100, 50}, [](SimulationParametersZoneValues const& values) { return values.friction; }, &SimulationParametersZoneActivatedValues::friction);
+
+    ASSERT_EQ(100 * 50, toInt(map.size()));
+    EXPECT_EQ(calcFriction({5.0f, 5.0f}), map.at(0));
+    EXPECT_EQ(calcFriction({505.0f, 255.0f}), map.at(25 * 100 + 50));
+    EXPECT_FLOAT_EQ(0.5f, map.at(25 * 100 + 50));
+}
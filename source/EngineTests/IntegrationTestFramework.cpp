@@ -100,12 +100,12 @@ CellDescription IntegrationTestFramework::getOtherCell(DataDescription const& da
     THROW_NOT_IMPLEMENTED();
 }
 
-bool IntegrationTestFramework::approxCompare(double expected, double actual, float precision) const
+bool IntegrationTestFramework::approxCompare(double expected, double actual, float precision)
 {
     return approxCompare(toFloat(expected), toFloat(actual));
 }
 
-bool IntegrationTestFramework::approxCompare(float expected, float actual, float precision) const
+bool IntegrationTestFramework::approxCompare(float expected, float actual, float precision)
 {
     auto absNorm = std::abs(expected) + std::abs(actual);
     if (absNorm < precision) {
@@ -114,12 +114,12 @@ bool IntegrationTestFramework::approxCompare(float expected, float actual, float
     return std::abs(expected - actual) / absNorm < precision;
 }
 
-bool IntegrationTestFramework::approxCompare(RealVector2D const& expected, RealVector2D const& actual) const
+bool IntegrationTestFramework::approxCompare(RealVector2D const& expected, RealVector2D const& actual)
 {
     return approxCompare(expected.x, expected.x) && approxCompare(expected.y, expected.y);
 }
 
-bool IntegrationTestFramework::approxCompare(std::vector<float> const& expected, std::vector<float> const& actual) const
+bool IntegrationTestFramework::approxCompare(std::vector<float> const& expected, std::vector<float> const& actual)
 {
     if (expected.size() != actual.size()) {
         return false;
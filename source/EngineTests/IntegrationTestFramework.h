@@ -13,6 +13,12 @@ public:
     IntegrationTestFramework(std::optional<SimulationParameters> const& parameters = std::nullopt, IntVector2D const& universeSize = IntVector2D{1000, 1000});
     virtual ~IntegrationTestFramework();
 
+    //static such that tests without a simulation can use them as well
+    static bool approxCompare(double expected, double actual, float precision = 0.001f);
+    static bool approxCompare(float expected, float actual, float precision = 0.001f);
+    static bool approxCompare(RealVector2D const& expected, RealVector2D const& actual);
+    static bool approxCompare(std::vector<float> const& expected, std::vector<float> const& actual);
+
 protected:
     double getEnergy(DataDescription const& data) const;
 
@@ -23,11 +29,6 @@ protected:
     CellDescription getOtherCell(DataDescription const& data, uint64_t id) const;
     CellDescription getOtherCell(DataDescription const& data, std::set<uint64_t> ids) const;
 
-    bool approxCompare(double expected, double actual, float precision = 0.001f) const;
-    bool approxCompare(float expected, float actual, float precision = 0.001f) const;
-    bool approxCompare(RealVector2D const& expected, RealVector2D const& actual) const;
-    bool approxCompare(std::vector<float> const& expected, std::vector<float> const& actual) const;
-
     bool compare(DataDescription left, DataDescription right) const;
     bool compare(CellDescription left, CellDescription right) const;
     bool compare(ParticleDescription left, ParticleDescription right) const;
@@ -0,0 +1,174 @@
+#include <filesystem>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Base/FileLogger.h"
+#include "Base/LockFreeRingBuffer.h"
+#include "Base/LoggingService.h"
+
+class LoggingServiceTests : public ::testing::Test
+{
+public:
+    LoggingServiceTests() = default;
+    ~LoggingServiceTests() = default;
+
+protected:
+    static auto constexpr NumProducers = 8;
+
+    //collects the messages of the form "<producer>:<index>"
+    class TestCallBack : public LoggingCallBack
+    {
+    public:
+        TestCallBack() { LoggingService::get().registerCallBack(this); }
+        ~TestCallBack() override { LoggingService::get().unregisterCallBack(this); }
+
+        void newLogMessage(Priority priority, std::string const& message) override
+        {
+            auto pos = message.rfind(": ");
+            auto separatorPos = message.find(':', pos + 2);
+            if (pos == std::string::npos || separatorPos == std::string::npos) {
+                return;
+            }
+            messages.emplace_back(std::stoi(message.substr(pos + 2, separatorPos - pos - 2)), std::stoi(message.substr(separatorPos + 1)));
+        }
+        void flush() override { ++numFlushes; }
+
+        std::vector<std::pair<int, int>> messages;
+        int numFlushes = 0;
+    };
+
+    template <typename Func>
+    void runConcurrently(Func const& func)
+    {
+        std::vector<std::thread> threads;
+        for (int producer = 0; producer < NumProducers; ++producer) {
+            threads.emplace_back([&, producer] { func(producer); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+};
+
+TEST_F(LoggingServiceTests, ringBuffer_full)
+{
+    LockFreeRingBuffer<int> ringBuffer(5);
+    ASSERT_EQ(8, ringBuffer.getCapacity());
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(ringBuffer.tryPush(std::move(i)));
+    }
+    EXPECT_FALSE(ringBuffer.tryPush(8));
+
+    int value = -1;
+    EXPECT_TRUE(ringBuffer.tryPop(value));
+    EXPECT_EQ(0, value);
+    EXPECT_TRUE(ringBuffer.tryPush(8));
+    for (int i = 1; i <= 8; ++i) {
+        EXPECT_TRUE(ringBuffer.tryPop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(ringBuffer.tryPop(value));
+}
+
+TEST_F(LoggingServiceTests, ringBuffer_noLossAndOrderUnderContention)
+{
+    auto constexpr NumValuesPerProducer = 20000;
+    LockFreeRingBuffer<uint64_t> ringBuffer(1024);
+
+    std::vector<int> lastIndexByProducer(NumProducers, -1);
+    auto numPopped = 0;
+    auto orderViolated = false;
+    std::thread consumer([&] {
+        uint64_t value;
+        while (numPopped < NumProducers * NumValuesPerProducer) {
+            if (ringBuffer.tryPop(value)) {
+                auto producer = static_cast<int>(value >> 32);
+                auto index = static_cast<int>(value & 0xffffffff);
+                orderViolated |= index != lastIndexByProducer[producer] + 1;
+                lastIndexByProducer[producer] = index;
+                ++numPopped;
+            }
+        }
+    });
+    runConcurrently([&](int producer) {
+        for (int index = 0; index < NumValuesPerProducer; ++index) {
+            while (!ringBuffer.tryPush(static_cast<uint64_t>(producer) << 32 | index)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    consumer.join();
+
+    EXPECT_FALSE(orderViolated);
+    for (auto const& lastIndex : lastIndexByProducer) {
+        EXPECT_EQ(NumValuesPerProducer - 1, lastIndex);
+    }
+}
+
+TEST_F(LoggingServiceTests, log_orderAndDroppedMessages)
+{
+    auto constexpr NumMessagesPerProducer = 20000;
+
+    auto numDroppedBefore = LoggingService::get().getNumDroppedMessages();
+    TestCallBack callback;
+    runConcurrently([&](int producer) {
+        for (int index = 0; index < NumMessagesPerProducer; ++index) {
+            log(Priority::Unimportant, std::to_string(producer) + ":" + std::to_string(index));
+        }
+    });
+    LoggingService::get().flush();
+    auto numDropped = LoggingService::get().getNumDroppedMessages() - numDroppedBefore;
+
+    EXPECT_EQ(NumProducers * NumMessagesPerProducer, toInt(callback.messages.size() + numDropped));
+    EXPECT_TRUE(callback.numFlushes > 0);
+
+    std::vector<int> lastIndexByProducer(NumProducers, -1);
+    for (auto const& [producer, index] : callback.messages) {
+        ASSERT_TRUE(producer >= 0 && producer < NumProducers);
+        EXPECT_TRUE(index > lastIndexByProducer[producer]);
+        lastIndexByProducer[producer] = index;
+    }
+}
+
+TEST_F(LoggingServiceTests, log_noLossWithinCapacity)
+{
+    auto numDroppedBefore = LoggingService::get().getNumDroppedMessages();
+    TestCallBack callback;
+    runConcurrently([&](int producer) {
+        for (int index = 0; index < 100; ++index) {
+            log(Priority::Important, std::to_string(producer) + ":" + std::to_string(index));
+        }
+    });
+    LoggingService::get().flush();
+
+    EXPECT_EQ(numDroppedBefore, LoggingService::get().getNumDroppedMessages());
+    EXPECT_EQ(NumProducers * 100, toInt(callback.messages.size()));
+}
+
+TEST_F(LoggingServiceTests, fileLogger_rotation)
+{
+    auto directory = std::filesystem::temp_directory_path() / "alien_logging_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    auto filename = directory / "test.log";
+    {
+        _FileLogger fileLogger(filename, 1000, 2);
+        for (int i = 0; i < 200; ++i) {
+            log(Priority::Important, "message " + std::to_string(i));
+        }
+        LoggingService::get().flush();
+    }
+    EXPECT_TRUE(std::filesystem::file_size(filename) <= 1000);
+    EXPECT_TRUE(std::filesystem::exists(directory / "test.1.log"));
+    EXPECT_TRUE(std::filesystem::exists(directory / "test.2.log"));
+    EXPECT_FALSE(std::filesystem::exists(directory / "test.3.log"));
+
+    std::ifstream stream(filename);
+    std::string lastLine;
+    for (std::string line; std::getline(stream, line);) {
+        lastLine = line;
+    }
+    EXPECT_TRUE(lastLine.ends_with("message 199"));
+    std::filesystem::remove_all(directory);
+}
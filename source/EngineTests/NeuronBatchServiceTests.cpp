@@ -0,0 +1,147 @@
+#include <random>
+#include <gtest/gtest.h>
+
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/NeuronBatchService.h"
+#include "EngineInterface/SimulationFacade.h"
+#include "IntegrationTestFramework.h"
+
+namespace
+{
+    NeuronDescription createRandomNeuron(std::mt19937& gen)
+    {
+        std::uniform_real_distribution<float> weightDistribution(-2.0f, 2.0f);
+        std::uniform_int_distribution<int> activationFunctionDistribution(0, NeuronActivationFunction_Count - 1);
+
+        NeuronDescription result;
+        for (int row = 0; row < MAX_CHANNELS; ++row) {
+            for (int col = 0; col < MAX_CHANNELS; ++col) {
+                result.weights[row][col] = weightDistribution(gen);
+            }
+            result.biases[row] = weightDistribution(gen);
+            result.activationFunctions[row] = activationFunctionDistribution(gen);
+        }
+        return result;
+    }
+
+    std::vector<float> createRandomSignal(std::mt19937& gen)
+    {
+        std::uniform_real_distribution<float> channelDistribution(-1.0f, 1.0f);
+        std::vector<float> result(MAX_CHANNELS);
+        for (auto& channel : result) {
+            channel = channelDistribution(gen);
+        }
+        return result;
+    }
+}
+
+class NeuronBatchServiceTests : public ::testing::Test
+{
+public:
+    NeuronBatchServiceTests() = default;
+    ~NeuronBatchServiceTests() = default;
+};
+
+//compares the host evaluation with the neuron processing of the simulation
+class NeuronBatchServiceGpuTests : public IntegrationTestFramework
+{
+public:
+    NeuronBatchServiceGpuTests()
+        : IntegrationTestFramework()
+    {}
+
+    ~NeuronBatchServiceGpuTests() = default;
+};
+
+TEST_F(NeuronBatchServiceTests, evaluate_bias)
+{
+    NeuronDescription neuron;
+    neuron.biases = {0, 0, 1, 0, 0, 0, 0, -1};
+
+    auto batch = NeuronBatchService::get().createBatch({neuron});
+    auto result = NeuronBatchService::get().evaluate(batch, {std::vector<float>(MAX_CHANNELS, 0)});
+
+    EXPECT_TRUE(IntegrationTestFramework::approxCompare(0.0f, result.at(0, 0, 0)));
+    EXPECT_TRUE(IntegrationTestFramework::approxCompare(2.0f / (1.0f + std::exp(-1.0f)) - 1.0f, result.at(0, 0, 2)));
+    EXPECT_TRUE(IntegrationTestFramework::approxCompare(2.0f / (1.0f + std::exp(1.0f)) - 1.0f, result.at(0, 0, 7)));
+}
+
+TEST_F(NeuronBatchServiceTests, evaluate_manyNeuronsAndSignals)
+{
+    std::mt19937 gen(42);
+    std::vector<NeuronDescription> neurons;
+    for (int i = 0; i < 19; ++i) {
+        neurons.emplace_back(createRandomNeuron(gen));
+    }
+    std::vector<std::vector<float>> signals;
+    for (int i = 0; i < 5; ++i) {
+        signals.emplace_back(createRandomSignal(gen));
+    }
+
+    auto batch = NeuronBatchService::get().createBatch(neurons);
+    auto result = NeuronBatchService::get().evaluate(batch, signals);
+
+    ASSERT_EQ(19, result.numNeurons);
+    ASSERT_EQ(5, result.numSignals);
+    for (int n = 0; n < 19; ++n) {
+        for (int s = 0; s < 5; ++s) {
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                auto sum = neurons[n].biases[row];
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    sum += neurons[n].weights[row][col] * signals[s][col];
+                }
+                auto expected = NeuronBatchService::get().applyActivationFunction(neurons[n].activationFunctions[row], sum);
+                EXPECT_TRUE(IntegrationTestFramework::approxCompare(expected, result.at(n, s, row)));
+            }
+        }
+    }
+}
+
+TEST_F(NeuronBatchServiceGpuTests, parityWithSimulation)
+{
+    std::mt19937 gen(1);
+    std::vector<NeuronDescription> neurons;
+    std::vector<std::vector<float>> signals;
+
+    DataDescription data;
+    for (int i = 0; i < 10; ++i) {
+        neurons.emplace_back(createRandomNeuron(gen));
+        signals.emplace_back(createRandomSignal(gen));
+
+        SignalDescription signal;
+        signal.channels = signals.back();
+        auto x = toFloat(i) * 10.0f + 1.0f;
+        data.addCells({
+            CellDescription()
+                .setId(2 * i + 1)
+                .setPos({x, 1.0f})
+                .setCellFunction(NerveDescription())
+                .setMaxConnections(2)
+                .setExecutionOrderNumber(5)
+                .setSignal(signal),
+            CellDescription()
+                .setId(2 * i + 2)
+                .setPos({x + 1.0f, 1.0f})
+                .setCellFunction(neurons.back())
+                .setMaxConnections(2)
+                .setExecutionOrderNumber(0)
+                .setInputExecutionOrderNumber(5),
+        });
+        data.addConnection(2 * i + 1, 2 * i + 2);
+    }
+
+    _simulationFacade->setSimulationData(data);
+    _simulationFacade->calcTimesteps(1);
+
+    auto actualData = _simulationFacade->getSimulationData();
+    auto actualCellById = getCellById(actualData);
+
+    auto batch = NeuronBatchService::get().createBatch(neurons);
+    auto result = NeuronBatchService::get().evaluate(batch, signals);
+    for (int i = 0; i < 10; ++i) {
+        auto const& actualChannels = actualCellById.at(2 * i + 2).signal.channels;
+        for (int channel = 0; channel < MAX_CHANNELS; ++channel) {
+            EXPECT_NEAR(result.at(i, i, channel), actualChannels[channel], 0.001f);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "Base/NumberGenerator.h"
+#include "Base/Parallel.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationFacade.h"
+
+#include "IntegrationTestFramework.h"
+
+class NumberGeneratorTests : public ::testing::Test
+{
+public:
+    NumberGeneratorTests() = default;
+    ~NumberGeneratorTests() = default;
+};
+
+class NumberGeneratorGpuTests : public IntegrationTestFramework
+{
+public:
+    NumberGeneratorGpuTests()
+        : IntegrationTestFramework(std::nullopt, {100, 100})
+    {}
+
+    ~NumberGeneratorGpuTests() = default;
+
+protected:
+    //a single radiating cell such that the random numbers are the only source of variation between runs
+    DataDescription runWithSeed(uint32_t seed, int timesteps)
+    {
+        _simulationFacade->closeSimulation();
+        auto gpuSettings = _simulationFacade->getGpuSettings();
+        gpuSettings.deterministicRandomNumbers = true;
+        gpuSettings.randomSeed = seed;
+        _simulationFacade->setGpuSettings_async(gpuSettings);
+
+        auto parameters = _parameters;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            parameters.baseValues.radiationCellAgeStrength[i] = 0.05f;
+            parameters.baseValues.radiationAbsorption[i] = 0;
+            parameters.baseValues.cellDeathProbability[i] = 0;
+        }
+        parameters.radiationProb = 0.5f;
+        _simulationFacade->newSimulation(0, GeneralSettings{100, 100}, parameters);
+
+        DataDescription data;
+        data.addCell(CellDescription().setId(1).setPos({50.0f, 50.0f}).setEnergy(1000.0f).setAge(1));
+        _simulationFacade->setSimulationData(data);
+        _simulationFacade->calcTimesteps(timesteps);
+
+        auto result = _simulationFacade->getSimulationData();
+        std::ranges::sort(result.particles, {}, &ParticleDescription::id);
+        return result;
+    }
+};
+
+TEST_F(NumberGeneratorTests, setSeed_reproducible)
+{
+    auto& numberGenerator = NumberGenerator::get();
+    numberGenerator.setSeed(42);
+    std::vector<uint32_t> expected;
+    for (int i = 0; i < 100; ++i) {
+        expected.emplace_back(numberGenerator.getRandomInt());
+    }
+    numberGenerator.setSeed(42);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(expected.at(i), numberGenerator.getRandomInt());
+    }
+
+    numberGenerator.setSeed(43);
+    auto numEqual = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (expected.at(i) == numberGenerator.getRandomInt()) {
+            ++numEqual;
+        }
+    }
+    EXPECT_TRUE(numEqual < 5);
+}
+
+TEST_F(NumberGeneratorTests, randomStream_independentOfOrder)
+{
+    RandomStream stream(7, 3);
+    std::vector<uint32_t> expected;
+    for (int i = 0; i < 10; ++i) {
+        expected.emplace_back(stream.getRandomInt());
+    }
+    EXPECT_EQ(10, stream.getCounter());
+
+    for (int i = 9; i >= 0; --i) {
+        EXPECT_EQ(expected.at(i), RandomStream(7, 3, i).getRandomInt());
+    }
+}
+
+TEST_F(NumberGeneratorTests, randomStream_differentStreams)
+{
+    std::set<uint32_t> values;
+    for (uint64_t seed = 0; seed < 10; ++seed) {
+        for (uint64_t stream = 0; stream < 100; ++stream) {
+            values.insert(RandomStream(seed, stream).getRandomInt());
+        }
+    }
+    EXPECT_EQ(1000, values.size());
+}
+
+TEST_F(NumberGeneratorTests, randomStream_uniform)
+{
+    auto stream = NumberGenerator::get().createStream(1);
+    std::vector<int> histogram(10, 0);
+    for (int i = 0; i < 100000; ++i) {
+        auto value = stream.getRandomFloat();
+        ASSERT_TRUE(value >= 0.0f && value < 1.0f);
+        ++histogram.at(static_cast<int>(value * 10));
+    }
+    for (auto const& count : histogram) {
+        EXPECT_TRUE(count > 9500 && count < 10500);
+    }
+}
+
+TEST_F(NumberGeneratorTests, randomStream_parallel)
+{
+    auto constexpr NumStreams = 1000;
+    std::vector<float> expected(NumStreams);
+    for (int i = 0; i < NumStreams; ++i) {
+        RandomStream stream(5, i);
+        for (int j = 0; j < 10; ++j) {
+            expected[i] += stream.getRandomFloat();
+        }
+    }
+
+    std::vector<float> actual(NumStreams);
+    Parallel::forEachPartition(
+        NumStreams,
+        [&](ParallelPartition const& partition) {
+            for (int i = partition.startIndex; i <= partition.endIndex; ++i) {
+                RandomStream stream(5, i);
+                for (int j = 0; j < 10; ++j) {
+                    actual[i] += stream.getRandomFloat();
+                }
+            }
+        },
+        4);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(NumberGeneratorGpuTests, deterministicRandomNumbers_sameSeed)
+{
+    auto data = runWithSeed(42, 30);
+    auto otherData = runWithSeed(42, 30);
+
+    ASSERT_FALSE(data.particles.empty());
+    EXPECT_TRUE(data == otherData);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDescriptionService.h"
+#include "EngineInterface/OfflineStatisticsService.h"
+#include "EngineInterface/SimulationFacade.h"
+
+#include "IntegrationTestFramework.h"
+
+namespace
+{
+    std::vector<uint8_t> createSelfReplicatingGenome(int numRepetitions, int subGenomeRepetitions)
+    {
+        auto subGenome = GenomeDescriptionService::get().convertDescriptionToBytes(
+            GenomeDescription().setHeader(GenomeHeaderDescription().setNumRepetitions(subGenomeRepetitions)).setCells({CellGenomeDescription()}));
+        return GenomeDescriptionService::get().convertDescriptionToBytes(
+            GenomeDescription()
+                .setHeader(GenomeHeaderDescription().setNumRepetitions(numRepetitions))
+                .setCells({
+                    CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)),
+                    CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setMakeSelfCopy()),
+                }));
+    }
+
+    void expectEqual(TimestepStatistics const& expected, TimestepStatistics const& actual)
+    {
+        for (int color = 0; color < MAX_COLORS; ++color) {
+            EXPECT_EQ(expected.numCells[color], actual.numCells[color]);
+            EXPECT_EQ(expected.numSelfReplicators[color], actual.numSelfReplicators[color]);
+            EXPECT_EQ(expected.numColonies[color], actual.numColonies[color]);
+            EXPECT_EQ(expected.numViruses[color], actual.numViruses[color]);
+            EXPECT_EQ(expected.numFreeCells[color], actual.numFreeCells[color]);
+            EXPECT_EQ(expected.numParticles[color], actual.numParticles[color]);
+            EXPECT_EQ(expected.numGenomeCells[color], actual.numGenomeCells[color]);
+            EXPECT_TRUE(IntegrationTestFramework::approxCompare(expected.genomeComplexity[color], actual.genomeComplexity[color]));
+            EXPECT_TRUE(IntegrationTestFramework::approxCompare(expected.maxGenomeComplexityOfColonies[color], actual.maxGenomeComplexityOfColonies[color]));
+            EXPECT_TRUE(IntegrationTestFramework::approxCompare(toFloat(expected.genomeComplexityVariance[color]), toFloat(actual.genomeComplexityVariance[color])));
+            EXPECT_TRUE(IntegrationTestFramework::approxCompare(expected.totalEnergy[color], actual.totalEnergy[color], 0.001f));
+        }
+    }
+}
+
+class OfflineStatisticsServiceTests : public ::testing::Test
+{
+public:
+    OfflineStatisticsServiceTests() = default;
+    ~OfflineStatisticsServiceTests() = default;
+};
+
+//compares the host calculation with the statistics kernels
+class OfflineStatisticsServiceGpuTests : public IntegrationTestFramework
+{
+public:
+    OfflineStatisticsServiceGpuTests()
+        : IntegrationTestFramework()
+    {}
+
+    ~OfflineStatisticsServiceGpuTests() = default;
+};
+
+TEST_F(OfflineStatisticsServiceTests, selfReplicatorWithRepetitionsInGenome)
+{
+    DataDescription data;
+    data.addCells({
+        CellDescription().setId(1).setCellFunction(ConstructorDescription().setGenome(createSelfReplicatingGenome(2, 3))),
+    });
+
+    auto statistics = OfflineStatisticsService::get().calcStatistics(data);
+
+    EXPECT_EQ(1, statistics.timeline.timestep.numCells[0]);
+    EXPECT_EQ(1, statistics.timeline.timestep.numSelfReplicators[0]);
+    EXPECT_EQ(10, statistics.timeline.timestep.numGenomeCells[0]);
+}
+
+TEST_F(OfflineStatisticsServiceTests, colonies)
+{
+    DataDescription data;
+    for (int i = 0; i < 30; ++i) {
+        data.addCell(CellDescription()
+                         .setId(i + 1)
+                         .setPos({toFloat(i * 3), 10.0f})
+                         .setColor(i < 25 ? 2 : 4)
+                         .setMutationId(i < 25 ? 5 : 6)
+                         .setGenomeComplexity(toFloat(i))
+                         .setCellFunction(ConstructorDescription().setGenome(createSelfReplicatingGenome(1, 1))));
+    }
+
+    auto statistics = OfflineStatisticsService::get().calcStatistics(data, 4);
+
+    EXPECT_EQ(25, statistics.timeline.timestep.numSelfReplicators[2]);
+    EXPECT_EQ(5, statistics.timeline.timestep.numSelfReplicators[4]);
+    EXPECT_EQ(1, statistics.timeline.timestep.numColonies[2]);
+    EXPECT_EQ(0, statistics.timeline.timestep.numColonies[4]);
+    EXPECT_TRUE(IntegrationTestFramework::approxCompare(12.0f, statistics.timeline.timestep.maxGenomeComplexityOfColonies[2]));
+}
+
+TEST_F(OfflineStatisticsServiceTests, ageHistogram)
+{
+    DataDescription data;
+    for (int i = 0; i < 100; ++i) {
+        data.addCell(CellDescription().setId(i + 1).setPos({toFloat(i * 3), 10.0f}).setAge(i * 10).setColor(i % 2));
+    }
+    data.addCell(CellDescription().setId(1000).setPos({10.0f, 50.0f}).setAge(100000).setBarrier(true));
+
+    auto statistics = OfflineStatisticsService::get().calcStatistics(data, 3);
+
+    EXPECT_EQ(990, statistics.histogram.maxValue);
+    auto numCells = 0;
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        for (int slot = 0; slot < MAX_HISTOGRAM_SLOTS; ++slot) {
+            numCells += statistics.histogram.numCellsByColorBySlot[color][slot];
+        }
+    }
+    EXPECT_EQ(100, numCells);
+    EXPECT_EQ(3, statistics.histogram.numCellsByColorBySlot[1][MAX_HISTOGRAM_SLOTS - 1]);  //ages 950, 970, 990
+}
+
+TEST_F(OfflineStatisticsServiceTests, independentOfNumberOfThreads)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(30).height(30));
+    for (auto& cell : data.cells) {
+        cell.mutationId = toInt(cell.id % 2);
+        cell.genomeComplexity = toFloat(cell.id % 5);
+        cell.setCellFunction(ConstructorDescription().setGenome(createSelfReplicatingGenome(1, 2)));
+    }
+
+    auto singleThreadStatistics = OfflineStatisticsService::get().calcStatistics(data, 1);
+    auto multiThreadStatistics = OfflineStatisticsService::get().calcStatistics(data, 8);
+
+    expectEqual(singleThreadStatistics.timeline.timestep, multiThreadStatistics.timeline.timestep);
+}
+
+TEST_F(OfflineStatisticsServiceGpuTests, parityWithGpu)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(20).height(20).center({100.0f, 100.0f}));
+    for (auto& cell : data.cells) {
+        cell.color = cell.id % MAX_COLORS;
+        cell.age = toInt(cell.id % 500);
+        cell.mutationId = toInt(cell.id % 3);
+        cell.genomeComplexity = toFloat(cell.id % 7);
+        if (cell.id % 4 == 0) {
+            cell.setCellFunction(ConstructorDescription().setGenome(createSelfReplicatingGenome(2, 3)));
+        }
+    }
+    data.addParticles({
+        ParticleDescription().setId(100000).setPos({10.0f, 10.0f}).setEnergy(30.0f).setColor(3),
+        ParticleDescription().setId(100001).setPos({20.0f, 10.0f}).setEnergy(40.0f).setColor(5),
+    });
+
+    _simulationFacade->setSimulationData(data);
+    auto gpuStatistics = _simulationFacade->getRawStatistics();
+    auto offlineStatistics = OfflineStatisticsService::get().calcStatistics(_simulationFacade->getSimulationData());
+
+    expectEqual(gpuStatistics.timeline.timestep, offlineStatistics.timeline.timestep);
+    EXPECT_EQ(gpuStatistics.histogram.maxValue, offlineStatistics.histogram.maxValue);
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        for (int slot = 0; slot < MAX_HISTOGRAM_SLOTS; ++slot) {
+            EXPECT_EQ(gpuStatistics.histogram.numCellsByColorBySlot[color][slot], offlineStatistics.histogram.numCellsByColorBySlot[color][slot]);
+        }
+    }
+}
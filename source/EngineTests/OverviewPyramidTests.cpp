@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include "Base/NumberGenerator.h"
+#include "EngineInterface/Colors.h"
+#include "EngineInterface/OverviewPyramid.h"
+
+class OverviewPyramidTests : public ::testing::Test
+{
+public:
+    OverviewPyramidTests() = default;
+    ~OverviewPyramidTests() = default;
+
+protected:
+    DataDescription createData(int numCells, int numParticles) const
+    {
+        auto& numberGen = NumberGenerator::get();
+        DataDescription result;
+        for (int i = 0; i < numCells; ++i) {
+            result.addCell(CellDescription()
+                               .setId(i + 1)
+                               .setPos({numberGen.getRandomFloat(0, toFloat(WorldSize.x)), numberGen.getRandomFloat(0, toFloat(WorldSize.y))})
+                               .setColor(toInt(numberGen.getRandomInt(MAX_COLORS)))
+                               .setEnergy(toFloat(numberGen.getRandomInt(200))));
+        }
+        for (int i = 0; i < numParticles; ++i) {
+            result.addParticle(ParticleDescription()
+                                   .setId(numCells + i + 1)
+                                   .setPos({numberGen.getRandomFloat(0, toFloat(WorldSize.x)), numberGen.getRandomFloat(0, toFloat(WorldSize.y))})
+                                   .setEnergy(toFloat(numberGen.getRandomInt(50))));
+        }
+        return result;
+    }
+
+    //brute-force sum over all cells and particles within the region of a tile
+    OverviewTile calcTile(DataDescription const& data, OverviewPyramid const& pyramid, int level, IntVector2D const& tilePos) const
+    {
+        auto tileSize = pyramid.getTileSize(level);
+        auto isInside = [&](RealVector2D const& pos) {
+            return toInt(pos.x) / toInt(tileSize) == tilePos.x && toInt(pos.y) / toInt(tileSize) == tilePos.y;
+        };
+        OverviewTile result;
+        for (auto const& cell : data.cells) {
+            if (isInside(cell.pos)) {
+                ++result.numCells;
+                ++result.numCellsByColor[cell.color];
+                result.energy += cell.energy;
+            }
+        }
+        for (auto const& particle : data.particles) {
+            if (isInside(particle.pos)) {
+                ++result.numParticles;
+                result.energy += particle.energy;
+            }
+        }
+        return result;
+    }
+
+    void checkTiles(DataDescription const& data, OverviewPyramid const& pyramid) const
+    {
+        for (int level = 0; level < pyramid.getNumLevels(); ++level) {
+            auto levelSize = pyramid.getLevelSize(level);
+            for (int x = 0; x < levelSize.x; ++x) {
+                for (int y = 0; y < levelSize.y; ++y) {
+                    auto expectedTile = calcTile(data, pyramid, level, {x, y});
+                    auto const& tile = pyramid.getTile(level, {x, y});
+                    ASSERT_EQ(expectedTile.numCells, tile.numCells);
+                    ASSERT_EQ(expectedTile.numParticles, tile.numParticles);
+                    ASSERT_EQ(expectedTile.numCellsByColor, tile.numCellsByColor);
+                    ASSERT_NEAR(expectedTile.energy, tile.energy, 0.01f);
+                }
+            }
+        }
+    }
+
+    IntVector2D const WorldSize = {100, 60};
+};
+
+TEST_F(OverviewPyramidTests, levels)
+{
+    OverviewPyramid pyramid(WorldSize, 8);
+    ASSERT_EQ(5, pyramid.getNumLevels());
+    EXPECT_EQ(IntVector2D({13, 8}), pyramid.getLevelSize(0));
+    EXPECT_EQ(IntVector2D({7, 4}), pyramid.getLevelSize(1));
+    EXPECT_EQ(IntVector2D({4, 2}), pyramid.getLevelSize(2));
+    EXPECT_EQ(IntVector2D({2, 1}), pyramid.getLevelSize(3));
+    EXPECT_EQ(IntVector2D({1, 1}), pyramid.getLevelSize(4));
+
+    EXPECT_EQ(0, pyramid.calcLevel(1.0f));
+    EXPECT_EQ(0, pyramid.calcLevel(0.1f));
+    EXPECT_EQ(1, pyramid.calcLevel(0.05f));
+    EXPECT_EQ(4, pyramid.calcLevel(0.001f));
+}
+
+TEST_F(OverviewPyramidTests, aggregatesMatchBruteForce)
+{
+    auto data = createData(5000, 500);
+    OverviewPyramid pyramid(WorldSize, 8);
+    pyramid.update(data, 4);
+
+    checkTiles(data, pyramid);
+    EXPECT_EQ(5000, pyramid.getTotal().numCells);
+    EXPECT_EQ(500, pyramid.getTotal().numParticles);
+    EXPECT_EQ(toInt(pyramid.getLevelSize(0).x * pyramid.getLevelSize(0).y), toInt(pyramid.getChangedTiles(0).size()));
+
+    ClusteredDataDescription clusteredData;
+    clusteredData.addCluster(ClusterDescription().addCells(data.cells));
+    clusteredData.addParticles(data.particles);
+    OverviewPyramid clusteredPyramid(WorldSize, 8);
+    clusteredPyramid.update(clusteredData);
+    for (int level = 0; level < pyramid.getNumLevels(); ++level) {
+        auto levelSize = pyramid.getLevelSize(level);
+        for (int x = 0; x < levelSize.x; ++x) {
+            for (int y = 0; y < levelSize.y; ++y) {
+                EXPECT_EQ(pyramid.getTile(level, {x, y}), clusteredPyramid.getTile(level, {x, y}));
+            }
+        }
+    }
+}
+
+TEST_F(OverviewPyramidTests, incrementalUpdate)
+{
+    auto data = createData(2000, 0);
+    OverviewPyramid pyramid(WorldSize, 8);
+    pyramid.update(data);
+
+    //move a single cell from tile (0, 0) to tile (12, 7) of level 0
+    data.cells.front().setPos({1.0f, 1.0f});
+    pyramid.update(data);
+    data.cells.front().setPos({99.0f, 59.0f});
+    pyramid.update(data);
+
+    checkTiles(data, pyramid);
+    EXPECT_EQ((std::vector<int>{0, 12 + 7 * 13}), pyramid.getChangedTiles(0));
+    EXPECT_EQ((std::vector<int>{0, 6 + 3 * 7}), pyramid.getChangedTiles(1));
+    EXPECT_EQ((std::vector<int>{0}), pyramid.getChangedTiles(4));
+
+    pyramid.update(data);
+    for (int level = 0; level < pyramid.getNumLevels(); ++level) {
+        EXPECT_TRUE(pyramid.getChangedTiles(level).empty());
+    }
+
+    OverviewPyramid rebuiltPyramid(WorldSize, 8);
+    rebuiltPyramid.update(data);
+    for (int level = 0; level < pyramid.getNumLevels(); ++level) {
+        auto levelSize = pyramid.getLevelSize(level);
+        for (int x = 0; x < levelSize.x; ++x) {
+            for (int y = 0; y < levelSize.y; ++y) {
+                EXPECT_EQ(rebuiltPyramid.getTile(level, {x, y}), pyramid.getTile(level, {x, y}));
+            }
+        }
+    }
+}
+
+TEST_F(OverviewPyramidTests, createRgbImage)
+{
+    DataDescription data;
+    for (int i = 0; i < 10; ++i) {
+        data.addCell(CellDescription().setId(i + 1).setPos({2.0f, 2.0f}).setColor(0));
+    }
+    data.addCell(CellDescription().setId(11).setPos({50.0f, 2.0f}).setColor(0));
+    OverviewPyramid pyramid(WorldSize, 8);
+    pyramid.update(data);
+
+    auto image = pyramid.createRgbImage(0);
+    ASSERT_EQ(13 * 8 * 3, image.size());
+    EXPECT_EQ((Const::IndividualCellColor1 >> 16) & 0xff, image.at(0));
+    EXPECT_EQ(Const::IndividualCellColor1 & 0xff, image.at(2));
+    EXPECT_TRUE(image.at(6 * 3 + 2) > 0 && image.at(6 * 3 + 2) < image.at(2));
+    EXPECT_EQ(0, image.at(3));
+}
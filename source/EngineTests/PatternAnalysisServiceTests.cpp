@@ -0,0 +1,103 @@
+#include "EngineInterface/PatternAnalysisService.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+class PatternAnalysisServiceTests : public ::testing::Test
+{
+public:
+    PatternAnalysisServiceTests() = default;
+    ~PatternAnalysisServiceTests() = default;
+
+protected:
+    ClusterDescription createCluster(int numCells, std::vector<std::pair<int, int>> const& edges, uint64_t firstId, std::vector<int> const& colors = {}) const
+    {
+        ClusterDescription result;
+        for (int i = 0; i < numCells; ++i) {
+            result.addCell(CellDescription().setId(firstId + i).setColor(colors.empty() ? 0 : colors.at(i)));
+        }
+        for (auto const& [index1, index2] : edges) {
+            result.cells.at(index1).connections.emplace_back(ConnectionDescription().setCellId(firstId + index2));
+            result.cells.at(index2).connections.emplace_back(ConnectionDescription().setCellId(firstId + index1));
+        }
+        return result;
+    }
+
+    ClusterDescription createChain(int numCells, uint64_t firstId, std::vector<int> const& colors = {}) const
+    {
+        std::vector<std::pair<int, int>> edges;
+        for (int i = 0; i + 1 < numCells; ++i) {
+            edges.emplace_back(i, i + 1);
+        }
+        return createCluster(numCells, edges, firstId, colors);
+    }
+};
+
+TEST_F(PatternAnalysisServiceTests, renumberedCluster)
+{
+    auto cluster1 = createCluster(5, {{0, 1}, {1, 2}, {2, 3}, {3, 1}, {3, 4}}, 1, {0, 1, 2, 3, 4});
+    auto cluster2 = createCluster(5, {{4, 3}, {3, 2}, {2, 1}, {1, 3}, {1, 0}}, 100, {4, 3, 2, 1, 0});
+    std::reverse(cluster2.cells.begin(), cluster2.cells.end());
+
+    auto const& service = PatternAnalysisService::get();
+    EXPECT_EQ(service.calcHash(cluster1), service.calcHash(cluster2));
+    EXPECT_TRUE(service.isIsomorphic(cluster1, cluster2));
+}
+
+TEST_F(PatternAnalysisServiceTests, differentAttributes)
+{
+    auto const& service = PatternAnalysisService::get();
+    auto cluster1 = createChain(4, 1, {0, 0, 1, 0});
+    auto cluster2 = createChain(4, 10, {0, 1, 0, 0});
+    auto cluster3 = createChain(4, 20, {0, 0, 0, 1});
+    EXPECT_TRUE(service.isIsomorphic(cluster1, cluster2));
+    EXPECT_FALSE(service.isIsomorphic(cluster1, cluster3));
+    EXPECT_NE(service.calcHash(cluster1), service.calcHash(cluster3));
+}
+
+TEST_F(PatternAnalysisServiceTests, structureNotDistinguishedByRefinement)
+{
+    //all cells of a hexagon and of two triangles have the same refined labels
+    auto hexagon = createCluster(6, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 0}}, 1);
+    auto triangles = createCluster(6, {{0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3}}, 10);
+
+    auto const& service = PatternAnalysisService::get();
+    EXPECT_EQ(service.calcHash(hexagon), service.calcHash(triangles));
+    EXPECT_FALSE(service.isIsomorphic(hexagon, triangles));
+
+    ClusteredDataDescription data;
+    data.clusters = {hexagon, triangles};
+    EXPECT_EQ(2, service.calcPatternClasses(data).size());
+}
+
+TEST_F(PatternAnalysisServiceTests, calcPatternClasses)
+{
+    ClusteredDataDescription data;
+    data.clusters.emplace_back(createChain(3, 1));
+    data.clusters.emplace_back(createCluster(3, {{0, 1}, {1, 2}, {2, 0}}, 10));
+    data.clusters.emplace_back(createChain(3, 20));
+    data.clusters.emplace_back(createChain(4, 30));
+    data.clusters.emplace_back(createCluster(3, {{2, 0}, {0, 1}, {1, 2}}, 40));
+    data.clusters.emplace_back(createChain(3, 50));
+    data.clusters.emplace_back(createChain(4, 60, {0, 0, 0, 1}));
+
+    for (auto maxThreads : {1, 4}) {
+        auto patternClasses = PatternAnalysisService::get().calcPatternClasses(data, maxThreads);
+        ASSERT_EQ(4, patternClasses.size());
+        EXPECT_EQ((std::vector<int>{0, 2, 5}), patternClasses.at(0).clusterIndices);
+        EXPECT_EQ((std::vector<int>{1, 4}), patternClasses.at(1).clusterIndices);
+        EXPECT_EQ((std::vector<int>{3}), patternClasses.at(2).clusterIndices);
+        EXPECT_EQ((std::vector<int>{6}), patternClasses.at(3).clusterIndices);
+    }
+}
+
+TEST_F(PatternAnalysisServiceTests, exportToCsv)
+{
+    ClusteredDataDescription data;
+    data.clusters.emplace_back(createChain(2, 7));
+    data.clusters.emplace_back(createChain(2, 9));
+
+    auto csv = PatternAnalysisService::get().exportToCsv(PatternAnalysisService::get().calcPatternClasses(data), data);
+    EXPECT_EQ("pattern,exemplars,cells,representant cell id\n1,2,2,7\n", csv);
+}
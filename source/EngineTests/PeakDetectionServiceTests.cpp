@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "PersisterInterface/PeakDetectionService.h"
+
+class PeakDetectionServiceTests : public ::testing::Test
+{
+public:
+    PeakDetectionServiceTests() = default;
+    ~PeakDetectionServiceTests() = default;
+
+protected:
+    RawStatisticsData createStatistics(double variance, float genomeComplexity, int numSelfReplicators, float maxGenomeComplexityOfColonies) const
+    {
+        RawStatisticsData result;
+        auto& timestep = result.timeline.timestep;
+        timestep.genomeComplexityVariance[0] = variance / 2;
+        timestep.genomeComplexityVariance[3] = variance / 2;
+        timestep.genomeComplexity[1] = genomeComplexity;
+        timestep.numSelfReplicators[1] = numSelfReplicators;
+        timestep.maxGenomeComplexityOfColonies[2] = maxGenomeComplexityOfColonies;
+        return result;
+    }
+};
+
+TEST_F(PeakDetectionServiceTests, calcMetric)
+{
+    auto const& service = PeakDetectionService::get();
+    auto statistics = createStatistics(10.0, 300.0f, 4, 120.0f);
+    EXPECT_DOUBLE_EQ(10.0, service.calcMetric(PeakCriterion_GenomeComplexityVariance, statistics));
+    EXPECT_DOUBLE_EQ(75.0, service.calcMetric(PeakCriterion_AverageGenomeComplexity, statistics));
+    EXPECT_DOUBLE_EQ(120.0, service.calcMetric(PeakCriterion_MaxGenomeComplexityOfColonies, statistics));
+    EXPECT_DOUBLE_EQ(4.0, service.calcMetric(PeakCriterion_NumSelfReplicators, statistics));
+    EXPECT_DOUBLE_EQ(0.0, service.calcMetric(PeakCriterion_AverageGenomeComplexity, RawStatisticsData()));
+    EXPECT_THROW(service.calcMetric(PeakCriterion_Count, statistics), std::runtime_error);
+}
+
+TEST_F(PeakDetectionServiceTests, isNewPeak)
+{
+    auto const& service = PeakDetectionService::get();
+    auto peak = createStatistics(10.0, 300.0f, 4, 120.0f);
+    auto candidate = createStatistics(12.0, 300.0f, 6, 100.0f);
+
+    EXPECT_TRUE(service.isNewPeak(PeakCriterion_GenomeComplexityVariance, candidate, peak));
+    EXPECT_FALSE(service.isNewPeak(PeakCriterion_AverageGenomeComplexity, candidate, peak));
+    EXPECT_FALSE(service.isNewPeak(PeakCriterion_MaxGenomeComplexityOfColonies, candidate, peak));
+    EXPECT_TRUE(service.isNewPeak(PeakCriterion_NumSelfReplicators, candidate, peak));
+
+    //equal values do not replace the captured peak
+    EXPECT_FALSE(service.isNewPeak(PeakCriterion_GenomeComplexityVariance, peak, peak));
+
+    //without a captured peak each candidate is taken
+    EXPECT_TRUE(service.isNewPeak(PeakCriterion_GenomeComplexityVariance, RawStatisticsData(), std::nullopt));
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include "Base/RingBuffer.h"
+
+class RingBufferTests : public ::testing::Test
+{
+public:
+    RingBufferTests() = default;
+    ~RingBufferTests() = default;
+};
+
+TEST_F(RingBufferTests, pushAndPop)
+{
+    RingBuffer<int> buffer(4);
+    EXPECT_TRUE(buffer.isEmpty());
+    for (int i = 0; i < 3; ++i) {
+        buffer.pushBack(i);
+    }
+    EXPECT_EQ(3, buffer.size());
+    EXPECT_EQ(0, buffer.front());
+    EXPECT_EQ(2, buffer.back());
+
+    buffer.popFront();
+    EXPECT_EQ(2, buffer.size());
+    EXPECT_EQ(1, buffer[0]);
+    EXPECT_EQ(2, buffer[1]);
+}
+
+TEST_F(RingBufferTests, overwriteOldest)
+{
+    RingBuffer<int> buffer(4);
+    for (int i = 0; i < 10; ++i) {
+        buffer.pushBack(i);
+    }
+    ASSERT_EQ(4, buffer.size());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(6 + i, buffer[i]);
+    }
+
+    buffer.popFront();
+    buffer.pushBack(10);
+    buffer.pushBack(11);
+    EXPECT_EQ(4, buffer.getCapacity());
+    EXPECT_EQ(8, buffer.front());
+    EXPECT_EQ(11, buffer.back());
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.isEmpty());
+}
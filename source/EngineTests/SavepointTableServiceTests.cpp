@@ -0,0 +1,164 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "PersisterInterface/SavepointTableService.h"
+
+class SavepointTableServiceTests : public ::testing::Test
+{
+public:
+    SavepointTableServiceTests()
+    {
+        _directory = std::filesystem::temp_directory_path() / ("savepointTableServiceTests_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+    ~SavepointTableServiceTests() { std::filesystem::remove_all(_directory); }
+
+protected:
+    std::string getFilename() const { return (_directory / "savepoints.json").string(); }
+
+    SavepointTable load() const
+    {
+        auto result = SavepointTableService::get().loadFromFile(getFilename());
+        if (!std::holds_alternative<SavepointTable>(result)) {
+            throw std::runtime_error("Could not load save point table.");
+        }
+        return std::get<SavepointTable>(result);
+    }
+
+    SavepointEntry createEntry(std::string const& name, SavepointState state = SavepointState_InQueue) const
+    {
+        return std::make_shared<_SavepointEntry>(_SavepointEntry{.filename = name + ".sim", .state = state, .name = name, .timestep = name.size()});
+    }
+
+    std::vector<std::string> getNames(SavepointTable const& table) const
+    {
+        std::vector<std::string> result;
+        for (int i = 0; i < table.getSize(); ++i) {
+            result.emplace_back(table.at(i)->name);
+        }
+        return result;
+    }
+
+    std::string readFile(std::filesystem::path const& filename) const
+    {
+        std::ifstream stream(filename, std::ios::binary);
+        std::stringstream result;
+        result << stream.rdbuf();
+        return result.str();
+    }
+
+    void writeFile(std::filesystem::path const& filename, std::string const& content) const
+    {
+        std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+        stream << content;
+    }
+
+    std::filesystem::path _directory;
+};
+
+TEST_F(SavepointTableServiceTests, replayJournal)
+{
+    auto& service = SavepointTableService::get();
+    auto table = load();
+    service.insertEntryAtFront(table, createEntry("a"));
+    service.insertEntryAtFront(table, createEntry("b"));
+    service.insertEntryAtFront(table, createEntry("c"));
+    service.updateEntry(table, 1, createEntry("b2", SavepointState_Persisted));
+    service.deleteEntry(table, table.at(2));
+
+    //changes are only journaled
+    EXPECT_FALSE(std::filesystem::exists(getFilename()));
+    EXPECT_TRUE(std::filesystem::exists(service.getJournalFilename(table)));
+
+    auto loadedTable = load();
+    EXPECT_EQ((std::vector<std::string>{"c", "b2"}), getNames(loadedTable));
+    EXPECT_EQ(SavepointState_Persisted, loadedTable.at(1)->state);
+    EXPECT_EQ(std::filesystem::path("b2.sim"), loadedTable.at(1)->filename);
+    EXPECT_EQ(2, loadedTable.at(1)->timestep);
+    EXPECT_EQ(3, loadedTable.getSequenceNumber());
+
+    //loading compacts the journal into the table file
+    EXPECT_TRUE(std::filesystem::exists(getFilename()));
+    EXPECT_FALSE(std::filesystem::exists(service.getJournalFilename(loadedTable)));
+    EXPECT_EQ((std::vector<std::string>{"c", "b2"}), getNames(load()));
+}
+
+TEST_F(SavepointTableServiceTests, truncatedJournal)
+{
+    auto& service = SavepointTableService::get();
+    auto table = load();
+    service.insertEntryAtFront(table, createEntry("a"));
+    service.insertEntryAtFront(table, createEntry("b"));
+    auto journal = readFile(service.getJournalFilename(table));
+    service.insertEntryAtFront(table, createEntry("c"));
+    auto fullJournal = readFile(service.getJournalFilename(table));
+    ASSERT_TRUE(fullJournal.size() > journal.size() + 10);
+
+    //last operation partially written
+    writeFile(service.getJournalFilename(table), fullJournal.substr(0, journal.size() + 10));
+    EXPECT_EQ((std::vector<std::string>{"b", "a"}), getNames(load()));
+    EXPECT_EQ((std::vector<std::string>{"b", "a"}), getNames(load()));
+}
+
+TEST_F(SavepointTableServiceTests, unterminatedLastOperation)
+{
+    auto& service = SavepointTableService::get();
+    auto table = load();
+    service.insertEntryAtFront(table, createEntry("a"));
+    service.insertEntryAtFront(table, createEntry("b"));
+    auto journal = readFile(service.getJournalFilename(table));
+    writeFile(service.getJournalFilename(table), journal.substr(0, journal.size() - 1));
+
+    EXPECT_EQ((std::vector<std::string>{"a"}), getNames(load()));
+}
+
+TEST_F(SavepointTableServiceTests, outdatedJournal)
+{
+    auto& service = SavepointTableService::get();
+    auto table = load();
+    service.insertEntryAtFront(table, createEntry("a"));
+    service.insertEntryAtFront(table, createEntry("b"));
+    auto journal = readFile(service.getJournalFilename(table));
+    table = load();
+
+    //journal has already been compacted into the table file but could not be removed
+    writeFile(service.getJournalFilename(table), journal);
+    EXPECT_EQ((std::vector<std::string>{"b", "a"}), getNames(load()));
+}
+
+TEST_F(SavepointTableServiceTests, periodicCompaction)
+{
+    auto& service = SavepointTableService::get();
+    auto table = load();
+    for (int i = 0; i < 250; ++i) {
+        service.insertEntryAtFront(table, createEntry(std::to_string(i)));
+    }
+    EXPECT_TRUE(std::filesystem::exists(getFilename()));
+
+    auto journal = readFile(service.getJournalFilename(table));
+    EXPECT_TRUE(std::count(journal.begin(), journal.end(), '\n') <= 101);
+
+    auto loadedTable = load();
+    ASSERT_EQ(250, loadedTable.getSize());
+    EXPECT_EQ("249", loadedTable.at(0)->name);
+    EXPECT_EQ("0", loadedTable.at(249)->name);
+    EXPECT_EQ(250, loadedTable.getSequenceNumber());
+}
+
+TEST_F(SavepointTableServiceTests, truncate)
+{
+    auto& service = SavepointTableService::get();
+    auto table = load();
+    for (auto const& name : {"a", "b", "c", "d", "e"}) {
+        service.insertEntryAtFront(table, createEntry(name));
+    }
+    auto nonPersistentEntries = service.truncate(table, 2);
+    EXPECT_EQ(3, nonPersistentEntries.size());
+    EXPECT_TRUE(service.truncate(table, 2).empty());
+
+    EXPECT_EQ((std::vector<std::string>{"e", "d"}), getNames(load()));
+}
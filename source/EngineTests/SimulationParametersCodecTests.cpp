@@ -0,0 +1,143 @@
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/SimulationParametersSchema.h"
+#include "PersisterInterface/SimulationParametersCodec.h"
+
+class SimulationParametersCodecTests : public ::testing::Test
+{
+public:
+    SimulationParametersCodecTests() = default;
+    ~SimulationParametersCodecTests() = default;
+
+protected:
+    SimulationParameters createParameters() const
+    {
+        SimulationParameters result;
+        result.cellGlowRadius = 3.5f;
+        result.cellMaxAge[3] = 1234;
+        result.motionType = MotionType_Collision;
+        result.motionData.collisionMotion.cellRepulsionStrength = 0.5f;
+        result.features.cellAgeLimiter = true;
+
+        result.numRadiationSources = 2;
+        result.radiationSource[1].shapeType = RadiationSourceShapeType_Rectangular;
+        result.radiationSource[1].shapeData.rectangularRadiationSource.width = 42.0f;
+        std::strcpy(result.radiationSource[1].name, "source");
+
+        result.numZones = 2;
+        auto& zone = result.zone[1];
+        zone.flowType = FlowType_Linear;
+        zone.flowData.linearFlow.angle = 90.0f;
+        zone.values.friction = 0.7f;
+        zone.activatedValues.friction = true;
+        zone.values.radiationAbsorption[2] = 0.25f;
+        zone.activatedValues.radiationAbsorption = true;
+        zone.values.cellFunctionAttackerFoodChainColorMatrix[1][2] = 0.5f;
+        zone.activatedValues.cellFunctionAttackerFoodChainColorMatrix = true;
+        return result;
+    }
+};
+
+TEST_F(SimulationParametersCodecTests, schema)
+{
+    auto const& schema = SimulationParametersSchema::get();
+    auto const& field = schema.getFields(ParameterScope::Zone).at(schema.getFieldIndex(ParameterScope::Zone, "radiation.absorption"));
+    EXPECT_EQ(ParameterType::Float, field.type);
+    EXPECT_EQ(ParameterShape::ColorVector, field.shape);
+    EXPECT_TRUE(field.activatedOffset.has_value());
+
+    SimulationParametersZone zone;
+    zone.values.radiationAbsorption[3] = 0.5f;
+    EXPECT_EQ(0.5f, field.getValue<float>(&zone)[3]);
+
+    EXPECT_THROW(schema.getFieldIndex(ParameterScope::Global, "unknown"), std::runtime_error);
+}
+
+TEST_F(SimulationParametersCodecTests, json_layout)
+{
+    boost::property_tree::ptree tree;
+    SimulationParametersCodec::get().encodeJson(tree, createParameters());
+
+    EXPECT_EQ(3.5f, tree.get<float>("simulation parameters.cell glow.radius"));
+    EXPECT_EQ(1234, tree.get<int>("simulation parameters.cell.max age[3]"));
+    EXPECT_EQ(0.5f, tree.get<float>("simulation parameters.motion.collision.repulsion strength"));
+    EXPECT_FALSE(tree.get_optional<float>("simulation parameters.fluid.smoothing length").has_value());
+    EXPECT_EQ(42.0f, tree.get<float>("simulation parameters.particle sources.1.shape.rectangular.width"));
+    EXPECT_EQ("source", tree.get<std::string>("simulation parameters.particle sources.1.name"));
+    EXPECT_FALSE(tree.get_optional<float>("simulation parameters.particle sources.1.shape.circular.radius").has_value());
+
+    EXPECT_TRUE(tree.get<bool>("simulation parameters.spots.1.friction.activated"));
+    EXPECT_EQ(0.7f, tree.get<float>("simulation parameters.spots.1.friction.value"));
+    EXPECT_TRUE(tree.get<bool>("simulation parameters.spots.1.radiation.absorption.activated"));
+    EXPECT_EQ(0.25f, tree.get<float>("simulation parameters.spots.1.radiation.absorption[2]"));
+    EXPECT_EQ(0.5f, tree.get<float>("simulation parameters.spots.1.cell.function.attacker.food chain color matrix.value[1, 2]"));
+    EXPECT_EQ(90.0f, tree.get<float>("simulation parameters.spots.1.flow.linear.angle"));
+    EXPECT_FALSE(tree.get_child_optional("simulation parameters.spots.2").has_value());
+}
+
+TEST_F(SimulationParametersCodecTests, json_roundtrip)
+{
+    auto parameters = createParameters();
+    boost::property_tree::ptree tree;
+    SimulationParametersCodec::get().encodeJson(tree, parameters);
+
+    SimulationParameters decodedParameters;
+    auto missingFields = SimulationParametersCodec::get().decodeJson(tree, decodedParameters);
+    EXPECT_EQ(parameters, decodedParameters);
+    for (auto const& missing : missingFields) {
+        EXPECT_FALSE(missing);
+    }
+}
+
+TEST_F(SimulationParametersCodecTests, json_missingFields)
+{
+    auto parameters = createParameters();
+    boost::property_tree::ptree tree;
+    SimulationParametersCodec::get().encodeJson(tree, parameters);
+    tree.get_child("simulation parameters.cell").erase("max age[3]");
+    tree.get_child("simulation parameters").erase("features");
+
+    SimulationParameters decodedParameters;
+    auto missingFields = SimulationParametersCodec::get().decodeJson(tree, decodedParameters);
+    EXPECT_EQ(SimulationParameters().cellMaxAge[3], decodedParameters.cellMaxAge[3]);
+    EXPECT_EQ(parameters.cellMaxAge[2], decodedParameters.cellMaxAge[2]);
+    EXPECT_FALSE(decodedParameters.features.cellAgeLimiter);
+
+    auto const& schema = SimulationParametersSchema::get();
+    EXPECT_TRUE(missingFields.at(schema.getFieldIndex(ParameterScope::Global, "cell.max age")));
+    EXPECT_TRUE(missingFields.at(schema.getFieldIndex(ParameterScope::Global, "features.cell age limiter")));
+    EXPECT_FALSE(missingFields.at(schema.getFieldIndex(ParameterScope::Global, "cell glow.radius")));
+}
+
+TEST_F(SimulationParametersCodecTests, binary_roundtrip)
+{
+    auto parameters = createParameters();
+    auto data = SimulationParametersCodec::get().encodeBinary(parameters);
+    EXPECT_EQ(parameters, SimulationParametersCodec::get().decodeBinary(data));
+    EXPECT_TRUE(data.size() < sizeof(SimulationParameters));
+}
+
+TEST_F(SimulationParametersCodecTests, binary_invalidData)
+{
+    auto data = SimulationParametersCodec::get().encodeBinary(createParameters());
+
+    auto truncatedData = data;
+    truncatedData.pop_back();
+    EXPECT_THROW(SimulationParametersCodec::get().decodeBinary(truncatedData), std::runtime_error);
+
+    auto otherSchemaData = data;
+    ++otherSchemaData.at(4);
+    EXPECT_THROW(SimulationParametersCodec::get().decodeBinary(otherSchemaData), std::runtime_error);
+}
+
+TEST_F(SimulationParametersCodecTests, calcHash)
+{
+    auto parameters = createParameters();
+    auto hash = SimulationParametersCodec::get().calcHash(parameters);
+    EXPECT_EQ(hash, SimulationParametersCodec::get().calcHash(createParameters()));
+
+    parameters.zone[1].activatedValues.friction = false;
+    EXPECT_NE(hash, SimulationParametersCodec::get().calcHash(parameters));
+}
@@ -0,0 +1,130 @@
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/SimulationParametersDiffService.h"
+
+class SimulationParametersDiffServiceTests : public ::testing::Test
+{
+public:
+    SimulationParametersDiffServiceTests() = default;
+    ~SimulationParametersDiffServiceTests() = default;
+
+protected:
+    SimulationParameters createParameters() const
+    {
+        SimulationParameters result;
+        result.numRadiationSources = 1;
+        result.numZones = 2;
+        result.zone[1].values.friction = 0.7f;
+        result.zone[1].activatedValues.friction = true;
+        return result;
+    }
+};
+
+TEST_F(SimulationParametersDiffServiceTests, equalParameters)
+{
+    auto changeSet = SimulationParametersDiffService::get().calcChangeSet(createParameters(), createParameters());
+    EXPECT_TRUE(changeSet.isEmpty());
+    EXPECT_TRUE(SimulationParametersDiffService::get().calcChangedMemoryRanges(changeSet).empty());
+}
+
+TEST_F(SimulationParametersDiffServiceTests, globalChange)
+{
+    auto const& diffService = SimulationParametersDiffService::get();
+    auto from = createParameters();
+    auto to = from;
+    to.cellMaxAge[3] = 1234;
+
+    auto changeSet = diffService.calcChangeSet(from, to);
+    ASSERT_EQ(1, changeSet.changes.size());
+    EXPECT_EQ("cell.max age", diffService.getName(changeSet.changes.front()));
+    EXPECT_TRUE(diffService.getChangedElements(changeSet, ParameterScope::Zone).empty());
+
+    auto ranges = diffService.calcChangedMemoryRanges(changeSet);
+    ASSERT_EQ(1, ranges.size());
+    EXPECT_EQ(offsetof(SimulationParameters, cellMaxAge), ranges.front().offset);
+    EXPECT_EQ(sizeof(SimulationParameters::cellMaxAge), ranges.front().size);
+}
+
+TEST_F(SimulationParametersDiffServiceTests, zoneChange)
+{
+    auto const& diffService = SimulationParametersDiffService::get();
+    auto from = createParameters();
+    auto to = from;
+    to.zone[1].activatedValues.friction = false;
+
+    auto changeSet = diffService.calcChangeSet(from, to);
+    ASSERT_EQ(1, changeSet.changes.size());
+    EXPECT_EQ("spots.1.friction", diffService.getName(changeSet.changes.front()));
+    EXPECT_EQ(std::set<int>{1}, diffService.getChangedElements(changeSet, ParameterScope::Zone));
+
+    diffService.revertChangeSet(to, changeSet);
+    EXPECT_EQ(from, to);
+}
+
+TEST_F(SimulationParametersDiffServiceTests, addAndRemoveZone)
+{
+    auto const& diffService = SimulationParametersDiffService::get();
+    auto from = createParameters();
+    auto to = from;
+    to.numZones = 3;
+    to.zone[2].flowType = FlowType_Radial;
+    to.zone[2].values.friction = 0.3f;
+
+    auto changeSet = diffService.calcChangeSet(from, to);
+    EXPECT_EQ((std::set<int>{2}), diffService.getChangedElements(changeSet, ParameterScope::Zone));
+
+    auto parameters = from;
+    diffService.applyChangeSet(parameters, changeSet);
+    EXPECT_EQ(to, parameters);
+    diffService.revertChangeSet(parameters, changeSet);
+    EXPECT_EQ(from, parameters);
+
+    parameters = to;
+    diffService.applyChangeSet(parameters, diffService.calcChangeSet(to, from));
+    EXPECT_EQ(from, parameters);
+}
+
+TEST_F(SimulationParametersDiffServiceTests, unionSwitch)
+{
+    auto const& diffService = SimulationParametersDiffService::get();
+    auto from = createParameters();
+    from.motionType = MotionType_Fluid;
+    auto to = from;
+    to.motionType = MotionType_Collision;
+    to.motionData.collisionMotion.cellRepulsionStrength = 0.5f;
+
+    auto changeSet = diffService.calcChangeSet(from, to);
+    auto parameters = from;
+    diffService.applyChangeSet(parameters, changeSet);
+    EXPECT_EQ(to, parameters);
+    diffService.revertChangeSet(parameters, changeSet);
+    EXPECT_EQ(from, parameters);
+}
+
+TEST_F(SimulationParametersDiffServiceTests, mergeMemoryRanges)
+{
+    auto const& diffService = SimulationParametersDiffService::get();
+    auto from = createParameters();
+    auto to = from;
+    to.zone[1].values.friction = 0.1f;
+    to.zone[1].values.rigidity = 0.2f;
+    to.cellGlowRadius = 3.0f;
+
+    auto changeSet = diffService.calcChangeSet(from, to);
+    EXPECT_EQ(3, changeSet.changes.size());
+
+    auto ranges = diffService.calcChangedMemoryRanges(changeSet, 0);
+    auto mergedRanges = diffService.calcChangedMemoryRanges(changeSet, sizeof(SimulationParameters));
+    EXPECT_TRUE(ranges.size() > 1);
+    ASSERT_EQ(1, mergedRanges.size());
+    EXPECT_EQ(ranges.front().offset, mergedRanges.front().offset);
+    EXPECT_EQ(ranges.back().offset + ranges.back().size, mergedRanges.front().offset + mergedRanges.front().size);
+
+    auto parameters = from;
+    for (auto const& range : mergedRanges) {
+        std::memcpy(reinterpret_cast<char*>(&parameters) + range.offset, reinterpret_cast<char const*>(&to) + range.offset, range.size);
+    }
+    EXPECT_EQ(to, parameters);
+}
@@ -0,0 +1,173 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "PersisterInterface/SnapshotRing.h"
+
+class SnapshotRingTests : public ::testing::Test
+{
+public:
+    SnapshotRingTests() = default;
+    ~SnapshotRingTests() = default;
+
+protected:
+    SimulationSnapshot createSnapshot(uint64_t timestep) const
+    {
+        std::mt19937 randomEngine(static_cast<unsigned int>(timestep));
+        std::uniform_real_distribution<float> distribution(0.0f, 100.0f);
+
+        SimulationSnapshot result;
+        result.timestep = timestep;
+        result.realTime = std::chrono::milliseconds(timestep * 10);
+        for (int i = 0; i < 200; ++i) {
+            result.data.addParticle(ParticleDescription()
+                                        .setId(i + 1)
+                                        .setPos({distribution(randomEngine), distribution(randomEngine)})
+                                        .setVel({distribution(randomEngine), distribution(randomEngine)})
+                                        .setEnergy(distribution(randomEngine)));
+        }
+        return result;
+    }
+
+    void push(SnapshotRing& ring, uint64_t timestep) const
+    {
+        ring.push(createSnapshot(timestep));
+        ring.waitForEncoding();
+    }
+
+    void checkSnapshot(uint64_t expectedTimestep, std::optional<SimulationSnapshot> const& actual) const
+    {
+        ASSERT_TRUE(actual.has_value());
+        auto expected = createSnapshot(expectedTimestep);
+        EXPECT_EQ(expected.timestep, actual->timestep);
+        EXPECT_EQ(expected.realTime, actual->realTime);
+        EXPECT_TRUE(expected.data == actual->data);
+    }
+};
+
+TEST_F(SnapshotRingTests, pushAndPop_withoutDeltaEncoding)
+{
+    SnapshotRing ring(SnapshotRingParameters().deltaEncoding(false));
+    for (uint64_t timestep = 1; timestep <= 5; ++timestep) {
+        push(ring, timestep);
+        checkSnapshot(timestep, ring.getNewest());
+    }
+    ASSERT_EQ(5, ring.getNumSnapshots());
+    EXPECT_GT(ring.getMemoryUsage(), 0);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FALSE(ring.testOnly_isDeltaEncoded(i));
+    }
+
+    for (uint64_t timestep = 5; timestep >= 1; --timestep) {
+        checkSnapshot(timestep, ring.pop());
+    }
+    EXPECT_TRUE(ring.isEmpty());
+    EXPECT_EQ(0, ring.getMemoryUsage());
+    EXPECT_FALSE(ring.pop().has_value());
+}
+
+TEST_F(SnapshotRingTests, pushAndPop_withDeltaEncoding)
+{
+    SnapshotRing ring(SnapshotRingParameters().deltaEncoding(true).keyframeInterval(10));
+    for (uint64_t timestep = 1; timestep <= 5; ++timestep) {
+        push(ring, timestep);
+        checkSnapshot(timestep, ring.getNewest());
+    }
+    ASSERT_EQ(5, ring.getNumSnapshots());
+    EXPECT_FALSE(ring.testOnly_isDeltaEncoded(0));
+    for (int i = 1; i < 5; ++i) {
+        EXPECT_TRUE(ring.testOnly_isDeltaEncoded(i));
+    }
+
+    for (uint64_t timestep = 5; timestep >= 1; --timestep) {
+        checkSnapshot(timestep, ring.pop());
+    }
+    EXPECT_TRUE(ring.isEmpty());
+    EXPECT_EQ(0, ring.getMemoryUsage());
+}
+
+TEST_F(SnapshotRingTests, decodingAcrossKeyframeInterval)
+{
+    SnapshotRing ring(SnapshotRingParameters().deltaEncoding(true).keyframeInterval(3));
+    for (uint64_t timestep = 1; timestep <= 7; ++timestep) {
+        push(ring, timestep);
+    }
+    ASSERT_EQ(7, ring.getNumSnapshots());
+    std::vector<bool> expectedDeltas{false, true, true, false, true, true, false};
+    for (int i = 0; i < 7; ++i) {
+        EXPECT_EQ(expectedDeltas[i], ring.testOnly_isDeltaEncoded(i));
+    }
+
+    for (uint64_t timestep = 7; timestep >= 1; --timestep) {
+        checkSnapshot(timestep, ring.getNewest());
+        checkSnapshot(timestep, ring.pop());
+    }
+}
+
+TEST_F(SnapshotRingTests, memoryBudget_dropsOrphanedDeltas)
+{
+    uint64_t keyframeSize;
+    {
+        SnapshotRing probe(SnapshotRingParameters().deltaEncoding(false));
+        push(probe, 1);
+        keyframeSize = probe.getMemoryUsage();
+    }
+
+    auto memoryBudget = keyframeSize * 4;
+    SnapshotRing ring(SnapshotRingParameters().deltaEncoding(true).keyframeInterval(3).memoryBudget(memoryBudget));
+    for (uint64_t timestep = 1; timestep <= 12; ++timestep) {
+        push(ring, timestep);
+        EXPECT_LE(ring.getMemoryUsage(), memoryBudget);
+        ASSERT_GT(ring.getNumSnapshots(), 0);
+        EXPECT_FALSE(ring.testOnly_isDeltaEncoded(0));
+    }
+    auto numSnapshots = ring.getNumSnapshots();
+    EXPECT_LT(numSnapshots, 12);
+
+    //the remaining snapshots are the newest ones and all of them can still be decoded
+    for (uint64_t timestep = 12; timestep > 12 - numSnapshots; --timestep) {
+        checkSnapshot(timestep, ring.pop());
+    }
+    EXPECT_TRUE(ring.isEmpty());
+    EXPECT_EQ(0, ring.getMemoryUsage());
+}
+
+TEST_F(SnapshotRingTests, popPendingEntry)
+{
+    SnapshotRing ring(SnapshotRingParameters().deltaEncoding(true));
+    push(ring, 1);
+
+    //the entry may still be queued or being encoded, in both cases its data is returned
+    ring.push(createSnapshot(2));
+    checkSnapshot(2, ring.pop());
+    ring.waitForEncoding();
+    ASSERT_EQ(1, ring.getNumSnapshots());
+    auto memoryUsage = ring.getMemoryUsage();
+
+    //the next snapshot is encoded relative to the remaining one
+    push(ring, 3);
+    ASSERT_EQ(2, ring.getNumSnapshots());
+    EXPECT_TRUE(ring.testOnly_isDeltaEncoded(1));
+    EXPECT_GT(ring.getMemoryUsage(), memoryUsage);
+    checkSnapshot(3, ring.pop());
+    checkSnapshot(1, ring.pop());
+    EXPECT_EQ(0, ring.getMemoryUsage());
+}
+
+TEST_F(SnapshotRingTests, clearResetsDeltaBase)
+{
+    SnapshotRing ring(SnapshotRingParameters().deltaEncoding(true));
+    push(ring, 1);
+    push(ring, 2);
+    EXPECT_TRUE(ring.testOnly_hasDeltaBase());
+
+    ring.clear();
+    EXPECT_TRUE(ring.isEmpty());
+    EXPECT_EQ(0, ring.getMemoryUsage());
+    EXPECT_FALSE(ring.testOnly_hasDeltaBase());
+
+    push(ring, 3);
+    ASSERT_EQ(1, ring.getNumSnapshots());
+    EXPECT_FALSE(ring.testOnly_isDeltaEncoded(0));
+    checkSnapshot(3, ring.getNewest());
+}
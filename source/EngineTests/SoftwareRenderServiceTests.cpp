@@ -0,0 +1,174 @@
+#include "EngineInterface/SoftwareRenderService.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/SimulationFacade.h"
+
+#include "IntegrationTestFramework.h"
+
+class SoftwareRenderServiceTests : public ::testing::Test
+{
+public:
+    SoftwareRenderServiceTests() = default;
+    ~SoftwareRenderServiceTests() = default;
+
+protected:
+    uint64_t getPixel(std::vector<uint64_t> const& image, IntVector2D const& imageSize, int x, int y) const { return image.at(x + y * imageSize.x); }
+
+    uint64_t getBackgroundPixel(SimulationParameters const& parameters) const
+    {
+        auto channel = [&](int shift) { return static_cast<uint64_t>(toFloat((parameters.backgroundColor >> shift) & 0xff) / 255 * 225.0f); };
+        return channel(0) | channel(8) << 16 | channel(16) << 32;
+    }
+};
+
+TEST_F(SoftwareRenderServiceTests, emptyWorld)
+{
+    SimulationParameters parameters;
+    IntVector2D imageSize{60, 40};
+
+    auto image = SoftwareRenderService::get().renderAccumulationImage(
+        DataDescription(), {100, 100}, parameters, SoftwareRenderService::RenderParameters().imageSize(imageSize).rectUpperLeft({-10.0f, 0}));
+
+    ASSERT_EQ(imageSize.x * imageSize.y, image.size());
+    for (int y = 0; y < imageSize.y; ++y) {
+        for (int x = 0; x < imageSize.x; ++x) {
+            auto expectedPixel = x < 10 ? 0 : getBackgroundPixel(parameters);  //black outside of the world
+            EXPECT_EQ(expectedPixel, getPixel(image, imageSize, x, y));
+        }
+    }
+}
+
+TEST_F(SoftwareRenderServiceTests, cell)
+{
+    SimulationParameters parameters;
+    IntVector2D imageSize{100, 100};
+    auto data = DataDescription().addCell(CellDescription().setId(1).setPos({10.0f, 10.0f}).setEnergy(100.0f));
+
+    auto image = SoftwareRenderService::get().renderAccumulationImage(
+        data, {100, 100}, parameters, SoftwareRenderService::RenderParameters().imageSize(imageSize).zoom(4.0f));
+
+    auto backgroundPixel = getBackgroundPixel(parameters);
+    EXPECT_NE(backgroundPixel, getPixel(image, imageSize, 40, 40));
+    EXPECT_NE(backgroundPixel, getPixel(image, imageSize, 41, 40));
+    EXPECT_EQ(backgroundPixel, getPixel(image, imageSize, 50, 40));
+    EXPECT_EQ(backgroundPixel, getPixel(image, imageSize, 40, 30));
+}
+
+TEST_F(SoftwareRenderServiceTests, independentOfThreadsAndTiles)
+{
+    SimulationParameters parameters;
+    parameters.features.cellGlow = true;
+    parameters.gridLines = true;
+    parameters.numZones = 1;
+    parameters.zone[0].posX = 30.0f;
+    parameters.zone[0].posY = 30.0f;
+    parameters.zone[0].color = 0x204060;
+    parameters.zone[0].shapeData.circularSpot.coreRadius = 10.0f;
+    parameters.zone[0].fadeoutRadius = 10.0f;
+
+    auto data = DescriptionEditService::get().createHex(DescriptionEditService::CreateHexParameters().layers(5).center({25.0f, 25.0f}));
+    data.addParticle(ParticleDescription().setId(1000).setPos({5.0f, 40.0f}).setEnergy(50.0f));
+
+    auto renderParameters = SoftwareRenderService::RenderParameters().imageSize({200, 150}).zoom(5.0f).rectUpperLeft({5.0f, 10.0f});
+    auto referenceImage = SoftwareRenderService::get().renderAccumulationImage(
+        data, {100, 100}, parameters, SoftwareRenderService::RenderParameters(renderParameters).maxThreads(1).tileHeight(150));
+
+    for (auto const& [maxThreads, tileHeight] : std::vector<std::pair<int, int>>{{1, 1}, {2, 7}, {4, 32}, {8, 16}}) {
+        auto image = SoftwareRenderService::get().renderAccumulationImage(
+            data, {100, 100}, parameters, SoftwareRenderService::RenderParameters(renderParameters).maxThreads(maxThreads).tileHeight(tileHeight));
+        EXPECT_EQ(referenceImage, image);
+    }
+}
+
+TEST_F(SoftwareRenderServiceTests, borderlessRendering)
+{
+    SimulationParameters parameters;
+    parameters.borderlessRendering = true;
+    IntVector2D imageSize{50, 30};
+    auto data = DataDescription().addCell(CellDescription().setId(1).setPos({10.0f, 10.0f}));
+
+    auto image = SoftwareRenderService::get().renderAccumulationImage(
+        data, {20, 20}, parameters, SoftwareRenderService::RenderParameters().imageSize(imageSize).zoom(1.0f));
+
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < 20; ++x) {
+            EXPECT_EQ(getPixel(image, imageSize, x, y), getPixel(image, imageSize, x + 20, y));
+        }
+    }
+}
+
+TEST_F(SoftwareRenderServiceTests, convertToRgb)
+{
+    IntVector2D imageSize{2, 2};
+    std::vector<uint64_t> image{0, 0xffffull | 0xffffull << 16 | 0xffffull << 32, 0, 0};
+
+    auto rgbImage = SoftwareRenderService::get().convertToRgb(image, imageSize, SoftwareRenderService::ToneMappingParameters());
+
+    ASSERT_EQ(12, rgbImage.size());
+    EXPECT_EQ(255, rgbImage[3]);
+    EXPECT_EQ(255, rgbImage[4]);
+    EXPECT_EQ(255, rgbImage[5]);
+    EXPECT_EQ(0, rgbImage[6]);
+    EXPECT_EQ(0, rgbImage[9]);
+}
+
+//compares the software renderer with the rendering kernels on a small scene
+class SoftwareRenderServiceGpuTests : public IntegrationTestFramework
+{
+public:
+    SoftwareRenderServiceGpuTests()
+        : IntegrationTestFramework(std::nullopt, {100, 100})
+    {}
+
+    ~SoftwareRenderServiceGpuTests() = default;
+};
+
+TEST_F(SoftwareRenderServiceGpuTests, matchesRenderingKernels)
+{
+    auto data = DescriptionEditService::get().createHex(DescriptionEditService::CreateHexParameters().layers(4).center({30.0f, 25.0f}).color(2));
+    data.addParticle(ParticleDescription().setId(1000).setPos({10.0f, 40.0f}).setEnergy(50.0f));
+    data.addParticle(ParticleDescription().setId(1001).setPos({60.0f, 12.0f}).setEnergy(20.0f));
+    _simulationFacade->setSimulationData(data);
+
+    IntVector2D imageSize{200, 150};
+    RealVector2D rectUpperLeft{5.0f, 10.0f};
+    auto zoom = 4.0f;
+    RealVector2D rectLowerRight{rectUpperLeft.x + toFloat(imageSize.x) / zoom, rectUpperLeft.y + toFloat(imageSize.y) / zoom};
+
+    auto gpuImage = _simulationFacade->testOnly_drawImage(rectUpperLeft, rectLowerRight, imageSize, zoom);
+    auto softwareImage = SoftwareRenderService::get().renderAccumulationImage(
+        _simulationFacade->getSimulationData(),
+        {100, 100},
+        _parameters,
+        SoftwareRenderService::RenderParameters()
+            .imageSize(imageSize)
+            .zoom(zoom)
+            .rectUpperLeft(rectUpperLeft)
+            .timestep(_simulationFacade->getCurrentTimestep()));
+    ASSERT_EQ(gpuImage.size(), softwareImage.size());
+
+    //the order of the atomic accumulation and float rounding at primitive edges may differ slightly
+    auto numDrawnPixels = 0;
+    auto numDeviatingPixels = 0;
+    auto backgroundPixel = softwareImage.front();
+    for (size_t i = 0; i < softwareImage.size(); ++i) {
+        if (softwareImage[i] != backgroundPixel) {
+            ++numDrawnPixels;
+        }
+        for (int shift = 0; shift <= 32; shift += 16) {
+            auto gpuChannel = toInt((gpuImage[i] >> shift) & 0xffff);
+            auto softwareChannel = toInt((softwareImage[i] >> shift) & 0xffff);
+            if (std::abs(gpuChannel - softwareChannel) > 8 + std::max(gpuChannel, softwareChannel) / 10) {
+                ++numDeviatingPixels;
+                break;
+            }
+        }
+    }
+    EXPECT_GT(numDrawnPixels, 100);
+    EXPECT_LE(numDeviatingPixels, numDrawnPixels / 50);
+}
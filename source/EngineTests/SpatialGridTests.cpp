@@ -0,0 +1,133 @@
+#include "EngineInterface/SpatialGrid.h"
+
+#include <algorithm>
+#include <random>
+#include <gtest/gtest.h>
+
+#include "Base/Math.h"
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/SpaceCalculator.h"
+
+class SpatialGridTests : public ::testing::Test
+{
+public:
+    SpatialGridTests() = default;
+    ~SpatialGridTests() = default;
+
+protected:
+    std::vector<RealVector2D> createRandomPositions(int number, RealVector2D const& lowerBound, RealVector2D const& upperBound)
+    {
+        std::uniform_real_distribution<float> distributionX(lowerBound.x, upperBound.x);
+        std::uniform_real_distribution<float> distributionY(lowerBound.y, upperBound.y);
+        std::vector<RealVector2D> result;
+        for (int i = 0; i < number; ++i) {
+            result.emplace_back(distributionX(_gen), distributionY(_gen));
+        }
+        return result;
+    }
+
+    std::vector<int> getSorted(std::vector<int> indices) const
+    {
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    std::mt19937 _gen{0};
+};
+
+TEST_F(SpatialGridTests, unbounded_matchesBruteForce)
+{
+    auto positions = createRandomPositions(2000, {-50.0f, -20.0f}, {70.0f, 40.0f});
+    SpatialGrid grid(1.5f);
+    grid.build(positions);
+
+    for (auto const& queryPos : createRandomPositions(200, {-60.0f, -30.0f}, {80.0f, 50.0f})) {
+        std::vector<int> expected;
+        for (int i = 0; i < toInt(positions.size()); ++i) {
+            if (Math::length(positions[i] - queryPos) <= 3.0f) {
+                expected.emplace_back(i);
+            }
+        }
+        EXPECT_EQ(expected, getSorted(grid.getIndicesWithinRadius(queryPos, 3.0f)));
+    }
+}
+
+TEST_F(SpatialGridTests, toroidal_matchesBruteForce)
+{
+    IntVector2D worldSize{100, 60};
+    SpaceCalculator spaceCalculator(worldSize);
+    auto positions = createRandomPositions(3000, {0, 0}, {100.0f, 60.0f});
+    SpatialGrid grid(worldSize, 2.0f);
+    grid.build(positions);
+
+    for (auto const& queryPos : createRandomPositions(200, {-10.0f, -10.0f}, {110.0f, 70.0f})) {
+        std::vector<int> expected;
+        for (int i = 0; i < toInt(positions.size()); ++i) {
+            if (spaceCalculator.distance(positions[i], queryPos) <= 4.0f) {
+                expected.emplace_back(i);
+            }
+        }
+        EXPECT_EQ(expected, getSorted(grid.getIndicesWithinRadius(queryPos, 4.0f)));
+    }
+}
+
+TEST_F(SpatialGridTests, toroidal_wrapAround)
+{
+    SpatialGrid grid({100, 100}, 1.0f);
+    grid.insert({99.5f, 99.5f});
+
+    EXPECT_TRUE(grid.isOccupied({0.2f, 0.2f}, 1.0f));
+    EXPECT_FALSE(grid.isOccupied({1.0f, 1.0f}, 1.0f));
+    EXPECT_TRUE(grid.isOccupied({-0.3f, 100.2f}, 1.0f));
+}
+
+TEST_F(SpatialGridTests, insert_matchesBuild)
+{
+    IntVector2D worldSize{200, 200};
+    auto positions = createRandomPositions(5000, {0, 0}, {200.0f, 200.0f});
+
+    SpatialGrid builtGrid(worldSize);
+    builtGrid.build(positions);
+    SpatialGrid insertedGrid(worldSize);
+    for (auto const& pos : positions) {
+        insertedGrid.insert(pos);
+    }
+
+    ASSERT_EQ(builtGrid.getNumEntries(), insertedGrid.getNumEntries());
+    for (auto const& queryPos : createRandomPositions(200, {0, 0}, {200.0f, 200.0f})) {
+        EXPECT_EQ(getSorted(builtGrid.getIndicesWithinRadius(queryPos, 5.0f)), getSorted(insertedGrid.getIndicesWithinRadius(queryPos, 5.0f)));
+    }
+}
+
+TEST_F(SpatialGridTests, isOccupied_strictDistance)
+{
+    SpatialGrid grid(1.0f);
+    grid.build({{0, 0}});
+
+    EXPECT_FALSE(grid.isOccupied({2.0f, 0}, 2.0f));
+    EXPECT_TRUE(grid.isOccupied({1.9f, 0}, 2.0f));
+    EXPECT_EQ(1, grid.getIndicesWithinRadius({2.0f, 0}, 2.0f).size());
+}
+
+TEST_F(SpatialGridTests, empty)
+{
+    SpatialGrid grid;
+    EXPECT_FALSE(grid.isOccupied({0, 0}, 10.0f));
+    EXPECT_TRUE(grid.getIndicesWithinRadius({0, 0}, 10.0f).empty());
+
+    grid.insert({1.0f, 1.0f});
+    grid.clear();
+    EXPECT_EQ(0, grid.getNumEntries());
+    EXPECT_FALSE(grid.isOccupied({1.0f, 1.0f}, 10.0f));
+}
+
+TEST_F(SpatialGridTests, reconnectCells_rect)
+{
+    auto data = DescriptionEditService::get().createRect(DescriptionEditService::CreateRectParameters().width(10).height(10));
+
+    int numConnections = 0;
+    for (auto const& cell : data.cells) {
+        numConnections += toInt(cell.connections.size());
+    }
+    EXPECT_EQ(2 * (9 * 10 + 10 * 9), numConnections);
+}
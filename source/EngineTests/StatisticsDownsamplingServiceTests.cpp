@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/StatisticsDownsamplingService.h"
+
+class StatisticsDownsamplingServiceTests : public ::testing::Test
+{
+public:
+    StatisticsDownsamplingServiceTests() = default;
+    ~StatisticsDownsamplingServiceTests() = default;
+
+protected:
+    void createSeries(int count)
+    {
+        _timePoints.clear();
+        _values.clear();
+        for (int i = 0; i < count; ++i) {
+            _timePoints.emplace_back(0.05 * i);
+            _values.emplace_back(std::sin(0.01 * i) * 100 + ((i * 7919) % 13));
+        }
+    }
+
+    std::vector<double> _timePoints;
+    std::vector<double> _values;
+};
+
+TEST_F(StatisticsDownsamplingServiceTests, smallSeries)
+{
+    createSeries(30);
+    auto indices = StatisticsDownsamplingService::get().calcMinMaxIndices(_timePoints.data(), _values.data(), 30, 10);
+    ASSERT_EQ(30, indices.size());
+    for (int i = 0; i < 30; ++i) {
+        EXPECT_EQ(i, indices.at(i));
+    }
+    EXPECT_TRUE(StatisticsDownsamplingService::get().calcMinMaxIndices(_timePoints.data(), _values.data(), 0, 10).empty());
+}
+
+TEST_F(StatisticsDownsamplingServiceTests, minMaxPreserved)
+{
+    auto constexpr Count = 10000;
+    auto constexpr NumBuckets = 100;
+    createSeries(Count);
+
+    auto indices = StatisticsDownsamplingService::get().calcMinMaxIndices(_timePoints.data(), _values.data(), Count, NumBuckets);
+    EXPECT_TRUE(indices.size() <= 4 * NumBuckets);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_EQ(std::adjacent_find(indices.begin(), indices.end()), indices.end());
+    EXPECT_EQ(0, indices.front());
+    EXPECT_EQ(Count - 1, indices.back());
+
+    //compare the value range per pixel column with the raw series
+    auto timeRange = _timePoints.back() - _timePoints.front();
+    auto getBucket = [&](int index) { return std::min(NumBuckets - 1, static_cast<int>(NumBuckets * (_timePoints.at(index) - _timePoints.front()) / timeRange)); };
+    std::vector<double> rawMin(NumBuckets, 1e10), rawMax(NumBuckets, -1e10), sampledMin(NumBuckets, 1e10), sampledMax(NumBuckets, -1e10);
+    for (int i = 0; i < Count; ++i) {
+        rawMin.at(getBucket(i)) = std::min(rawMin.at(getBucket(i)), _values.at(i));
+        rawMax.at(getBucket(i)) = std::max(rawMax.at(getBucket(i)), _values.at(i));
+    }
+    for (auto index : indices) {
+        sampledMin.at(getBucket(index)) = std::min(sampledMin.at(getBucket(index)), _values.at(index));
+        sampledMax.at(getBucket(index)) = std::max(sampledMax.at(getBucket(index)), _values.at(index));
+    }
+    EXPECT_EQ(rawMin, sampledMin);
+    EXPECT_EQ(rawMax, sampledMax);
+}
+
+TEST_F(StatisticsDownsamplingServiceTests, singlePeak)
+{
+    auto constexpr Count = 5000;
+    _timePoints.clear();
+    _values.assign(Count, 1.0);
+    for (int i = 0; i < Count; ++i) {
+        _timePoints.emplace_back(i);
+    }
+    _values.at(2345) = 1000.0;
+
+    auto indices = StatisticsDownsamplingService::get().calcMinMaxIndices(_timePoints.data(), _values.data(), Count, 50);
+    EXPECT_NE(std::find(indices.begin(), indices.end(), 2345), indices.end());
+}
+
+TEST_F(StatisticsDownsamplingServiceTests, constantTime)
+{
+    auto constexpr Count = 1000;
+    _timePoints.assign(Count, 3.0);
+    _values.assign(Count, 0.0);
+    _values.at(10) = -1.0;
+    _values.at(20) = 1.0;
+
+    auto indices = StatisticsDownsamplingService::get().calcMinMaxIndices(_timePoints.data(), _values.data(), Count, 50);
+    EXPECT_EQ((std::vector<int>{0, 10, 20, Count - 1}), indices);
+}
@@ -0,0 +1,145 @@
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "PersisterInterface/SweepSpecification.h"
+
+class SweepSpecificationParserTests : public ::testing::Test
+{
+public:
+    SweepSpecificationParserTests()
+    {
+        auto testName = std::string(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        _directory = std::filesystem::temp_directory_path() / ("sweepSpecificationParserTests_" + testName);
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+    ~SweepSpecificationParserTests() { std::filesystem::remove_all(_directory); }
+
+protected:
+    SweepSpecification parse(std::string const& json) const
+    {
+        auto filename = _directory / "sweep.json";
+        std::ofstream(filename, std::ios::binary) << json;
+        return SweepSpecificationParser::parse(filename);
+    }
+
+    std::filesystem::path _directory;
+};
+
+TEST_F(SweepSpecificationParserTests, parse)
+{
+    auto specification = parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": 1000, "snapshot interval": 100, "repetitions": 2,
+        "parameters": [
+            {"node": "simulation parameters.friction", "from": 0.001, "to": 0.003, "steps": 3},
+            {"node": "simulation parameters.cell.min energy[0]", "values": [40, 50]}]})");
+
+    EXPECT_EQ("base.sim", specification.input.string());
+    EXPECT_EQ("sweep", specification.outputDirectory.string());
+    EXPECT_EQ(1000, specification.timesteps);
+    EXPECT_EQ(100, specification.snapshotInterval);
+    EXPECT_EQ(1000, specification.statisticsInterval);
+    EXPECT_EQ(2, specification.repetitions);
+    ASSERT_EQ(2, specification.parameterRanges.size());
+    EXPECT_EQ("simulation parameters.friction", specification.parameterRanges[0].node);
+    EXPECT_EQ((std::vector<std::string>{"0.001", "0.002", "0.003"}), specification.parameterRanges[0].values);
+    EXPECT_EQ((std::vector<std::string>{"40", "50"}), specification.parameterRanges[1].values);
+}
+
+TEST_F(SweepSpecificationParserTests, parse_missingKey)
+{
+    EXPECT_THROW(parse(R"({"input": "base.sim", "output directory": "sweep"})"), std::runtime_error);
+    EXPECT_THROW(
+        parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": 1000, "parameters": [{"values": [1, 2]}]})"), std::runtime_error);
+}
+
+TEST_F(SweepSpecificationParserTests, parse_wrongType)
+{
+    EXPECT_THROW(parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": "many"})"), std::runtime_error);
+    EXPECT_THROW(
+        parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": 1000,
+            "parameters": [{"node": "simulation parameters.friction", "from": "low", "to": 0.003, "steps": 3}]})"),
+        std::runtime_error);
+}
+
+TEST_F(SweepSpecificationParserTests, parse_emptyRange)
+{
+    EXPECT_THROW(
+        parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": 1000,
+            "parameters": [{"node": "simulation parameters.friction", "values": []}]})"),
+        std::runtime_error);
+    EXPECT_THROW(
+        parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": 1000,
+            "parameters": [{"node": "simulation parameters.friction", "from": 0.001, "to": 0.003, "steps": 0}]})"),
+        std::runtime_error);
+    EXPECT_THROW(parse(R"({"input": "base.sim", "output directory": "sweep", "time steps": 1000, "repetitions": 0})"), std::runtime_error);
+}
+
+TEST_F(SweepSpecificationParserTests, createJobs_cartesianProduct)
+{
+    SweepSpecification specification;
+    specification.repetitions = 2;
+    specification.parameterRanges = {{"a", {"1", "2", "3"}}, {"b", {"x", "y"}}};
+
+    auto jobs = SweepSpecificationParser::createJobs(specification);
+
+    ASSERT_EQ(12, jobs.size());
+    std::set<std::string> names;
+    std::set<std::tuple<std::string, std::string, int>> combinations;
+    for (auto const& job : jobs) {
+        names.insert(job.name);
+        ASSERT_EQ(2, job.parameterValues.size());
+        EXPECT_EQ("a", job.parameterValues[0].first);
+        EXPECT_EQ("b", job.parameterValues[1].first);
+        combinations.insert({job.parameterValues[0].second, job.parameterValues[1].second, job.repetition});
+    }
+    EXPECT_EQ(12, names.size());
+    EXPECT_EQ(12, combinations.size());
+    EXPECT_EQ("run_0000", jobs.front().name);
+    EXPECT_EQ("run_0011", jobs.back().name);
+
+    //repetitions of the same parameter combination are adjacent
+    EXPECT_EQ(jobs[0].parameterValues, jobs[1].parameterValues);
+    EXPECT_EQ(0, jobs[0].repetition);
+    EXPECT_EQ(1, jobs[1].repetition);
+}
+
+TEST_F(SweepSpecificationParserTests, createJobs_withoutParameterRanges)
+{
+    SweepSpecification specification;
+    specification.repetitions = 3;
+
+    auto jobs = SweepSpecificationParser::createJobs(specification);
+
+    ASSERT_EQ(3, jobs.size());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(i, jobs[i].repetition);
+        EXPECT_TRUE(jobs[i].parameterValues.empty());
+    }
+}
+
+TEST_F(SweepSpecificationParserTests, applyParameterValues)
+{
+    SweepJob job{"run_0000", 0, {{"simulation parameters.friction", "0.002"}, {"simulation parameters.cell.min energy[0]", "45"}}};
+
+    auto parameters = SweepSpecificationParser::applyParameterValues(SimulationParameters(), job);
+
+    EXPECT_FLOAT_EQ(0.002f, parameters.baseValues.friction);
+    EXPECT_FLOAT_EQ(45.0f, parameters.baseValues.cellMinEnergy[0]);
+    EXPECT_FLOAT_EQ(SimulationParameters().baseValues.cellMinEnergy[1], parameters.baseValues.cellMinEnergy[1]);
+}
+
+TEST_F(SweepSpecificationParserTests, applyParameterValues_unknownNode)
+{
+    SweepJob job{"run_0000", 0, {{"simulation parameters.nonexisting", "1"}}};
+    EXPECT_THROW(SweepSpecificationParser::applyParameterValues(SimulationParameters(), job), std::runtime_error);
+}
+
+TEST_F(SweepSpecificationParserTests, applyParameterValues_wrongType)
+{
+    SweepJob job{"run_0000", 0, {{"simulation parameters.friction", "high"}}};
+    EXPECT_THROW(SweepSpecificationParser::applyParameterValues(SimulationParameters(), job), std::runtime_error);
+}
@@ -260,6 +260,9 @@ void AutosaveWindow::processSettings()
                         .values({
                             "None",
                             "Genome complexity variance",
+                            "Average genome complexity",
+                            "Max genome complexity of colonies",
+                            "Self-replicators",
                         })
                         .tooltip("If activated, the simulation is monitored continuously. When the autosave interval expires, the time at which the selected "
                                  "measured value was particularly high is saved."),
@@ -398,7 +401,8 @@ void AutosaveWindow::processAutomaticSavepoints()
                         GetPeakSimulationRequestData{
                             .peakDeserializedSimulation = _peakDeserializedSimulation,
                             .zoom = Viewport::get().getZoomFactor(),
-                            .center = Viewport::get().getCenterInWorldPos()});
+                            .center = Viewport::get().getCenterInWorldPos(),
+                            .criterion = _catchPeaks - CatchPeaks_Variance + PeakCriterion_GenomeComplexityVariance});
                 },
                 [&](auto const& requestId) {},
                 [](auto const& errors) { GenericMessageDialog::get().information("Error", errors); });
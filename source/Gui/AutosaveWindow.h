@@ -79,7 +79,10 @@ private:
     enum CatchPeaks_
     {
         CatchPeaks_None,
-        CatchPeaks_Variance
+        CatchPeaks_Variance,
+        CatchPeaks_AverageGenomeComplexity,
+        CatchPeaks_MaxGenomeComplexityOfColonies,
+        CatchPeaks_NumSelfReplicators
     };
     CatchPeaks _origCatchPeaks = CatchPeaks_None;
     CatchPeaks _catchPeaks = _origCatchPeaks;
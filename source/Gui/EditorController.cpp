@@ -199,29 +199,29 @@ void EditorController::processInspectorWindows()
 
     //inspector windows closed?
     std::vector<InspectorWindow> inspectorWindows;
-    std::vector<CellOrParticleDescription> inspectedEntities;
+    std::vector<uint64_t> entityIds;
+    InspectedPayloads payloads{false, false, false};
     for (auto const& inspectorWindow : _inspectorWindows) {
         if (!inspectorWindow->isClosed()) {
             inspectorWindows.emplace_back(inspectorWindow);
+            entityIds.emplace_back(inspectorWindow->getId());
 
-            auto id = inspectorWindow->getId();
-            inspectedEntities.emplace_back(EditorModel::get().getInspectedEntity(id));
+            auto requiredPayloads = inspectorWindow->getRequiredPayloads();
+            payloads.neuronData |= requiredPayloads.neuronData;
+            payloads.genomeData |= requiredPayloads.genomeData;
+            payloads.metadata |= requiredPayloads.metadata;
         }
     }
     _inspectorWindows = inspectorWindows;
-    EditorModel::get().setInspectedEntities(inspectedEntities);
 
-    //update inspected entities from simulation
-    if (inspectedEntities.empty()) {
+    //update inspected entities from simulation (genomes, neural networks and annotations only for open tabs)
+    if (entityIds.empty()) {
+        EditorModel::get().setInspectedEntities({});
         return;
     }
-    std::vector<uint64_t> entityIds;
-    for (auto const& entity : inspectedEntities) {
-        entityIds.emplace_back(DescriptionEditService::get().getId(entity));
-    }
-    auto inspectedData = _simulationFacade->getInspectedSimulationData(entityIds);
+    auto inspectedData = _simulationFacade->getInspectedSimulationData(entityIds, payloads);
     auto newInspectedEntities = DescriptionEditService::get().getObjects(inspectedData);
-    EditorModel::get().setInspectedEntities(newInspectedEntities);
+    EditorModel::get().setInspectedEntities(newInspectedEntities, payloads);
 
     inspectorWindows.clear();
     for (auto const& inspectorWindow : _inspectorWindows) {
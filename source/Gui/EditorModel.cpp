@@ -41,21 +41,31 @@ bool EditorModel::existsInspectedEntity(uint64_t id) const
     return _inspectedEntityById.find(id) != _inspectedEntityById.end();
 }
 
-CellOrParticleDescription EditorModel::getInspectedEntity(uint64_t id) const
+CellOrParticleDescription const& EditorModel::getInspectedEntity(uint64_t id) const
 {
     return _inspectedEntityById.at(id);
 }
 
+InspectedPayloads EditorModel::getInspectedPayloads(uint64_t id) const
+{
+    return _inspectedPayloadsById.at(id);
+}
+
 void EditorModel::addInspectedEntity(CellOrParticleDescription const& entity)
 {
-    _inspectedEntityById.emplace(DescriptionEditService::get().getId(entity), entity);
+    auto id = DescriptionEditService::get().getId(entity);
+    _inspectedEntityById.emplace(id, entity);
+    _inspectedPayloadsById.emplace(id, InspectedPayloads());
 }
 
-void EditorModel::setInspectedEntities(std::vector<CellOrParticleDescription> const& inspectedEntities)
+void EditorModel::setInspectedEntities(std::vector<CellOrParticleDescription> const& inspectedEntities, InspectedPayloads const& payloads)
 {
     _inspectedEntityById.clear();
+    _inspectedPayloadsById.clear();
     for (auto const& entity : inspectedEntities) {
-        _inspectedEntityById.emplace(DescriptionEditService::get().getId(entity), entity);
+        auto id = DescriptionEditService::get().getId(entity);
+        _inspectedEntityById.emplace(id, entity);
+        _inspectedPayloadsById.emplace(id, payloads);
     }
 }
 
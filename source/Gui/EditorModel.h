@@ -3,6 +3,7 @@
 #include "Base/Definitions.h"
 #include "Base/Singleton.h"
 #include "EngineInterface/Definitions.h"
+#include "EngineInterface/InspectedEntityIds.h"
 #include "EngineInterface/SelectionShallowData.h"
 
 #include "Definitions.h"
@@ -23,9 +24,10 @@ public:
     void clear();
 
     bool existsInspectedEntity(uint64_t id) const;
-    CellOrParticleDescription getInspectedEntity(uint64_t id) const;
+    CellOrParticleDescription const& getInspectedEntity(uint64_t id) const;
+    InspectedPayloads getInspectedPayloads(uint64_t id) const;  //payloads which are contained in the inspected entity
     void addInspectedEntity(CellOrParticleDescription const& entity);
-    void setInspectedEntities(std::vector<CellOrParticleDescription> const& inspectedEntities);
+    void setInspectedEntities(std::vector<CellOrParticleDescription> const& inspectedEntities, InspectedPayloads const& payloads = InspectedPayloads());
     bool areEntitiesInspected() const;
 
     void setPencilWidth(float value);
@@ -44,6 +46,7 @@ private:
     SelectionShallowData _selectionShallowData;
 
     std::unordered_map<uint64_t, CellOrParticleDescription> _inspectedEntityById;
+    std::unordered_map<uint64_t, InspectedPayloads> _inspectedPayloadsById;
 
     float _pencilWidth = 3.0f;
     int _defaultColorCode = 0;
@@ -20,6 +20,8 @@ void GpuSettingsDialog::initIntern(SimulationFacade simulationFacade)
 
     GpuSettings gpuSettings;
     gpuSettings.numBlocks = GlobalSettings::get().getValue("settings.gpu.num blocks", gpuSettings.numBlocks);
+    gpuSettings.deterministicRandomNumbers = GlobalSettings::get().getValue("settings.gpu.deterministic random numbers", gpuSettings.deterministicRandomNumbers);
+    gpuSettings.randomSeed = static_cast<uint32_t>(GlobalSettings::get().getValue("settings.gpu.random seed", static_cast<int>(gpuSettings.randomSeed)));
 
     _simulationFacade->setGpuSettings_async(gpuSettings);
 }
@@ -28,6 +30,8 @@ void GpuSettingsDialog::shutdownIntern()
 {
     auto gpuSettings = _simulationFacade->getGpuSettings();
     GlobalSettings::get().setValue("settings.gpu.num blocks", gpuSettings.numBlocks);
+    GlobalSettings::get().setValue("settings.gpu.deterministic random numbers", gpuSettings.deterministicRandomNumbers);
+    GlobalSettings::get().setValue("settings.gpu.random seed", static_cast<int>(gpuSettings.randomSeed));
 }
 
 GpuSettingsDialog::GpuSettingsDialog()
@@ -49,6 +53,18 @@ void GpuSettingsDialog::processIntern()
                      "blocks."),
         gpuSettings.numBlocks);
 
+    auto randomSeed = static_cast<int>(gpuSettings.randomSeed);
+    AlienImGui::InputInt(
+        AlienImGui::InputIntParameters()
+            .name("Random seed")
+            .textWidth(RightColumnWidth)
+            .tooltip("If enabled, each CUDA thread draws its random numbers from its own stream derived from the seed instead of a shared pool. This makes "
+                     "runs with the same input and settings reproducible as far as the random numbers are concerned. Takes effect for the next simulation "
+                     "that is created or loaded."),
+        randomSeed,
+        &gpuSettings.deterministicRandomNumbers);
+    gpuSettings.randomSeed = static_cast<uint32_t>(randomSeed);
+
     ImGui::Dummy({0, ImGui::GetContentRegionAvail().y - scale(50.0f)});
     AlienImGui::Separator();
 
@@ -12,18 +12,32 @@ _GuiLogger::~_GuiLogger()
     LoggingService::get().unregisterCallBack(this);
 }
 
-std::vector<std::string> const& _GuiLogger::getMessages(Priority minPriority) const
+uint64_t _GuiLogger::getVersion() const
 {
-    if (Priority::Important == minPriority) {
-        return _importantLogMessages;
-    }
-    return _allLogMessages;
+    return _version.load();
+}
+
+std::vector<std::string> _GuiLogger::getMessages(Priority minPriority) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const& messages = Priority::Important == minPriority ? _importantLogMessages : _allLogMessages;
+    return std::vector<std::string>(messages.begin(), messages.end());
 }
 
 void _GuiLogger::newLogMessage(Priority priority, std::string const& message)
 {
-    _allLogMessages.emplace_back(message);
-    if (Priority::Important == priority) {
-        _importantLogMessages.emplace_back(message);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _allLogMessages.emplace_back(message);
+        if (_allLogMessages.size() > MaxMessages) {
+            _allLogMessages.pop_front();
+        }
+        if (Priority::Important == priority) {
+            _importantLogMessages.emplace_back(message);
+            if (_importantLogMessages.size() > MaxMessages) {
+                _importantLogMessages.pop_front();
+            }
+        }
     }
+    ++_version;
 }
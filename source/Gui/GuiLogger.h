@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <mutex>
+
 #include "Base/LoggingService.h"
 #include "Definitions.h"
 
@@ -9,12 +13,18 @@ public:
     _GuiLogger();
     ~_GuiLogger() override;
 
-    std::vector<std::string> const& getMessages(Priority minPriority) const;
+    static auto constexpr MaxMessages = 10000;  //older messages are discarded
+
+    //messages are added by the logging thread, the version is increased on each new message such that callers can skip unchanged copies
+    uint64_t getVersion() const;
+    std::vector<std::string> getMessages(Priority minPriority) const;
 
 private:
 
     void newLogMessage(Priority priority, std::string const& message) override;
 
-    std::vector<std::string> _allLogMessages;
-    std::vector<std::string> _importantLogMessages;
+    std::atomic<uint64_t> _version = 0;
+    mutable std::mutex _mutex;
+    std::deque<std::string> _allLogMessages;
+    std::deque<std::string> _importantLogMessages;
 };
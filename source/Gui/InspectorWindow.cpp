@@ -52,6 +52,8 @@ void _InspectorWindow::process()
     if (!_on) {
         return;
     }
+    _requiredPayloads = InspectedPayloads{.neuronData = false, .genomeData = _selectGenomeTab, .metadata = false};
+
     auto width = calcWindowWidth();
     auto height = isCell() ? StyleRepository::get().scale(370.0f)
                            : StyleRepository::get().scale(70.0f);
@@ -59,7 +61,7 @@ void _InspectorWindow::process()
     ImGui::SetNextWindowBgAlpha(Const::WindowAlpha * ImGui::GetStyle().Alpha);
     ImGui::SetNextWindowSize({width, height}, ImGuiCond_Appearing);
     ImGui::SetNextWindowPos({_initialPos.x, _initialPos.y}, ImGuiCond_Appearing);
-    auto entity = EditorModel::get().getInspectedEntity(_entityId);
+    auto const& entity = EditorModel::get().getInspectedEntity(_entityId);
     if (ImGui::Begin(generateTitle().c_str(), &_on, ImGuiWindowFlags_HorizontalScrollbar)) {
         auto windowPos = ImGui::GetWindowPos();
         if (isCell()) {
@@ -103,9 +105,14 @@ uint64_t _InspectorWindow::getId() const
     return _entityId;
 }
 
+InspectedPayloads _InspectorWindow::getRequiredPayloads() const
+{
+    return _requiredPayloads;
+}
+
 bool _InspectorWindow::isCell() const
 {
-    auto entity = EditorModel::get().getInspectedEntity(_entityId);
+    auto const& entity = EditorModel::get().getInspectedEntity(_entityId);
     return std::holds_alternative<CellDescription>(entity);
 }
 
@@ -123,6 +130,7 @@ std::string _InspectorWindow::generateTitle() const
 
 void _InspectorWindow::processCell(CellDescription cell)
 {
+    _fetchedPayloads = EditorModel::get().getInspectedPayloads(_entityId);
     if (ImGui::BeginTabBar(
             "##CellInspect", /*ImGuiTabBarFlags_AutoSelectNewTabs | */ImGuiTabBarFlags_FittingPolicyResizeDown)) {
         auto origCell = cell;
@@ -140,7 +148,7 @@ void _InspectorWindow::processCell(CellDescription cell)
 
         ImGui::EndTabBar();
 
-        if (cell != origCell) {
+        if (cell != origCell && completeMissingPayloads(cell)) {
             _simulationFacade->changeCell(cell);
         }
     }
@@ -317,6 +325,7 @@ void _InspectorWindow::processCellFunctionPropertiesTab(CellDescription& cell)
         if (ImGui::BeginChild("##", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar)) {
             switch (cell.getCellFunctionType()) {
             case CellFunction_Neuron: {
+                _requiredPayloads.neuronData = true;
                 processNeuronContent(std::get<NeuronDescription>(*cell.cellFunction));
             } break;
             case CellFunction_Transmitter: {
@@ -367,6 +376,11 @@ void _InspectorWindow::processCellGenomeTab(Description& desc)
         _selectGenomeTab = false;
     }
     if (ImGui::BeginTabItem("Genome", nullptr, flags)) {
+        _requiredPayloads.genomeData = true;
+        if (!_fetchedPayloads.genomeData) {
+            ImGui::EndTabItem();
+            return;
+        }
         if (ImGui::BeginChild("##", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar)) {
 
             auto previewNodeResult = ImGui::TreeNodeEx("Preview (reference configuration)", TreeNodeFlags);
@@ -478,6 +492,11 @@ void _InspectorWindow::processCellGenomeTab(Description& desc)
 void _InspectorWindow::processCellMetadataTab(CellDescription& cell)
 {
     if (ImGui::BeginTabItem("Annotation", nullptr, ImGuiTabItemFlags_None)) {
+        _requiredPayloads.metadata = true;
+        if (!_fetchedPayloads.metadata) {
+            ImGui::EndTabItem();
+            return;
+        }
         if (ImGui::BeginChild("##", ImVec2(0, 0), false, 0)) {
             AlienImGui::InputText(AlienImGui::InputTextParameters().hint("Name").textWidth(0), cell.metadata.name);
 
@@ -516,6 +535,9 @@ void _InspectorWindow::processNerveContent(NerveDescription& nerve)
 
 void _InspectorWindow::processNeuronContent(NeuronDescription& neuron)
 {
+    if (!_fetchedPayloads.neuronData) {
+        return;
+    }
     if (ImGui::TreeNodeEx("Neural network", TreeNodeFlags)) {
         AlienImGui::NeuronSelection(
             AlienImGui::NeuronSelectionParameters().rightMargin(0), neuron.weights, neuron.biases, neuron.activationFunctions);
@@ -740,18 +762,20 @@ void _InspectorWindow::validateAndCorrect(CellDescription& cell) const
     switch (cell.getCellFunctionType()) {
     case CellFunction_Constructor: {
         auto& constructor = std::get<ConstructorDescription>(*cell.cellFunction);
-        auto numNodes = GenomeDescriptionService::get().convertNodeAddressToNodeIndex(constructor.genome, toInt(constructor.genome.size()));
-        if (numNodes > 0) {
-            constructor.genomeCurrentNodeIndex = ((constructor.genomeCurrentNodeIndex % numNodes) + numNodes) % numNodes;
-        } else {
-            constructor.genomeCurrentNodeIndex = 0;
-        }
+        if (_fetchedPayloads.genomeData) {
+            auto numNodes = GenomeDescriptionService::get().convertNodeAddressToNodeIndex(constructor.genome, toInt(constructor.genome.size()));
+            if (numNodes > 0) {
+                constructor.genomeCurrentNodeIndex = ((constructor.genomeCurrentNodeIndex % numNodes) + numNodes) % numNodes;
+            } else {
+                constructor.genomeCurrentNodeIndex = 0;
+            }
 
-        auto numRepetitions = GenomeDescriptionService::get().getNumRepetitions(constructor.genome);
-        if (numRepetitions != std::numeric_limits<int>::max()) {
-            constructor.genomeCurrentRepetition = ((constructor.genomeCurrentRepetition % numRepetitions) + numRepetitions) % numRepetitions;
-        } else {
-            constructor.genomeCurrentRepetition = 0;
+            auto numRepetitions = GenomeDescriptionService::get().getNumRepetitions(constructor.genome);
+            if (numRepetitions != std::numeric_limits<int>::max()) {
+                constructor.genomeCurrentRepetition = ((constructor.genomeCurrentRepetition % numRepetitions) + numRepetitions) % numRepetitions;
+            } else {
+                constructor.genomeCurrentRepetition = 0;
+            }
         }
 
         constructor.constructionActivationTime = ((constructor.constructionActivationTime % Const::MaxActivationTime) + Const::MaxActivationTime) % Const::MaxActivationTime;
@@ -788,3 +812,44 @@ void _InspectorWindow::validateAndCorrect(CellDescription& cell) const
     } break;
     }
 }
+
+bool _InspectorWindow::completeMissingPayloads(CellDescription& cell) const
+{
+    if (_fetchedPayloads.neuronData && _fetchedPayloads.genomeData && _fetchedPayloads.metadata) {
+        return true;
+    }
+
+    //payloads of closed tabs have not been fetched and must not be overwritten by the change
+    auto data = _simulationFacade->getInspectedSimulationData({_entityId});
+    if (data.cells.empty()) {
+        return false;
+    }
+    auto const& simCell = data.cells.front();
+    if (!_fetchedPayloads.metadata) {
+        cell.metadata = simCell.metadata;
+    }
+    if (cell.getCellFunctionType() != simCell.getCellFunctionType()) {
+        return true;
+    }
+    switch (cell.getCellFunctionType()) {
+    case CellFunction_Neuron: {
+        if (!_fetchedPayloads.neuronData) {
+            auto& neuron = std::get<NeuronDescription>(*cell.cellFunction);
+            auto const& simNeuron = std::get<NeuronDescription>(*simCell.cellFunction);
+            neuron.weights = simNeuron.weights;
+            neuron.biases = simNeuron.biases;
+        }
+    } break;
+    case CellFunction_Constructor: {
+        if (!_fetchedPayloads.genomeData) {
+            std::get<ConstructorDescription>(*cell.cellFunction).genome = std::get<ConstructorDescription>(*simCell.cellFunction).genome;
+        }
+    } break;
+    case CellFunction_Injector: {
+        if (!_fetchedPayloads.genomeData) {
+            std::get<InjectorDescription>(*cell.cellFunction).genome = std::get<InjectorDescription>(*simCell.cellFunction).genome;
+        }
+    } break;
+    }
+    return true;
+}
@@ -2,6 +2,7 @@
 
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/InspectedEntityIds.h"
 #include "Definitions.h"
 
 struct MemoryEditor;
@@ -17,6 +18,7 @@ public:
 
     bool isClosed() const;
     uint64_t getId() const;
+    InspectedPayloads getRequiredPayloads() const;
 
 private:
     bool isCell() const;
@@ -47,6 +49,7 @@ private:
     float calcWindowWidth() const;
 
     void validateAndCorrect(CellDescription& cell) const;
+    bool completeMissingPayloads(CellDescription& cell) const;
 
     SimulationFacade _simulationFacade;
 
@@ -56,4 +59,6 @@ private:
     uint64_t _entityId = 0;
     float _genomeZoom = 20.0f;
     bool _selectGenomeTab = false;
+    InspectedPayloads _fetchedPayloads;
+    InspectedPayloads _requiredPayloads;
 };
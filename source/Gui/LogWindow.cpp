@@ -33,7 +33,13 @@ void LogWindow::processIntern()
         ImGui::PushFont(StyleRepository::get().getMonospaceMediumFont());
         ImGui::PushStyleColor(ImGuiCol_Text, (ImVec4)Const::MonospaceColor);
 
-        for (auto const& logMessage : _logger->getMessages(_verbose ? Priority::Unimportant : Priority::Important) | boost::adaptors::reversed) {
+        auto version = _logger->getVersion();
+        if (version != _logVersion || _verbose != _logMessagesVerbose) {
+            _logMessages = _logger->getMessages(_verbose ? Priority::Unimportant : Priority::Important);
+            _logVersion = version;
+            _logMessagesVerbose = _verbose;
+        }
+        for (auto const& logMessage : _logMessages | boost::adaptors::reversed) {
             ImGui::TextUnformatted(logMessage.c_str());
         }
         ImGui::PopStyleColor();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "Base/Singleton.h"
 
 #include "Definitions.h"
@@ -19,4 +21,9 @@ private:
     bool _verbose = false;
 
     GuiLogger _logger;
+
+    //copy of the logger messages, only refreshed when new messages arrive or the verbosity changes
+    std::vector<std::string> _logMessages;
+    std::optional<uint64_t> _logVersion;
+    bool _logMessagesVerbose = false;
 };
@@ -143,9 +143,6 @@ void MassOperationsDialog::colorCheckbox(std::string id, uint32_t cellColor, boo
 
 void MassOperationsDialog::onExecute()
 {
-    auto timestep = static_cast<uint32_t>(_simulationFacade->getCurrentTimestep());
-    auto parameters = _simulationFacade->getSimulationParameters();
-    auto generalSettings = _simulationFacade->getGeneralSettings();
     auto content = [&] {
         if (_restrictToSelectedClusters) {
             return _simulationFacade->getSelectedClusteredSimulationData(true);
@@ -186,9 +183,7 @@ void MassOperationsDialog::onExecute()
         _simulationFacade->removeSelectedObjects(true);
         _simulationFacade->addAndSelectSimulationData(DataDescription(content));
     } else {
-        _simulationFacade->closeSimulation();
-        _simulationFacade->newSimulation(timestep, generalSettings, parameters);
-        _simulationFacade->setClusteredSimulationData(content);       
+        _simulationFacade->setClusteredSimulationData(content);
     }
 }
 
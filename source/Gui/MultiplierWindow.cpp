@@ -137,6 +137,12 @@ void MultiplierWindow::processRandomPanel()
         AlienImGui::InputFloatParameters().name("Max angular velocity").textWidth(RightColumnWidth).format("%.1f").step(0.1f),
         _randomParameters._maxAngularVel);
     AlienImGui::Checkbox(AlienImGui::CheckboxParameters().name("Overlapping check").textWidth(RightColumnWidth), _randomParameters._overlappingCheck);
+    AlienImGui::Checkbox(
+        AlienImGui::CheckboxParameters()
+            .name("Parallel placement")
+            .textWidth(RightColumnWidth)
+            .tooltip("Copies are placed concurrently in batches. This is considerably faster for large numbers of copies."),
+        _randomParameters._parallelPlacement);
 }
 
 void MultiplierWindow::validateAndCorrect()
@@ -9,6 +9,7 @@
 
 #include "Base/GlobalSettings.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/PatternAnalysisService.h"
 #include "PersisterInterface/SerializerService.h"
 #include "EngineInterface/SimulationFacade.h"
 
@@ -54,7 +55,9 @@ void PatternAnalysisDialog::show()
 
 void PatternAnalysisDialog::saveRepetitiveActiveClustersToFiles(std::string const& filename)
 {
-    auto const partitionClassDataByDescription = calcPartitionData();
+    auto const data = _simulationFacade->getClusteredSimulationData();
+    auto patternClasses = PatternAnalysisService::get().calcPatternClasses(data);
+    std::erase_if(patternClasses, [](PatternClass const& patternClass) { return patternClass.getNumElements() <= 1; });
 
     std::ofstream file;
     file.open(filename, std::ios_base::out);
@@ -63,19 +66,10 @@ void PatternAnalysisDialog::saveRepetitiveActiveClustersToFiles(std::string cons
         return;
     }
 
-    int sum = 0;
-    std::vector<PartitionClassData> partitionData;
-    for (auto const& [analysisDesc, partitionClassData] : partitionClassDataByDescription) {
-        if (partitionClassData.numberOfElements > 1) {
-            partitionData.emplace_back(partitionClassData);
-        }
-    }
-    std::sort(partitionData.begin(), partitionData.end());
-
-    file << "number of repetitive active cell networks: " << partitionData.size() << std::endl << std::endl;
-    for (auto const& [index, partitionClassData] : partitionData | boost::adaptors::reversed | boost::adaptors::indexed(1)) {
+    file << "number of repetitive active cell networks: " << patternClasses.size() << std::endl << std::endl;
+    for (auto const& [index, patternClass] : patternClasses | boost::adaptors::indexed(1)) {
 
-        file << "cell network " << index << ": " << partitionClassData.numberOfElements << " exemplars" << std::endl;
+        file << "cell network " << index << ": " << patternClass.getNumElements() << " exemplars" << std::endl;
 
         std::stringstream clusterNameStream;
         clusterNameStream << "cell network" << std::setfill('0') << std::setw(6) << index << ".sim";
@@ -85,69 +79,17 @@ void PatternAnalysisDialog::saveRepetitiveActiveClustersToFiles(std::string cons
         clusterFilename /= clusterNameStream.str();
 
         ClusteredDataDescription pattern;
-        pattern.clusters = std::vector<ClusterDescription>{partitionClassData.representant};
+        pattern.clusters = std::vector<ClusterDescription>{data.clusters.at(patternClass.clusterIndices.front())};
 
         SerializerService::get().serializeContentToFile(clusterFilename.string(), pattern);
     }
     file.close();
 
     std::stringstream messageStream;
-    messageStream << partitionData.size() << " repetitive active cell network found. A summary is saved to " << filename << "." << std::endl;
-    if (!partitionData.empty()) {
+    messageStream << patternClasses.size() << " repetitive active cell network found. A summary is saved to " << filename << "." << std::endl;
+    if (!patternClasses.empty()) {
         messageStream << "Representative cell networks are save from `cluster" << std::setfill('0') << std::setw(6) << 0 << ".sim` to `cluster" << std::setfill('0')
-                      << std::setw(6) << partitionData.size() - 1 << ".sim`.";
+                      << std::setw(6) << patternClasses.size() - 1 << ".sim`.";
     }
     GenericMessageDialog::get().information("Analysis result", messageStream.str());
 }
-
-auto PatternAnalysisDialog::calcPartitionData() const -> std::map<ClusterAnalysisDescription, PartitionClassData>
-{
-    auto data = _simulationFacade->getClusteredSimulationData();
-
-    std::map<ClusterAnalysisDescription, PartitionClassData> result;
-
-    for (auto const& cluster : data.clusters) {
-        auto const clusterAnalysisData = getAnalysisDescription(cluster);
-        auto& partitionData = result[clusterAnalysisData];
-        if (1 == ++partitionData.numberOfElements) {
-            partitionData.representant = cluster;
-        }
-    }
-    return result;
-}
-
-auto PatternAnalysisDialog::getAnalysisDescription(ClusterDescription const& cluster) const -> ClusterAnalysisDescription
-{
-    ClusterAnalysisDescription result;
-    std::map<uint64_t, CellAnalysisDescription> cellAnalysisDescById;
-    auto insertCellAnalysisDescription = [&cellAnalysisDescById](CellDescription const& cell) {
-        if (cellAnalysisDescById.find(cell.id) == cellAnalysisDescById.end()) {
-            CellAnalysisDescription result;
-            result.maxConnections = cell.maxConnections;
-            result.numConnections = cell.connections.size();
-            result.constructionState = cell.livingState;
-            result.inputExecutionOrderNumber = cell.inputExecutionOrderNumber;
-            result.outputBlocked = cell.outputBlocked;
-            result.executionOrderNumber = cell.executionOrderNumber;
-            result.color = cell.color;
-            result.cellFunction = cell.getCellFunctionType();
-
-            cellAnalysisDescById.insert_or_assign(cell.id, result);
-        }
-    };
-
-    std::map<uint64_t, int> cellDescIndexById;
-    for (auto const& [index, cell] : cluster.cells | boost::adaptors::indexed(0)) {
-        cellDescIndexById.insert_or_assign(cell.id, toInt(index));
-    }
-
-    for (auto const& cell : cluster.cells) {
-        insertCellAnalysisDescription(cell);
-        for (auto const& connection : cell.connections) {
-            auto connectingCellId = connection.cellId;
-            insertCellAnalysisDescription(cluster.cells.at(cellDescIndexById.at(connectingCellId)));
-            result.connectedCells.insert(std::set<CellAnalysisDescription>{cellAnalysisDescById.at(cell.id), cellAnalysisDescById.at(connectingCellId)});
-        }
-    }
-    return result;
-}
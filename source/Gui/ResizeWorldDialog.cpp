@@ -89,10 +89,10 @@ void ResizeWorldDialog::onResizing()
 
     _simulationFacade->newSimulation(timestep, generalSettings, parameters);
 
-    DescriptionEditService::get().correctConnections(content, {_width, _height});
     if (_scaleContent) {
         DescriptionEditService::get().duplicate(content, origWorldSize, {_width, _height});
     }
+    DescriptionEditService::get().correctConnections(content, {_width, _height});
     _simulationFacade->setClusteredSimulationData(content);
     _simulationFacade->setStatisticsHistory(statistics);
     _simulationFacade->setRealTime(realtime);
@@ -15,6 +15,7 @@
 #include "Base/StringHelper.h"
 #include "EngineInterface/Colors.h"
 #include "EngineInterface/SimulationFacade.h"
+#include "EngineInterface/StatisticsDownsamplingService.h"
 #include "EngineInterface/StatisticsHistory.h"
 #include "PersisterInterface/SerializerService.h"
 
@@ -505,24 +506,34 @@ void StatisticsWindow::processPlot(int row, DataPoint DataPointCollection::*valu
         longtermStatistics = &dummy;
     }
 
+    //an empty live history results in an empty plot, it does not fall back to the long-term history
     auto const& dataPointCollectionHistory = _timelineLiveStatistics.getDataPointCollectionHistory();
-    auto count = _plotMode == 0 ? toInt(dataPointCollectionHistory.size()) : toInt(longtermStatistics->size());
-    auto startTime = _plotMode == 0 ? dataPointCollectionHistory.back().time - toDouble(_timeHorizonForLiveStatistics)
+    auto isLiveHistory = _plotMode == 0;
+    auto liveEndTime = dataPointCollectionHistory.isEmpty() ? 0.0 : dataPointCollectionHistory.back().time;
+    auto startTime = isLiveHistory ? liveEndTime - toDouble(_timeHorizonForLiveStatistics)
         : longtermStatistics->back().time - (longtermStatistics->back().time - longtermStatistics->front().time) * toDouble(_timeHorizonForLongtermStatistics) / 100;
-    auto endTime = _plotMode == 0 ? dataPointCollectionHistory.back().time : longtermStatistics->back().time;
-    auto values = _plotMode == 0 ? &(dataPointCollectionHistory[0].*valuesPtr) : &((*longtermStatistics)[0].*valuesPtr);
-    auto timePoints = _plotMode == 0 ? &dataPointCollectionHistory[0].time : &(*longtermStatistics)[0].time;
-    auto systemClock = _plotMode == 0 ? nullptr : &(*longtermStatistics)[0].systemClock;
+    auto endTime = isLiveHistory ? liveEndTime : longtermStatistics->back().time;
+
+    //one bucket per pixel column of the plot
+    auto numBuckets = std::max(1, toInt(ImGui::GetContentRegionAvail().x));
+    auto createSeries = [&](int component) {
+        return isLiveHistory ? createPlotSeries(dataPointCollectionHistory, valuesPtr, component, startTime, false, numBuckets)
+                             : createPlotSeries(*longtermStatistics, valuesPtr, component, startTime, true, numBuckets);
+    };
 
     switch (_plotType) {
     case 0:
-        plotSumColorsIntern(row, values, timePoints, systemClock, count, startTime, endTime, fracPartDecimals);
-        break;
-    case 1:
-        plotByColorIntern(row, values, timePoints, count, startTime, endTime, fracPartDecimals);
+        plotSumColorsIntern(row, createSeries(MAX_COLORS), startTime, endTime, fracPartDecimals);
         break;
+    case 1: {
+        std::vector<PlotSeries> seriesByColor;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            seriesByColor.emplace_back(createSeries(i));
+        }
+        plotByColorIntern(row, seriesByColor, startTime, endTime, fracPartDecimals);
+    } break;
     default:
-        plotForColorIntern(row, values, _plotType - 2, timePoints, systemClock, count, startTime, endTime, fracPartDecimals);
+        plotForColorIntern(row, createSeries(_plotType - 2), _plotType - 2, startTime, endTime, fracPartDecimals);
         break;
     }
     ImGui::Spacing();
@@ -541,39 +552,66 @@ void StatisticsWindow::processBackground()
     }
 }
 
-namespace
+template <typename History>
+PlotSeries StatisticsWindow::createPlotSeries(
+    History const& history,
+    DataPoint DataPointCollection::*valuesPtr,
+    int component,
+    double startTime,
+    bool withSystemClock,
+    int numBuckets) const
 {
-    double getMaxWithDataPointStride(double const* data, double const* timePoints, double startTime, int count)
-    {
-        auto constexpr strideDouble = sizeof(DataPointCollection) / sizeof(double);
+    auto count = toInt(history.size());
+    auto getValue = [&](int index) {
+        auto const& dataPoint = history[index].*valuesPtr;
+        return component < MAX_COLORS ? dataPoint.values[component] : dataPoint.summedValues;
+    };
 
-        auto result = 0.0;
-        for (int i = count / 20; i < count; ++i) {
-            if (timePoints[i * strideDouble] >= startTime - NEAR_ZERO) {
-                result = std::max(result, data[i * strideDouble]);
-            }
+    //binary search for the first visible data point, its predecessor is also taken such that the graph reaches the left border
+    auto startIndex = 0;
+    for (auto endIndex = count; startIndex < endIndex;) {
+        auto middleIndex = (startIndex + endIndex) / 2;
+        if (history[middleIndex].time < startTime - NEAR_ZERO) {
+            startIndex = middleIndex + 1;
+        } else {
+            endIndex = middleIndex;
+        }
+    }
+    startIndex = std::max(0, startIndex - 1);
+
+    std::vector<double> timePoints;
+    std::vector<double> values;
+    timePoints.reserve(count - startIndex);
+    values.reserve(count - startIndex);
+    PlotSeries result;
+    for (int i = startIndex; i < count; ++i) {
+        auto time = history[i].time;
+        auto value = getValue(i);
+        timePoints.emplace_back(time);
+        values.emplace_back(value);
+        if (i >= count / 20 && time >= startTime - NEAR_ZERO) {
+            result.maxValue = std::max(result.maxValue, value);
         }
-        return result;
     }
+
+    auto indices = StatisticsDownsamplingService::get().calcMinMaxIndices(timePoints.data(), values.data(), toInt(values.size()), numBuckets);
+    result.timePoints.reserve(indices.size());
+    result.values.reserve(indices.size());
+    for (auto index : indices) {
+        result.timePoints.emplace_back(timePoints[index]);
+        result.values.emplace_back(values[index]);
+        if (withSystemClock) {
+            result.systemClock.emplace_back(history[startIndex + index].systemClock);
+        }
+    }
+    return result;
 }
 
-void StatisticsWindow::plotSumColorsIntern(
-    int row,
-    DataPoint const* dataPoints,
-    double const* timePoints,
-    double const* systemClock,
-    int count,
-    double startTime,
-    double endTime,
-    int fracPartDecimals)
+void StatisticsWindow::plotSumColorsIntern(int row, PlotSeries const& series, double startTime, double endTime, int fracPartDecimals)
 {
-    auto constexpr strideBytes = sizeof(DataPointCollection);
-    auto constexpr strideDouble = sizeof(DataPointCollection) / sizeof(double);
-
-    double const* plotDataY = reinterpret_cast<double const*>(dataPoints) + MAX_COLORS;
-    double upperBound = getMaxWithDataPointStride(plotDataY, timePoints, startTime, count);
-    double endValue = count > 0 ? plotDataY[(count - 1) * strideDouble] : 0.0;
-    upperBound = getUpperBound(upperBound);
+    auto count = toInt(series.values.size());
+    double endValue = count > 0 ? series.values.back() : 0.0;
+    double upperBound = getUpperBound(series.maxValue);
 
     ImGui::PushID(row);
     ImPlot::PushStyleColor(ImPlotCol_FrameBg, (ImU32)ImColor(0.0f, 0.0f, 0.0f, ImGui::GetStyle().Alpha));
@@ -595,14 +633,14 @@ void StatisticsWindow::plotSumColorsIntern(
         }
         if (count > 0) {
             ImPlot::PushStyleColor(ImPlotCol_Line, color);
-            ImPlot::PlotLine("##", timePoints, plotDataY, count, 0, 0, strideBytes);
+            ImPlot::PlotLine("##", series.timePoints.data(), series.values.data(), count);
             ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.5f * ImGui::GetStyle().Alpha);
-            ImPlot::PlotShaded("##", timePoints, plotDataY, count, 0, 0, 0, strideBytes);
+            ImPlot::PlotShaded("##", series.timePoints.data(), series.values.data(), count);
             ImPlot::PopStyleVar();
             ImPlot::PopStyleColor();
         }
         if (ImGui::GetStyle().Alpha == 1.0f && ImPlot::IsPlotHovered() && count > 0) {
-            drawValuesAtMouseCursor(plotDataY, timePoints, systemClock, count, startTime, endTime, upperBound, fracPartDecimals);
+            drawValuesAtMouseCursor(series, startTime, endTime, upperBound, fracPartDecimals);
         }
         ImPlot::EndPlot();
     }
@@ -611,18 +649,11 @@ void StatisticsWindow::plotSumColorsIntern(
     ImGui::PopID();
 }
 
-void StatisticsWindow::plotByColorIntern(
-    int row,
-    DataPoint const* values,
-    double const* timePoints,
-    int count,
-    double startTime,
-    double endTime,
-    int fracPartDecimals)
+void StatisticsWindow::plotByColorIntern(int row, std::vector<PlotSeries> const& seriesByColor, double startTime, double endTime, int fracPartDecimals)
 {
     auto upperBound = 0.0;
-    for (int i = 0; i < MAX_COLORS; ++i) {
-        upperBound = std::max(upperBound, getMaxWithDataPointStride(reinterpret_cast<double const*>(values) + i, timePoints, startTime, count));
+    for (auto const& series : seriesByColor) {
+        upperBound = std::max(upperBound, series.maxValue);
     }
     upperBound = getUpperBound(upperBound);
 
@@ -648,9 +679,11 @@ void StatisticsWindow::plotByColorIntern(
             ImColor color(toInt((colorRaw >> 16) & 0xff), toInt((colorRaw >> 8) & 0xff), toInt(colorRaw & 0xff));
 
             ImPlot::PushStyleColor(ImPlotCol_Line, (ImU32)color);
-            auto endValue = count > 0 ? *(reinterpret_cast<double const*>(reinterpret_cast<DataPointCollection const*>(values) + (count - 1)) + i) : 0.0f;
+            auto const& series = seriesByColor.at(i);
+            auto count = toInt(series.values.size());
+            auto endValue = count > 0 ? series.values.back() : 0.0;
             auto labelId = StringHelper::format(toFloat(endValue), fracPartDecimals);
-            ImPlot::PlotLine(labelId.c_str(), timePoints, reinterpret_cast<double const*>(values) + i, count, 0, 0, sizeof(DataPointCollection));
+            ImPlot::PlotLine(labelId.c_str(), series.timePoints.data(), series.values.data(), count);
             ImPlot::PopStyleColor();
             ImGui::PopID();
         }
@@ -662,24 +695,11 @@ void StatisticsWindow::plotByColorIntern(
     ImGui::PopID();
 }
 
-void StatisticsWindow::plotForColorIntern(
-    int row,
-    DataPoint const* values,
-    int colorIndex,
-    double const* timePoints,
-    double const* systemClock,
-    int count,
-    double startTime,
-    double endTime,
-    int fracPartDecimals)
+void StatisticsWindow::plotForColorIntern(int row, PlotSeries const& series, int colorIndex, double startTime, double endTime, int fracPartDecimals)
 {
-    auto constexpr strideBytes = sizeof(DataPointCollection);
-    auto constexpr strideDouble = sizeof(DataPointCollection) / sizeof(double);
-
-    auto valuesForColor = reinterpret_cast<double const*>(values) + colorIndex;
-    auto upperBound = getMaxWithDataPointStride(valuesForColor, timePoints, startTime, count);
-    upperBound = getUpperBound(upperBound);
-    auto endValue = count > 0 ? valuesForColor[(count - 1) * strideDouble] : 0.0;
+    auto count = toInt(series.values.size());
+    auto upperBound = getUpperBound(series.maxValue);
+    auto endValue = count > 0 ? series.values.back() : 0.0;
 
     ImGui::PushID(row);
     ImPlot::PushStyleColor(ImPlotCol_FrameBg, (ImU32)ImColor(0.0f, 0.0f, 0.0f, ImGui::GetStyle().Alpha));
@@ -709,13 +729,13 @@ void StatisticsWindow::plotForColorIntern(
         }
         if (count > 0) {
             ImPlot::PushStyleColor(ImPlotCol_Line, color);
-            ImPlot::PlotLine("##", timePoints, valuesForColor, count, 0, 0, strideBytes);
+            ImPlot::PlotLine("##", series.timePoints.data(), series.values.data(), count);
             ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.5f * ImGui::GetStyle().Alpha);
-            ImPlot::PlotShaded("##", timePoints, valuesForColor, count, 0, 0, 0, strideBytes);
+            ImPlot::PlotShaded("##", series.timePoints.data(), series.values.data(), count);
             ImPlot::PopStyleVar();
             ImPlot::PopStyleColor();
             if (ImGui::GetStyle().Alpha == 1.0f && ImPlot::IsPlotHovered()) {
-                drawValuesAtMouseCursor(valuesForColor, timePoints, systemClock, count, startTime, endTime, upperBound, fracPartDecimals);
+                drawValuesAtMouseCursor(series, startTime, endTime, upperBound, fracPartDecimals);
             }
         }
         ImPlot::EndPlot();
@@ -773,38 +793,29 @@ namespace
     }
 }
 
-void StatisticsWindow::drawValuesAtMouseCursor(
-    double const* dataPoints,
-    double const* timePoints,
-    double const* systemClock,
-    int count,
-    double startTime,
-    double endTime,
-    double upperBound,
-    int fracPartDecimals)
+void StatisticsWindow::drawValuesAtMouseCursor(PlotSeries const& series, double startTime, double endTime, double upperBound, int fracPartDecimals)
 {
-    auto constexpr stride = sizeof(DataPointCollection) / sizeof(double);
-
+    auto count = toInt(series.values.size());
     auto mousePos = ImPlot::GetPlotMousePos();
     mousePos.x = std::max(startTime, std::min(endTime, mousePos.x));
-    mousePos.y = dataPoints[0];
+    mousePos.y = series.values[0];
 
     auto dateTimeString =
         [&] {
-        if (systemClock == nullptr) {
+        if (series.systemClock.empty()) {
             for (int i = 1; i < count; ++i) {
-                if (timePoints[i * stride] > mousePos.x) {
-                    mousePos.y = dataPoints[i * stride];
+                if (series.timePoints[i] > mousePos.x) {
+                    mousePos.y = series.values[i];
                     break;
                 }
             }
             return std::string();
         }
-        auto systemClockEntry = systemClock[0];
+        auto systemClockEntry = series.systemClock[0];
         for (int i = 1; i < count; ++i) {
-            if (timePoints[i * stride] > mousePos.x) {
-                mousePos.y = dataPoints[i * stride];
-                systemClockEntry = systemClock[i * stride];
+            if (series.timePoints[i] > mousePos.x) {
+                mousePos.y = series.values[i];
+                systemClockEntry = series.systemClock[i];
                 break;
             }
         }
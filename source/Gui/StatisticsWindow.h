@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <vector>
 
 #include "Base/Singleton.h"
 #include "EngineInterface/Definitions.h"
@@ -14,6 +15,15 @@
 
 struct ImPlotPoint;
 
+//data points of a graph which are drawn in a plot
+struct PlotSeries
+{
+    std::vector<double> timePoints;
+    std::vector<double> values;
+    std::vector<double> systemClock;  //empty for live statistics
+    double maxValue = 0;  //maximum of the data points in the visible time range, the oldest 5% of the history are ignored
+};
+
 class StatisticsWindow : public AlienWindow<SimulationFacade>
 {
     MAKE_SINGLETON_NO_DEFAULT_CONSTRUCTION(StatisticsWindow);
@@ -36,39 +46,24 @@ private:
 
     void processBackground() override;
 
-    void plotSumColorsIntern(
-        int row,
-        DataPoint const* dataPoints,
-        double const* timePoints,
-        double const* systemClock,
-        int count,
+    //extracts a component of the data points starting at startTime and downsamples it to numBuckets pixel columns
+    template <typename History>
+    PlotSeries createPlotSeries(
+        History const& history,
+        DataPoint DataPointCollection::*valuesPtr,
+        int component,
         double startTime,
-        double endTime,
-        int fracPartDecimals);
-    void plotByColorIntern(int row, DataPoint const* values, double const* timePoints, int count, double startTime, double endTime, int fracPartDecimals);
-    void plotForColorIntern(
-        int row,
-        DataPoint const* values,
-        int colorIndex,
-        double const* timePoints,
-        double const* systemClock,
-        int count,
-        double startTime,
-        double endTime,
-        int fracPartDecimals);
+        bool withSystemClock,
+        int numBuckets) const;
+
+    void plotSumColorsIntern(int row, PlotSeries const& series, double startTime, double endTime, int fracPartDecimals);
+    void plotByColorIntern(int row, std::vector<PlotSeries> const& seriesByColor, double startTime, double endTime, int fracPartDecimals);
+    void plotForColorIntern(int row, PlotSeries const& series, int colorIndex, double startTime, double endTime, int fracPartDecimals);
 
     void setPlotScale();
     double getUpperBound(double maxValue);
 
-    void drawValuesAtMouseCursor(
-        double const* dataPoints,
-        double const* timePoints,
-        double const* systemClock,
-        int count,
-        double startTime,
-        double endTime,
-        double upperBound,
-        int fracPartDecimals);
+    void drawValuesAtMouseCursor(PlotSeries const& series, double startTime, double endTime, double upperBound, int fracPartDecimals);
 
     void validateAndCorrect();
 
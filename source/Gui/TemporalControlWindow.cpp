@@ -27,7 +27,8 @@ void TemporalControlWindow::initIntern(SimulationFacade simulationFacade)
 
 void TemporalControlWindow::onSnapshot()
 {
-    _snapshot = createSnapshot();
+    _flashback.clear();
+    _flashback.push(createSnapshot());
 }
 
 TemporalControlWindow::TemporalControlWindow()
@@ -155,15 +156,16 @@ void TemporalControlWindow::processPauseButton()
 
 void TemporalControlWindow::processStepBackwardButton()
 {
-    ImGui::BeginDisabled(_history.empty() || _simulationFacade->isSimulationRunning());
+    ImGui::BeginDisabled(_history.isEmpty() || _simulationFacade->isSimulationRunning());
     auto result = AlienImGui::ToolbarButton(AlienImGui::ToolbarButtonParameters().text(ICON_FA_CHEVRON_LEFT));
     AlienImGui::Tooltip("Load previous time step");
     if (result) {
-        auto const& snapshot = _history.back();
-        delayedExecution([this, snapshot] { applySnapshot(snapshot); });
+        delayedExecution([this] {
+            if (auto snapshot = _history.pop()) {
+                applySnapshot(*snapshot);
+            }
+        });
         printOverlayMessage("Loading previous time step ...");
-
-        _history.pop_back();
     }
     ImGui::EndDisabled();
 }
@@ -174,7 +176,7 @@ void TemporalControlWindow::processStepForwardButton()
     auto result = AlienImGui::ToolbarButton(AlienImGui::ToolbarButtonParameters().text(ICON_FA_CHEVRON_RIGHT));
     AlienImGui::Tooltip("Process single time step");
     if (result) {
-        _history.emplace_back(createSnapshot());
+        _history.push(createSnapshot());
         _simulationFacade->calcTimesteps(1);
     }
     ImGui::EndDisabled();
@@ -193,12 +195,16 @@ void TemporalControlWindow::processCreateFlashbackButton()
 
 void TemporalControlWindow::processLoadFlashbackButton()
 {
-    ImGui::BeginDisabled(!_snapshot);
+    ImGui::BeginDisabled(_flashback.isEmpty());
     auto result = AlienImGui::ToolbarButton(AlienImGui::ToolbarButtonParameters().text(ICON_FA_UNDO));
     AlienImGui::Tooltip("Loading in-memory flashback: It loads the saved world from the memory. Static simulation parameters will not be changed. Non-static parameters "
                         "(such as the position of moving zones) will be restored as well.");
     if (result) {
-        delayedExecution([this] { applySnapshot(*_snapshot); });
+        delayedExecution([this] {
+            if (auto snapshot = _flashback.getNewest()) {
+                applySnapshot(*snapshot);
+            }
+        });
         _simulationFacade->removeSelection();
         _history.clear();
 
@@ -207,9 +213,9 @@ void TemporalControlWindow::processLoadFlashbackButton()
     ImGui::EndDisabled();
 }
 
-TemporalControlWindow::Snapshot TemporalControlWindow::createSnapshot()
+SimulationSnapshot TemporalControlWindow::createSnapshot()
 {
-    Snapshot result;
+    SimulationSnapshot result;
     result.timestep = _simulationFacade->getCurrentTimestep();
     result.realTime = _simulationFacade->getRealTime();
     result.data = _simulationFacade->getSimulationData();
@@ -218,7 +224,7 @@ TemporalControlWindow::Snapshot TemporalControlWindow::createSnapshot()
 }
 
 
-void TemporalControlWindow::applySnapshot(Snapshot const& snapshot)
+void TemporalControlWindow::applySnapshot(SimulationSnapshot const& snapshot)
 {
     auto parameters = _simulationFacade->getSimulationParameters();
     auto const& origParameters = snapshot.parameters;
@@ -1,11 +1,8 @@
 #pragma once
 
-#include <chrono>
-
 #include "Base/Singleton.h"
 #include "EngineInterface/Definitions.h"
-#include "EngineInterface/Descriptions.h"
-#include "EngineInterface/SimulationParameters.h"
+#include "PersisterInterface/SnapshotRing.h"
 
 #include "Definitions.h"
 #include "AlienWindow.h"
@@ -35,24 +32,16 @@ private:
     void processCreateFlashbackButton();
     void processLoadFlashbackButton();
 
-    struct Snapshot
-    {
-        uint64_t timestep;
-        std::chrono::milliseconds realTime;
-        SimulationParameters parameters;
-        DataDescription data;
-    };
-    Snapshot createSnapshot();
-    void applySnapshot(Snapshot const& snapshot);
+    SimulationSnapshot createSnapshot();
+    void applySnapshot(SimulationSnapshot const& snapshot);
 
     template <typename MovedObjectType>
     void restorePosition(MovedObjectType& movedObject, MovedObjectType const& origMovedObject, uint64_t origTimestep);
     
     SimulationFacade _simulationFacade; 
 
-    std::optional<Snapshot> _snapshot;
-
-    std::vector<Snapshot> _history;
+    SnapshotRing _flashback{SnapshotRingParameters().deltaEncoding(false)};
+    SnapshotRing _history;
 
     bool _slowDown = false;
     int _tpsRestriction = 30;
@@ -7,7 +7,7 @@
 #include "EngineInterface/RawStatisticsData.h"
 #include "EngineInterface/StatisticsConverterService.h"
 
-std::vector<DataPointCollection> const& TimelineLiveStatistics::getDataPointCollectionHistory() const
+RingBuffer<DataPointCollection> const& TimelineLiveStatistics::getDataPointCollectionHistory() const
 {
     return _dataPointCollectionHistory;
 }
@@ -22,7 +22,7 @@ void TimelineLiveStatistics::update(TimelineStatistics const& data, uint64_t tim
     _timeSinceSimStart += toDouble(duration) / 1000;
 
     auto newDataPoint = StatisticsConverterService::get().convert(data, timestep, _timeSinceSimStart, _lastData, _lastTimestep);
-    _dataPointCollectionHistory.emplace_back(newDataPoint);
+    _dataPointCollectionHistory.pushBack(newDataPoint);
     _lastData = data;
     _lastTimestep = timestep;
     _lastTimepoint = timepoint;
@@ -30,7 +30,7 @@ void TimelineLiveStatistics::update(TimelineStatistics const& data, uint64_t tim
 
 void TimelineLiveStatistics::truncate()
 {
-    if (!_dataPointCollectionHistory.empty() && _dataPointCollectionHistory.back().time - _dataPointCollectionHistory.front().time > (MaxLiveHistory + 1.0)) {
-        _dataPointCollectionHistory.erase(_dataPointCollectionHistory.begin());
+    while (!_dataPointCollectionHistory.isEmpty() && _dataPointCollectionHistory.back().time - _dataPointCollectionHistory.front().time > (MaxLiveHistory + 1.0)) {
+        _dataPointCollectionHistory.popFront();
     }
 }
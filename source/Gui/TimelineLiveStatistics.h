@@ -1,9 +1,9 @@
 #pragma once
 
 #include <chrono>
-#include <vector>
 #include <optional>
 
+#include "Base/RingBuffer.h"
 #include "EngineInterface/Colors.h"
 #include "EngineInterface/RawStatisticsData.h"
 #include "EngineInterface/DataPointCollection.h"
@@ -12,8 +12,9 @@ class TimelineLiveStatistics
 {
 public:
     static auto constexpr MaxLiveHistory = 240.0f;  //in seconds
+    static auto constexpr MaxLiveHistorySize = 5000;  //suffices for MaxLiveHistory at the minimum update interval of 50 ms
 
-    std::vector<DataPointCollection> const& getDataPointCollectionHistory() const;
+    RingBuffer<DataPointCollection> const& getDataPointCollectionHistory() const;
     void update(TimelineStatistics const& statistics, uint64_t timestep);
 
 private:
@@ -21,7 +22,7 @@ private:
 
     double _timeSinceSimStart = 0;  //in seconds
 
-    std::vector<DataPointCollection> _dataPointCollectionHistory;
+    RingBuffer<DataPointCollection> _dataPointCollectionHistory = RingBuffer<DataPointCollection>(MaxLiveHistorySize);
 
     std::optional<uint64_t> _lastTimestep;
     std::optional<std::chrono::steady_clock::time_point> _lastTimepoint;
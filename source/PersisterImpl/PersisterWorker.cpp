@@ -9,6 +9,7 @@
 #include "Base/StringHelper.h"
 #include "Base/UnlockGuard.h"
 #include "PersisterInterface/SerializerService.h"
+#include "PersisterInterface/PeakDetectionService.h"
 #include "PersisterInterface/PersisterRequestResult.h"
 #include "EngineInterface/SimulationFacade.h"
 #include "EngineInterface/GenomeDescriptionService.h"
@@ -625,15 +626,14 @@ _PersisterWorker::PersisterRequestResultOrError _PersisterWorker::processRequest
         UnlockGuard unlockGuard(lock);
 
         auto const& requestData = request->getData();
+        auto const& peakSimulation = requestData.peakDeserializedSimulation;
 
-        auto peakStatistics = requestData.peakDeserializedSimulation->getRawStatisticsData();
-
-        DeserializedSimulation deserializedSimulation;
-        deserializedSimulation.statistics = _simulationFacade->getStatisticsHistory().getCopiedData();
+        //the candidate is evaluated on its raw statistics first, statistics history and simulation data are only copied for a new peak
         auto currentRawStatistics = _simulationFacade->getRawStatistics();
-        if (sumColorVector(currentRawStatistics.timeline.timestep.genomeComplexityVariance)
-            >= sumColorVector(peakStatistics.timeline.timestep.genomeComplexityVariance)) {
-
+        auto peakStatistics = !peakSimulation->isEmpty() ? std::make_optional(peakSimulation->getRawStatisticsData()) : std::nullopt;
+        if (PeakDetectionService::get().isNewPeak(requestData.criterion, currentRawStatistics, peakStatistics)) {
+            DeserializedSimulation deserializedSimulation;
+            deserializedSimulation.statistics = _simulationFacade->getStatisticsHistory().getCopiedData();
             deserializedSimulation.auxiliaryData.realTime = _simulationFacade->getRealTime();
             deserializedSimulation.auxiliaryData.zoom = requestData.zoom;
             deserializedSimulation.auxiliaryData.center = requestData.center;
@@ -641,8 +641,8 @@ _PersisterWorker::PersisterRequestResultOrError _PersisterWorker::processRequest
             deserializedSimulation.auxiliaryData.simulationParameters = _simulationFacade->getSimulationParameters();
             deserializedSimulation.auxiliaryData.timestep = static_cast<uint32_t>(_simulationFacade->getCurrentTimestep());
             deserializedSimulation.mainData = _simulationFacade->getClusteredSimulationData();
-            requestData.peakDeserializedSimulation->setDeserializedSimulation(std::move(deserializedSimulation));
-            requestData.peakDeserializedSimulation->setLastStatisticsData(currentRawStatistics);
+            peakSimulation->setDeserializedSimulation(std::move(deserializedSimulation));
+            peakSimulation->setLastStatisticsData(currentRawStatistics);
         }
         return std::make_shared<_GetPeakSimulationRequestResult>(request->getRequestId(), GetPeakSimulationResultData());
     } catch (...) {
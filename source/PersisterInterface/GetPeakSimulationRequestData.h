@@ -1,5 +1,6 @@
 #pragma once
 
+#include "PeakCriterion.h"
 #include "SharedDeserializedSimulation.h"
 
 struct GetPeakSimulationRequestData
@@ -7,4 +8,5 @@ struct GetPeakSimulationRequestData
     SharedDeserializedSimulation peakDeserializedSimulation;
     float zoom = 1.0f;
     RealVector2D center;
+    PeakCriterion criterion = PeakCriterion_GenomeComplexityVariance;
 };
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+//measured value whose maximum is captured by GetPeakSimulationRequest
+using PeakCriterion = int;
+enum PeakCriterion_
+{
+    PeakCriterion_GenomeComplexityVariance,
+    PeakCriterion_AverageGenomeComplexity,
+    PeakCriterion_MaxGenomeComplexityOfColonies,
+    PeakCriterion_NumSelfReplicators,
+    PeakCriterion_Count
+};
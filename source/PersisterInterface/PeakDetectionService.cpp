@@ -0,0 +1,40 @@
+#include "PeakDetectionService.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+double PeakDetectionService::calcMetric(PeakCriterion criterion, RawStatisticsData const& statistics) const
+{
+    auto const& timestep = statistics.timeline.timestep;
+    if (criterion == PeakCriterion_GenomeComplexityVariance) {
+        return sumColorVector(timestep.genomeComplexityVariance);
+    }
+    if (criterion == PeakCriterion_AverageGenomeComplexity) {
+        auto sumGenomeComplexity = 0.0;
+        auto sumNumSelfReplicators = 0.0;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            sumGenomeComplexity += timestep.genomeComplexity[i];
+            sumNumSelfReplicators += timestep.numSelfReplicators[i];
+        }
+        return sumNumSelfReplicators > 0 ? sumGenomeComplexity / sumNumSelfReplicators : 0.0;
+    }
+    if (criterion == PeakCriterion_MaxGenomeComplexityOfColonies) {
+        return *std::max_element(std::begin(timestep.maxGenomeComplexityOfColonies), std::end(timestep.maxGenomeComplexityOfColonies));
+    }
+    if (criterion == PeakCriterion_NumSelfReplicators) {
+        auto result = 0.0;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            result += timestep.numSelfReplicators[i];
+        }
+        return result;
+    }
+    throw std::runtime_error("Unknown peak criterion.");
+}
+
+bool PeakDetectionService::isNewPeak(PeakCriterion criterion, RawStatisticsData const& candidate, std::optional<RawStatisticsData> const& peak) const
+{
+    if (!peak.has_value()) {
+        return true;
+    }
+    return calcMetric(criterion, candidate) > calcMetric(criterion, *peak);
+}
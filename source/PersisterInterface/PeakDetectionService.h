@@ -0,0 +1,20 @@
+#pragma once
+
+#include <optional>
+
+#include "Base/Singleton.h"
+#include "EngineInterface/RawStatisticsData.h"
+
+#include "PeakCriterion.h"
+
+//compares the statistics of a candidate with those of the captured peak, i.e. no simulation data is needed for the decision
+class PeakDetectionService
+{
+    MAKE_SINGLETON(PeakDetectionService);
+
+public:
+    double calcMetric(PeakCriterion criterion, RawStatisticsData const& statistics) const;
+
+    //true if no peak has been captured yet or the metric of the candidate is higher than that of the peak
+    bool isNewPeak(PeakCriterion criterion, RawStatisticsData const& candidate, std::optional<RawStatisticsData> const& peak) const;
+};
@@ -51,5 +51,8 @@ private:
     std::filesystem::path _filename;
     int _sequenceNumber = 0;
     std::deque<SavepointEntry> _entries;
+
+    int _journalGeneration = 0;  //the journal is only valid for the table file with the same generation
+    int _numJournalOperations = 0;
 };
 
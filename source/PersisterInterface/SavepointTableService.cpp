@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <fstream>
 #include <ranges>
+#include <sstream>
 
 #include <boost/property_tree/json_parser.hpp>
 
@@ -11,6 +12,8 @@
 
 namespace
 {
+    auto constexpr MaxNumJournalOperations = 100;
+
     bool hasWriteAccess(std::filesystem::path const& path)
     {
         std::filesystem::path tempFilePath = path / "temp_test_file.tmp";
@@ -41,21 +44,24 @@ auto SavepointTableService::loadFromFile(std::string const& filename) -> std::va
             return Error{};
         }
 
-        // savepoint file does not exist
-        if (!std::filesystem::exists(filename)) {
-            return SavepointTable(filename, {});
-        }
+        SavepointTable result(filename, std::deque<SavepointEntry>());
 
-        std::ifstream stream(filename, std::ios::binary);
-        if (!stream) {
-            return Error{};
-        }
+        // savepoint file may not exist if only the journal has been written so far
+        if (std::filesystem::exists(filename)) {
+            std::ifstream stream(filename, std::ios::binary);
+            if (!stream) {
+                return Error{};
+            }
 
-        boost::property_tree::ptree tree;
-        boost::property_tree::read_json(stream, tree);
-        SavepointTable result(filename, std::deque<SavepointEntry>());
-        encodeDecode(tree, result, ParserTask::Decode);
+            boost::property_tree::ptree tree;
+            boost::property_tree::read_json(stream, tree);
+            encodeDecode(tree, result, ParserTask::Decode);
+        }
 
+        replayJournal(result);
+        if (result._numJournalOperations > 0) {
+            compact(result);
+        }
         return result;
     } catch (...) {
         return Error{};
@@ -67,7 +73,7 @@ std::vector<SavepointEntry> SavepointTableService::truncate(SavepointTable& tabl
     std::vector<SavepointEntry> result;
 
     auto& entries = table._entries;
-    if (entries.size() < newSize) {
+    if (toInt(entries.size()) <= newSize) {
         return result;
     }
 
@@ -81,7 +87,11 @@ std::vector<SavepointEntry> SavepointTableService::truncate(SavepointTable& tabl
     }
 
     entries.erase(entries.begin() + newSize, entries.end());
-    updateFile(table);
+
+    boost::property_tree::ptree operation;
+    operation.put("operation", "truncate");
+    operation.put("size", newSize);
+    appendToJournal(table, operation);
     return result;
 }
 
@@ -89,13 +99,28 @@ void SavepointTableService::insertEntryAtFront(SavepointTable& table, SavepointE
 {
     table._entries.emplace_front(entry);
     ++table._sequenceNumber;
-    updateFile(table);
+
+    boost::property_tree::ptree operation;
+    operation.put("operation", "insert");
+    auto entryCopy = entry;
+    boost::property_tree::ptree entryTree;
+    encodeDecode(entryTree, entryCopy, ParserTask::Encode);
+    operation.add_child("entry", entryTree);
+    appendToJournal(table, operation);
 }
 
 void SavepointTableService::updateEntry(SavepointTable& table, int row, SavepointEntry const& newEntry) const
 {
     table._entries.at(row) = newEntry;
-    updateFile(table);
+
+    boost::property_tree::ptree operation;
+    operation.put("operation", "update");
+    operation.put("row", row);
+    auto entryCopy = newEntry;
+    boost::property_tree::ptree entryTree;
+    encodeDecode(entryTree, entryCopy, ParserTask::Encode);
+    operation.add_child("entry", entryTree);
+    appendToJournal(table, operation);
 }
 
 void SavepointTableService::deleteEntry(SavepointTable& table, SavepointEntry const& entry) const
@@ -105,8 +130,17 @@ void SavepointTableService::deleteEntry(SavepointTable& table, SavepointEntry co
         SerializerService::get().deleteSimulation(filename);
     }
 
-    table._entries.erase(std::remove(table._entries.begin(), table._entries.end(), entry), table._entries.end());
-    updateFile(table);
+    auto findResult = std::find(table._entries.begin(), table._entries.end(), entry);
+    if (findResult == table._entries.end()) {
+        return;
+    }
+    auto row = toInt(findResult - table._entries.begin());
+    table._entries.erase(findResult);
+
+    boost::property_tree::ptree operation;
+    operation.put("operation", "delete");
+    operation.put("row", row);
+    appendToJournal(table, operation);
 }
 
 std::filesystem::path SavepointTableService::calcAbsolutePath(SavepointTable const& table, SavepointEntry const& entry) const
@@ -124,16 +158,74 @@ std::filesystem::path SavepointTableService::calcEntryPath(SavepointTable const&
     return std::filesystem::relative(absolutePath, table.getFilename().parent_path());
 }
 
+std::filesystem::path SavepointTableService::getJournalFilename(SavepointTable const& table) const
+{
+    auto result = table.getFilename();
+    result += ".journal";
+    return result;
+}
+
+void SavepointTableService::compact(SavepointTable& table) const
+{
+    //a crash after writing the table file leaves a journal with an outdated generation which is ignored on loading
+    ++table._journalGeneration;
+    updateFile(table);
+
+    std::error_code errorCode;
+    std::filesystem::remove(getJournalFilename(table), errorCode);
+    table._numJournalOperations = 0;
+}
+
 void SavepointTableService::updateFile(SavepointTable& table) const
 {
     try {
-        std::ofstream stream(table.getFilename(), std::ios::binary);
+        //the table file is replaced at once such that it is never left partially written
+        auto tempFilename = table.getFilename();
+        tempFilename += ".tmp";
+        {
+            std::ofstream stream(tempFilename, std::ios::binary);
+            if (!stream) {
+                throw std::runtime_error("Could not access save point table file: " + tempFilename.string());
+            }
+            boost::property_tree::ptree tree;
+            encodeDecode(tree, table, ParserTask::Encode);
+            boost::property_tree::json_parser::write_json(stream, tree);
+            if (!stream) {
+                throw std::runtime_error("Could not write save point table file: " + tempFilename.string());
+            }
+        }
+        std::filesystem::rename(tempFilename, table.getFilename());
+    } catch (std::exception const& e) {
+        throw std::runtime_error(std::string("The following error occurred: ") + e.what());
+    } catch (...) {
+        throw std::runtime_error("Unknown error.");
+    }
+}
+
+void SavepointTableService::appendToJournal(SavepointTable& table, boost::property_tree::ptree const& operation) const
+{
+    if (table._numJournalOperations >= MaxNumJournalOperations) {
+        compact(table);
+        return;
+    }
+    try {
+        //one operation per line, a new journal starts with the generation of the table file
+        auto isNewJournal = table._numJournalOperations == 0;
+        std::ofstream stream(getJournalFilename(table), std::ios::binary | (isNewJournal ? std::ios::trunc : std::ios::app));
         if (!stream) {
-            throw std::runtime_error("Could not access save point table file: " + table.getFilename().string());
+            throw std::runtime_error("Could not access save point journal file: " + getJournalFilename(table).string());
         }
-        boost::property_tree::ptree tree;
-        encodeDecode(tree, table, ParserTask::Encode);
-        boost::property_tree::json_parser::write_json(stream, tree);
+        if (isNewJournal) {
+            boost::property_tree::ptree header;
+            header.put("journal generation", table._journalGeneration);
+            boost::property_tree::json_parser::write_json(stream, header, false);
+        }
+        boost::property_tree::json_parser::write_json(stream, operation, false);
+        stream.flush();
+        if (!stream) {
+            throw std::runtime_error("Could not write save point journal file: " + getJournalFilename(table).string());
+        }
+        ++table._numJournalOperations;
     } catch (std::exception const& e) {
         throw std::runtime_error(std::string("The following error occurred: ") + e.what());
     } catch (...) {
@@ -141,9 +233,72 @@ void SavepointTableService::updateFile(SavepointTable& table) const
     }
 }
 
+void SavepointTableService::replayJournal(SavepointTable& table) const
+{
+    std::ifstream stream(getJournalFilename(table), std::ios::binary);
+    if (!stream) {
+        return;
+    }
+    std::string line;
+    auto isHeader = true;
+    while (std::getline(stream, line)) {
+
+        //the last line is incomplete if it is not terminated
+        if (stream.eof()) {
+            return;
+        }
+        try {
+            std::istringstream lineStream(line);
+            boost::property_tree::ptree operation;
+            boost::property_tree::read_json(lineStream, operation);
+            if (isHeader) {
+                if (operation.get<int>("journal generation") != table._journalGeneration) {
+                    return;
+                }
+                isHeader = false;
+            } else {
+                applyJournalOperation(table, operation);
+                ++table._numJournalOperations;
+            }
+        } catch (...) {
+            return;
+        }
+    }
+}
+
+void SavepointTableService::applyJournalOperation(SavepointTable& table, boost::property_tree::ptree& operation) const
+{
+    auto& entries = table._entries;
+    auto type = operation.get<std::string>("operation");
+    if (type == "insert") {
+        auto entry = std::make_shared<_SavepointEntry>();
+        encodeDecode(operation.get_child("entry"), entry, ParserTask::Decode);
+        entries.emplace_front(entry);
+        ++table._sequenceNumber;
+    } else if (type == "update") {
+        auto entry = std::make_shared<_SavepointEntry>();
+        encodeDecode(operation.get_child("entry"), entry, ParserTask::Decode);
+        entries.at(operation.get<int>("row")) = entry;
+    } else if (type == "delete") {
+        auto row = operation.get<int>("row");
+        if (row < 0 || row >= toInt(entries.size())) {
+            throw std::runtime_error("Invalid row in save point journal.");
+        }
+        entries.erase(entries.begin() + row);
+    } else if (type == "truncate") {
+        auto size = operation.get<int>("size");
+        if (size >= 0 && size < toInt(entries.size())) {
+            entries.erase(entries.begin() + size, entries.end());
+        }
+    } else {
+        throw std::runtime_error("Unknown operation in save point journal: " + type);
+    }
+}
+
 void SavepointTableService::encodeDecode(boost::property_tree::ptree& tree, SavepointTable& table, ParserTask task) const
 {
     JsonParser::encodeDecode(tree, table._sequenceNumber, 0, "sequence number", task);
+    JsonParser::encodeDecode(tree, table._journalGeneration, 0, "journal generation", task);
     encodeDecode(tree, table._entries, task);
 }
 
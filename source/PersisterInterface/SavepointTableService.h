@@ -13,6 +13,9 @@
 #include "Definitions.h"
 #include "SavepointTable.h"
 
+//changes are appended as operations to a journal next to the table file (<filename>.journal) instead of rewriting the table file
+//the journal is replayed on loading and compacted into the table file when it becomes too long;
+//incompletely written operations at the end of the journal (e.g. after a crash) are ignored
 class SavepointTableService
 {
     MAKE_SINGLETON(SavepointTableService);
@@ -28,8 +31,16 @@ public:
     std::filesystem::path calcAbsolutePath(SavepointTable const& table, SavepointEntry const& entry) const;
     std::filesystem::path calcEntryPath(SavepointTable const& table, std::filesystem::path const& absolutePath) const;
 
+    std::filesystem::path getJournalFilename(SavepointTable const& table) const;
+    void compact(SavepointTable& table) const;  //writes the table file and starts a new journal
+
 private:
     void updateFile(SavepointTable& table) const;
+
+    void appendToJournal(SavepointTable& table, boost::property_tree::ptree const& operation) const;
+    void replayJournal(SavepointTable& table) const;
+    void applyJournalOperation(SavepointTable& table, boost::property_tree::ptree& operation) const;
+
     void encodeDecode(boost::property_tree::ptree& tree, SavepointTable& table, ParserTask task) const;
     void encodeDecode(boost::property_tree::ptree& tree, std::deque<SavepointEntry>& entries, ParserTask task) const;
     void encodeDecode(boost::property_tree::ptree& tree, SavepointEntry& entry, ParserTask task) const;
@@ -845,6 +845,12 @@ namespace cereal
     {
         ar(data.clusters, data.particles);
     }
+
+    template <class Archive>
+    void serialize(Archive& ar, DataDescription& data)
+    {
+        ar(data.cells, data.particles);
+    }
 }
 
 bool SerializerService::serializeSimulationToFiles(std::filesystem::path const& filename, DeserializedSimulation const& data)
@@ -1124,6 +1130,25 @@ bool SerializerService::serializeStatisticsToFile(std::filesystem::path const& f
     }
 }
 
+bool SerializerService::appendStatisticsToFile(std::filesystem::path const& filename, StatisticsHistoryData const& statistics)
+{
+    try {
+        auto isNewFile = !std::filesystem::exists(filename) || std::filesystem::file_size(filename) == 0;
+        std::ofstream stream(filename, std::ios::binary | std::ios::app);
+        if (!stream) {
+            return false;
+        }
+        if (isNewFile) {
+            serializeStatisticsHeader(stream);
+        }
+        serializeStatisticsContent(statistics, stream);
+        stream.close();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 bool SerializerService::serializeContentToFile(std::filesystem::path const& filename, ClusteredDataDescription const& content)
 {
     try {
@@ -1151,6 +1176,67 @@ bool SerializerService::deserializeContentFromFile(ClusteredDataDescription& con
     }
 }
 
+bool SerializerService::serializeDataToBinary(std::string& output, DataDescription const& input)
+{
+    try {
+        std::stringstream stream;
+        {
+            cereal::PortableBinaryOutputArchive archive(stream);
+            archive(input);
+        }
+        output = stream.str();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SerializerService::deserializeDataFromBinary(DataDescription& output, std::string const& input)
+{
+    try {
+        std::stringstream stream(input);
+        cereal::PortableBinaryInputArchive archive(stream);
+        archive(output);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SerializerService::compress(std::string& output, std::string const& input)
+{
+    try {
+        std::stringstream stdStream;
+        {
+            zstr::ostream stream(stdStream, std::ios::binary);
+            if (!stream) {
+                return false;
+            }
+            stream.write(input.data(), input.size());
+        }
+        output = stdStream.str();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SerializerService::decompress(std::string& output, std::string const& input, uint64_t uncompressedSize)
+{
+    try {
+        std::stringstream stdStream(input);
+        zstr::istream stream(stdStream, std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        output.resize(uncompressedSize);
+        stream.read(output.data(), uncompressedSize);
+        return static_cast<uint64_t>(stream.gcount()) == uncompressedSize;
+    } catch (...) {
+        return false;
+    }
+}
+
 void SerializerService::serializeDataDescription(ClusteredDataDescription const& data, std::ostream& stream)
 {
     cereal::PortableBinaryOutputArchive archive(stream);
@@ -1408,7 +1494,12 @@ namespace
 
 void SerializerService::serializeStatistics(StatisticsHistoryData const& statistics, std::ostream& stream)
 {
-    //header row
+    serializeStatisticsHeader(stream);
+    serializeStatisticsContent(statistics, stream);
+}
+
+void SerializerService::serializeStatisticsHeader(std::ostream& stream)
+{
     auto writeLabelAllColors = [&stream](auto const& name) {
         for (int i = 0; i < MAX_COLORS; ++i) {
             if (i != 0) {
@@ -1433,8 +1524,10 @@ void SerializerService::serializeStatistics(StatisticsHistoryData const& statist
         ++index;
     }
     stream << std::endl;
+}
 
-    //content
+void SerializerService::serializeStatisticsContent(StatisticsHistoryData const& statistics, std::ostream& stream)
+{
     for (auto dataPoints : statistics) {
         std::vector<std::string> entries;
         save(entries, dataPoints);
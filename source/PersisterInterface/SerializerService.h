@@ -35,10 +35,18 @@ public:
     bool deserializeSimulationParametersFromFile(SimulationParameters& parameters, std::filesystem::path const& filename);
 
     bool serializeStatisticsToFile(std::filesystem::path const& filename, StatisticsHistoryData const& statistics);
+    bool appendStatisticsToFile(std::filesystem::path const& filename, StatisticsHistoryData const& statistics);  //header is written for new files
 
     bool serializeContentToFile(std::filesystem::path const& filename, ClusteredDataDescription const& content);
     bool deserializeContentFromFile(ClusteredDataDescription& content, std::filesystem::path const& filename);
 
+    //uncompressed binary encoding for in-memory storage
+    bool serializeDataToBinary(std::string& output, DataDescription const& input);
+    bool deserializeDataFromBinary(DataDescription& output, std::string const& input);
+
+    bool compress(std::string& output, std::string const& input);
+    bool decompress(std::string& output, std::string const& input, uint64_t uncompressedSize);
+
 private:
     void serializeDataDescription(ClusteredDataDescription const& data, std::ostream& stream);
     bool deserializeDataDescription(ClusteredDataDescription& data, std::filesystem::path const& filename);
@@ -51,6 +59,8 @@ private:
     void deserializeSimulationParameters(SimulationParameters& parameters, std::istream& stream);
 
     void serializeStatistics(StatisticsHistoryData const& statistics, std::ostream& stream);
+    void serializeStatisticsHeader(std::ostream& stream);
+    void serializeStatisticsContent(StatisticsHistoryData const& statistics, std::ostream& stream);
     void deserializeStatistics(StatisticsHistoryData& statistics, std::istream& stream);
 
     bool wrapGenome(ClusteredDataDescription& output, std::vector<uint8_t> const& input);
@@ -0,0 +1,385 @@
+#include "SimulationParametersCodec.h"
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "Base/Definitions.h"
+
+namespace
+{
+    using ptree = boost::property_tree::ptree;
+
+    std::string toString(ParameterField const& field, void const* object, int elementIndex)
+    {
+        switch (field.type) {
+        case ParameterType::Bool:
+            return field.getValue<bool>(object)[elementIndex] ? std::string("true") : std::string("false");
+        case ParameterType::Int:
+            return std::to_string(field.getValue<int>(object)[elementIndex]);
+        case ParameterType::UInt32:
+            return std::to_string(field.getValue<uint32_t>(object)[elementIndex]);
+        case ParameterType::Float: {
+            std::ostringstream out;
+            out.precision(8);
+            out << std::fixed << field.getValue<float>(object)[elementIndex];
+            return out.str();
+        }
+        case ParameterType::Char64: {
+            auto value = field.getValue<char>(object);
+            return std::string(value, strnlen(value, sizeof(Char64)));
+        }
+        }
+        return {};
+    }
+
+    void fromNode(ParameterField const& field, ptree const& node, void* object, void const* defaultObject, int elementIndex)
+    {
+        switch (field.type) {
+        case ParameterType::Bool:
+            field.getValue<bool>(object)[elementIndex] = node.get_value<bool>(field.getValue<bool>(defaultObject)[elementIndex]);
+            break;
+        case ParameterType::Int:
+            field.getValue<int>(object)[elementIndex] = node.get_value<int>(field.getValue<int>(defaultObject)[elementIndex]);
+            break;
+        case ParameterType::UInt32:
+            field.getValue<uint32_t>(object)[elementIndex] = node.get_value<uint32_t>(field.getValue<uint32_t>(defaultObject)[elementIndex]);
+            break;
+        case ParameterType::Float:
+            field.getValue<float>(object)[elementIndex] = node.get_value<float>(field.getValue<float>(defaultObject)[elementIndex]);
+            break;
+        case ParameterType::Char64: {
+            auto value = node.get_value<std::string>(std::string(field.getValue<char>(defaultObject)));
+            auto copyLength = std::min(toInt(sizeof(Char64)) - 1, toInt(value.size()));
+            value.copy(field.getValue<char>(object), copyLength);
+            field.getValue<char>(object)[copyLength] = '\0';
+        } break;
+        }
+    }
+
+    void setDefault(ParameterField const& field, void* object, void const* defaultObject, int elementIndex)
+    {
+        auto elementSize = field.getElementSize();
+        std::memcpy(
+            field.getValue<char>(object) + elementIndex * elementSize, field.getValue<char>(defaultObject) + elementIndex * elementSize, elementSize);
+    }
+
+    ptree& getOrCreateChild(ptree& tree, std::string const& path)
+    {
+        if (auto child = tree.get_child_optional(path)) {
+            return *child;
+        }
+        return tree.put_child(path, ptree());
+    }
+
+    void setProperty(ptree& parent, std::string const& property, std::string const& value)
+    {
+        auto findResult = parent.find(property);
+        if (findResult != parent.not_found()) {
+            findResult->second.data() = value;
+        } else {
+            parent.push_back({property, ptree(value)});
+        }
+    }
+
+    ptree const* findProperty(boost::optional<ptree const&> const& parent, std::string const& property)
+    {
+        if (!parent) {
+            return nullptr;
+        }
+        auto findResult = parent->find(property);
+        return findResult != parent->not_found() ? &findResult->second : nullptr;
+    }
+
+    void writeBytes(std::vector<uint8_t>& data, void const* source, size_t size)
+    {
+        auto bytes = static_cast<uint8_t const*>(source);
+        data.insert(data.end(), bytes, bytes + size);
+    }
+
+    void readBytes(std::vector<uint8_t> const& data, size_t& pos, void* target, size_t size)
+    {
+        if (pos + size > data.size()) {
+            throw std::runtime_error("Binary simulation parameters are truncated.");
+        }
+        std::memcpy(target, data.data() + pos, size);
+        pos += size;
+    }
+}
+
+void SimulationParametersCodec::encodeJson(boost::property_tree::ptree& tree, SimulationParameters const& parameters) const
+{
+    encodeJsonFields(tree, ParameterScope::Global, _globalPaths, &parameters);
+}
+
+std::vector<bool> SimulationParametersCodec::decodeJson(boost::property_tree::ptree const& tree, SimulationParameters& parameters) const
+{
+    std::vector<bool> result(SimulationParametersSchema::get().getFields(ParameterScope::Global).size(), false);
+    decodeJsonFields(tree, ParameterScope::Global, _globalPaths, &parameters, &_defaultParameters, &result);
+    return result;
+}
+
+std::vector<uint8_t> SimulationParametersCodec::encodeBinary(SimulationParameters const& parameters) const
+{
+    std::vector<uint8_t> result;
+    result.reserve(sizeof(SimulationParameters) / 4);
+
+    auto magicNumber = BinaryMagicNumber;
+    auto schemaHash = SimulationParametersSchema::get().getSchemaHash();
+    writeBytes(result, &magicNumber, sizeof(magicNumber));
+    writeBytes(result, &schemaHash, sizeof(schemaHash));
+    encodeBinaryFields(result, ParameterScope::Global, &parameters);
+    return result;
+}
+
+SimulationParameters SimulationParametersCodec::decodeBinary(std::vector<uint8_t> const& data) const
+{
+    size_t pos = 0;
+    uint32_t magicNumber;
+    uint64_t schemaHash;
+    readBytes(data, pos, &magicNumber, sizeof(magicNumber));
+    readBytes(data, pos, &schemaHash, sizeof(schemaHash));
+    if (magicNumber != BinaryMagicNumber) {
+        throw std::runtime_error("Data does not contain binary simulation parameters.");
+    }
+    if (schemaHash != SimulationParametersSchema::get().getSchemaHash()) {
+        throw std::runtime_error("Binary simulation parameters have been encoded with a different parameter schema.");
+    }
+
+    SimulationParameters result;
+    decodeBinaryFields(data, pos, ParameterScope::Global, &result);
+    if (pos != data.size()) {
+        throw std::runtime_error("Binary simulation parameters contain unexpected data.");
+    }
+    return result;
+}
+
+uint64_t SimulationParametersCodec::calcHash(SimulationParameters const& parameters) const
+{
+    //FNV-1a
+    uint64_t result = 0xcbf29ce484222325ull;
+    for (auto const& byte : encodeBinary(parameters)) {
+        result ^= byte;
+        result *= 0x100000001b3ull;
+    }
+    return result;
+}
+
+SimulationParametersCodec::SimulationParametersCodec()
+{
+    std::string const prefix = "simulation parameters.";
+    _globalPaths = createFieldPaths(ParameterScope::Global, prefix);
+    for (auto const& field : SimulationParametersSchema::get().getFields(ParameterScope::Global)) {
+        if (!field.array) {
+            continue;
+        }
+        std::vector<FieldPaths> elementPaths;
+        for (int index = 0; index < field.array->maxCount; ++index) {
+            elementPaths.emplace_back(createFieldPaths(field.array->elementScope, prefix + field.name + "." + std::to_string(index) + "."));
+        }
+        _arrayElementPaths.emplace(field.array->elementScope, std::move(elementPaths));
+    }
+}
+
+auto SimulationParametersCodec::createFieldPaths(ParameterScope scope, std::string const& prefix) const -> FieldPaths
+{
+    FieldPaths result;
+    for (auto const& field : SimulationParametersSchema::get().getFields(scope)) {
+        NodePaths paths;
+        if (field.array) {
+            result.emplace_back(paths);
+            continue;
+        }
+        auto node = prefix + field.name;
+        auto lastDotIndex = node.find_last_of('.');
+        paths.valueParent = node.substr(0, lastDotIndex);
+        auto property = node.substr(lastDotIndex + 1);
+
+        if (field.activatedOffset) {
+            paths.activatedParent = node;
+            paths.activatedProperty = "activated";
+
+            //except for color vectors the values of activatable fields are stored in a child node
+            if (field.shape != ParameterShape::ColorVector) {
+                paths.valueParent = node;
+                property = "value";
+            }
+        }
+
+        switch (field.shape) {
+        case ParameterShape::Scalar:
+            paths.valueProperties.emplace_back(property);
+            break;
+        case ParameterShape::ColorVector:
+            for (int i = 0; i < MAX_COLORS; ++i) {
+                paths.valueProperties.emplace_back(property + "[" + std::to_string(i) + "]");
+            }
+            break;
+        case ParameterShape::ColorMatrix:
+            for (int i = 0; i < MAX_COLORS; ++i) {
+                for (int j = 0; j < MAX_COLORS; ++j) {
+                    paths.valueProperties.emplace_back(property + "[" + std::to_string(i) + ", " + std::to_string(j) + "]");
+                }
+            }
+            break;
+        }
+        result.emplace_back(paths);
+    }
+    return result;
+}
+
+void SimulationParametersCodec::encodeJsonFields(boost::property_tree::ptree& tree, ParameterScope scope, FieldPaths const& paths, void const* object) const
+{
+    auto const& fields = SimulationParametersSchema::get().getFields(scope);
+    for (int fieldIndex = 0; fieldIndex < toInt(fields.size()); ++fieldIndex) {
+        auto const& field = fields[fieldIndex];
+        if (!field.persistent || !field.exists(object)) {
+            continue;
+        }
+        if (field.array) {
+            auto const& elementPaths = _arrayElementPaths.at(field.array->elementScope);
+            for (int index = 0, count = field.getArrayCount(object); index < count; ++index) {
+                auto element = static_cast<char const*>(object) + field.offset + index * field.array->elementSize;
+                encodeJsonFields(tree, field.array->elementScope, elementPaths.at(index), element);
+            }
+            continue;
+        }
+
+        auto const& nodePaths = paths.at(fieldIndex);
+        if (field.activatedOffset) {
+            auto& activatedParent = getOrCreateChild(tree, nodePaths.activatedParent);
+            setProperty(activatedParent, nodePaths.activatedProperty, *field.getActivated(object) ? std::string("true") : std::string("false"));
+        }
+        auto& valueParent = getOrCreateChild(tree, nodePaths.valueParent);
+        for (int elementIndex = 0; elementIndex < toInt(nodePaths.valueProperties.size()); ++elementIndex) {
+            setProperty(valueParent, nodePaths.valueProperties[elementIndex], toString(field, object, elementIndex));
+        }
+    }
+}
+
+void SimulationParametersCodec::decodeJsonFields(
+    boost::property_tree::ptree const& tree,
+    ParameterScope scope,
+    FieldPaths const& paths,
+    void* object,
+    void const* defaultObject,
+    std::vector<bool>* missingFields) const
+{
+    auto const& fields = SimulationParametersSchema::get().getFields(scope);
+    for (int fieldIndex = 0; fieldIndex < toInt(fields.size()); ++fieldIndex) {
+        auto const& field = fields[fieldIndex];
+        if (!field.persistent || !field.exists(object)) {
+            continue;
+        }
+        if (field.array) {
+            auto const& elementPaths = _arrayElementPaths.at(field.array->elementScope);
+            for (int index = 0, count = field.getArrayCount(object); index < count; ++index) {
+                auto elementOffset = field.offset + index * field.array->elementSize;
+                decodeJsonFields(
+                    tree,
+                    field.array->elementScope,
+                    elementPaths.at(index),
+                    static_cast<char*>(object) + elementOffset,
+                    static_cast<char const*>(defaultObject) + elementOffset,
+                    nullptr);
+            }
+            continue;
+        }
+
+        auto const& nodePaths = paths.at(fieldIndex);
+        auto missing = false;
+        if (field.activatedOffset) {
+            auto& activated = *field.getActivated(object);
+            activated = *field.getActivated(defaultObject);
+            if (auto node = findProperty(tree.get_child_optional(nodePaths.activatedParent), nodePaths.activatedProperty)) {
+                activated = node->get_value<bool>(activated);
+            } else {
+                missing = true;
+            }
+        }
+        auto valueParent = tree.get_child_optional(nodePaths.valueParent);
+        for (int elementIndex = 0; elementIndex < toInt(nodePaths.valueProperties.size()); ++elementIndex) {
+            if (auto node = findProperty(valueParent, nodePaths.valueProperties[elementIndex])) {
+                fromNode(field, *node, object, defaultObject, elementIndex);
+            } else {
+                setDefault(field, object, defaultObject, elementIndex);
+                missing = true;
+            }
+        }
+        if (missingFields) {
+            (*missingFields)[fieldIndex] = missing;
+        }
+    }
+}
+
+void SimulationParametersCodec::encodeBinaryFields(std::vector<uint8_t>& data, ParameterScope scope, void const* object) const
+{
+    for (auto const& field : SimulationParametersSchema::get().getFields(scope)) {
+        if (!field.exists(object)) {
+            continue;
+        }
+        if (field.array) {
+            for (int index = 0, count = field.getArrayCount(object); index < count; ++index) {
+                encodeBinaryFields(data, field.array->elementScope, static_cast<char const*>(object) + field.offset + index * field.array->elementSize);
+            }
+            continue;
+        }
+
+        if (field.activatedOffset) {
+            data.emplace_back(*field.getActivated(object) ? 1 : 0);
+        }
+        if (field.type == ParameterType::Char64) {
+            auto value = field.getValue<char>(object);
+            auto length = static_cast<uint8_t>(strnlen(value, sizeof(Char64) - 1));
+            data.emplace_back(length);
+            writeBytes(data, value, length);
+        } else if (field.type == ParameterType::Bool) {
+            for (int elementIndex = 0; elementIndex < field.getNumElements(); ++elementIndex) {
+                data.emplace_back(field.getValue<bool>(object)[elementIndex] ? 1 : 0);
+            }
+        } else {
+            writeBytes(data, field.getValue<char>(object), field.getNumElements() * field.getElementSize());
+        }
+    }
+}
+
+void SimulationParametersCodec::decodeBinaryFields(std::vector<uint8_t> const& data, size_t& pos, ParameterScope scope, void* object) const
+{
+    for (auto const& field : SimulationParametersSchema::get().getFields(scope)) {
+        if (!field.exists(object)) {
+            continue;
+        }
+        if (field.array) {
+            auto count = *reinterpret_cast<int const*>(static_cast<char const*>(object) + field.array->countOffset);
+            if (count < 0 || count > field.array->maxCount) {
+                throw std::runtime_error("Binary simulation parameters contain an invalid number of " + field.name + ".");
+            }
+            for (int index = 0; index < count; ++index) {
+                decodeBinaryFields(data, pos, field.array->elementScope, static_cast<char*>(object) + field.offset + index * field.array->elementSize);
+            }
+            continue;
+        }
+
+        uint8_t byte;
+        if (field.activatedOffset) {
+            readBytes(data, pos, &byte, 1);
+            *field.getActivated(object) = byte != 0;
+        }
+        if (field.type == ParameterType::Char64) {
+            readBytes(data, pos, &byte, 1);
+            if (byte >= sizeof(Char64)) {
+                throw std::runtime_error("Binary simulation parameters contain an invalid string.");
+            }
+            auto value = field.getValue<char>(object);
+            readBytes(data, pos, value, byte);
+            value[byte] = '\0';
+        } else if (field.type == ParameterType::Bool) {
+            for (int elementIndex = 0; elementIndex < field.getNumElements(); ++elementIndex) {
+                readBytes(data, pos, &byte, 1);
+                field.getValue<bool>(object)[elementIndex] = byte != 0;
+            }
+        } else {
+            readBytes(data, pos, field.getValue<char>(object), field.getNumElements() * field.getElementSize());
+        }
+    }
+}
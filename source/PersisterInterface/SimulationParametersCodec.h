@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "Base/Singleton.h"
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/SimulationParametersSchema.h"
+
+//encodes the simulation parameters generically along SimulationParametersSchema, either as nodes of the settings file or in a compact binary form
+//the node paths are assembled once at construction
+class SimulationParametersCodec
+{
+    MAKE_SINGLETON_NO_DEFAULT_CONSTRUCTION(SimulationParametersCodec);
+
+public:
+    void encodeJson(boost::property_tree::ptree& tree, SimulationParameters const& parameters) const;
+
+    //fields which are not present in the tree get their default values
+    //returns for each global field of the schema whether it has been missing
+    std::vector<bool> decodeJson(boost::property_tree::ptree const& tree, SimulationParameters& parameters) const;
+
+    //the binary form can only be decoded with the same schema
+    std::vector<uint8_t> encodeBinary(SimulationParameters const& parameters) const;
+    SimulationParameters decodeBinary(std::vector<uint8_t> const& data) const;  //throws std::runtime_error
+
+    uint64_t calcHash(SimulationParameters const& parameters) const;
+
+private:
+    SimulationParametersCodec();
+
+    struct NodePaths
+    {
+        std::string valueParent;
+        std::vector<std::string> valueProperties;  //one for each element
+        std::string activatedParent;
+        std::string activatedProperty;
+    };
+    using FieldPaths = std::vector<NodePaths>;  //indexed by the field index of a scope
+
+    FieldPaths createFieldPaths(ParameterScope scope, std::string const& prefix) const;
+
+    void encodeJsonFields(boost::property_tree::ptree& tree, ParameterScope scope, FieldPaths const& paths, void const* object) const;
+    void decodeJsonFields(
+        boost::property_tree::ptree const& tree,
+        ParameterScope scope,
+        FieldPaths const& paths,
+        void* object,
+        void const* defaultObject,
+        std::vector<bool>* missingFields) const;
+
+    void encodeBinaryFields(std::vector<uint8_t>& data, ParameterScope scope, void const* object) const;
+    void decodeBinaryFields(std::vector<uint8_t> const& data, size_t& pos, ParameterScope scope, void* object) const;
+
+    static auto constexpr BinaryMagicNumber = 0x42505341u;  //"ASPB"
+
+    SimulationParameters _defaultParameters;
+    FieldPaths _globalPaths;
+    std::map<ParameterScope, std::vector<FieldPaths>> _arrayElementPaths;  //indexed by element index
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <chrono>
+
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationParameters.h"
+
+struct SimulationSnapshot
+{
+    uint64_t timestep = 0;
+    std::chrono::milliseconds realTime;
+    SimulationParameters parameters;
+    DataDescription data;
+};
@@ -0,0 +1,275 @@
+#include "SnapshotRing.h"
+
+#include <algorithm>
+
+#include "Base/LoggingService.h"
+
+#include "SerializerService.h"
+
+namespace
+{
+    void applyXorDelta(std::string& target, std::string const& base)
+    {
+        auto size = std::min(target.size(), base.size());
+        for (size_t i = 0; i < size; ++i) {
+            target[i] ^= base[i];
+        }
+    }
+}
+
+SnapshotRing::SnapshotRing(SnapshotRingParameters const& parameters)
+    : _parameters(parameters)
+{
+    _encoderThread = std::thread(&SnapshotRing::runEncoderLoop, this);
+}
+
+SnapshotRing::~SnapshotRing()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _isShutdown = true;
+    }
+    _encodingCondition.notify_all();
+    _encoderThread.join();
+}
+
+void SnapshotRing::push(SimulationSnapshot snapshot)
+{
+    {
+        std::lock_guard lock(_mutex);
+        Entry entry;
+        entry.id = _nextId++;
+        entry.timestep = snapshot.timestep;
+        entry.realTime = snapshot.realTime;
+        entry.parameters = snapshot.parameters;
+        entry.pendingData = std::make_shared<DataDescription const>(std::move(snapshot.data));
+        _entries.emplace_back(std::move(entry));
+    }
+    _encodingCondition.notify_one();
+}
+
+std::optional<SimulationSnapshot> SnapshotRing::pop()
+{
+    std::unique_lock lock(_mutex);
+    if (_entries.empty()) {
+        return std::nullopt;
+    }
+    auto chain = getDecodingChain(toInt(_entries.size()) - 1);
+    auto entry = std::move(_entries.back());
+    _entries.pop_back();
+    if (entry.encodedData) {
+        _memoryUsage -= entry.encodedData->size();
+    }
+    lock.unlock();
+
+    return decode(entry, chain);
+}
+
+std::optional<SimulationSnapshot> SnapshotRing::getNewest() const
+{
+    std::unique_lock lock(_mutex);
+    if (_entries.empty()) {
+        return std::nullopt;
+    }
+    auto chain = getDecodingChain(toInt(_entries.size()) - 1);
+    auto entry = _entries.back();
+    lock.unlock();
+
+    return decode(entry, chain);
+}
+
+void SnapshotRing::clear()
+{
+    std::lock_guard lock(_mutex);
+    _entries.clear();
+    _memoryUsage = 0;
+    _deltaBase.reset();
+}
+
+bool SnapshotRing::isEmpty() const
+{
+    std::lock_guard lock(_mutex);
+    return _entries.empty();
+}
+
+int SnapshotRing::getNumSnapshots() const
+{
+    std::lock_guard lock(_mutex);
+    return toInt(_entries.size());
+}
+
+uint64_t SnapshotRing::getMemoryUsage() const
+{
+    std::lock_guard lock(_mutex);
+    return _memoryUsage;
+}
+
+void SnapshotRing::waitForEncoding() const
+{
+    std::unique_lock lock(_mutex);
+    _encodedCondition.wait(lock, [this] { return !_isEncoding && !hasPendingEntries(); });
+}
+
+bool SnapshotRing::testOnly_isDeltaEncoded(int index) const
+{
+    std::lock_guard lock(_mutex);
+    return _entries.at(index).isDelta;
+}
+
+bool SnapshotRing::testOnly_hasDeltaBase() const
+{
+    std::lock_guard lock(_mutex);
+    return _deltaBase.has_value();
+}
+
+void SnapshotRing::runEncoderLoop()
+{
+    std::unique_lock lock(_mutex);
+    while (true) {
+        _encodingCondition.wait(lock, [this] { return _isShutdown || hasPendingEntries(); });
+        if (_isShutdown) {
+            return;
+        }
+
+        auto entryIter = findFirstPendingEntry();
+        auto id = entryIter->id;
+        auto data = entryIter->pendingData;
+
+        std::shared_ptr<std::string const> deltaBaseBinary;
+        auto keyframeDistance = 0;
+        if (_parameters._deltaEncoding && entryIter != _entries.begin() && _deltaBase) {
+            auto const& predecessor = *std::prev(entryIter);
+            if (predecessor.id == _deltaBase->id && predecessor.keyframeDistance + 1 < _parameters._keyframeInterval) {
+                deltaBaseBinary = _deltaBase->binary;
+                keyframeDistance = predecessor.keyframeDistance + 1;
+            }
+        }
+        _isEncoding = true;
+        lock.unlock();
+
+        //encode without holding the lock
+        auto binary = std::make_shared<std::string>();
+        std::string encodedData;
+        auto success = SerializerService::get().serializeDataToBinary(*binary, *data);
+        if (success) {
+            if (deltaBaseBinary) {
+                auto delta = *binary;
+                applyXorDelta(delta, *deltaBaseBinary);
+                success = SerializerService::get().compress(encodedData, delta);
+            } else {
+                success = SerializerService::get().compress(encodedData, *binary);
+            }
+        }
+
+        lock.lock();
+        _isEncoding = false;
+        entryIter = findEntry(id);
+        if (success) {
+            //an entry removed during encoding (pop, clear) must not become the base, the previous base stays valid for its successor
+            if (entryIter != _entries.end()) {
+                _deltaBase = DeltaBase{id, binary};
+            }
+        } else {
+            log(Priority::Important, "snapshot could not be encoded");
+            _deltaBase.reset();
+        }
+        if (entryIter != _entries.end()) {
+            if (success) {
+                entryIter->pendingData.reset();
+                entryIter->encodedData = std::make_shared<std::string const>(std::move(encodedData));
+                entryIter->binarySize = binary->size();
+                entryIter->isDelta = deltaBaseBinary != nullptr;
+                entryIter->keyframeDistance = keyframeDistance;
+                _memoryUsage += entryIter->encodedData->size();
+                dropOldestEntriesIfNecessary();
+            } else {
+                entryIter->encodingFailed = true;
+            }
+        }
+        _encodedCondition.notify_all();
+    }
+}
+
+bool SnapshotRing::hasPendingEntries() const
+{
+    return std::any_of(_entries.begin(), _entries.end(), [](Entry const& entry) { return entry.pendingData && !entry.encodingFailed; });
+}
+
+auto SnapshotRing::findFirstPendingEntry() -> std::deque<Entry>::iterator
+{
+    return std::find_if(_entries.begin(), _entries.end(), [](Entry const& entry) { return entry.pendingData && !entry.encodingFailed; });
+}
+
+auto SnapshotRing::findEntry(uint64_t id) -> std::deque<Entry>::iterator
+{
+    return std::find_if(_entries.begin(), _entries.end(), [&id](Entry const& entry) { return entry.id == id; });
+}
+
+void SnapshotRing::removeOldestEntry()
+{
+    auto const& entry = _entries.front();
+    if (entry.encodedData) {
+        _memoryUsage -= entry.encodedData->size();
+    }
+    if (_deltaBase && _deltaBase->id == entry.id) {
+        _deltaBase.reset();
+    }
+    _entries.pop_front();
+}
+
+void SnapshotRing::dropOldestEntriesIfNecessary()
+{
+    while (_memoryUsage > _parameters._memoryBudget && _entries.size() > 1 && _entries.front().encodedData) {
+        removeOldestEntry();
+
+        //deltas cannot be decoded without their predecessors
+        while (!_entries.empty() && _entries.front().encodedData && _entries.front().isDelta) {
+            removeOldestEntry();
+        }
+    }
+}
+
+auto SnapshotRing::getDecodingChain(int index) const -> std::vector<EncodedPart>
+{
+    std::vector<EncodedPart> result;
+    if (!_entries.at(index).encodedData) {
+        return result;
+    }
+    auto keyframeIndex = index;
+    while (_entries.at(keyframeIndex).isDelta) {
+        --keyframeIndex;
+    }
+    for (int i = keyframeIndex; i <= index; ++i) {
+        auto const& entry = _entries.at(i);
+        result.emplace_back(EncodedPart{entry.encodedData, entry.binarySize});
+    }
+    return result;
+}
+
+SimulationSnapshot SnapshotRing::decode(Entry const& entry, std::vector<EncodedPart> const& chain) const
+{
+    SimulationSnapshot result;
+    result.timestep = entry.timestep;
+    result.realTime = entry.realTime;
+    result.parameters = entry.parameters;
+    if (entry.pendingData) {
+        result.data = *entry.pendingData;
+        return result;
+    }
+
+    std::string binary;
+    for (size_t i = 0; i < chain.size(); ++i) {
+        std::string decompressed;
+        if (!SerializerService::get().decompress(decompressed, *chain[i].encodedData, chain[i].binarySize)) {
+            throw std::runtime_error("Snapshot could not be decoded.");
+        }
+        if (i > 0) {
+            applyXorDelta(decompressed, binary);
+        }
+        binary = std::move(decompressed);
+    }
+    if (!SerializerService::get().deserializeDataFromBinary(result.data, binary)) {
+        throw std::runtime_error("Snapshot could not be decoded.");
+    }
+    return result;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "Base/Definitions.h"
+
+#include "SimulationSnapshot.h"
+
+struct SnapshotRingParameters
+{
+    MEMBER_DECLARATION(SnapshotRingParameters, uint64_t, memoryBudget, 1024ull * 1024 * 1024);
+    MEMBER_DECLARATION(SnapshotRingParameters, bool, deltaEncoding, true);
+    MEMBER_DECLARATION(SnapshotRingParameters, int, keyframeInterval, 10);
+};
+
+//Stores simulation snapshots as compressed binary encodings and drops the oldest ones when the memory budget is exceeded.
+//Encoding is done on a background thread; only the requested snapshot is decoded.
+//With delta encoding, a snapshot is encoded as byte-wise difference to its predecessor, except for every keyframeInterval-th one.
+class SnapshotRing
+{
+public:
+    SnapshotRing(SnapshotRingParameters const& parameters = SnapshotRingParameters());
+    ~SnapshotRing();
+
+    void push(SimulationSnapshot snapshot);
+    std::optional<SimulationSnapshot> pop();  //removes and returns the newest snapshot
+    std::optional<SimulationSnapshot> getNewest() const;
+    void clear();
+
+    bool isEmpty() const;
+    int getNumSnapshots() const;
+    uint64_t getMemoryUsage() const;  //size of the encoded snapshots in bytes
+
+    void waitForEncoding() const;
+
+    bool testOnly_isDeltaEncoded(int index) const;  //index 0 refers to the oldest snapshot
+    bool testOnly_hasDeltaBase() const;
+
+private:
+    struct Entry
+    {
+        uint64_t id = 0;
+        uint64_t timestep = 0;
+        std::chrono::milliseconds realTime;
+        SimulationParameters parameters;
+
+        std::shared_ptr<DataDescription const> pendingData;  //present until encoded
+        bool encodingFailed = false;
+        std::shared_ptr<std::string const> encodedData;
+        uint64_t binarySize = 0;
+        bool isDelta = false;
+        int keyframeDistance = 0;
+    };
+    struct EncodedPart
+    {
+        std::shared_ptr<std::string const> encodedData;
+        uint64_t binarySize = 0;
+    };
+
+    void runEncoderLoop();
+    bool hasPendingEntries() const;
+    std::deque<Entry>::iterator findFirstPendingEntry();
+    std::deque<Entry>::iterator findEntry(uint64_t id);
+    void removeOldestEntry();
+    void dropOldestEntriesIfNecessary();
+
+    std::vector<EncodedPart> getDecodingChain(int index) const;
+    SimulationSnapshot decode(Entry const& entry, std::vector<EncodedPart> const& chain) const;
+
+    SnapshotRingParameters _parameters;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _encodingCondition;
+    mutable std::condition_variable _encodedCondition;
+    std::deque<Entry> _entries;
+    uint64_t _nextId = 1;
+    uint64_t _memoryUsage = 0;
+    bool _isEncoding = false;
+    bool _isShutdown = false;
+
+    //binary encoding of the last encoded snapshot serves as base for the next delta
+    struct DeltaBase
+    {
+        uint64_t id = 0;
+        std::shared_ptr<std::string const> binary;
+    };
+    std::optional<DeltaBase> _deltaBase;
+
+    std::thread _encoderThread;
+};
@@ -0,0 +1,125 @@
+#include "SweepSpecification.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "AuxiliaryDataParserService.h"
+
+namespace
+{
+    std::string toString(double value)
+    {
+        std::ostringstream out;
+        out << std::setprecision(8) << value;
+        return out.str();
+    }
+
+    bool isNumber(std::string const& value)
+    {
+        std::istringstream in(value);
+        double number;
+        in >> number;
+        return !in.fail() && in.eof();
+    }
+
+    bool isBool(std::string const& value) { return value == "true" || value == "false"; }
+}
+
+SweepSpecification SweepSpecificationParser::parse(std::filesystem::path const& filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Could not open sweep specification " + filename.string() + ".");
+    }
+    boost::property_tree::ptree tree;
+    boost::property_tree::read_json(stream, tree);
+
+    SweepSpecification result;
+    result.input = tree.get<std::string>("input");
+    result.outputDirectory = tree.get<std::string>("output directory");
+    result.timesteps = tree.get<uint64_t>("time steps");
+    result.snapshotInterval = tree.get<uint64_t>("snapshot interval", result.snapshotInterval);
+    result.statisticsInterval = tree.get<uint64_t>("statistics interval", result.statisticsInterval);
+    result.repetitions = tree.get<int>("repetitions", result.repetitions);
+    if (result.repetitions < 1 || result.statisticsInterval == 0) {
+        throw std::runtime_error("Invalid sweep specification: repetitions and statistics interval must be positive.");
+    }
+
+    if (auto parametersTree = tree.get_child_optional("parameters")) {
+        for (auto const& [key, parameterTree] : *parametersTree) {
+            SweepParameterRange range;
+            range.node = parameterTree.get<std::string>("node");
+            if (auto valuesTree = parameterTree.get_child_optional("values")) {
+                for (auto const& [valueKey, valueTree] : *valuesTree) {
+                    range.values.emplace_back(valueTree.get_value<std::string>());
+                }
+            } else {
+                auto from = parameterTree.get<double>("from");
+                auto to = parameterTree.get<double>("to");
+                auto steps = parameterTree.get<int>("steps");
+                if (steps < 1) {
+                    throw std::runtime_error("Invalid sweep specification: steps for " + range.node + " must be positive.");
+                }
+                for (int i = 0; i < steps; ++i) {
+                    range.values.emplace_back(toString(steps > 1 ? from + (to - from) * i / (steps - 1) : from));
+                }
+            }
+            if (range.values.empty()) {
+                throw std::runtime_error("Invalid sweep specification: no values given for " + range.node + ".");
+            }
+            result.parameterRanges.emplace_back(range);
+        }
+    }
+    return result;
+}
+
+std::vector<SweepJob> SweepSpecificationParser::createJobs(SweepSpecification const& specification)
+{
+    size_t numCombinations = 1;
+    for (auto const& range : specification.parameterRanges) {
+        numCombinations *= range.values.size();
+    }
+
+    std::vector<SweepJob> result;
+    result.reserve(numCombinations * specification.repetitions);
+    for (size_t combination = 0; combination < numCombinations; ++combination) {
+        std::vector<std::pair<std::string, std::string>> parameterValues;
+        auto remainder = combination;
+        for (auto const& range : specification.parameterRanges) {
+            parameterValues.emplace_back(range.node, range.values.at(remainder % range.values.size()));
+            remainder /= range.values.size();
+        }
+        for (int repetition = 0; repetition < specification.repetitions; ++repetition) {
+            std::ostringstream name;
+            name << "run_" << std::setw(4) << std::setfill('0') << result.size();
+            result.emplace_back(SweepJob{name.str(), repetition, parameterValues});
+        }
+    }
+    return result;
+}
+
+SimulationParameters SweepSpecificationParser::applyParameterValues(SimulationParameters const& parameters, SweepJob const& job)
+{
+    using boost::property_tree::ptree;
+
+    //the parameters are modified in their serialized form such that every field known to the settings file can be swept
+    auto tree = AuxiliaryDataParserService::get().encodeSimulationParameters(parameters);
+    for (auto const& [node, value] : job.parameterValues) {
+        auto path = ptree::path_type(node, '.');
+        if (!tree.get_child_optional(path)) {
+            throw std::runtime_error("Unknown simulation parameter " + node + ".");
+        }
+
+        //the decoder falls back to default values for malformed entries, hence the type is checked here
+        auto origValue = tree.get<std::string>(path);
+        if ((isNumber(origValue) && !isNumber(value)) || (isBool(origValue) && !isBool(value))) {
+            throw std::runtime_error("Invalid value " + value + " for simulation parameter " + node + ".");
+        }
+        tree.put(path, value);
+    }
+    return AuxiliaryDataParserService::get().decodeSimulationParameters(tree);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "EngineInterface/SimulationParameters.h"
+
+//a parameter is addressed by its node in the *.settings.json file, e.g. "simulation parameters.friction" or
+//"simulation parameters.cell.min energy[0]"
+struct SweepParameterRange
+{
+    std::string node;
+    std::vector<std::string> values;
+};
+
+struct SweepSpecification
+{
+    std::filesystem::path input;
+    std::filesystem::path outputDirectory;
+    uint64_t timesteps = 0;
+    uint64_t snapshotInterval = 0;  //0 = only the final state is saved
+    uint64_t statisticsInterval = 1000;
+    int repetitions = 1;
+    std::vector<SweepParameterRange> parameterRanges;
+};
+
+struct SweepJob
+{
+    std::string name;
+    int repetition = 0;
+    std::vector<std::pair<std::string, std::string>> parameterValues;  //node and value
+};
+
+class SweepSpecificationParser
+{
+public:
+    //example:
+    //{
+    //  "input": "base.sim", "output directory": "sweep", "time steps": 100000, "snapshot interval": 10000, "statistics interval": 1000,
+    //  "repetitions": 2,
+    //  "parameters": [
+    //    {"node": "simulation parameters.friction", "from": 0.0005, "to": 0.002, "steps": 4},
+    //    {"node": "simulation parameters.cell.min energy[0]", "values": [40, 50]}
+    //  ]
+    //}
+    static SweepSpecification parse(std::filesystem::path const& filename);
+
+    //cartesian product of all parameter ranges and repetitions
+    static std::vector<SweepJob> createJobs(SweepSpecification const& specification);
+
+    static SimulationParameters applyParameterValues(SimulationParameters const& parameters, SweepJob const& job);
+};